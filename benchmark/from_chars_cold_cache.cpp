@@ -0,0 +1,111 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Cost of parsing doubles with random exponents when the power-of-five table of the fast_float engine
+// is not in cache, e.g. on a core whose L1 and L2 are shared with other hot data.
+// Between two calls the benchmark walks an eviction buffer, and only the call itself is timed.
+//
+// Build it once as is, and once with -DBOOST_CHARCONV_FASTFLOAT_COMPACT_TABLE to compare the full table with the compact one.
+
+#include <boost/charconv/detail/fast_float/fast_float.hpp>
+#include <boost/charconv/to_chars.hpp>
+#include <boost/core/detail/splitmix64.hpp>
+#include <boost/config.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <cmath>
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+
+constexpr unsigned N = 200'000;
+
+static BOOST_NOINLINE void init_input_data( std::vector<std::string>& data )
+{
+    data.reserve( N );
+
+    boost::detail::splitmix64 rng;
+
+    while( data.size() < N )
+    {
+        std::uint64_t tmp = rng();
+
+        double x;
+        std::memcpy( &x, &tmp, sizeof(x) );
+
+        if( !std::isfinite(x) ) continue;
+
+        char buffer[ 64 ];
+        auto r = boost::charconv::to_chars( buffer, buffer + sizeof( buffer ), x, boost::charconv::chars_format::scientific );
+
+        data.emplace_back( buffer, r.ptr );
+    }
+}
+
+static BOOST_NOINLINE std::uint64_t evict( std::vector<std::uint64_t>& buffer )
+{
+    std::uint64_t s = 0;
+
+    // One write per cache line
+    for( std::size_t i = 0; i < buffer.size(); i += 8 )
+    {
+        s += buffer[ i ]++;
+    }
+
+    return s;
+}
+
+// Median and 90th percentile of the per call latency, with the timer overhead included
+static BOOST_NOINLINE void run( std::vector<std::string> const& data, std::vector<std::uint64_t>& buffer, std::size_t kb )
+{
+    std::vector<std::int64_t> times;
+    times.reserve( data.size() );
+
+    std::uint64_t s = 0;
+
+    for( auto const& str: data )
+    {
+        s += evict( buffer );
+
+        auto t1 = std::chrono::steady_clock::now();
+
+        double y = 0;
+        boost::charconv::detail::fast_float::from_chars( str.data(), str.data() + str.size(), y );
+
+        auto t2 = std::chrono::steady_clock::now();
+
+        s += y > 0;
+        times.push_back( std::chrono::duration_cast<std::chrono::nanoseconds>( t2 - t1 ).count() );
+    }
+
+    std::sort( times.begin(), times.end() );
+
+    std::cout << "evicting " << std::setw( 5 ) << kb << " KB between calls: "
+              << "p50 " << std::setw( 5 ) << times[ times.size() / 2 ] << " ns, "
+              << "p90 " << std::setw( 5 ) << times[ times.size() * 9 / 10 ] << " ns (s=" << s << ")\n";
+}
+
+int main()
+{
+    std::cout << BOOST_COMPILER << "\n";
+    std::cout << BOOST_STDLIB << "\n";
+
+#ifdef BOOST_CHARCONV_FASTFLOAT_COMPACT_TABLE
+    std::cout << "Power-of-five table: compact\n\n";
+#else
+    std::cout << "Power-of-five table: full\n\n";
+#endif
+
+    std::vector<std::string> data;
+    init_input_data( data );
+
+    for( std::size_t kb: { 0, 32, 256, 1024 } )
+    {
+        std::vector<std::uint64_t> buffer( kb * 1024 / sizeof( std::uint64_t ) );
+        run( data, buffer, kb );
+    }
+}
@@ -15,6 +15,7 @@
 #include <iomanip>
 #include <charconv>
 #include <random>
+#include <string>
 
 constexpr unsigned N = 2'000'000;
 constexpr int K = 10;
@@ -81,6 +82,34 @@ template<class T> static BOOST_NOINLINE void init_input_data_uint64( std::vector
     }
 }
 
+// Short decimals with small exponents such as 1234.5678, which are typical of hand written or fixed precision data
+template<class T> static BOOST_NOINLINE void init_input_data_decimal( std::vector<std::string>& data )
+{
+    data.reserve( N );
+
+    boost::detail::splitmix64 rng;
+
+    for( unsigned i = 0; i < N; ++i )
+    {
+        std::uint64_t x = rng();
+
+        std::string y = std::to_string( x % 100'000'000 );
+        std::size_t const frac_digits = ( x >> 32 ) % 9;
+
+        if( frac_digits != 0 )
+        {
+            if( y.size() <= frac_digits )
+            {
+                y.insert( 0, frac_digits - y.size() + 1, '0' );
+            }
+
+            y.insert( y.size() - frac_digits, 1, '.' );
+        }
+
+        data.push_back( y );
+    }
+}
+
 using namespace std::chrono_literals;
 
 template<class T> void test_strtox( std::vector<std::string> const& data, bool general, char const* label );
@@ -234,6 +263,37 @@ BOOST_NOINLINE void test_boost_from_chars<long double>( std::vector<std::string>
     std::cout << "boost::charconv::from_chars<long double>, " << label << ": " << std::setw( 5 ) << ( t2 - t1 ) / 1ms << " ms (s=" << s << ")\n";
 }
 
+template<class T> static BOOST_NOINLINE void test_boost_from_chars_batch( std::vector<std::string> const& data, bool general, char const* label )
+{
+    std::vector<boost::core::string_view> views( data.begin(), data.end() );
+    std::vector<T> values( data.size() );
+    std::vector<std::errc> errors( data.size() );
+
+    auto t1 = std::chrono::steady_clock::now();
+
+    double s = 0;
+
+    for( int i = 0; i < K; ++i )
+    {
+        boost::charconv::from_chars_batch( views.data(), views.size(), values.data(), errors.data(), general? boost::charconv::chars_format::general: boost::charconv::chars_format::scientific );
+
+        for( auto const& y: values )
+        {
+            s = s / 16.0 + y;
+        }
+    }
+
+    auto t2 = std::chrono::steady_clock::now();
+
+    std::cout << "boost::charconv::from_chars_batch<" << boost::core::type_name<T>() << ">, " << label << ": " << std::setw( 5 ) << ( t2 - t1 ) / 1ms << " ms (s=" << s << ")\n";
+}
+
+// No batch overload for long double
+template<>
+BOOST_NOINLINE void test_boost_from_chars_batch<long double>( std::vector<std::string> const&, bool, char const* )
+{
+}
+
 template<class T> static void test( bool general )
 {
     std::vector<std::string> data;
@@ -244,6 +304,7 @@ template<class T> static void test( bool general )
     test_strtox<T>( data, general, label );
     test_std_from_chars<T>( data, general, label );
     test_boost_from_chars<T>( data, general, label );
+    test_boost_from_chars_batch<T>( data, general, label );
 
     std::cout << std::endl;
 }
@@ -259,6 +320,23 @@ template<class T> static void test2()
     test_strtox<T>( data, general, label );
     test_std_from_chars<T>( data, general, label );
     test_boost_from_chars<T>( data, general, label );
+    test_boost_from_chars_batch<T>( data, general, label );
+
+    std::cout << std::endl;
+}
+
+template<class T> static void test3()
+{
+    std::vector<std::string> data;
+    init_input_data_decimal<T>( data );
+
+    bool general = true;
+    char const* label = "decimal";
+
+    test_strtox<T>( data, general, label );
+    test_std_from_chars<T>( data, general, label );
+    test_boost_from_chars<T>( data, general, label );
+    test_boost_from_chars_batch<T>( data, general, label );
 
     std::cout << std::endl;
 }
@@ -278,4 +356,9 @@ int main()
 
     test2<float>();
     test2<double>();
+    test2<long double>();
+
+    test3<float>();
+    test3<double>();
+    test3<long double>();
 }
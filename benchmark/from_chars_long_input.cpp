@@ -0,0 +1,95 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Cost per input byte of from_chars and from_chars_bounded on numbers from 1 KB to 10 MB long.
+// "zeros" is 0.000...0001 and "digits" is a long random significand that rounds near a halfway point,
+// which are the inputs an untrusted client can use to make a single call expensive.
+
+#include <boost/charconv/from_chars.hpp>
+#include <boost/core/type_name.hpp>
+#include <boost/core/detail/splitmix64.hpp>
+#include <boost/config.hpp>
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <string>
+
+constexpr std::size_t max_digits = 1000;
+
+static std::string make_zeros( std::size_t size )
+{
+    return "0." + std::string( size - 3, '0' ) + "1";
+}
+
+static std::string make_digits( std::size_t size )
+{
+    boost::detail::splitmix64 rng;
+
+    std::string str = "1.";
+    while( str.size() < size )
+    {
+        str += static_cast<char>( '0' + rng() % 10 );
+    }
+
+    return str;
+}
+
+template<class T, class F> static BOOST_NOINLINE void test_size( std::string const& str, F f, char const* name, char const* label )
+{
+    // Keep the total work per measurement roughly constant
+    std::size_t const n = ( std::max )( std::size_t( 1 ), std::size_t( 100'000'000 ) / str.size() );
+
+    double s = 0;
+    std::size_t errors = 0;
+
+    auto t1 = std::chrono::steady_clock::now();
+
+    for( std::size_t i = 0; i < n; ++i )
+    {
+        T y {};
+        auto r = f( str.data(), str.data() + str.size(), y );
+
+        errors += r.ec != std::errc();
+        s = s / 16.0 + static_cast<double>( y );
+    }
+
+    auto t2 = std::chrono::steady_clock::now();
+
+    double ns = static_cast<double>( std::chrono::duration_cast<std::chrono::nanoseconds>( t2 - t1 ).count() ) / static_cast<double>( n );
+
+    std::cout << std::setw( 32 ) << name << "<" << boost::core::type_name<T>() << ">, " << std::setw( 6 ) << label << ", "
+              << std::setw( 8 ) << str.size() << " bytes: "
+              << std::setw( 12 ) << std::fixed << std::setprecision( 0 ) << ns << " ns/call, "
+              << std::setw( 8 ) << std::setprecision( 3 ) << ns / static_cast<double>( str.size() ) << " ns/byte"
+              << ( errors ? " (rejected)" : "" ) << " (s=" << std::setprecision( 6 ) << s << ")\n";
+}
+
+template<class T> static void test( char const* label, std::string ( *make )( std::size_t ) )
+{
+    for( std::size_t size = 1000; size <= 10'000'000; size *= 10 )
+    {
+        std::string str = make( size );
+
+        test_size<T>( str, []( char const* first, char const* last, T& y ) { return boost::charconv::from_chars( first, last, y ); }, "boost::charconv::from_chars", label );
+        test_size<T>( str, []( char const* first, char const* last, T& y ) { return boost::charconv::from_chars_bounded( first, last, y, max_digits ); }, "boost::charconv::from_chars_bounded", label );
+    }
+
+    std::cout << std::endl;
+}
+
+template<class T> static void test()
+{
+    test<T>( "zeros", make_zeros );
+    test<T>( "digits", make_digits );
+}
+
+int main()
+{
+    std::cout << BOOST_COMPILER << "\n";
+    std::cout << BOOST_STDLIB << "\n\n";
+
+    test<float>();
+    test<double>();
+    test<long double>();
+}
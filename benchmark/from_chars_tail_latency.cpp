@@ -0,0 +1,174 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Per call latency percentiles of from_chars and from_chars_approximate.
+// The adversarial inputs are decimal expansions of more than 19 significant digits at or next to the midpoint
+// of two adjacent values, which force from_chars into big integer digit comparison.
+// Shorter inputs are rounded correctly by Eisel-Lemire alone, so they never reach that path.
+
+#include <boost/charconv/from_chars.hpp>
+#include <boost/charconv/to_chars.hpp>
+#include <boost/core/type_name.hpp>
+#include <boost/core/detail/splitmix64.hpp>
+#include <boost/config.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <cmath>
+#include <iostream>
+#include <iomanip>
+#include <limits>
+#include <string>
+#include <vector>
+
+constexpr unsigned N = 200'000;
+
+template<class T> static BOOST_NOINLINE void init_shortest_data( std::vector<std::string>& data )
+{
+    data.reserve( N );
+
+    boost::detail::splitmix64 rng;
+
+    while( data.size() < N )
+    {
+        std::uint64_t tmp = rng();
+
+        T x;
+        std::memcpy( &x, &tmp, sizeof(x) );
+
+        if( !std::isfinite(x) ) continue;
+
+        char buffer[ 64 ];
+        auto r = boost::charconv::to_chars( buffer, buffer + sizeof( buffer ), x );
+
+        data.emplace_back( buffer, r.ptr );
+    }
+}
+
+// Exact decimal expansion of the midpoint of x and the next value up, which needs one more bit than T has.
+// For float the midpoint is a double, and for double it is a long double, which is only wider on some platforms.
+static std::string exact_midpoint( float x )
+{
+    double m = ( static_cast<double>( x ) + static_cast<double>( std::nextafter( x, std::numeric_limits<float>::infinity() ) ) ) / 2;
+
+    char buffer[ 256 ];
+    auto r = boost::charconv::to_chars( buffer, buffer + sizeof( buffer ), m, boost::charconv::chars_format::scientific, 150 );
+
+    return std::string( buffer, r.ptr );
+}
+
+static std::string exact_midpoint( double x )
+{
+    long double m = ( static_cast<long double>( x ) + static_cast<long double>( std::nextafter( x, std::numeric_limits<double>::infinity() ) ) ) / 2;
+
+    char buffer[ 1200 ];
+    std::snprintf( buffer, sizeof( buffer ), "%.800Le", m );
+
+    return buffer;
+}
+
+template<class T> static BOOST_NOINLINE void init_halfway_data( std::vector<std::string>& data )
+{
+    data.reserve( N );
+
+    boost::detail::splitmix64 rng;
+
+    while( data.size() < N )
+    {
+        std::uint64_t tmp = rng();
+
+        T x;
+        std::memcpy( &x, &tmp, sizeof(x) );
+
+        if( !std::isfinite(x) || x < 0 || std::isinf( std::nextafter( x, std::numeric_limits<T>::infinity() ) ) ) continue;
+
+        std::string str = exact_midpoint( x );
+
+        // Trim the trailing zeros of the significand
+        auto exp_pos = str.find( 'e' );
+        std::string significand = str.substr( 0, exp_pos );
+        std::string exponent = str.substr( exp_pos );
+        significand.erase( significand.find_last_not_of( '0' ) + 1 );
+
+        // The significand is "d.ddd...", and midpoints that are this short never reach the slow path
+        if( significand.size() <= 20 ) continue;
+
+        switch( data.size() % 3 )
+        {
+            case 0: // Exactly halfway
+                data.push_back( significand + exponent );
+                break;
+
+            case 1: // Just above halfway
+                data.push_back( significand + "000000001" + exponent );
+                break;
+
+            default: // Just below halfway
+                significand.back() = static_cast<char>( significand.back() - 1 );
+                data.push_back( significand + "999999999" + exponent );
+                break;
+        }
+    }
+}
+
+template<class T, class F> static BOOST_NOINLINE void test_latency( std::vector<std::string> const& data, F f, char const* name, char const* label )
+{
+    std::vector<std::chrono::steady_clock::duration> times;
+    times.reserve( data.size() );
+
+    double s = 0;
+
+    for( auto const& x: data )
+    {
+        T y {};
+
+        auto t1 = std::chrono::steady_clock::now();
+        f( x.data(), x.data() + x.size(), y );
+        auto t2 = std::chrono::steady_clock::now();
+
+        times.push_back( t2 - t1 );
+        s = s / 16.0 + y;
+    }
+
+    std::sort( times.begin(), times.end() );
+
+    auto percentile = [&]( double p ) { return std::chrono::duration_cast<std::chrono::nanoseconds>( times[ static_cast<std::size_t>( p * static_cast<double>( times.size() - 1 ) ) ] ).count(); };
+
+    std::cout << std::setw( 40 ) << name << "<" << boost::core::type_name<T>() << ">, " << std::setw( 8 ) << label << ": "
+              << "p50 " << std::setw( 6 ) << percentile( 0.5 ) << " ns, "
+              << "p99 " << std::setw( 6 ) << percentile( 0.99 ) << " ns, "
+              << "p99.99 " << std::setw( 6 ) << percentile( 0.9999 ) << " ns, "
+              << "max " << std::setw( 7 ) << percentile( 1.0 ) << " ns (s=" << s << ")\n";
+}
+
+template<class T> static void test( std::vector<std::string> const& data, char const* label )
+{
+    test_latency<T>( data, []( char const* first, char const* last, T& y ) { boost::charconv::from_chars( first, last, y ); }, "boost::charconv::from_chars", label );
+    test_latency<T>( data, []( char const* first, char const* last, T& y ) { boost::charconv::from_chars_approximate( first, last, y ); }, "boost::charconv::from_chars_approximate", label );
+}
+
+template<class T> static void test()
+{
+    std::vector<std::string> data;
+
+    init_shortest_data<T>( data );
+    test<T>( data, "shortest" );
+
+    data.clear();
+
+    init_halfway_data<T>( data );
+    test<T>( data, "halfway" );
+
+    std::cout << std::endl;
+}
+
+int main()
+{
+    std::cout << BOOST_COMPILER << "\n";
+    std::cout << BOOST_STDLIB << "\n\n";
+
+    test<float>();
+    test<double>();
+}
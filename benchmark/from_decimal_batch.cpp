@@ -0,0 +1,131 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Throughput of converting arrays of decimals, as binary wire formats store them, back to float and double.
+// "loop" calls from_decimal for each decimal, "batch" calls from_decimal_batch over the whole array.
+// The "random" inputs are to_decimal of random bit patterns, which mostly need Eisel-Lemire.
+// The "short" inputs have at most 6 digits and a small negative exponent, which take the Clinger fast path,
+// where the batch probes the rounding mode once instead of once per element.
+
+#include <boost/charconv.hpp>
+#include <boost/core/detail/splitmix64.hpp>
+#include <boost/core/type_name.hpp>
+#include <boost/config.hpp>
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <cstring>
+#include <cstdint>
+#include <cmath>
+
+using namespace std::chrono_literals;
+
+constexpr unsigned N = 1'000'000;
+constexpr int K = 10;
+
+template<class T> struct decimal_type;
+template<> struct decimal_type<float> { using type = boost::charconv::decimal_fp<std::uint32_t>; using bits = std::uint32_t; };
+template<> struct decimal_type<double> { using type = boost::charconv::decimal_fp<std::uint64_t>; using bits = std::uint64_t; };
+
+template<class T> static BOOST_NOINLINE void init_random_data( std::vector<typename decimal_type<T>::type>& data )
+{
+    data.reserve( N );
+
+    boost::detail::splitmix64 rng;
+
+    while( data.size() < N )
+    {
+        auto tmp = static_cast<typename decimal_type<T>::bits>( rng() );
+
+        T x;
+        std::memcpy( &x, &tmp, sizeof(x) );
+
+        if( !std::isfinite(x) ) continue;
+
+        data.push_back( boost::charconv::to_decimal( x ) );
+    }
+}
+
+template<class T> static BOOST_NOINLINE void init_short_data( std::vector<typename decimal_type<T>::type>& data )
+{
+    data.reserve( N );
+
+    boost::detail::splitmix64 rng;
+
+    while( data.size() < N )
+    {
+        using significand_type = decltype( data.back().significand );
+        data.push_back( { static_cast<significand_type>( rng() % 1000000 ), -static_cast<int>( rng() % 6 ), false } );
+    }
+}
+
+template<class T> static BOOST_NOINLINE void test_loop( std::vector<typename decimal_type<T>::type> const& data, char const* label )
+{
+    std::vector<T> values( data.size() );
+
+    auto t1 = std::chrono::steady_clock::now();
+
+    std::size_t s = 0;
+
+    for( int i = 0; i < K; ++i )
+    {
+        for( std::size_t j = 0; j < data.size(); ++j )
+        {
+            s += boost::charconv::from_decimal( data[ j ], values[ j ] ) == std::errc();
+        }
+
+        s += static_cast<std::size_t>( values[ static_cast<std::size_t>( i ) ] != 0 );
+    }
+
+    auto t2 = std::chrono::steady_clock::now();
+
+    std::cout << "      from_decimal loop<" << boost::core::type_name<T>() << ">, " << label << ": " << std::setw( 5 ) << ( t2 - t1 ) / 1ms << " ms (s=" << s << ")\n";
+}
+
+template<class T> static BOOST_NOINLINE void test_batch( std::vector<typename decimal_type<T>::type> const& data, char const* label )
+{
+    std::vector<T> values( data.size() );
+    std::vector<std::errc> errors( data.size() );
+
+    auto t1 = std::chrono::steady_clock::now();
+
+    std::size_t s = 0;
+
+    for( int i = 0; i < K; ++i )
+    {
+        s += boost::charconv::from_decimal_batch( data.data(), data.size(), values.data(), errors.data() );
+        s += static_cast<std::size_t>( values[ static_cast<std::size_t>( i ) ] != 0 );
+    }
+
+    auto t2 = std::chrono::steady_clock::now();
+
+    std::cout << "     from_decimal_batch<" << boost::core::type_name<T>() << ">, " << label << ": " << std::setw( 5 ) << ( t2 - t1 ) / 1ms << " ms (s=" << s << ")\n";
+}
+
+template<class T> static void test()
+{
+    std::vector<typename decimal_type<T>::type> data;
+
+    init_random_data<T>( data );
+    test_loop<T>( data, "random" );
+    test_batch<T>( data, "random" );
+
+    data.clear();
+
+    init_short_data<T>( data );
+    test_loop<T>( data, "short" );
+    test_batch<T>( data, "short" );
+
+    std::cout << std::endl;
+}
+
+int main()
+{
+    std::cout << BOOST_COMPILER << "\n";
+    std::cout << BOOST_STDLIB << "\n\n";
+
+    test<float>();
+    test<double>();
+}
@@ -0,0 +1,158 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Throughput of shortest to_chars for the 16-bit floating point formats, over every finite value
+// in random order. "ryu" runs generic_binary_to_decimal for each value, and "table" looks the
+// decimal significand and exponent up in the tables of src/to_chars_16_bit_float_tables.hpp,
+// which is what to_chars uses when the library is built with BOOST_CHARCONV_16_BIT_FLOAT_TABLES.
+// Both print the digits with generic_to_chars. When the compiler has std::float16_t or
+// std::bfloat16_t, to_chars itself is timed as well.
+
+#include "../src/to_chars_16_bit_float_tables.hpp"
+#include <boost/charconv.hpp>
+#include <boost/core/detail/splitmix64.hpp>
+#include <boost/config.hpp>
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <algorithm>
+#include <vector>
+#include <cstring>
+#include <cstdint>
+
+using namespace std::chrono_literals;
+using namespace boost::charconv::detail::ryu;
+
+constexpr int K = 20;
+
+template<std::uint32_t MantissaBits, std::uint32_t ExponentBits> static BOOST_NOINLINE void init_input_data( std::vector<std::uint16_t>& data )
+{
+    constexpr std::uint32_t exponent_mask = ( ( 1u << ExponentBits ) - 1 ) << MantissaBits;
+
+    for( std::uint32_t bits = 0; bits < 65536; ++bits )
+    {
+        if( ( bits & exponent_mask ) != exponent_mask )
+        {
+            data.push_back( static_cast<std::uint16_t>( bits ) );
+        }
+    }
+
+    boost::detail::splitmix64 rng;
+
+    for( std::size_t i = data.size() - 1; i > 0; --i )
+    {
+        std::swap( data[ i ], data[ rng() % ( i + 1 ) ] );
+    }
+}
+
+template<std::uint32_t MantissaBits, std::uint32_t ExponentBits> static BOOST_NOINLINE void test_ryu( std::vector<std::uint16_t> const& data, char const* type )
+{
+    auto t1 = std::chrono::steady_clock::now();
+
+    std::size_t s = 0;
+
+    for( int i = 0; i < K; ++i )
+    {
+        char buffer[ 32 ];
+
+        for( auto x: data )
+        {
+            auto fd = generic_binary_to_decimal( x, MantissaBits, ExponentBits, false );
+            int n = generic_to_chars( fd, buffer, sizeof( buffer ) );
+
+            s += static_cast<std::size_t>( n );
+            s += static_cast<unsigned char>( buffer[0] );
+        }
+    }
+
+    auto t2 = std::chrono::steady_clock::now();
+
+    std::cout << std::setw( 8 ) << type << ", ryu:      " << std::setw( 5 ) << ( t2 - t1 ) / 1ms << " ms (s=" << s << ")\n";
+}
+
+static BOOST_NOINLINE void test_table( std::vector<std::uint16_t> const& data, floating_decimal_128 (*lookup)( std::uint16_t ), char const* type )
+{
+    auto t1 = std::chrono::steady_clock::now();
+
+    std::size_t s = 0;
+
+    for( int i = 0; i < K; ++i )
+    {
+        char buffer[ 32 ];
+
+        for( auto x: data )
+        {
+            auto fd = lookup( x );
+            int n = generic_to_chars( fd, buffer, sizeof( buffer ) );
+
+            s += static_cast<std::size_t>( n );
+            s += static_cast<unsigned char>( buffer[0] );
+        }
+    }
+
+    auto t2 = std::chrono::steady_clock::now();
+
+    std::cout << std::setw( 8 ) << type << ", table:    " << std::setw( 5 ) << ( t2 - t1 ) / 1ms << " ms (s=" << s << ")\n";
+}
+
+template<class T> static BOOST_NOINLINE void test_to_chars( std::vector<std::uint16_t> const& data, char const* type )
+{
+    std::vector<T> values( data.size() );
+    std::memcpy( values.data(), data.data(), data.size() * sizeof( T ) );
+
+    auto t1 = std::chrono::steady_clock::now();
+
+    std::size_t s = 0;
+
+    for( int i = 0; i < K; ++i )
+    {
+        char buffer[ 32 ];
+
+        for( auto x: values )
+        {
+            auto r = boost::charconv::to_chars( buffer, buffer + sizeof( buffer ), x );
+
+            s += static_cast<std::size_t>( r.ptr - buffer );
+            s += static_cast<unsigned char>( buffer[0] );
+        }
+    }
+
+    auto t2 = std::chrono::steady_clock::now();
+
+    std::cout << std::setw( 8 ) << type << ", to_chars: " << std::setw( 5 ) << ( t2 - t1 ) / 1ms << " ms (s=" << s << ")\n";
+}
+
+int main()
+{
+    std::cout << BOOST_COMPILER << "\n";
+    std::cout << BOOST_STDLIB << "\n\n";
+
+    {
+        std::vector<std::uint16_t> data;
+        init_input_data<10, 5>( data );
+
+        test_ryu<10, 5>( data, "float16" );
+        test_table( data, boost::charconv::detail::float16_bits_to_fd128, "float16" );
+
+#ifdef BOOST_CHARCONV_HAS_FLOAT16
+        test_to_chars<std::float16_t>( data, "float16" );
+#endif
+
+        std::cout << std::endl;
+    }
+
+    {
+        std::vector<std::uint16_t> data;
+        init_input_data<7, 8>( data );
+
+        test_ryu<7, 8>( data, "bfloat16" );
+        test_table( data, boost::charconv::detail::bfloat16_bits_to_fd128, "bfloat16" );
+
+#ifdef BOOST_CHARCONV_HAS_BRAINFLOAT16
+        test_to_chars<std::bfloat16_t>( data, "bfloat16" );
+#endif
+
+        std::cout << std::endl;
+    }
+}
@@ -0,0 +1,161 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Throughput of writing arrays of doubles as comma separated text, the way CSV and JSON exporters do.
+// The input imitates the coordinates of canada.json: longitudes and latitudes with up to 17 significant digits.
+// "loop" calls to_chars for each value into a scratch buffer and appends it with the separator,
+// "batch" calls to_chars_batch over the whole array and flushes the output buffer whenever it fills up.
+
+#include <boost/charconv.hpp>
+#include <boost/core/detail/splitmix64.hpp>
+#include <boost/config.hpp>
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <cstring>
+#include <cstdint>
+
+using namespace std::chrono_literals;
+
+constexpr unsigned N = 1'000'000;
+constexpr int K = 10;
+
+// The output buffer is flushed to the sink whenever it fills up
+constexpr std::size_t buffer_size = 64 * 1024;
+
+static BOOST_NOINLINE void init_input_data( std::vector<double>& data )
+{
+    data.reserve( N );
+
+    boost::detail::splitmix64 rng;
+
+    for( unsigned i = 0; i < N / 2; ++i )
+    {
+        double u = static_cast<double>( rng() >> 11 ) * 0x1p-53;
+        double v = static_cast<double>( rng() >> 11 ) * 0x1p-53;
+
+        data.push_back( -141.0 + 89.0 * u );
+        data.push_back( 41.6 + 41.5 * v );
+    }
+}
+
+static BOOST_NOINLINE std::size_t flush( char const* first, char const* last )
+{
+    return static_cast<std::size_t>( last - first ) + static_cast<unsigned char>( first[ 0 ] );
+}
+
+static BOOST_NOINLINE void test_loop( std::vector<double> const& data, char const* label, boost::charconv::chars_format fmt, int precision )
+{
+    std::vector<char> output( buffer_size );
+
+    auto t1 = std::chrono::steady_clock::now();
+
+    std::size_t s = 0;
+
+    for( int i = 0; i < K; ++i )
+    {
+        char* first = output.data();
+        char* last = first + output.size();
+        char* ptr = first;
+
+        bool separator = false;
+
+        for( auto x: data )
+        {
+            char buffer[ 64 ];
+
+            auto r = precision == -1?
+                     boost::charconv::to_chars( buffer, buffer + sizeof( buffer ), x, fmt ):
+                     boost::charconv::to_chars( buffer, buffer + sizeof( buffer ), x, fmt, precision );
+
+            std::size_t n = static_cast<std::size_t>( r.ptr - buffer );
+
+            if( static_cast<std::size_t>( last - ptr ) < n + separator )
+            {
+                s += flush( first, ptr );
+                ptr = first;
+            }
+
+            if( separator )
+            {
+                *ptr++ = ',';
+            }
+
+            std::memcpy( ptr, buffer, n );
+            ptr += n;
+
+            separator = true;
+        }
+
+        s += flush( first, ptr );
+    }
+
+    auto t2 = std::chrono::steady_clock::now();
+
+    std::cout << "   to_chars loop, " << label << ": " << std::setw( 5 ) << ( t2 - t1 ) / 1ms << " ms (s=" << s << ")\n";
+}
+
+static BOOST_NOINLINE void test_batch( std::vector<double> const& data, char const* label, boost::charconv::chars_format fmt, int precision )
+{
+    std::vector<char> output( buffer_size );
+
+    auto t1 = std::chrono::steady_clock::now();
+
+    std::size_t s = 0;
+
+    for( int i = 0; i < K; ++i )
+    {
+        char* first = output.data();
+        char* last = first + output.size();
+        char* ptr = first;
+
+        double const* values = data.data();
+        std::size_t count = data.size();
+
+        for( ;; )
+        {
+            auto r = precision == -1?
+                     boost::charconv::to_chars_batch( ptr, last, values, count, ',', fmt ):
+                     boost::charconv::to_chars_batch( ptr, last, values, count, ',', fmt, precision );
+
+            s += flush( first, r.ptr );
+
+            if( r )
+            {
+                break;
+            }
+
+            // The separator before the next value starts the next buffer
+            values += r.count;
+            count -= r.count;
+
+            first[ 0 ] = ',';
+            ptr = first + 1;
+        }
+    }
+
+    auto t2 = std::chrono::steady_clock::now();
+
+    std::cout << "  to_chars_batch, " << label << ": " << std::setw( 5 ) << ( t2 - t1 ) / 1ms << " ms (s=" << s << ")\n";
+}
+
+int main()
+{
+    std::cout << BOOST_COMPILER << "\n";
+    std::cout << BOOST_STDLIB << "\n\n";
+
+    std::vector<double> data;
+    init_input_data( data );
+
+    test_loop( data, "shortest general", boost::charconv::chars_format::general, -1 );
+    test_batch( data, "shortest general", boost::charconv::chars_format::general, -1 );
+
+    std::cout << std::endl;
+
+    test_loop( data, "fixed, 6 digits", boost::charconv::chars_format::fixed, 6 );
+    test_batch( data, "fixed, 6 digits", boost::charconv::chars_format::fixed, 6 );
+
+    std::cout << std::endl;
+}
@@ -8,6 +8,7 @@
 
 #ifdef BOOST_CHARCONV_HAS_STDFLOAT128
 #include <charconv>
+#include <vector>
 
 std::ostream& operator<<( std::ostream& os, std::float128_t v)
 {
@@ -21,15 +22,24 @@ std::ostream& operator<<( std::ostream& os, std::float128_t v)
 
 
 #include <boost/charconv/to_chars.hpp>
+#include <boost/charconv/detail/dragonbox/dragonbox.hpp>
 #include <boost/core/type_name.hpp>
 #include <boost/core/detail/splitmix64.hpp>
 #include <boost/config.hpp>
 #include <type_traits>
+#include <limits>
 #include <chrono>
 #include <cstdio>
+#include <cstring>
+#include <cmath>
 #include <iostream>
 #include <iomanip>
 #include <charconv>
+#include <vector>
+
+#ifdef BOOST_CHARCONV_HAS_QUADMATH
+#include <quadmath.h>
+#endif
 
 constexpr unsigned N = 2'000'000;
 constexpr int K = 10;
@@ -53,6 +63,50 @@ template<class T> static BOOST_NOINLINE void init_input_data( std::vector<T>& da
     }
 }
 
+// A random 64-bit significand scaled by a random power of two covers the whole range of
+// long double, whether it is 64, 80 or 128 bits wide
+template<> BOOST_NOINLINE void init_input_data<long double>( std::vector<long double>& data )
+{
+    data.reserve( N );
+
+    boost::detail::splitmix64 rng;
+
+    int const max_exp = std::numeric_limits<long double>::max_exponent;
+    int const min_exp = std::numeric_limits<long double>::min_exponent - std::numeric_limits<long double>::digits;
+
+    for( unsigned i = 0; i < N; ++i )
+    {
+        std::uint64_t tmp = rng();
+
+        long double x = std::ldexp( static_cast<long double>( tmp >> 1 ), static_cast<int>( rng() % static_cast<std::uint64_t>( max_exp - min_exp ) ) + min_exp - 63 );
+
+        if( !std::isfinite(x) || x == 0 ) continue;
+
+        data.push_back( ( tmp & 1 )? -x: x );
+    }
+}
+
+#ifdef BOOST_CHARCONV_HAS_QUADMATH
+template<> BOOST_NOINLINE void init_input_data<__float128>( std::vector<__float128>& data )
+{
+    data.reserve( N );
+
+    boost::detail::splitmix64 rng;
+
+    for( unsigned i = 0; i < N; ++i )
+    {
+        boost::uint128_type tmp = ( static_cast<boost::uint128_type>( rng() ) << 64 ) | rng();
+
+        __float128 x;
+        std::memcpy( &x, &tmp, sizeof(x) );
+
+        if( isnanq(x) || isinfq(x) ) continue;
+
+        data.push_back( x );
+    }
+}
+#endif
+
 #ifdef BOOST_CHARCONV_HAS_STDFLOAT128
 template<> BOOST_NOINLINE void init_input_data<std::float128_t>( std::vector<std::float128_t>& data )
 {
@@ -77,33 +131,56 @@ template<> BOOST_NOINLINE void init_input_data<std::float128_t>( std::vector<std
 
 using namespace std::chrono_literals;
 
+static int snprintf_impl( char* buffer, std::size_t size, bool general, int prec, double x )
+{
+    return std::snprintf( buffer, size, general? "%.*g": "%.*e", prec, x );
+}
+
+static int snprintf_impl( char* buffer, std::size_t size, bool general, int prec, long double x )
+{
+    return std::snprintf( buffer, size, general? "%.*Lg": "%.*Le", prec, x );
+}
+
+#ifdef BOOST_CHARCONV_HAS_QUADMATH
+static int snprintf_impl( char* buffer, std::size_t size, bool general, int prec, __float128 x )
+{
+    return quadmath_snprintf( buffer, size, general? "%.*Qg": "%.*Qe", prec, x );
+}
+#endif
+
+// The number of digits after the first that snprintf needs to round trip
+template<class T> static int round_trip_precision()
+{
+    return std::numeric_limits<T>::max_digits10 - 1;
+}
+
+#ifdef BOOST_CHARCONV_HAS_QUADMATH
+template<> int round_trip_precision<__float128>()
+{
+    return 35;
+}
+#endif
+
 template<class T> static BOOST_NOINLINE void test_snprintf( std::vector<T> const& data, bool general, char const* label, int precision )
 {
     auto t1 = std::chrono::steady_clock::now();
 
     std::size_t s = 0;
 
-    char const* format = general? "%.*g": "%.*e";
-
     int prec = precision;
 
     if( prec == 0 )
     {
-        prec = 16;
-
-        BOOST_IF_CONSTEXPR( std::is_same<T, float>::value )
-        {
-            prec = 8;
-        }
+        prec = round_trip_precision<T>();
     }
 
     for( int i = 0; i < K; ++i )
     {
-        char buffer[ 22 ];
+        char buffer[ 64 ];
 
         for( auto x: data )
         {
-            auto r = std::snprintf( buffer, sizeof( buffer ), format, prec, x );
+            auto r = snprintf_impl( buffer, sizeof( buffer ), general, prec, x );
             s += r;
             s += static_cast<unsigned char>( buffer[0] );
         }
@@ -122,7 +199,7 @@ template<class T> static BOOST_NOINLINE void test_std_to_chars( std::vector<T> c
 
     for( int i = 0; i < K; ++i )
     {
-        char buffer[ 21 ];
+        char buffer[ 64 ];
 
         for( auto x: data )
         {
@@ -150,7 +227,7 @@ template<class T> static BOOST_NOINLINE void test_boost_to_chars( std::vector<T>
 
     for( int i = 0; i < K; ++i )
     {
-        char buffer[ 21 ];
+        char buffer[ 64 ];
 
         for( auto x: data )
         {
@@ -170,6 +247,158 @@ template<class T> static BOOST_NOINLINE void test_boost_to_chars( std::vector<T>
     std::cout << "boost::charconv::to_chars<" << boost::core::type_name<T>() << ">, " << label << ", " << precision << ": " << std::setw( 5 ) << ( t2 - t1 ) / 1ms << " ms (s=" << s << ")\n";
 }
 
+static int snprintf_hex_impl( char* buffer, std::size_t size, int prec, double x )
+{
+    return prec == -1? std::snprintf( buffer, size, "%a", x ): std::snprintf( buffer, size, "%.*a", prec, x );
+}
+
+static int snprintf_hex_impl( char* buffer, std::size_t size, int prec, long double x )
+{
+    return prec == -1? std::snprintf( buffer, size, "%La", x ): std::snprintf( buffer, size, "%.*La", prec, x );
+}
+
+#ifdef BOOST_CHARCONV_HAS_QUADMATH
+static int snprintf_hex_impl( char* buffer, std::size_t size, int prec, __float128 x )
+{
+    return prec == -1? quadmath_snprintf( buffer, size, "%Qa", x ): quadmath_snprintf( buffer, size, "%.*Qa", prec, x );
+}
+#endif
+
+// Hexadecimal output, shortest when precision is -1
+template<class T> static BOOST_NOINLINE void test_snprintf_hex( std::vector<T> const& data, int precision )
+{
+    auto t1 = std::chrono::steady_clock::now();
+
+    std::size_t s = 0;
+
+    for( int i = 0; i < K; ++i )
+    {
+        char buffer[ 64 ];
+
+        for( auto x: data )
+        {
+            auto r = snprintf_hex_impl( buffer, sizeof( buffer ), precision, x );
+            s += r;
+            s += static_cast<unsigned char>( buffer[0] );
+        }
+    }
+
+    auto t2 = std::chrono::steady_clock::now();
+
+    std::cout << "            std::snprintf<" << boost::core::type_name<T>() << ">, hex, " << precision << ": " << std::setw( 5 ) << ( t2 - t1 ) / 1ms << " ms (s=" << s << ")\n";
+}
+
+template<class T> static BOOST_NOINLINE void test_boost_to_chars_hex( std::vector<T> const& data, int precision )
+{
+    auto t1 = std::chrono::steady_clock::now();
+
+    std::size_t s = 0;
+
+    for( int i = 0; i < K; ++i )
+    {
+        char buffer[ 64 ];
+
+        for( auto x: data )
+        {
+            auto r = precision == -1?
+                     boost::charconv::to_chars( buffer, buffer + sizeof( buffer ), x, boost::charconv::chars_format::hex ):
+                     boost::charconv::to_chars( buffer, buffer + sizeof( buffer ), x, boost::charconv::chars_format::hex, precision );
+
+            s += static_cast<std::size_t>( r.ptr - buffer );
+            s += static_cast<unsigned char>( buffer[0] );
+        }
+    }
+
+    auto t2 = std::chrono::steady_clock::now();
+
+    std::cout << "boost::charconv::to_chars<" << boost::core::type_name<T>() << ">, hex, " << precision << ": " << std::setw( 5 ) << ( t2 - t1 ) / 1ms << " ms (s=" << s << ")\n";
+}
+
+template<class T> static void test_hex( std::vector<T> const& data )
+{
+    for( int precision: { -1, 6 } )
+    {
+        test_snprintf_hex( data, precision );
+        test_boost_to_chars_hex( data, precision );
+
+        std::cout << std::endl;
+    }
+}
+
+// Walks buffer, writing one word per cache line, to evict the Dragonbox cache between two calls
+static BOOST_NOINLINE std::size_t evict( std::vector<std::uint64_t>& buffer )
+{
+    std::size_t s = 0;
+
+    for( std::size_t i = 0; i < buffer.size(); i += 8 )
+    {
+        s += static_cast<std::size_t>( buffer[ i ]++ );
+    }
+
+    return s;
+}
+
+// Shortest output with the full (10 KB) or compact (600 bytes) Dragonbox cache, with a hot cache
+// and with evict_kb of other data touched between two calls. The cold figures include the eviction
+// itself, which is reported on its own as "eviction only".
+template<class T, class Policy> static BOOST_NOINLINE void test_dragonbox_cache( std::vector<T> const& data, Policy policy, char const* label, std::size_t evict_kb )
+{
+    std::vector<std::uint64_t> buffer( evict_kb * 1024 / sizeof( std::uint64_t ) );
+
+    // The cold runs are much slower, so they use fewer values
+    std::size_t const n = evict_kb == 0? data.size(): data.size() / 20;
+    int const k = evict_kb == 0? K: 1;
+
+    auto t1 = std::chrono::steady_clock::now();
+
+    std::size_t s = 0;
+
+    for( int i = 0; i < k; ++i )
+    {
+        char buffer_out[ 32 ];
+
+        for( std::size_t j = 0; j < n; ++j )
+        {
+            if( evict_kb != 0 )
+            {
+                s += evict( buffer );
+            }
+
+            if( label != nullptr )
+            {
+                auto r = boost::charconv::detail::dragonbox_to_chars( data[ j ], buffer_out, buffer_out + sizeof( buffer_out ), boost::charconv::chars_format::general, policy );
+
+                s += static_cast<std::size_t>( r.ptr - buffer_out );
+                s += static_cast<unsigned char>( buffer_out[0] );
+            }
+        }
+    }
+
+    auto t2 = std::chrono::steady_clock::now();
+
+    std::cout << "     dragonbox<" << boost::core::type_name<T>() << ">, " << std::setw( 13 ) << ( label != nullptr? label: "eviction only" ) << ", "
+              << std::setw( 4 ) << evict_kb << " KB evicted: " << std::setw( 5 ) << ( t2 - t1 ) / 1ms << " ms (s=" << s << ")\n";
+}
+
+template<class T> static void test_dragonbox_cache()
+{
+    std::vector<T> data;
+    init_input_data( data );
+
+    for( std::size_t evict_kb: { 0, 256 } )
+    {
+        if( evict_kb != 0 )
+        {
+            test_dragonbox_cache( data, boost::charconv::detail::policy::cache::full, nullptr, evict_kb );
+        }
+
+        test_dragonbox_cache( data, boost::charconv::detail::policy::cache::full, "full cache", evict_kb );
+        test_dragonbox_cache( data, boost::charconv::detail::policy::cache::compact, "compact cache", evict_kb );
+
+        std::cout << std::endl;
+    }
+}
+
 template<class T> static void test()
 {
     std::vector<T> data;
@@ -198,8 +427,40 @@ template<class T> static void test()
     test_boost_to_chars( data, true, "general", 6 );
 
     std::cout << std::endl;
+
+    test_hex( data );
 }
 
+#ifdef BOOST_CHARCONV_HAS_QUADMATH
+template<> void test<__float128>()
+{
+    std::vector<__float128> data;
+    init_input_data( data );
+
+    test_snprintf( data, false, "scientific", 0 );
+    test_boost_to_chars( data, false, "scientific", 0 );
+
+    std::cout << std::endl;
+
+    test_snprintf( data, false, "scientific", 6 );
+    test_boost_to_chars( data, false, "scientific", 6 );
+
+    std::cout << std::endl;
+
+    test_snprintf( data, true, "general", 0 );
+    test_boost_to_chars( data, true, "general", 0 );
+
+    std::cout << std::endl;
+
+    test_snprintf( data, true, "general", 6 );
+    test_boost_to_chars( data, true, "general", 6 );
+
+    std::cout << std::endl;
+
+    test_hex( data );
+}
+#endif
+
 #ifdef BOOST_CHARCONV_HAS_STDFLOAT128
 template<> void test<std::float128_t>()
 {
@@ -228,6 +489,40 @@ template<> void test<std::float128_t>()
 }
 #endif
 
+// Counters, timestamps and IDs: integers of every magnitude up to 2^digits, stored as T
+template<class T> static BOOST_NOINLINE void init_integer_input_data( std::vector<T>& data )
+{
+    data.reserve( N );
+
+    boost::detail::splitmix64 rng;
+
+    constexpr int digits = std::numeric_limits<T>::digits;
+
+    for( unsigned i = 0; i < N; ++i )
+    {
+        std::uint64_t tmp = rng() >> ( 64 - digits + static_cast<int>( rng() % digits ) );
+        data.push_back( static_cast<T>( tmp ) );
+    }
+}
+
+template<class T> static void test_integers()
+{
+    std::vector<T> data;
+    init_integer_input_data( data );
+
+    test_snprintf( data, true, "general, integers", 0 );
+    test_std_to_chars( data, true, "general, integers", 0 );
+    test_boost_to_chars( data, true, "general, integers", 0 );
+
+    std::cout << std::endl;
+
+    test_snprintf( data, false, "scientific, integers", 0 );
+    test_std_to_chars( data, false, "scientific, integers", 0 );
+    test_boost_to_chars( data, false, "scientific, integers", 0 );
+
+    std::cout << std::endl;
+}
+
 int main()
 {
     std::cout << BOOST_COMPILER << "\n";
@@ -235,6 +530,13 @@ int main()
 
     test<float>();
     test<double>();
+    test<long double>();
+    test_integers<float>();
+    test_integers<double>();
+    #ifdef BOOST_CHARCONV_HAS_QUADMATH
+    test<__float128>();
+    #endif
+    test_dragonbox_cache<double>();
     #ifdef BOOST_CHARCONV_HAS_STDFLOAT128
     test<std::float128_t>();
     #endif
@@ -0,0 +1,173 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Speed of to_chars with a precision for each pair of floff caches, against the size of their tables.
+// "%.17g" is general output with 17 significant digits of random doubles, and "%.6f" is fixed output
+// with 6 decimals of values below 10^9. Each is timed with a hot cache and with 256 KB of other data
+// touched between two calls, which is reported on its own as "eviction only".
+//
+// The caches used by to_chars itself are chosen when building the library with
+// BOOST_CHARCONV_FLOFF_COMPRESSED_MAIN_CACHE and BOOST_CHARCONV_FLOFF_SUPER_COMPACT_EXTENDED_CACHE.
+
+#include <boost/charconv/detail/dragonbox/floff.hpp>
+#include <boost/charconv/chars_format.hpp>
+#include <boost/core/detail/splitmix64.hpp>
+#include <boost/config.hpp>
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <cstring>
+#include <cstdint>
+#include <cmath>
+
+using namespace std::chrono_literals;
+using namespace boost::charconv::detail;
+
+constexpr unsigned N = 1'000'000;
+constexpr int K = 5;
+
+static BOOST_NOINLINE void init_random_data( std::vector<double>& data )
+{
+    data.reserve( N );
+
+    boost::detail::splitmix64 rng;
+
+    for( unsigned i = 0; i < N; ++i )
+    {
+        std::uint64_t tmp = rng();
+
+        double x;
+        std::memcpy( &x, &tmp, sizeof(x) );
+
+        if( !std::isfinite(x) ) continue;
+
+        data.push_back( x );
+    }
+}
+
+static BOOST_NOINLINE void init_moderate_data( std::vector<double>& data )
+{
+    data.reserve( N );
+
+    boost::detail::splitmix64 rng;
+
+    for( unsigned i = 0; i < N; ++i )
+    {
+        double x = static_cast<double>( rng() >> 11 ) / static_cast<double>( UINT64_C(1) << 53 );
+        x = std::ldexp( x, static_cast<int>( rng() % 30 ) );
+
+        data.push_back( x );
+    }
+}
+
+// Walks buffer, writing one word per cache line, to evict the floff caches between two calls
+static BOOST_NOINLINE std::size_t evict( std::vector<std::uint64_t>& buffer )
+{
+    std::size_t s = 0;
+
+    for( std::size_t i = 0; i < buffer.size(); i += 8 )
+    {
+        s += static_cast<std::size_t>( buffer[ i ]++ );
+    }
+
+    return s;
+}
+
+template<class Cache> static std::size_t extended_cache_size()
+{
+    return sizeof( Cache::cache ) + sizeof( Cache::multiplier_index_info_table );
+}
+
+template<class MainCache> struct main_cache_size;
+
+template<> struct main_cache_size<main_cache_full>
+{
+    static std::size_t get() { return sizeof( main_cache_holder::cache ); }
+};
+
+template<> struct main_cache_size<main_cache_compressed>
+{
+    static std::size_t get() { return sizeof( compressed_cache_detail::cache_holder_t::table ) + sizeof( compressed_cache_detail::pow5_holder_t::table ); }
+};
+
+template<class MainCache, class ExtendedCache> static BOOST_NOINLINE void test( std::vector<double> const& data, int precision, boost::charconv::chars_format fmt, char const* label, std::size_t evict_kb, char const* caches )
+{
+    std::vector<std::uint64_t> buffer( evict_kb * 1024 / sizeof( std::uint64_t ) );
+
+    // The cold runs are much slower, so they use fewer values
+    std::size_t const n = evict_kb == 0? data.size(): data.size() / 10;
+    int const k = evict_kb == 0? K: 1;
+
+    auto t1 = std::chrono::steady_clock::now();
+
+    std::size_t s = 0;
+
+    for( int i = 0; i < k; ++i )
+    {
+        char buffer_out[ 64 ];
+
+        for( std::size_t j = 0; j < n; ++j )
+        {
+            if( evict_kb != 0 )
+            {
+                s += evict( buffer );
+            }
+
+            if( caches != nullptr )
+            {
+                auto r = floff<MainCache, ExtendedCache>( data[ j ], precision, buffer_out, buffer_out + sizeof( buffer_out ), fmt );
+
+                s += static_cast<std::size_t>( r.ptr - buffer_out );
+                s += static_cast<unsigned char>( buffer_out[0] );
+            }
+        }
+    }
+
+    auto t2 = std::chrono::steady_clock::now();
+
+    if( caches != nullptr )
+    {
+        std::cout << std::setw( 26 ) << caches << " (" << std::setw( 5 ) << main_cache_size<MainCache>::get() + extended_cache_size<ExtendedCache>() << " bytes), ";
+    }
+    else
+    {
+        std::cout << std::setw( 42 ) << "eviction only, ";
+    }
+
+    std::cout << label << ", " << std::setw( 3 ) << evict_kb << " KB evicted: " << std::setw( 5 ) << ( t2 - t1 ) / 1ms << " ms (s=" << s << ")\n";
+}
+
+static void test( std::vector<double> const& data, int precision, boost::charconv::chars_format fmt, char const* label )
+{
+    for( std::size_t evict_kb: { 0, 256 } )
+    {
+        if( evict_kb != 0 )
+        {
+            test<main_cache_full, extended_cache_long>( data, precision, fmt, label, evict_kb, nullptr );
+        }
+
+        test<main_cache_full, extended_cache_long>( data, precision, fmt, label, evict_kb, "full + long" );
+        test<main_cache_full, extended_cache_super_compact>( data, precision, fmt, label, evict_kb, "full + super compact" );
+        test<main_cache_compressed, extended_cache_long>( data, precision, fmt, label, evict_kb, "compressed + long" );
+        test<main_cache_compressed, extended_cache_super_compact>( data, precision, fmt, label, evict_kb, "compressed + super compact" );
+
+        std::cout << std::endl;
+    }
+}
+
+int main()
+{
+    std::cout << BOOST_COMPILER << "\n";
+    std::cout << BOOST_STDLIB << "\n\n";
+
+    std::vector<double> random_data;
+    init_random_data( random_data );
+
+    std::vector<double> moderate_data;
+    init_moderate_data( moderate_data );
+
+    test( random_data, 17, boost::charconv::chars_format::general, "%.17g" );
+    test( moderate_data, 6, boost::charconv::chars_format::fixed, "%.6f" );
+}
@@ -0,0 +1,21 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_CHARCONV_DECIMAL_FP_HPP
+#define BOOST_CHARCONV_DECIMAL_FP_HPP
+
+namespace boost { namespace charconv {
+
+// A floating point value as a decimal: (is_negative ? -1 : 1) * significand * 10^exponent
+template <typename Unsigned_Integer>
+struct decimal_fp
+{
+    Unsigned_Integer significand;
+    int exponent;
+    bool is_negative;
+};
+
+}} // Namespaces
+
+#endif // BOOST_CHARCONV_DECIMAL_FP_HPP
@@ -0,0 +1,20 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_CHARCONV_DECIMAL_ROUNDING_HPP
+#define BOOST_CHARCONV_DECIMAL_ROUNDING_HPP
+
+namespace boost { namespace charconv {
+
+// How from_chars_decimal treats digits below the requested scale
+enum class decimal_rounding : unsigned
+{
+    nearest_even,   // Round to nearest, ties to even
+    nearest_away,   // Round to nearest, ties away from zero
+    truncate        // Discard the extra digits (round toward zero)
+};
+
+}} // Namespaces
+
+#endif // BOOST_CHARCONV_DECIMAL_ROUNDING_HPP
@@ -41,7 +41,7 @@ template <typename ResultType, typename Unsigned_Integer, typename ArrayPtr>
 inline ResultType fast_path(std::int64_t q, Unsigned_Integer w, bool negative, ArrayPtr table) noexcept
 {
     // The general idea is as follows.
-    // if 0 <= s <= 2^64 and if 10^0 <= p <= 10^27
+    // if 0 <= s <= 2^64 and if 10^0 <= p <= 10^27 (2^113 and 10^48 for 128 bit long double)
     // Both s and p can be represented exactly
     // because of this s*p and s/p will produce
     // correctly rounded values
@@ -65,6 +65,22 @@ inline ResultType fast_path(std::int64_t q, Unsigned_Integer w, bool negative, A
     return ld;
 }
 
+// The fast path needs every operation to be rounded to nearest using the full width of the significand.
+// Like fast_float::detail::rounds_to_nearest this checks the rounding mode without calling fegetround,
+// and it also rejects an x87 control word that limits the precision to 53 bits, which is the default on some platforms.
+inline bool long_double_rounds_to_nearest() noexcept
+{
+    // volatile prevents the comparisons from being evaluated at compile time
+    static volatile long double ldmin = (std::numeric_limits<long double>::min)();
+    static volatile long double ldeps = std::numeric_limits<long double>::epsilon();
+    const long double min_value = ldmin;
+    const long double eps_value = ldeps;
+
+    // Only when rounding to nearest is 1 + min == 1 - min,
+    // and only with the full precision does 1 + epsilon not round back to 1
+    return (min_value + 1.0L == 1.0L - min_value) && (1.0L + eps_value != 1.0L);
+}
+
 template <typename ResultType, typename Unsigned_Integer>
 inline ResultType compute_float80(std::int64_t q, Unsigned_Integer w, bool negative, std::errc& success) noexcept
 {
@@ -78,10 +94,44 @@ inline ResultType compute_float80(std::int64_t q, Unsigned_Integer w, bool negat
     // How to read floating point numbers accurately.
     // ACM SIGPLAN Notices. 1990
     // https://dl.acm.org/doi/pdf/10.1145/93542.93557
-    static constexpr auto clinger_max_exp = BOOST_CHARCONV_LDBL_BITS == 80 ? 27 : 48;   // NOLINT : Only changes by platform
-    static constexpr auto clinger_min_exp = BOOST_CHARCONV_LDBL_BITS == 80 ? -34 : -55; // NOLINT
+    //
+    // 10^27 (80 bit) and 10^48 (128 bit) are the largest powers of ten that fit in the significand,
+    // and so does any integer up to 2^64 (80 bit) and 2^113 (128 bit).
+    // With both exact w * 10^q and w / 10^-q are a single correctly rounded operation.
+    static constexpr auto clinger_max_exp = BOOST_CHARCONV_LDBL_BITS == 80 ? 27 : 48;     // NOLINT : Only changes by platform
+    static constexpr auto clinger_min_exp = -clinger_max_exp;
+    static constexpr auto clinger_mantissa_bits = BOOST_CHARCONV_LDBL_BITS == 80 ? 64 : 113; // NOLINT
+    const auto clinger_max_mantissa = static_cast<Unsigned_Integer>(1) << clinger_mantissa_bits;
+    const auto ten = static_cast<Unsigned_Integer>(10);
+
+    if (w != 0)
+    {
+        // Trailing zeros of the significand are not significant, e.g. 1.00000000000000000000000
+        while (w > clinger_max_mantissa && w % ten == 0)
+        {
+            w /= ten;
+            ++q;
+        }
+
+        // Move the excess of a large exponent into the significand while it stays exact, e.g. 15e30 is 15000e27
+        if (q > clinger_max_exp && q <= clinger_max_exp + 39)
+        {
+            while (q > clinger_max_exp && w <= clinger_max_mantissa / ten)
+            {
+                w *= ten;
+                --q;
+            }
+        }
+    }
+
+    // A larger w is still exact if it fits in the significand once its trailing zero bits are removed, e.g. 2^112
+    auto odd_w = w;
+    while (odd_w > clinger_max_mantissa && (odd_w & static_cast<Unsigned_Integer>(1)) == static_cast<Unsigned_Integer>(0))
+    {
+        odd_w >>= 1;
+    }
 
-    if (clinger_min_exp <= q && q <= clinger_max_exp && w <= static_cast<Unsigned_Integer>(1) << 113)
+    if (clinger_min_exp <= q && q <= clinger_max_exp && odd_w <= clinger_max_mantissa && long_double_rounds_to_nearest())
     {
         success = std::errc();
         return fast_path<ResultType>(q, w, negative, powers_of_ten_ld);
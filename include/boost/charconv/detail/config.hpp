@@ -165,6 +165,11 @@ static_assert((BOOST_CHARCONV_ENDIAN_BIG_BYTE || BOOST_CHARCONV_ENDIAN_LITTLE_BY
 #  define BOOST_CHARCONV_ASSUME(expr)
 #endif
 
+// SSE2 is part of every x86-64 target, and can be turned off with BOOST_CHARCONV_NO_SIMD
+#if !defined(BOOST_CHARCONV_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#  define BOOST_CHARCONV_HAS_SSE2
+#endif
+
 // Detection for C++23 fixed width floating point types
 // All of these types are optional so check for each of them individually
 #if (defined(_MSVC_LANG) && _MSVC_LANG > 202002L) || __cplusplus > 202002L
@@ -1457,6 +1457,73 @@ namespace cache {
             return cache_format::cache[std::size_t(k - cache_format::min_k)];
         }
     };
+
+    // Recovers the binary64 entries from every 27th one (see compressed_cache_detail),
+    // which needs about 600 bytes instead of 10 KB at the cost of two extra multiplications.
+    // A recovered entry can be up to two units in the last place above the full one,
+    // which is within the error the algorithm tolerates, so the results are the same.
+    // binary32 always uses the full cache since it is only 78 entries.
+    struct compact : base
+    {
+        using cache_policy = compact;
+
+        template <typename FloatFormat, typename cache_format = typename std::conditional<std::is_same<FloatFormat, ieee754_binary32>::value, 
+                                                                                          cache_holder_ieee754_binary32,
+                                                                                          cache_holder_ieee754_binary64>::type>
+        static BOOST_CHARCONV_CXX14_CONSTEXPR typename cache_format::cache_entry_type get_cache(int k) noexcept 
+        {
+            BOOST_IF_CONSTEXPR (std::is_same<FloatFormat, ieee754_binary64>::value)
+            {
+                static_assert(cache_format::min_k == main_cache_holder::min_k && cache_format::max_k == main_cache_holder::max_k,
+                              "The compressed cache must cover the same range as the full cache");
+
+                // Compute the base index.
+                const auto cache_index = static_cast<int>(static_cast<std::uint32_t>(k - cache_format::min_k) /
+                                                          compressed_cache_detail::compression_ratio);
+
+                const auto kb = cache_index * compressed_cache_detail::compression_ratio + cache_format::min_k;
+                const auto offset = k - kb;
+
+                // Get the base cache.
+                const auto base_cache = compressed_cache_detail::cache_holder_t::table[cache_index];
+
+                if (offset == 0)
+                {
+                    return base_cache;
+                }
+
+                // Compute the required amount of bit-shift.
+                const auto alpha = log::floor_log2_pow10(kb + offset) - log::floor_log2_pow10(kb) - offset;
+                BOOST_CHARCONV_ASSERT(alpha > 0 && alpha < 64);
+
+                // Try to recover the real cache.
+                const auto pow5 = compressed_cache_detail::pow5_holder_t::table[offset];
+                auto recovered_cache = umul128(base_cache.high, pow5);
+                const auto middle_low = umul128(base_cache.low, pow5);
+
+                recovered_cache += middle_low.high;
+
+                const auto high_to_middle = recovered_cache.high << (64 - alpha);
+                const auto middle_to_low = recovered_cache.low << (64 - alpha);
+
+                recovered_cache = uint128{(recovered_cache.low >> alpha) | high_to_middle, ((middle_low.low >> alpha) | middle_to_low)};
+
+                BOOST_CHARCONV_ASSERT(recovered_cache.low + 1 != 0);
+                return uint128{recovered_cache.high, recovered_cache.low + 1};
+            }
+            else
+            {
+                return cache_format::cache[std::size_t(k - cache_format::min_k)];
+            }
+        }
+    };
+
+    // Cache used when no cache policy is given, selected at build time
+    #ifdef BOOST_CHARCONV_DRAGONBOX_COMPACT_CACHE
+    using default_cache = compact;
+    #else
+    using default_cache = full;
+    #endif
 }
 }
 
@@ -1522,6 +1589,7 @@ namespace binary_to_decimal_rounding {
 
 namespace cache {
     BOOST_INLINE_VARIABLE constexpr auto full = detail::policy_impl::cache::full{};
+    BOOST_INLINE_VARIABLE constexpr auto compact = detail::policy_impl::cache::compact{};
 }
 } // Namespace Policy
 
@@ -2402,7 +2470,7 @@ to_decimal(dragonbox_signed_significand_bits<Float, FloatTraits> dragonbox_signe
     
     #ifdef BOOST_CHARCONV_NO_CXX14_RETURN_TYPE_DEDUCTION
     // For C++11 we hardcode the policy holder
-    using policy_holder = policy_holder<decimal_to_binary_rounding::nearest_to_even, binary_to_decimal_rounding::to_even, cache::full, sign::return_sign, trailing_zero::remove>;
+    using policy_holder = policy_holder<decimal_to_binary_rounding::nearest_to_even, binary_to_decimal_rounding::to_even, cache::default_cache, sign::return_sign, trailing_zero::remove>;
     
     #else
     
@@ -2413,7 +2481,7 @@ to_decimal(dragonbox_signed_significand_bits<Float, FloatTraits> dragonbox_signe
                                                     decimal_to_binary_rounding::nearest_to_even>,
                                 base_default_pair<binary_to_decimal_rounding::base,
                                                     binary_to_decimal_rounding::to_even>,
-                                base_default_pair<cache::base, cache::full>>{},
+                                base_default_pair<cache::base, cache::default_cache>>{},
         policies...));
     
     #endif
@@ -2717,7 +2785,7 @@ to_chars_result to_chars_n(Float x, char* first, char* last, chars_format fmt, B
 
     #ifdef BOOST_CHARCONV_NO_CXX14_RETURN_TYPE_DEDUCTION
     // For C++11 we hardcode the policy holder
-    using policy_holder = policy_holder<decimal_to_binary_rounding::nearest_to_even, binary_to_decimal_rounding::to_even, cache::full, sign::return_sign, trailing_zero::remove>;
+    using policy_holder = policy_holder<decimal_to_binary_rounding::nearest_to_even, binary_to_decimal_rounding::to_even, cache::default_cache, sign::return_sign, trailing_zero::remove>;
     
     #else
     
@@ -2728,7 +2796,7 @@ to_chars_result to_chars_n(Float x, char* first, char* last, chars_format fmt, B
                                                     decimal_to_binary_rounding::nearest_to_even>,
                                 base_default_pair<binary_to_decimal_rounding::base,
                                                     binary_to_decimal_rounding::to_even>,
-                                base_default_pair<cache::base, cache::full>>{},
+                                base_default_pair<cache::base, cache::default_cache>>{},
         policies...));
     
     #endif
@@ -1176,6 +1176,22 @@ constexpr std::uint8_t extended_cache_super_compact::cache_block_counts[];
 
 #endif
 
+// The caches used by to_chars when a precision is given. The full main cache is shared with Dragonbox,
+// and the compressed one with its compact cache (see BOOST_CHARCONV_DRAGONBOX_COMPACT_CACHE).
+// The super compact extended cache is about a sixth of the size of the long one, but generates digits
+// from a longer multiplication.
+#ifdef BOOST_CHARCONV_FLOFF_COMPRESSED_MAIN_CACHE
+using default_main_cache = main_cache_compressed;
+#else
+using default_main_cache = main_cache_full;
+#endif
+
+#ifdef BOOST_CHARCONV_FLOFF_SUPER_COMPACT_EXTENDED_CACHE
+using default_extended_cache = extended_cache_super_compact;
+#else
+using default_extended_cache = extended_cache_long;
+#endif
+
 #ifdef BOOST_MSVC
 # pragma warning(push)
 # pragma warning(disable: 4100) // MSVC 14.0 warning of unused formal parameter is incorrect
@@ -1320,12 +1336,23 @@ inline to_chars_result print_zero_fixed(char* buffer, std::size_t buffer_size, c
     return {buffer + 2 + precision, std::errc()};
 }
 
+// floff does not check the buffer size for chars_format::general, so the buffer must hold this many characters.
+// This is the sign, the decimal dot, precision significand digits (some of which may be trailing zeros that are
+// removed at the end), and either the exponent (at most "e-324") or the leading zeros of fixed format (at most "0.000").
+constexpr std::size_t floff_general_max_length(int precision) noexcept
+{
+    return static_cast<std::size_t>(precision == 0 ? 1 : precision) + 7U;
+}
+
 // precision means the number of decimal significand digits minus 1.
 // Assumes round-to-nearest, tie-to-even rounding.
 template <typename MainCache = main_cache_full, typename ExtendedCache>
 BOOST_CHARCONV_SAFEBUFFERS to_chars_result floff(const double x, int precision, char* first, char* last,
                                                  boost::charconv::chars_format fmt) noexcept
 {
+    static_assert(ExtendedCache::segment_length == 22 || ExtendedCache::segment_length == 252,
+                  "Only extended_cache_long and extended_cache_super_compact are supported");
+
     if (first >= last)
     {
         return {last, std::errc::value_too_large};
@@ -1508,7 +1535,7 @@ BOOST_CHARCONV_SAFEBUFFERS to_chars_result floff(const double x, int precision,
 
         int first_segment_length = 19;
         auto first_segment_aligned = first_segment; // Aligned to have 19 digits.
-        while (first_segment_aligned < UINT64_C(10000000000000000))
+        while (first_segment_aligned < UINT64_C(100000000000000000))
         {
             first_segment_aligned *= 100;
             first_segment_length -= 2;
@@ -1763,7 +1790,7 @@ BOOST_CHARCONV_SAFEBUFFERS to_chars_result floff(const double x, int precision,
 
             const auto initial_digits = static_cast<std::uint32_t>(prod >> 32);
 
-            buffer -= (initial_digits < 10 && buffer != first ? 1 : 0);
+            buffer -= (initial_digits < 10 && buffer != buffer_starting_pos ? 1 : 0);
             remaining_digits -= (2 - (initial_digits < 10 ? 1 : 0));
 
             // Avoid the situation where we have a leading 0 that we don't need
@@ -2476,7 +2503,7 @@ BOOST_CHARCONV_SAFEBUFFERS to_chars_result floff(const double x, int precision,
 
                             if (check_rounding_condition_with_next_bit(
                                     current_digits, segment_boundary_rounding_bit,
-                                    has_further_digits<0, 1, ExtendedCache>(significand, exp2_base, k, uconst0, uconst1)))
+                                    has_further_digits<0, 0, ExtendedCache>(significand, exp2_base, k, uconst0, uconst0)))
                             {
                                 goto round_up_two_digits;
                             }
@@ -2779,7 +2806,8 @@ BOOST_CHARCONV_SAFEBUFFERS to_chars_result floff(const double x, int precision,
 
                             BOOST_CHARCONV_ASSERT(remaining_digits >= 3);
 
-                            if (remaining_digits > 4)
+                            // The second subsegment can have up to 7 digits, so up to two more pairs may be needed.
+                            for (int i = 0; i < (remaining_digits - 3) / 2; ++i)
                             {
                                 prod = static_cast<std::uint32_t>(prod) * UINT64_C(100);
                                 print_2_digits(static_cast<std::uint32_t>(prod >> 32), buffer);
@@ -3326,7 +3354,7 @@ BOOST_CHARCONV_SAFEBUFFERS to_chars_result floff(const double x, int precision,
                             if (check_rounding_condition_subsegment_boundary_with_next_subsegment(
                                     current_digits,
                                     uint_with_known_number_of_digits<9>{static_cast<std::uint32_t>(second_part)},
-                                    compute_has_further_digits<1, 9, ExtendedCache>, remaining_subsegment_pairs, significand, exp2_base, k))
+                                    compute_has_further_digits<1, 0, ExtendedCache>, remaining_subsegment_pairs, significand, exp2_base, k))
                             {
                                 goto round_up_two_digits;
                             }
@@ -3652,7 +3680,7 @@ BOOST_CHARCONV_SAFEBUFFERS to_chars_result floff(const double x, int precision,
                         last_subsegment_pair >>= 1;
 
                         const auto first_part = static_cast<std::uint32_t>(last_subsegment_pair / power_of_10[9]);
-                        const auto second_part = static_cast<std::uint32_t>(last_subsegment_pair) - power_of_10[9] * first_part;
+                        const auto second_part = static_cast<std::uint32_t>(last_subsegment_pair - power_of_10[9] * first_part);
 
                         if (remaining_digits <= 9)
                         {
@@ -3913,6 +3941,9 @@ round_up:
     round_up_one_digit:
         if (++current_digits == 10)
         {
+            // Only the parity of remaining_digits is used from here on, to tell how many digits
+            // current_digits holds. Some paths jump here without keeping it in sync.
+            remaining_digits = 1;
             goto round_up_all_9s;
         }
 
@@ -3923,6 +3954,7 @@ round_up:
     round_up_two_digits:
         if (++current_digits == 100)
         {
+            remaining_digits = 2;
             goto round_up_all_9s;
         }
 
@@ -4018,9 +4050,10 @@ round_up_all_9s:
                 ++decimal_dot_pos;
             }
         }
-        else if (decimal_exponent_normalized == 0)
+        else
         {
-            // For the case 0.99...9 -> 1.00...0, the rounded digit is one before the first digit written.
+            // For the cases 0.99...9 -> 1.00...0 and 0.0099...9 -> 0.0100...0, the rounded digit is one before
+            // the first digit written.
             // Note: decimal_exponent_normalized was negative before the increment (++decimal_exponent_normalized),
             //       so we already have printed "00" onto the buffer.
             //       Hence, --digit_starting_pos doesn't go more than the starting position of the buffer.
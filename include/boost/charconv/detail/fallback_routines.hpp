@@ -12,10 +12,13 @@
 #include <boost/charconv/chars_format.hpp>
 #include <system_error>
 #include <type_traits>
+#include <algorithm>
 #include <locale>
 #include <clocale>
 #include <cstring>
 #include <cstdio>
+#include <cstdlib>
+#include <cstdint>
 
 namespace boost {
 namespace charconv {
@@ -206,6 +209,130 @@ from_chars_result from_chars_strtod_impl(const char* first, const char* last, T&
     return r;
 }
 
+// Rounding a decimal string to any of the supported binary formats depends on at most this many significant digits,
+// the longest being the exact expansion of a binary128 midpoint near the subnormal range.
+// Only whether any of the digits after these is non-zero can change the result.
+static constexpr std::size_t strtod_max_digits = 11565;
+
+// Rewrites the decimal number at the start of [first, last) as [-]0.<digits>e<exponent> into buffer,
+// keeping at most strtod_max_digits significant digits followed by a 1 if any non-zero digit was dropped.
+// The result rounds the same as the original, and buffer must hold strtod_max_digits + 32 characters.
+//
+// Returns the number of characters written, or 0 if there is no number, and sets number_end to the end of the number.
+inline std::size_t compact_decimal_string(const char* first, const char* last, char* buffer, const char*& number_end) noexcept
+{
+    auto next = first;
+    auto out = buffer;
+
+    if (next != last && *next == '-')
+    {
+        *out++ = '-';
+        ++next;
+    }
+
+    *out++ = '0';
+    *out++ = '.';
+
+    std::int64_t exponent = 0;
+    std::size_t digits = 0;
+    bool any_digits = false;
+    bool significant = false;
+    bool sticky = false;
+
+    const auto push_digit = [&](char c) noexcept
+    {
+        if (digits < strtod_max_digits)
+        {
+            *out++ = c;
+            ++digits;
+        }
+        else if (c != '0')
+        {
+            sticky = true;
+        }
+    };
+
+    while (next != last && *next >= '0' && *next <= '9')
+    {
+        any_digits = true;
+        if (significant || *next != '0')
+        {
+            significant = true;
+            ++exponent;
+            push_digit(*next);
+        }
+        ++next;
+    }
+
+    if (next != last && *next == '.')
+    {
+        ++next;
+        while (next != last && *next >= '0' && *next <= '9')
+        {
+            any_digits = true;
+            if (significant || *next != '0')
+            {
+                significant = true;
+                push_digit(*next);
+            }
+            else
+            {
+                --exponent;
+            }
+            ++next;
+        }
+    }
+
+    if (!any_digits)
+    {
+        return 0;
+    }
+
+    // The exponent is only part of the number if it has at least one digit
+    if (next != last && (*next == 'e' || *next == 'E'))
+    {
+        auto exp_next = next + 1;
+        bool exp_negative = false;
+        if (exp_next != last && (*exp_next == '+' || *exp_next == '-'))
+        {
+            exp_negative = *exp_next == '-';
+            ++exp_next;
+        }
+
+        if (exp_next != last && *exp_next >= '0' && *exp_next <= '9')
+        {
+            // Anything past 10^8 over or underflows every supported type
+            std::int64_t exp_value = 0;
+            while (exp_next != last && *exp_next >= '0' && *exp_next <= '9')
+            {
+                if (exp_value < 100000000)
+                {
+                    exp_value = exp_value * 10 + (*exp_next - '0');
+                }
+                ++exp_next;
+            }
+
+            exponent += exp_negative ? -exp_value : exp_value;
+            next = exp_next;
+        }
+    }
+
+    number_end = next;
+
+    if (sticky)
+    {
+        *out++ = '1';
+    }
+
+    if (digits != 0)
+    {
+        *out++ = 'e';
+        out = to_chars_int(out, out + 24, exponent).ptr;
+    }
+
+    return static_cast<std::size_t>(out - buffer);
+}
+
 template <typename T>
 inline from_chars_result from_chars_strtod(const char* first, const char* last, T& value) noexcept
 {
@@ -215,18 +342,29 @@ inline from_chars_result from_chars_strtod(const char* first, const char* last,
         return from_chars_strtod_impl(first, last, value, buffer);
     }
 
-    // If the string to be parsed does not fit into the 1024 byte static buffer than we have to allocate a buffer.
+    // Longer strings are compacted first so that neither the copy nor the work done by strto* grows with the input.
+    // The first half of the buffer holds the compacted string, and the second half the copy made by from_chars_strtod_impl.
     // malloc is used here because it does not throw on allocation failure.
 
-    char* buffer = static_cast<char*>(std::malloc(static_cast<std::size_t>(last - first + 1)));
+    const auto buffer_size = (std::min)(static_cast<std::size_t>(last - first), strtod_max_digits) + 32;
+    char* buffer = static_cast<char*>(std::malloc(2 * buffer_size));
     if (buffer == nullptr)
     {
         return {first, std::errc::not_enough_memory};
     }
 
-    auto r = from_chars_strtod_impl(first, last, value, buffer);
+    const char* number_end = first;
+    const auto compact_size = compact_decimal_string(first, last, buffer, number_end);
+    if (compact_size == 0)
+    {
+        std::free(buffer);
+        return {first, std::errc::invalid_argument};
+    }
+
+    auto r = from_chars_strtod_impl(buffer, buffer + compact_size, value, buffer + buffer_size);
     std::free(buffer);
 
+    r.ptr = r.ptr == buffer ? first : number_end;
     return r;
 }
 
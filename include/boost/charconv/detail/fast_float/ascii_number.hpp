@@ -142,11 +142,15 @@ parsed_number_string_t<UC> parse_number_string(UC const *p, UC const * pend, par
   parsed_number_string_t<UC> answer;
   answer.valid = false;
   answer.too_many_digits = false;
+  // JSON and TOML require digits on both sides of the decimal point, and forbid leading zeros
+  bool const strict_digits = options.grammar == number_grammar::json || options.grammar == number_grammar::toml;
+  bool const allows_leading_plus = options.grammar == number_grammar::toml || options.grammar == number_grammar::csv;
+
   answer.negative = (*p == UC('-'));
 #ifdef BOOST_CHARCONV_FASTFLOAT_ALLOWS_LEADING_PLUS // disabled by default
   if ((*p == UC('-')) || (*p == UC('+')))
 #else
-  if (*p == UC('-')) // C++17 20.19.3.(7.1) explicitly forbids '+' sign here
+  if ((*p == UC('-')) || (allows_leading_plus && *p == UC('+'))) // C++17 20.19.3.(7.1) forbids '+'; only the toml and csv grammars allow it
 #endif
   {
     ++p;
@@ -171,6 +175,12 @@ parsed_number_string_t<UC> parse_number_string(UC const *p, UC const * pend, par
   UC const * const end_of_integer_part = p;
   int64_t digit_count = int64_t(end_of_integer_part - start_digits);
   answer.integer = span<const UC>(start_digits, size_t(digit_count));
+  if (strict_digits) {
+    // at least one digit in the integer part, without leading zeros
+    if (digit_count == 0 || (start_digits[0] == UC('0') && digit_count > 1)) {
+      return answer;
+    }
+  }
   int64_t exponent = 0;
   if ((p != pend) && (*p == decimal_point)) {
     ++p;
@@ -191,6 +201,10 @@ parsed_number_string_t<UC> parse_number_string(UC const *p, UC const * pend, par
     exponent = before - p;
     answer.fraction = span<const UC>(before, size_t(p - before));
     digit_count -= exponent;
+    if (strict_digits && exponent == 0) {
+      // at least one digit after the decimal point
+      return answer;
+    }
   }
   // we must have encountered at least one integer!
   if (digit_count == 0) {
@@ -26,18 +26,26 @@ namespace boost { namespace charconv { namespace detail { namespace fast_float {
 template <int bit_precision>
 BOOST_FORCEINLINE BOOST_CHARCONV_FASTFLOAT_CONSTEXPR20
 value128 compute_product_approximation(int64_t q, uint64_t w) {
+#ifdef BOOST_CHARCONV_FASTFLOAT_COMPACT_TABLE
+  const value128 power_of_five = compact_powers::get(q);
+  const uint64_t power_of_five_high = power_of_five.high;
+  const uint64_t power_of_five_low = power_of_five.low;
+#else
   const int index = 2 * int(q - powers::smallest_power_of_five);
+  const uint64_t power_of_five_high = powers::power_of_five_128[index];
+  const uint64_t power_of_five_low = powers::power_of_five_128[index + 1];
+#endif
   // For small values of q, e.g., q in [0,27], the answer is always exact because
   // The line value128 firstproduct = full_multiplication(w, power_of_five_128[index]);
   // gives the exact answer.
-  value128 firstproduct = full_multiplication(w, powers::power_of_five_128[index]);
+  value128 firstproduct = full_multiplication(w, power_of_five_high);
   static_assert((bit_precision >= 0) && (bit_precision <= 64), " precision should  be in (0,64]");
   constexpr uint64_t precision_mask = (bit_precision < 64) ?
                (uint64_t(0xFFFFFFFFFFFFFFFF) >> bit_precision)
                : uint64_t(0xFFFFFFFFFFFFFFFF);
   if((firstproduct.high & precision_mask) == precision_mask) { // could further guard with  (lower + w < lower)
     // regarding the second product, we only need secondproduct.high, but our expectation is that the compiler will optimize this extra work away if needed.
-    value128 secondproduct = full_multiplication(w, powers::power_of_five_128[index + 1]);
+    value128 secondproduct = full_multiplication(w, power_of_five_low);
     firstproduct.low += secondproduct.high;
     if(secondproduct.high > firstproduct.low) {
       firstproduct.high++;
@@ -147,9 +155,17 @@ adjusted_mantissa compute_float(int64_t q, uint64_t w)  noexcept  {
       return answer;
     }
     // next line is safe because -answer.power2 + 1 < 64
-    answer.mantissa >>= -answer.power2 + 1;
-    // Thankfully, we can't have both "round-to-even" and subnormals because
-    // "round-to-even" only occurs for powers close to 0.
+    const int subnormal_shift = -answer.power2 + 1;
+    // For float and double we can't have both "round-to-even" and subnormals because
+    // "round-to-even" only occurs for powers close to 0. The subnormals of binary16
+    // are close enough though: a halfway value needs w to be divisible by 5**-q,
+    // which is possible as long as 5**-q fits in 64 bits, i.e. q >= -27.
+    if ((product.low <= 1) && (q >= -27) &&
+        ((answer.mantissa << (upperbit + 64 - binary::mantissa_explicit_bits() - 3)) == product.high) &&
+        ((answer.mantissa & ((uint64_t(1) << subnormal_shift) - 1)) == 0) && (((answer.mantissa >> subnormal_shift) & 3) == 1)) {
+      answer.mantissa &= ~(uint64_t(1) << subnormal_shift); // flip it so that we do not round up
+    }
+    answer.mantissa >>= subnormal_shift;
     answer.mantissa += (answer.mantissa & 1); // round up
     answer.mantissa >>= 1;
     // There is a weird scenario where we don't have a subnormal but just.
@@ -69,12 +69,12 @@ adjusted_mantissa to_extended(T value) noexcept {
   if ((bits & exponent_mask) == 0) {
     // denormal
     am.power2 = 1 - bias;
-    am.mantissa = bits & mantissa_mask;
+    am.mantissa = uint64_t(bits & mantissa_mask);
   } else {
     // normal
     am.power2 = int32_t((bits & exponent_mask) >> binary_format<T>::mantissa_explicit_bits());
     am.power2 -= bias;
-    am.mantissa = (bits & mantissa_mask) | hidden_bit_mask;
+    am.mantissa = uint64_t((bits & mantissa_mask) | hidden_bit_mask);
   }
 
   return am;
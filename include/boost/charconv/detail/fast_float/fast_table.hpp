@@ -703,6 +703,135 @@ constexpr uint64_t powers_template<unused>::power_of_five_128[number_of_entries]
 
 using powers = powers_template<>;
 
+#ifdef BOOST_CHARCONV_FASTFLOAT_COMPACT_TABLE
+
+/**
+ * Compact replacement for power_of_five_128, selected by defining
+ * BOOST_CHARCONV_FASTFLOAT_COMPACT_TABLE, in the same way as the
+ * compressed caches of Dragonbox.
+ * Only every 27th entry is stored. The entries in between are the
+ * leading 128 bits of base * 5^r for r in [0, 27), which are off by at
+ * most a couple of units in the last place from the full table, so a
+ * 2-bit correction per power (stored biased by one) makes the result
+ * identical to power_of_five_128. This is about 800 bytes instead of 10 KB,
+ * at the cost of two extra 64x64 multiplications per conversion.
+ */
+template <class unused = void>
+struct compact_powers_template {
+
+constexpr static int compression_ratio = 27;
+constexpr static int number_of_bases = (powers::largest_power_of_five - powers::smallest_power_of_five + compression_ratio) / compression_ratio;
+constexpr static int number_of_corrections = (powers::largest_power_of_five - powers::smallest_power_of_five + 32) / 32;
+
+// power_of_five_128 for 5^-342, 5^-315, ..., 5^306
+constexpr static uint64_t base_power_of_five_128[2 * number_of_bases] = {
+    0xeef453d6923bd65a,0x113faa2906a13b3f,
+    0xc1069cd4eabe89f8,0x999ec0bb696e840a,
+    0x9becce62836ac577,0x4ee367f9430aec32,
+    0xfbe9141915d7a922,0x4bf1ff9f0062baa8,
+    0xcb7ddcdda26da268,0xa9942f5dcf7dfd09,
+    0xa46116538d0deb78,0x52d9be85f074e608,
+    0x84c8d4dfd2c63f3b,0x29ecd9f40041e073,
+    0xd686619ba27255a2,0xc80a537b0efefebd,
+    0xad4ab7112eb3929d,0x86c16c98d2c953c6,
+    0x8bfbea76c619ef36,0x57eb4edb3c55b65a,
+    0xe2280b6c20dd5232,0x25c6da63c38de1b0,
+    0xb6b00d69bb55c8d1,0x3d607b97c5fd0d22,
+    0x9392ee8e921d5d07,0x3aff322e62439fd0,
+    0xee6b280000000000,0x0000000000000000,
+    0xc097ce7bc90715b3,0x4b9f100000000000,
+    0x9b934c3b330c8577,0x63cc55f49f88eb2f,
+    0xfb5878494ace3a5f,0x04ab48a04065c723,
+    0xcb090c8001ab551c,0x5cadf5bfd3072cc5,
+    0xa402b9c5a8d3a6e7,0x5f16206c9c6209a6,
+    0x847c9b5d7c2e09b7,0x69956135febada11,
+    0xd60b3bd56a5586f1,0x8a71e223d8d3b074,
+    0xace73cbfdc0bfb7b,0x636cc64d1001550b,
+    0x8bab8eefb6409c1a,0x1ad089b6c2f7548e,
+    0xe1a63853bbd26451,0x5e7873f8a0396973,
+    0xb6472e511c81471d,0xe0133fe4adf8e952};
+
+constexpr static uint64_t power_of_five_64[compression_ratio] = {
+    1, 5, 25, 125, 625, 3125, 15625, 78125, 390625,
+    1953125, 9765625, 48828125, 244140625, 1220703125, 6103515625, 30517578125, 152587890625, 762939453125,
+    3814697265625, 19073486328125, 95367431640625, 476837158203125, 2384185791015625, 11920928955078125, 59604644775390625, 298023223876953125, 1490116119384765625};
+
+// 32 corrections per word, 2 bits each, in the order of power_of_five_128
+constexpr static uint64_t corrections[number_of_corrections] = {
+    0x6a5a65656a6aa995, 0xa69a95559a9a5a56, 0x9565555699a9aa9a,
+    0x565aa95a99a59656, 0xaaaaaa6aeba655a5, 0x9569a69a9a6a969a,
+    0x595599a5a56956aa, 0xa595aa5955555555, 0x55555555599aa9aa,
+    0xab96655655555555, 0x44105555555541fa, 0x5555555555555555,
+    0x99aaa55555555555, 0xaaaa69a9a9696656, 0x55556aa5595aaa5a,
+    0x5666655555955955, 0xa96aa96669a69a95, 0x9aaa5a5aaaa9a9aa,
+    0x5565565aa56aaa6a, 0xa969aaaaa5955696, 0x0000000000156aab};
+
+// Returns the same value as power_of_five_128 for 5^q
+BOOST_FORCEINLINE static BOOST_CHARCONV_FASTFLOAT_CONSTEXPR20
+value128 get(int64_t q) noexcept {
+  const int index = int(q - powers::smallest_power_of_five);
+  const int base_index = 2 * (index / compression_ratio);
+  const int offset = index % compression_ratio;
+
+  value128 answer(base_power_of_five_128[base_index + 1], base_power_of_five_128[base_index]);
+  if (offset != 0) {
+    // 192-bit product of the base and 5^offset, whose most significant word is in [2, 2^62)
+    const uint64_t pow5 = power_of_five_64[offset];
+    const value128 upper = full_multiplication(answer.high, pow5);
+    const value128 lower = full_multiplication(answer.low, pow5);
+    uint64_t top = upper.high;
+    const uint64_t middle = upper.low + lower.high;
+    if (middle < upper.low) {
+      top++;
+    }
+
+    // Keep the leading 128 bits
+    const int lz = leading_zeroes(top);
+    answer.high = (top << lz) | (middle >> (64 - lz));
+    answer.low = (middle << lz) | (lower.low >> (64 - lz));
+  }
+
+  const uint64_t correction = (corrections[index / 32] >> (2 * (index % 32))) & 3;
+  if (correction == 0) {
+    if (answer.low == 0) {
+      answer.high--;
+    }
+    answer.low--;
+  } else {
+    const uint64_t low = answer.low + (correction - 1);
+    if (low < answer.low) {
+      answer.high++;
+    }
+    answer.low = low;
+  }
+
+  return answer;
+}
+
+};
+
+template <class unused>
+constexpr int compact_powers_template<unused>::compression_ratio;
+
+template <class unused>
+constexpr int compact_powers_template<unused>::number_of_bases;
+
+template <class unused>
+constexpr int compact_powers_template<unused>::number_of_corrections;
+
+template <class unused>
+constexpr uint64_t compact_powers_template<unused>::base_power_of_five_128[2 * number_of_bases];
+
+template <class unused>
+constexpr uint64_t compact_powers_template<unused>::power_of_five_64[compression_ratio];
+
+template <class unused>
+constexpr uint64_t compact_powers_template<unused>::corrections[number_of_corrections];
+
+using compact_powers = compact_powers_template<>;
+
+#endif // BOOST_CHARCONV_FASTFLOAT_COMPACT_TABLE
+
 }}}} // namespace fast_float
 
 #endif
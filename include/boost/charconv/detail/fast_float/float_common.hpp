@@ -12,6 +12,7 @@
 #include <boost/charconv/detail/from_chars_result.hpp>
 #include <boost/charconv/detail/config.hpp>
 #include <boost/charconv/chars_format.hpp>
+#include <boost/charconv/number_grammar.hpp>
 #include <cfloat>
 #include <cstdint>
 #include <cassert>
@@ -25,13 +26,15 @@ namespace boost { namespace charconv { namespace detail { namespace fast_float {
 template <typename UC>
 struct parse_options_t {
   constexpr explicit parse_options_t(chars_format fmt = chars_format::general,
-    UC dot = UC('.'))
-    : format(fmt), decimal_point(dot) {}
+    UC dot = UC('.'), number_grammar gram = number_grammar::standard)
+    : format(fmt), decimal_point(dot), grammar(gram) {}
 
   /** Which number formats are accepted */
   chars_format format;
   /** The character used as decimal point */
   UC decimal_point;
+  /** Which spellings of a number are accepted within those formats */
+  number_grammar grammar;
 };
 using parse_options = parse_options_t<char>;
 
@@ -282,11 +285,24 @@ constexpr static int32_t invalid_am_bias = -0x8000;
 // used for binary_format_lookup_tables<T>::max_mantissa
 constexpr uint64_t constant_55555 = 5 * 5 * 5 * 5 * 5;
 
+template <typename T>
+constexpr bool is_supported_float_type() {
+  return std::is_same<T, float>::value || std::is_same<T, double>::value
+#ifdef BOOST_CHARCONV_HAS_FLOAT16
+      || std::is_same<T, std::float16_t>::value
+#endif
+#ifdef BOOST_CHARCONV_HAS_BRAINFLOAT16
+      || std::is_same<T, std::bfloat16_t>::value
+#endif
+      ;
+}
+
 template <typename T, typename U = void>
 struct binary_format_lookup_tables;
 
 template <typename T> struct binary_format : binary_format_lookup_tables<T> {
-  using equiv_uint = typename std::conditional<sizeof(T) == 4, uint32_t, uint64_t>::type;
+  using equiv_uint = typename std::conditional<sizeof(T) == 2, uint16_t,
+                     typename std::conditional<sizeof(T) == 4, uint32_t, uint64_t>::type>::type;
 
   static inline constexpr int mantissa_explicit_bits();
   static inline constexpr int minimum_exponent();
@@ -376,6 +392,53 @@ constexpr float binary_format_lookup_tables<float, U>::powers_of_ten[];
 template <typename U>
 constexpr uint64_t binary_format_lookup_tables<float, U>::max_mantissa[];
 
+#ifdef BOOST_CHARCONV_HAS_FLOAT16
+
+template <typename U>
+struct binary_format_lookup_tables<std::float16_t, U> {
+  static constexpr std::float16_t powers_of_ten[] = {1e0F16, 1e1F16, 1e2F16, 1e3F16, 1e4F16};
+
+  // Largest integer value v so that (5**index * v) <= 1<<11.
+  // 0x800 == 1<<11
+  static constexpr uint64_t max_mantissa[] = {
+    UINT64_C(0x800),
+    UINT64_C(0x800) / UINT64_C(5),
+    UINT64_C(0x800) / (UINT64_C(5) * UINT64_C(5)),
+    UINT64_C(0x800) / (UINT64_C(5) * UINT64_C(5) * UINT64_C(5)),
+    UINT64_C(0x800) / (UINT64_C(5) * UINT64_C(5) * UINT64_C(5) * UINT64_C(5))};
+};
+
+template <typename U>
+constexpr std::float16_t binary_format_lookup_tables<std::float16_t, U>::powers_of_ten[];
+
+template <typename U>
+constexpr uint64_t binary_format_lookup_tables<std::float16_t, U>::max_mantissa[];
+
+#endif // BOOST_CHARCONV_HAS_FLOAT16
+
+#ifdef BOOST_CHARCONV_HAS_BRAINFLOAT16
+
+template <typename U>
+struct binary_format_lookup_tables<std::bfloat16_t, U> {
+  static constexpr std::bfloat16_t powers_of_ten[] = {1e0BF16, 1e1BF16, 1e2BF16, 1e3BF16};
+
+  // Largest integer value v so that (5**index * v) <= 1<<8.
+  // 0x100 == 1<<8
+  static constexpr uint64_t max_mantissa[] = {
+    UINT64_C(0x100),
+    UINT64_C(0x100) / UINT64_C(5),
+    UINT64_C(0x100) / (UINT64_C(5) * UINT64_C(5)),
+    UINT64_C(0x100) / (UINT64_C(5) * UINT64_C(5) * UINT64_C(5))};
+};
+
+template <typename U>
+constexpr std::bfloat16_t binary_format_lookup_tables<std::bfloat16_t, U>::powers_of_ten[];
+
+template <typename U>
+constexpr uint64_t binary_format_lookup_tables<std::bfloat16_t, U>::max_mantissa[];
+
+#endif // BOOST_CHARCONV_HAS_BRAINFLOAT16
+
 template <> inline constexpr int binary_format<double>::min_exponent_fast_path() {
 #if (FLT_EVAL_METHOD != 1) && (FLT_EVAL_METHOD != 0)
   return 0;
@@ -524,13 +587,157 @@ template <> inline constexpr binary_format<double>::equiv_uint
   return 0x0010000000000000;
 }
 
+#ifdef BOOST_CHARCONV_HAS_FLOAT16
+
+// The fast path operations may be evaluated in binary32 (e.g. FLT_EVAL_METHOD == 0 promotes _Float16 to float).
+// Since binary32 has more than 2 * 11 + 2 bits of precision the double rounding is innocuous.
+template <> inline constexpr int binary_format<std::float16_t>::min_exponent_fast_path() {
+#if (FLT_EVAL_METHOD != 1) && (FLT_EVAL_METHOD != 0)
+  return 0;
+#else
+  return -4;
+#endif
+}
+template <> inline constexpr int binary_format<std::float16_t>::max_exponent_fast_path() {
+  return 4;
+}
+template <> inline constexpr int binary_format<std::float16_t>::mantissa_explicit_bits() {
+  return 10;
+}
+template <> inline constexpr int binary_format<std::float16_t>::max_exponent_round_to_even() {
+  return 5;
+}
+template <> inline constexpr int binary_format<std::float16_t>::min_exponent_round_to_even() {
+  return -22;
+}
+template <> inline constexpr int binary_format<std::float16_t>::minimum_exponent() {
+  return -15;
+}
+template <> inline constexpr int binary_format<std::float16_t>::infinite_power() {
+  return 0x1F;
+}
+template <> inline constexpr int binary_format<std::float16_t>::sign_index() { return 15; }
+
+template <> inline constexpr uint64_t binary_format<std::float16_t>::max_mantissa_fast_path() {
+  return uint64_t(2) << mantissa_explicit_bits();
+}
+template <> inline constexpr uint64_t binary_format<std::float16_t>::max_mantissa_fast_path(int64_t power) {
+  // caller is responsible to ensure that
+  // power >= 0 && power <= 4
+  //
+  // Work around clang bug https://godbolt.org/z/zedh7rrhc
+  return (void)max_mantissa[0], max_mantissa[power];
+}
+template <>
+inline constexpr std::float16_t binary_format<std::float16_t>::exact_power_of_ten(int64_t power) {
+  // Work around clang bug https://godbolt.org/z/zedh7rrhc
+  return (void)powers_of_ten[0], powers_of_ten[power];
+}
+template <>
+inline constexpr int binary_format<std::float16_t>::largest_power_of_ten() {
+  return 4;
+}
+template <>
+inline constexpr int binary_format<std::float16_t>::smallest_power_of_ten() {
+  return -27;
+}
+template <> inline constexpr size_t binary_format<std::float16_t>::max_digits() {
+  return 22;
+}
+template <> inline constexpr binary_format<std::float16_t>::equiv_uint
+    binary_format<std::float16_t>::exponent_mask() {
+  return 0x7C00;
+}
+template <> inline constexpr binary_format<std::float16_t>::equiv_uint
+    binary_format<std::float16_t>::mantissa_mask() {
+  return 0x03FF;
+}
+template <> inline constexpr binary_format<std::float16_t>::equiv_uint
+    binary_format<std::float16_t>::hidden_bit_mask() {
+  return 0x0400;
+}
+
+#endif // BOOST_CHARCONV_HAS_FLOAT16
+
+#ifdef BOOST_CHARCONV_HAS_BRAINFLOAT16
+
+// As above the fast path operations may be evaluated in binary32 without double rounding errors
+template <> inline constexpr int binary_format<std::bfloat16_t>::min_exponent_fast_path() {
+#if (FLT_EVAL_METHOD != 1) && (FLT_EVAL_METHOD != 0)
+  return 0;
+#else
+  return -3;
+#endif
+}
+template <> inline constexpr int binary_format<std::bfloat16_t>::max_exponent_fast_path() {
+  return 3;
+}
+template <> inline constexpr int binary_format<std::bfloat16_t>::mantissa_explicit_bits() {
+  return 7;
+}
+template <> inline constexpr int binary_format<std::bfloat16_t>::max_exponent_round_to_even() {
+  return 3;
+}
+template <> inline constexpr int binary_format<std::bfloat16_t>::min_exponent_round_to_even() {
+  return -24;
+}
+template <> inline constexpr int binary_format<std::bfloat16_t>::minimum_exponent() {
+  return -127;
+}
+template <> inline constexpr int binary_format<std::bfloat16_t>::infinite_power() {
+  return 0xFF;
+}
+template <> inline constexpr int binary_format<std::bfloat16_t>::sign_index() { return 15; }
+
+template <> inline constexpr uint64_t binary_format<std::bfloat16_t>::max_mantissa_fast_path() {
+  return uint64_t(2) << mantissa_explicit_bits();
+}
+template <> inline constexpr uint64_t binary_format<std::bfloat16_t>::max_mantissa_fast_path(int64_t power) {
+  // caller is responsible to ensure that
+  // power >= 0 && power <= 3
+  //
+  // Work around clang bug https://godbolt.org/z/zedh7rrhc
+  return (void)max_mantissa[0], max_mantissa[power];
+}
+template <>
+inline constexpr std::bfloat16_t binary_format<std::bfloat16_t>::exact_power_of_ten(int64_t power) {
+  // Work around clang bug https://godbolt.org/z/zedh7rrhc
+  return (void)powers_of_ten[0], powers_of_ten[power];
+}
+template <>
+inline constexpr int binary_format<std::bfloat16_t>::largest_power_of_ten() {
+  return 38;
+}
+template <>
+inline constexpr int binary_format<std::bfloat16_t>::smallest_power_of_ten() {
+  return -60;
+}
+template <> inline constexpr size_t binary_format<std::bfloat16_t>::max_digits() {
+  return 98;
+}
+template <> inline constexpr binary_format<std::bfloat16_t>::equiv_uint
+    binary_format<std::bfloat16_t>::exponent_mask() {
+  return 0x7F80;
+}
+template <> inline constexpr binary_format<std::bfloat16_t>::equiv_uint
+    binary_format<std::bfloat16_t>::mantissa_mask() {
+  return 0x007F;
+}
+template <> inline constexpr binary_format<std::bfloat16_t>::equiv_uint
+    binary_format<std::bfloat16_t>::hidden_bit_mask() {
+  return 0x0080;
+}
+
+#endif // BOOST_CHARCONV_HAS_BRAINFLOAT16
+
 template<typename T>
 BOOST_FORCEINLINE BOOST_CHARCONV_FASTFLOAT_CONSTEXPR20
 void to_float(bool negative, adjusted_mantissa am, T &value) {
   using uint = typename binary_format<T>::equiv_uint;
-  uint word = static_cast<uint>(am.mantissa);
-  word |= uint(am.power2) << binary_format<T>::mantissa_explicit_bits();
-  word |= uint(negative) << binary_format<T>::sign_index();
+  uint64_t bits = am.mantissa;
+  bits |= uint64_t(am.power2) << binary_format<T>::mantissa_explicit_bits();
+  bits |= uint64_t(negative) << binary_format<T>::sign_index();
+  const uint word = static_cast<uint>(bits);
 #if BOOST_CHARCONV_FASTFLOAT_HAS_BIT_CAST
   value = std::bit_cast<T>(word);
 #else
@@ -80,6 +80,42 @@ parse_infnan(UC const * first, UC const * last, T &value)  noexcept  {
   return answer;
 }
 
+/**
+ * Special values for the grammar of `options.grammar`.
+ * TOML only spells them as lowercase inf and nan with an optional sign, while JSON and CSV have none.
+ **/
+template <typename T, typename UC>
+from_chars_result_t<UC> BOOST_CHARCONV_FASTFLOAT_CONSTEXPR14
+parse_infnan(UC const * first, UC const * last, T &value, number_grammar grammar)  noexcept  {
+  if (grammar == number_grammar::standard) {
+    return parse_infnan(first, last, value);
+  }
+  from_chars_result_t<UC> answer{};
+  answer.ptr = first;
+  answer.ec = std::errc::invalid_argument;
+  if (grammar != number_grammar::toml) {
+    return answer;
+  }
+  UC const * p = first;
+  bool const minusSign = (*p == UC('-'));
+  if ((*p == UC('-')) || (*p == UC('+'))) {
+    ++p;
+  }
+  if (last - p >= 3) {
+    if (p[0] == UC('n') && p[1] == UC('a') && p[2] == UC('n')) {
+      answer.ptr = p + 3;
+      answer.ec = std::errc();
+      value = minusSign ? -std::numeric_limits<T>::quiet_NaN() : std::numeric_limits<T>::quiet_NaN();
+    }
+    else if (p[0] == UC('i') && p[1] == UC('n') && p[2] == UC('f')) {
+      answer.ptr = p + 3;
+      answer.ec = std::errc();
+      value = minusSign ? -std::numeric_limits<T>::infinity() : std::numeric_limits<T>::infinity();
+    }
+  }
+  return answer;
+}
+
 #if defined(__GNUC__) && __GNUC__ < 5 && !defined(__clang__)
 # pragma GCC diagnostic pop
 #endif
@@ -157,39 +193,20 @@ from_chars_result_t<UC> from_chars(UC const * first, UC const * last,
   return from_chars_advanced(first, last, value, parse_options_t<UC>{fmt});
 }
 
-template<typename T, typename UC>
-BOOST_CHARCONV_FASTFLOAT_CONSTEXPR20
-from_chars_result_t<UC> from_chars_advanced(UC const * first, UC const * last,
-                                      T &value, parse_options_t<UC> options)  noexcept  {
-
-  static_assert (std::is_same<T, double>::value || std::is_same<T, float>::value, "only float and double are supported");
-  static_assert (std::is_same<UC, char>::value ||
-                 std::is_same<UC, wchar_t>::value ||
-                 std::is_same<UC, char16_t>::value ||
-                 std::is_same<UC, char32_t>::value , "only char, wchar_t, char16_t and char32_t are supported");
+namespace detail {
 
-  from_chars_result_t<UC> answer;
-#ifdef BOOST_CHARCONV_FASTFLOAT_SKIP_WHITE_SPACE  // disabled by default
-  while ((first != last) && fast_float::is_space(uint8_t(*first))) {
-    first++;
-  }
-#endif
-  if (first == last) {
-    answer.ec = std::errc::invalid_argument;
-    answer.ptr = first;
-    return answer;
-  }
-  parsed_number_string_t<UC> pns = parse_number_string<UC>(first, last, options);
-  if (!pns.valid) {
-    return detail::parse_infnan(first, last, value);
-  }
-  answer.ec = std::errc(); // be optimistic
-  answer.ptr = pns.lastmatch;
-  // The implementation of the Clinger's fast path is convoluted because
-  // we want round-to-nearest in all cases, irrespective of the rounding mode
-  // selected on the thread.
-  // We proceed optimistically, assuming that detail::rounds_to_nearest() returns
-  // true.
+/**
+ * Clinger's fast path. Returns true if the value could be computed exactly with a
+ * single floating-point multiplication or division.
+ *
+ * The implementation is convoluted because we want round-to-nearest in all cases,
+ * irrespective of the rounding mode selected on the thread. `rounds_nearest` is only
+ * invoked once the exponent and digit count are known to be in range, so single
+ * conversions do not pay for the rounding mode probe unless they can use it.
+ */
+template <typename T, typename UC, typename RoundingProbe>
+BOOST_FORCEINLINE BOOST_CHARCONV_FASTFLOAT_CONSTEXPR20
+bool clinger_fast_path(parsed_number_string_t<UC> const& pns, RoundingProbe rounds_nearest, T &value) noexcept {
   if (binary_format<T>::min_exponent_fast_path() <= pns.exponent && pns.exponent <= binary_format<T>::max_exponent_fast_path() && !pns.too_many_digits) {
     // Unfortunately, the conventional Clinger's fast path is only possible
     // when the system rounds to the nearest float.
@@ -198,15 +215,23 @@ from_chars_result_t<UC> from_chars_advanced(UC const * first, UC const * last,
     // We could check it first (before the previous branch), but
     // there might be performance advantages at having the check
     // be last.
-    if(!cpp20_and_in_constexpr() && detail::rounds_to_nearest())  {
+    if(rounds_nearest())  {
       // We have that fegetround() == FE_TONEAREST.
       // Next is Clinger's fast path.
       if (pns.mantissa <=binary_format<T>::max_mantissa_fast_path()) {
         value = T(pns.mantissa);
         if (pns.exponent < 0) { value = value / binary_format<T>::exact_power_of_ten(-pns.exponent); }
-        else { value = value * binary_format<T>::exact_power_of_ten(pns.exponent); }
+        else {
+          value = value * binary_format<T>::exact_power_of_ten(pns.exponent);
+          // binary16 has fewer decimal digits of range than the fast path admits,
+          // so leave the overflowing values to the slow path which reports them.
+          if (binary_format<T>::largest_power_of_ten() < binary_format<T>::max_exponent_fast_path() + 19 &&
+              value > (std::numeric_limits<T>::max)()) {
+            return false;
+          }
+        }
         if (pns.negative) { value = -value; }
-        return answer;
+        return true;
       }
     } else {
       // We do not have that fegetround() == FE_TONEAREST.
@@ -215,17 +240,26 @@ from_chars_result_t<UC> from_chars_advanced(UC const * first, UC const * last,
 #if defined(__clang__)
         // Clang may map 0 to -0.0 when fegetround() == FE_DOWNWARD
         if(pns.mantissa == 0) {
-          value = pns.negative ? -0. : 0.;
-          return answer;
+          value = pns.negative ? T(-0.) : T(0.);
+          return true;
         }
 #endif
         value = T(pns.mantissa) * binary_format<T>::exact_power_of_ten(pns.exponent);
         if (pns.negative) { value = -value; }
-        return answer;
+        return true;
       }
     }
   }
-  adjusted_mantissa am = compute_float<binary_format<T>>(pns.exponent, pns.mantissa);
+  return false;
+}
+
+/**
+ * Completes a conversion once the Eisel-Lemire product `am` of the parsed number is known:
+ * resolves the rare ambiguous cases, packs the result into `value` and reports over/underflow.
+ */
+template <typename T, typename UC>
+BOOST_FORCEINLINE BOOST_CHARCONV_FASTFLOAT_CONSTEXPR20
+std::errc finish_compute_float(parsed_number_string_t<UC>& pns, adjusted_mantissa am, T &value) noexcept {
   if(pns.too_many_digits && am.power2 >= 0) {
     if(am != compute_float<binary_format<T>>(pns.exponent, pns.mantissa + 1)) {
       am = compute_error<binary_format<T>>(pns.exponent, pns.mantissa);
@@ -237,11 +271,158 @@ from_chars_result_t<UC> from_chars_advanced(UC const * first, UC const * last,
   to_float(pns.negative, am, value);
   // Test for over/underflow.
   if ((pns.mantissa != 0 && am.mantissa == 0 && am.power2 == 0) || am.power2 == binary_format<T>::infinite_power()) {
-    answer.ec = std::errc::result_out_of_range;
+    return std::errc::result_out_of_range;
+  }
+  return std::errc();
+}
+
+/**
+ * Like `finish_compute_float`, but never falls back to big integer arithmetic.
+ * compute_float rounds every 64-bit mantissa correctly, so inputs of up to 19 significant digits are exact.
+ * Longer inputs are rounded from their truncated mantissa without the compute_error/digit_comp correction,
+ * so the result is the correctly rounded value or one of its neighbours.
+ */
+template <typename T, typename UC>
+BOOST_FORCEINLINE BOOST_CHARCONV_FASTFLOAT_CONSTEXPR20
+std::errc finish_compute_float_approximate(parsed_number_string_t<UC> const& pns, adjusted_mantissa am, T &value) noexcept {
+  to_float(pns.negative, am, value);
+  // Test for over/underflow.
+  if ((pns.mantissa != 0 && am.mantissa == 0 && am.power2 == 0) || am.power2 == binary_format<T>::infinite_power()) {
+    return std::errc::result_out_of_range;
+  }
+  return std::errc();
+}
+
+} // namespace detail
+
+template<typename T, typename UC>
+BOOST_CHARCONV_FASTFLOAT_CONSTEXPR20
+from_chars_result_t<UC> from_chars_advanced(UC const * first, UC const * last,
+                                      T &value, parse_options_t<UC> options)  noexcept  {
+
+  static_assert (is_supported_float_type<T>(), "only float, double, std::float16_t and std::bfloat16_t are supported");
+  static_assert (std::is_same<UC, char>::value ||
+                 std::is_same<UC, wchar_t>::value ||
+                 std::is_same<UC, char16_t>::value ||
+                 std::is_same<UC, char32_t>::value , "only char, wchar_t, char16_t and char32_t are supported");
+
+  from_chars_result_t<UC> answer;
+#ifdef BOOST_CHARCONV_FASTFLOAT_SKIP_WHITE_SPACE  // disabled by default
+  while ((first != last) && fast_float::is_space(uint8_t(*first))) {
+    first++;
   }
+#endif
+  if (first == last) {
+    answer.ec = std::errc::invalid_argument;
+    answer.ptr = first;
+    return answer;
+  }
+  parsed_number_string_t<UC> pns = parse_number_string<UC>(first, last, options);
+  if (!pns.valid) {
+    return detail::parse_infnan(first, last, value, options.grammar);
+  }
+  answer.ec = std::errc(); // be optimistic
+  answer.ptr = pns.lastmatch;
+  // We proceed optimistically, assuming that detail::rounds_to_nearest() returns true.
+  if (detail::clinger_fast_path(pns, []() { return !cpp20_and_in_constexpr() && detail::rounds_to_nearest(); }, value)) {
+    return answer;
+  }
+  adjusted_mantissa am = compute_float<binary_format<T>>(pns.exponent, pns.mantissa);
+  answer.ec = detail::finish_compute_float(pns, am, value);
   return answer;
 }
 
+/**
+ * Same as `from_chars_advanced`, except that the result may be off by one ULP for the rare inputs
+ * that would otherwise need big integer arithmetic to be rounded correctly. The cost of a conversion
+ * is therefore bounded by the number of characters, which removes the latency spikes of those inputs.
+ */
+template<typename T, typename UC>
+BOOST_CHARCONV_FASTFLOAT_CONSTEXPR20
+from_chars_result_t<UC> from_chars_approximate(UC const * first, UC const * last,
+                                         T &value, parse_options_t<UC> options)  noexcept  {
+
+  static_assert (is_supported_float_type<T>(), "only float, double, std::float16_t and std::bfloat16_t are supported");
+
+  from_chars_result_t<UC> answer;
+  if (first == last) {
+    answer.ec = std::errc::invalid_argument;
+    answer.ptr = first;
+    return answer;
+  }
+  parsed_number_string_t<UC> pns = parse_number_string<UC>(first, last, options);
+  if (!pns.valid) {
+    return detail::parse_infnan(first, last, value, options.grammar);
+  }
+  answer.ptr = pns.lastmatch;
+  if (detail::clinger_fast_path(pns, []() { return !cpp20_and_in_constexpr() && detail::rounds_to_nearest(); }, value)) {
+    answer.ec = std::errc();
+    return answer;
+  }
+  answer.ec = detail::finish_compute_float_approximate(pns, compute_float<binary_format<T>>(pns.exponent, pns.mantissa), value);
+  return answer;
+}
+
+/**
+ * Parses `count` strings into `values`, storing the outcome of each conversion in `errors`.
+ *
+ * Each string must be consumed in its entirety, otherwise its error is `std::errc::invalid_argument`.
+ * Like the strict `from_chars` overloads, `values[i]` is only written when `errors[i] == std::errc()`.
+ * Returns the number of successful conversions.
+ *
+ * The rounding mode is probed once for the whole batch rather than once per element.
+ */
+template <typename T, typename StringView>
+BOOST_CHARCONV_FASTFLOAT_CONSTEXPR20
+std::size_t from_chars_batch(StringView const * strings, std::size_t count, T * values, std::errc * errors,
+                             chars_format fmt = chars_format::general) noexcept {
+
+  static_assert (is_supported_float_type<T>(), "only float, double, std::float16_t and std::bfloat16_t are supported");
+
+  const parse_options_t<char> options {fmt};
+  const bool nearest = !cpp20_and_in_constexpr() && detail::rounds_to_nearest();
+  const auto rounding_probe = [nearest]() { return nearest; };
+
+  // The elements are independent of each other, so the loop is written without any carried state
+  // other than the success count. This lets the 64x64->128 bit multiplications of the Eisel-Lemire
+  // path of neighbouring elements overlap in the pipeline.
+  std::size_t successes = 0;
+  for (std::size_t i = 0; i < count; ++i) {
+    char const * first = strings[i].data();
+    char const * last = first + strings[i].size();
+    T value {};
+    std::errc ec;
+
+    if (first == last) {
+      errors[i] = std::errc::invalid_argument;
+      continue;
+    }
+
+    parsed_number_string_t<char> pns = parse_number_string<char>(first, last, options);
+    if (!pns.valid) {
+      const auto r = detail::parse_infnan(first, last, value);
+      ec = (r.ec == std::errc() && r.ptr != last) ? std::errc::invalid_argument : r.ec;
+    }
+    else if (pns.lastmatch != last) {
+      ec = std::errc::invalid_argument;
+    }
+    else if (detail::clinger_fast_path(pns, rounding_probe, value)) {
+      ec = std::errc();
+    }
+    else {
+      ec = detail::finish_compute_float(pns, compute_float<binary_format<T>>(pns.exponent, pns.mantissa), value);
+    }
+
+    errors[i] = ec;
+    if (ec == std::errc()) {
+      values[i] = value;
+      ++successes;
+    }
+  }
+
+  return successes;
+}
+
 }}}} // namespace fast_float
 
 #endif
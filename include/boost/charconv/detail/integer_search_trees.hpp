@@ -190,7 +190,6 @@ BOOST_CHARCONV_CXX14_CONSTEXPR int num_digits(uint128 x) noexcept
 # pragma warning(pop)
 #endif
 
-#ifdef BOOST_CHARCONV_HAS_INT128
 static constexpr std::array<std::uint64_t, 20> powers_of_10 =
 {{
     UINT64_C(1), UINT64_C(10), UINT64_C(100), UINT64_C(1000), UINT64_C(10000), UINT64_C(100000), UINT64_C(1000000), 
@@ -199,6 +198,7 @@ static constexpr std::array<std::uint64_t, 20> powers_of_10 =
     UINT64_C(10000000000000000), UINT64_C(100000000000000000), UINT64_C(1000000000000000000), UINT64_C(10000000000000000000)
 }};
 
+#ifdef BOOST_CHARCONV_HAS_INT128
 // Assume that if someone is using 128 bit ints they are favoring the top end of the range
 // Max value is 340,282,366,920,938,463,463,374,607,431,768,211,455 (39 digits)
 BOOST_CHARCONV_CXX14_CONSTEXPR int num_digits(boost::uint128_type x) noexcept
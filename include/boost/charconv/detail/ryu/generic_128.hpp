@@ -389,14 +389,10 @@ static BOOST_CHARCONV_CXX14_CONSTEXPR uint32_t pow5bits(const uint32_t e) noexce
     return static_cast<uint32_t>(((e * UINT64_C(163391164108059)) >> 46) + 1);
 }
 
+// Computes the 384-bit product of a and b, and stores it as three 128-bit words starting with the least significant one.
 static BOOST_CHARCONV_CXX14_CONSTEXPR
-void mul_128_256_shift(
-        const uint64_t* const a, const uint64_t* const b,
-        const uint32_t shift, const uint32_t corr,
-        uint64_t* const result) noexcept
+void mul_128_256(const uint64_t* const a, const uint64_t* const b, unsigned_128_type* const result) noexcept
 {
-    BOOST_CHARCONV_ASSERT(shift > 0);
-    BOOST_CHARCONV_ASSERT(shift < 256);
     const unsigned_128_type b00 = static_cast<unsigned_128_type>(a[0]) * b[0]; // 0
     const unsigned_128_type b01 = static_cast<unsigned_128_type>(a[0]) * b[1]; // 64
     const unsigned_128_type b02 = static_cast<unsigned_128_type>(a[0]) * b[2]; // 128
@@ -422,6 +418,26 @@ void mul_128_256_shift(
     const unsigned_128_type d2 = p1 < q1;                                        // 256
     const unsigned_128_type p2 = b13 + (s3 >> 64) + c2 + (c3 << 64) + d1 + d2;   // 256
 
+    result[0] = p0;
+    result[1] = p1;
+    result[2] = p2;
+}
+
+static BOOST_CHARCONV_CXX14_CONSTEXPR
+void mul_128_256_shift(
+        const uint64_t* const a, const uint64_t* const b,
+        const uint32_t shift, const uint32_t corr,
+        uint64_t* const result) noexcept
+{
+    BOOST_CHARCONV_ASSERT(shift > 0);
+    BOOST_CHARCONV_ASSERT(shift < 256);
+
+    unsigned_128_type product[3] {};
+    mul_128_256(a, b, product);
+    const unsigned_128_type p0 = product[0];
+    const unsigned_128_type p1 = product[1];
+    const unsigned_128_type p2 = product[2];
+
     if (shift < 128)
     {
         const unsigned_128_type r0 = corr + ((p0 >> shift) | (p1 << (128 - shift)));
@@ -523,16 +539,98 @@ static BOOST_CHARCONV_CXX14_CONSTEXPR bool multipleOfPowerOf2(const unsigned_128
     return (value & ((static_cast<unsigned_128_type>(1) << p) - 1)) == 0;
 }
 
+// Returns the low 128 bits of (m * mul) >> j, and stores those of ((m + 2) * mul) >> j and ((m - 1 - mmShift) * mul) >> j
+// in vp and vm. This takes a single multiplication, since the products for the bounds differ from m * mul by mul or 2 * mul.
 static BOOST_CHARCONV_CXX14_CONSTEXPR
-unsigned_128_type mulShift(const unsigned_128_type m, const uint64_t* const mul, const int32_t j) noexcept
+unsigned_128_type mulShiftAll(const unsigned_128_type m, const uint64_t* const mul, const int32_t j,
+                              unsigned_128_type* const vp, unsigned_128_type* const vm, const uint32_t mmShift) noexcept
 {
     BOOST_CHARCONV_ASSERT(j > 128);
+    BOOST_CHARCONV_ASSERT(j < 256);
     uint64_t a[2] {};
     a[0] = static_cast<uint64_t>(m);
     a[1] = static_cast<uint64_t>(m >> 64);
-    uint64_t result[4] {};
-    mul_128_256_shift(a, mul, static_cast<uint32_t>(j), 0, result);
-    return (static_cast<unsigned_128_type>(result[1]) << 64) | result[0];
+    unsigned_128_type product[3] {};
+    mul_128_256(a, mul, product);
+
+    const unsigned_128_type mul_low = (static_cast<unsigned_128_type>(mul[1]) << 64) | mul[0];
+    const unsigned_128_type mul_high = (static_cast<unsigned_128_type>(mul[3]) << 64) | mul[2];
+    const auto shift = static_cast<uint32_t>(j - 128);
+
+    // The multipliers have fewer than 255 bits, so 2 * mul fits in the two low words
+    BOOST_CHARCONV_ASSERT((mul[3] >> 62) == 0);
+    const unsigned_128_type twice_mul_low = mul_low << 1;
+    const unsigned_128_type twice_mul_high = (mul_high << 1) | (mul_low >> 127);
+
+    // m * mul + 2 * mul
+    {
+        const unsigned_128_type r0 = product[0] + twice_mul_low;
+        const unsigned_128_type c0 = r0 < twice_mul_low;
+        const unsigned_128_type s1 = product[1] + twice_mul_high;
+        const unsigned_128_type c1 = s1 < twice_mul_high;
+        const unsigned_128_type r1 = s1 + c0;
+        const unsigned_128_type r2 = product[2] + c1 + (r1 < s1);
+        *vp = (r1 >> shift) | (r2 << (128 - shift));
+    }
+
+    // m * mul - (1 + mmShift) * mul
+    {
+        const unsigned_128_type sub0 = mmShift != 0 ? twice_mul_low : mul_low;
+        const unsigned_128_type sub1 = mmShift != 0 ? twice_mul_high : mul_high;
+
+        const unsigned_128_type b0 = product[0] < sub0;
+        const unsigned_128_type s1 = product[1] - sub1;
+        const unsigned_128_type b1 = product[1] < sub1;
+        const unsigned_128_type r1 = s1 - b0;
+        const unsigned_128_type r2 = product[2] - b1 - (s1 < b0);
+        *vm = (r1 >> shift) | (r2 << (128 - shift));
+    }
+
+    return (product[1] >> shift) | (product[2] << (128 - shift));
+}
+
+// Returns floor(x / 10) for any 128-bit x. Dividing 128-bit integers is a library call, so this multiplies by
+// ceil(2^130 / 5) instead, which is exact for x / 2 < 2^127 (Granlund and Montgomery).
+static BOOST_CHARCONV_CXX14_CONSTEXPR unsigned_128_type div10(const unsigned_128_type x) noexcept
+{
+    if (static_cast<uint64_t>(x >> 64) == 0)
+    {
+        return static_cast<uint64_t>(x) / 10U;
+    }
+
+    const uint64_t a0 = static_cast<uint64_t>(x >> 1);
+    const uint64_t a1 = static_cast<uint64_t>(x >> 65);
+    constexpr uint64_t m = UINT64_C(0xCCCCCCCCCCCCCCCC);
+
+    const unsigned_128_type p00 = static_cast<unsigned_128_type>(a0) * (m + 1U);
+    const unsigned_128_type p01 = static_cast<unsigned_128_type>(a0) * m;
+    const unsigned_128_type p10 = static_cast<unsigned_128_type>(a1) * (m + 1U);
+    const unsigned_128_type p11 = static_cast<unsigned_128_type>(a1) * m;
+
+    const unsigned_128_type middle = (p00 >> 64) + static_cast<uint64_t>(p01) + static_cast<uint64_t>(p10);
+    return (p11 + (p01 >> 64) + (p10 >> 64) + (middle >> 64)) >> 2;
+}
+
+// Returns floor(x / 100) for any 128-bit x, multiplying x / 4 < 2^126 by ceil(2^131 / 25) as in div10.
+static BOOST_CHARCONV_CXX14_CONSTEXPR unsigned_128_type div100(const unsigned_128_type x) noexcept
+{
+    if (static_cast<uint64_t>(x >> 64) == 0)
+    {
+        return static_cast<uint64_t>(x) / 100U;
+    }
+
+    const uint64_t a0 = static_cast<uint64_t>(x >> 2);
+    const uint64_t a1 = static_cast<uint64_t>(x >> 66);
+    constexpr uint64_t m0 = UINT64_C(0x1EB851EB851EB852);
+    constexpr uint64_t m1 = UINT64_C(0x51EB851EB851EB85);
+
+    const unsigned_128_type p00 = static_cast<unsigned_128_type>(a0) * m0;
+    const unsigned_128_type p01 = static_cast<unsigned_128_type>(a0) * m1;
+    const unsigned_128_type p10 = static_cast<unsigned_128_type>(a1) * m0;
+    const unsigned_128_type p11 = static_cast<unsigned_128_type>(a1) * m1;
+
+    const unsigned_128_type middle = (p00 >> 64) + static_cast<uint64_t>(p01) + static_cast<uint64_t>(p10);
+    return (p11 + (p01 >> 64) + (p10 >> 64) + (middle >> 64)) >> 3;
 }
 
 // Returns floor(log_10(2^e)).
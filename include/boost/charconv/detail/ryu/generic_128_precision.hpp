@@ -0,0 +1,782 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+//
+// Formatting of binary80 and binary128 values with a given precision, i.e. the equivalent of
+// printf's %.*Le, %.*Lf and %.*Lg. Ryu only produces the shortest representation, and rounding that
+// to a precision is not correct, so the exact decimal expansion of the binary value is generated
+// instead, nine digits (one segment) at a time:
+//
+//  - The integer part is converted to base 10^9 segments up front with a multiword division.
+//  - The fractional part is kept as a multiword fraction with a power of two denominator, and every
+//    multiplication by 10^9 moves the next segment out of it.
+//
+// Only the words that are not zero yet take part in a multiplication, and only as many segments as
+// the precision asks for are generated, so the usual cases work on two or three words.
+
+#ifndef BOOST_CHARCONV_DETAIL_RYU_GENERIC_128_PRECISION_HPP
+#define BOOST_CHARCONV_DETAIL_RYU_GENERIC_128_PRECISION_HPP
+
+#include <boost/charconv/detail/ryu/ryu_generic_128.hpp>
+#include <boost/charconv/detail/bit_layouts.hpp>
+#include <boost/charconv/detail/to_chars_integer_impl.hpp>
+#include <boost/charconv/detail/integer_search_trees.hpp>
+#include <boost/charconv/detail/config.hpp>
+#include <boost/charconv/chars_format.hpp>
+#include <system_error>
+#include <cstring>
+#include <cstdint>
+#include <cstddef>
+
+namespace boost { namespace charconv { namespace detail { namespace ryu {
+
+// value = (-1)^sign * mantissa * 2^exponent
+struct floating_binary_128
+{
+    unsigned_128_type mantissa;
+    int32_t exponent;
+    bool sign;
+};
+
+// Same parameters as generic_binary_to_decimal, for finite values
+static inline struct floating_binary_128 generic_binary_to_fb128(
+        const unsigned_128_type bits,
+        const uint32_t mantissaBits, const uint32_t exponentBits, const bool explicitLeadingBit) noexcept
+{
+    const int32_t bias = static_cast<int32_t>((1u << (exponentBits - 1)) - 1);
+    const bool ieeeSign = ((bits >> (mantissaBits + exponentBits)) & 1) != 0;
+    const unsigned_128_type ieeeMantissa = bits & ((one << mantissaBits) - 1);
+    const int32_t ieeeExponent = static_cast<int32_t>(static_cast<uint32_t>((bits >> mantissaBits) & ((one << exponentBits) - 1u)));
+
+    struct floating_binary_128 fb;
+    fb.sign = ieeeSign;
+
+    if (explicitLeadingBit)
+    {
+        // mantissaBits includes the explicit leading bit
+        fb.mantissa = ieeeMantissa;
+        fb.exponent = (ieeeExponent == 0 ? 1 : ieeeExponent) - bias - static_cast<int32_t>(mantissaBits) + 1;
+    }
+    else
+    {
+        fb.mantissa = ieeeExponent == 0 ? ieeeMantissa : (one << mantissaBits) | ieeeMantissa;
+        fb.exponent = (ieeeExponent == 0 ? 1 : ieeeExponent) - bias - static_cast<int32_t>(mantissaBits);
+    }
+
+    return fb;
+}
+
+// No binary80 or binary128 value has more significant decimal digits than this, which is the
+// length of (2^112 - 1) * 2^-16494, so any larger precision gives the same %g output
+static constexpr int generic_max_significant_digits = 11563;
+
+// Produces the decimal digits of a non-zero mantissa * 2^exponent from the first significant one on,
+// followed by as many zeros as are asked for
+class generic_digit_generator
+{
+    static constexpr uint32_t ten_9 = UINT32_C(1000000000);
+
+    // 2^16384 needs 512 words after a shift by up to 31 bits, and 2^-16494 needs 516
+    static constexpr int max_words = 520;
+
+    // 2^16384 has 4933 decimal digits
+    static constexpr int max_segments = 549;
+
+    uint32_t words_[max_words];
+    uint32_t segments_[max_segments];
+
+    // Integer part, least significant segment first. next_segment_ is the next one to print.
+    int next_segment_ {-1};
+
+    // Fractional part is words_ / 2^(32 * word_count_), and only [low_word_, high_word_] are non-zero
+    int word_count_ {};
+    int low_word_ {};
+    int high_word_ {-1};
+
+    // Current segment, printed to digits_[1..9]
+    char digits_[10] {};
+    int next_digit_ {10};
+
+    int exponent_ {};
+
+    // Divides words[0..top] by 10^9 until nothing is left, storing the remainders as segments
+    int to_segments(uint32_t* words, int top) noexcept
+    {
+        int count = 0;
+        while (top >= 0)
+        {
+            uint64_t remainder = 0;
+            for (int i = top; i >= 0; --i)
+            {
+                const uint64_t current = (remainder << 32) | words[i];
+                words[i] = static_cast<uint32_t>(current / ten_9);
+                remainder = current % ten_9;
+            }
+
+            segments_[count++] = static_cast<uint32_t>(remainder);
+
+            while (top >= 0 && words[top] == 0)
+            {
+                --top;
+            }
+        }
+
+        return count;
+    }
+
+    // Multiplies the fractional part by 10^9 and returns the integer part of the product
+    uint32_t next_fraction_segment() noexcept
+    {
+        uint64_t carry = 0;
+        for (int i = low_word_; i <= high_word_; ++i)
+        {
+            const uint64_t product = static_cast<uint64_t>(words_[i]) * ten_9 + carry;
+            words_[i] = static_cast<uint32_t>(product);
+            carry = product >> 32;
+        }
+
+        if (high_word_ + 1 < word_count_)
+        {
+            if (carry != 0)
+            {
+                words_[++high_word_] = static_cast<uint32_t>(carry);
+            }
+            carry = 0;
+        }
+
+        while (low_word_ <= high_word_ && words_[low_word_] == 0)
+        {
+            ++low_word_;
+        }
+
+        return static_cast<uint32_t>(carry);
+    }
+
+    void load_segment(uint32_t segment) noexcept
+    {
+        decompose32(segment, digits_);
+        next_digit_ = 1;
+    }
+
+    void refill() noexcept
+    {
+        if (next_segment_ >= 0)
+        {
+            load_segment(segments_[next_segment_--]);
+        }
+        else if (low_word_ <= high_word_)
+        {
+            load_segment(next_fraction_segment());
+        }
+        else
+        {
+            std::memset(digits_ + 1, '0', 9);
+            next_digit_ = 1;
+        }
+    }
+
+public:
+    generic_digit_generator(unsigned_128_type mantissa, int32_t exponent) noexcept
+    {
+        BOOST_CHARCONV_ASSERT(mantissa != 0);
+
+        int segment_count = 0;
+
+        if (exponent >= 0)
+        {
+            // Everything is in the integer part
+            const int shift_words = exponent / 32;
+            const int shift_bits = exponent % 32;
+
+            std::memset(words_, 0, static_cast<std::size_t>(shift_words) * sizeof(uint32_t));
+            for (int i = 0; i < 4; ++i)
+            {
+                words_[shift_words + i] = static_cast<uint32_t>(mantissa >> (32 * i));
+            }
+            words_[shift_words + 4] = 0;
+
+            if (shift_bits != 0)
+            {
+                for (int i = shift_words + 4; i > shift_words; --i)
+                {
+                    words_[i] = (words_[i] << shift_bits) | (words_[i - 1] >> (32 - shift_bits));
+                }
+                words_[shift_words] <<= shift_bits;
+            }
+
+            int top = shift_words + 4;
+            while (words_[top] == 0)
+            {
+                --top;
+            }
+
+            segment_count = to_segments(words_, top);
+        }
+        else
+        {
+            const int fraction_bits = -exponent;
+
+            if (fraction_bits < 128)
+            {
+                const unsigned_128_type integer_part = mantissa >> fraction_bits;
+                if (integer_part != 0)
+                {
+                    uint32_t integer_words[4];
+                    int top = -1;
+                    for (int i = 0; i < 4; ++i)
+                    {
+                        integer_words[i] = static_cast<uint32_t>(integer_part >> (32 * i));
+                        if (integer_words[i] != 0)
+                        {
+                            top = i;
+                        }
+                    }
+
+                    segment_count = to_segments(integer_words, top);
+                }
+
+                mantissa &= (one << fraction_bits) - 1;
+            }
+
+            // Align the fraction to a whole number of words
+            word_count_ = (fraction_bits + 31) / 32;
+            const int shift_bits = 32 * word_count_ - fraction_bits;
+            const int words_used = word_count_ < 5 ? word_count_ : 5;
+
+            uint32_t fraction_words[5] {};
+            for (int i = 0; i < 4; ++i)
+            {
+                fraction_words[i] = static_cast<uint32_t>(mantissa >> (32 * i));
+            }
+            if (shift_bits != 0)
+            {
+                for (int i = 4; i > 0; --i)
+                {
+                    fraction_words[i] = (fraction_words[i] << shift_bits) | (fraction_words[i - 1] >> (32 - shift_bits));
+                }
+                fraction_words[0] <<= shift_bits;
+            }
+
+            for (int i = 0; i < words_used; ++i)
+            {
+                words_[i] = fraction_words[i];
+                if (fraction_words[i] != 0)
+                {
+                    high_word_ = i;
+                }
+            }
+
+            while (low_word_ <= high_word_ && words_[low_word_] == 0)
+            {
+                ++low_word_;
+            }
+        }
+
+        if (segment_count > 0)
+        {
+            const uint32_t first_segment = segments_[segment_count - 1];
+            const int first_digits = num_digits(first_segment);
+
+            exponent_ = 9 * (segment_count - 1) + first_digits - 1;
+            next_segment_ = segment_count - 2;
+            load_segment(first_segment);
+            next_digit_ = 10 - first_digits;
+        }
+        else
+        {
+            // Skip the leading zeros of a value below 1
+            int leading_zeros = 0;
+            uint32_t first_segment = next_fraction_segment();
+            while (first_segment == 0)
+            {
+                leading_zeros += 9;
+                first_segment = next_fraction_segment();
+            }
+
+            const int first_digits = num_digits(first_segment);
+
+            exponent_ = -(leading_zeros + 9 - first_digits) - 1;
+            load_segment(first_segment);
+            next_digit_ = 10 - first_digits;
+        }
+    }
+
+    // Decimal exponent of the first significant digit
+    int exponent() const noexcept
+    {
+        return exponent_;
+    }
+
+    void write(char* result, std::size_t count) noexcept
+    {
+        while (count != 0)
+        {
+            if (next_digit_ == 10)
+            {
+                refill();
+            }
+
+            std::size_t available = static_cast<std::size_t>(10 - next_digit_);
+            if (available > count)
+            {
+                available = count;
+            }
+
+            std::memcpy(result, digits_ + next_digit_, available);
+            next_digit_ += static_cast<int>(available);
+            result += available;
+            count -= available;
+        }
+    }
+
+    char next() noexcept
+    {
+        if (next_digit_ == 10)
+        {
+            refill();
+        }
+
+        return digits_[next_digit_++];
+    }
+
+    // True if every digit that has not been produced yet is zero
+    bool exhausted() const noexcept
+    {
+        for (int i = next_digit_; i < 10; ++i)
+        {
+            if (digits_[i] != '0')
+            {
+                return false;
+            }
+        }
+
+        for (int i = next_segment_; i >= 0; --i)
+        {
+            if (segments_[i] != 0)
+            {
+                return false;
+            }
+        }
+
+        return low_word_ > high_word_;
+    }
+
+    // Consumes the digit after the last one produced and decides whether they round up, with ties to even
+    bool round_up(char last_digit) noexcept
+    {
+        const char round_digit = next();
+        if (round_digit != '5')
+        {
+            return round_digit > '5';
+        }
+
+        return !exhausted() || (last_digit - '0') % 2 == 1;
+    }
+};
+
+// Adds one to the last digit of [first, last), skipping a decimal point.
+// Returns true if the carry runs out of the first digit, which leaves only zeros behind.
+inline bool generic_increment_digits(char* first, char* last) noexcept
+{
+    while (last != first)
+    {
+        --last;
+        if (*last == '.')
+        {
+            continue;
+        }
+        if (*last != '9')
+        {
+            ++*last;
+            return false;
+        }
+        *last = '0';
+    }
+
+    return true;
+}
+
+// Writes e+XX with at least two exponent digits
+inline char* generic_print_exponent(char* result, int exponent) noexcept
+{
+    *result++ = 'e';
+    if (exponent < 0)
+    {
+        *result++ = '-';
+        exponent = -exponent;
+    }
+    else
+    {
+        *result++ = '+';
+    }
+
+    const auto exponent_digits = static_cast<std::size_t>(exponent < 10 ? 2 : num_digits(static_cast<uint32_t>(exponent)));
+    char buffer[10];
+    decompose32(static_cast<uint32_t>(exponent), buffer);
+    std::memcpy(result, buffer + 10 - exponent_digits, exponent_digits);
+
+    return result + exponent_digits;
+}
+
+inline std::ptrdiff_t generic_exponent_length(int exponent) noexcept
+{
+    if (exponent < 0)
+    {
+        exponent = -exponent;
+    }
+
+    return 2 + (exponent < 100 ? 2 : num_digits(static_cast<uint32_t>(exponent)));
+}
+
+// 0.000e+00, 0.000 or 0
+inline int generic_zero_to_chars(char* result, const std::ptrdiff_t result_size, chars_format fmt, int precision, bool sign) noexcept
+{
+    if (fmt == chars_format::general)
+    {
+        precision = 0;
+    }
+
+    const std::ptrdiff_t length = static_cast<std::ptrdiff_t>(sign) + 1 + (precision > 0 ? static_cast<std::ptrdiff_t>(precision) + 1 : 0)
+                                  + (fmt == chars_format::scientific ? 4 : 0);
+    if (length > result_size)
+    {
+        return -static_cast<int>(std::errc::value_too_large);
+    }
+
+    char* current = result;
+    if (sign)
+    {
+        *current++ = '-';
+    }
+
+    *current++ = '0';
+    if (precision > 0)
+    {
+        *current++ = '.';
+        std::memset(current, '0', static_cast<std::size_t>(precision));
+        current += precision;
+    }
+
+    if (fmt == chars_format::scientific)
+    {
+        std::memcpy(current, "e+00", 4);
+        current += 4;
+    }
+
+    return static_cast<int>(current - result);
+}
+
+// d.ddde+XX with precision digits after the decimal point
+inline int generic_to_chars_scientific_precision(generic_digit_generator& digits, char* result,
+                                                 const std::ptrdiff_t result_size, int precision) noexcept
+{
+    const std::ptrdiff_t significand_length = 1 + (precision > 0 ? static_cast<std::ptrdiff_t>(precision) + 1 : 0);
+    if (significand_length > result_size)
+    {
+        return -static_cast<int>(std::errc::value_too_large);
+    }
+
+    int exponent = digits.exponent();
+
+    // Leave room for the decimal point after the first digit
+    char* const first_digit = precision > 0 ? result + 1 : result;
+    char* const last_digit = first_digit + precision + 1;
+    digits.write(first_digit, static_cast<std::size_t>(precision) + 1);
+
+    if (digits.round_up(last_digit[-1]) && generic_increment_digits(first_digit, last_digit))
+    {
+        *first_digit = '1';
+        ++exponent;
+    }
+
+    if (precision > 0)
+    {
+        result[0] = result[1];
+        result[1] = '.';
+    }
+
+    if (significand_length + generic_exponent_length(exponent) > result_size)
+    {
+        return -static_cast<int>(std::errc::value_too_large);
+    }
+
+    return static_cast<int>(generic_print_exponent(result + significand_length, exponent) - result);
+}
+
+// ddd.ddd with precision digits after the decimal point
+inline int generic_to_chars_fixed_precision(generic_digit_generator& digits, char* result,
+                                            const std::ptrdiff_t result_size, int precision) noexcept
+{
+    const int exponent = digits.exponent();
+    const std::ptrdiff_t fraction_length = precision > 0 ? static_cast<std::ptrdiff_t>(precision) + 1 : 0;
+
+    if (exponent >= 0)
+    {
+        const std::ptrdiff_t integer_digits = static_cast<std::ptrdiff_t>(exponent) + 1;
+        if (integer_digits + fraction_length > result_size)
+        {
+            return -static_cast<int>(std::errc::value_too_large);
+        }
+
+        digits.write(result, static_cast<std::size_t>(integer_digits));
+        char* last = result + integer_digits;
+        if (precision > 0)
+        {
+            *last++ = '.';
+            digits.write(last, static_cast<std::size_t>(precision));
+            last += precision;
+        }
+
+        if (digits.round_up(last[-1]) && generic_increment_digits(result, last))
+        {
+            // 99.9 became 00.0, and is now 100.0
+            if (integer_digits + fraction_length + 1 > result_size)
+            {
+                return -static_cast<int>(std::errc::value_too_large);
+            }
+
+            result[0] = '1';
+            result[integer_digits] = '0';
+            if (precision > 0)
+            {
+                result[integer_digits + 1] = '.';
+                *last++ = '0';
+            }
+            else
+            {
+                ++last;
+            }
+        }
+
+        return static_cast<int>(last - result);
+    }
+
+    if (1 + fraction_length > result_size)
+    {
+        return -static_cast<int>(std::errc::value_too_large);
+    }
+
+    // 0.000ddd, where the first significant digit is -exponent places after the decimal point
+    const std::ptrdiff_t leading_zeros = static_cast<std::ptrdiff_t>(-exponent) - 1;
+    char* last = result;
+    *last++ = '0';
+    if (precision > 0)
+    {
+        *last++ = '.';
+    }
+
+    bool round_up = false;
+    if (leading_zeros >= precision)
+    {
+        std::memset(last, '0', static_cast<std::size_t>(precision));
+        last += precision;
+
+        // The first significant digit decides, unless it is even further away
+        if (leading_zeros == precision)
+        {
+            round_up = digits.round_up('0');
+        }
+    }
+    else
+    {
+        std::memset(last, '0', static_cast<std::size_t>(leading_zeros));
+        last += leading_zeros;
+        digits.write(last, static_cast<std::size_t>(precision - leading_zeros));
+        last += precision - leading_zeros;
+        round_up = digits.round_up(last[-1]);
+    }
+
+    if (round_up)
+    {
+        generic_increment_digits(result, last);
+    }
+
+    return static_cast<int>(last - result);
+}
+
+// %g: precision significant digits, in fixed notation if the exponent is in [-4, precision),
+// without trailing zeros. The output is usually much shorter than the precision, so only as many
+// digits as the buffer can hold are kept, and the rest only need to round away.
+inline int generic_to_chars_general_precision(generic_digit_generator& digits, char* result,
+                                              const std::ptrdiff_t result_size, int precision) noexcept
+{
+    if (precision == 0)
+    {
+        precision = 1;
+    }
+    else if (precision > generic_max_significant_digits)
+    {
+        precision = generic_max_significant_digits;
+    }
+
+    if (result_size < 1)
+    {
+        return -static_cast<int>(std::errc::value_too_large);
+    }
+
+    const std::ptrdiff_t kept = precision < result_size ? precision : result_size;
+    digits.write(result, static_cast<std::size_t>(kept));
+
+    // Digits beyond the buffer have to be all zeros, or all nines that carry into it
+    bool all_zeros = true;
+    bool all_nines = true;
+    char last_digit = result[kept - 1];
+    for (std::ptrdiff_t i = kept; i < precision; ++i)
+    {
+        last_digit = digits.next();
+        all_zeros = all_zeros && last_digit == '0';
+        all_nines = all_nines && last_digit == '9';
+    }
+
+    int exponent = digits.exponent();
+    if (digits.round_up(last_digit))
+    {
+        if (!all_nines)
+        {
+            return -static_cast<int>(std::errc::value_too_large);
+        }
+        if (generic_increment_digits(result, result + kept))
+        {
+            result[0] = '1';
+            ++exponent;
+        }
+    }
+    else if (!all_zeros)
+    {
+        return -static_cast<int>(std::errc::value_too_large);
+    }
+
+    std::ptrdiff_t significant_digits = kept;
+    while (significant_digits > 1 && result[significant_digits - 1] == '0')
+    {
+        --significant_digits;
+    }
+
+    if (exponent >= precision || exponent < -4)
+    {
+        // d.ddde+XX
+        const std::ptrdiff_t significand_length = significant_digits > 1 ? significant_digits + 1 : 1;
+        if (significand_length + generic_exponent_length(exponent) > result_size)
+        {
+            return -static_cast<int>(std::errc::value_too_large);
+        }
+
+        if (significant_digits > 1)
+        {
+            std::memmove(result + 2, result + 1, static_cast<std::size_t>(significant_digits - 1));
+            result[1] = '.';
+        }
+
+        return static_cast<int>(generic_print_exponent(result + significand_length, exponent) - result);
+    }
+
+    if (exponent >= 0)
+    {
+        // ddd.ddd
+        const std::ptrdiff_t integer_digits = static_cast<std::ptrdiff_t>(exponent) + 1;
+        if (integer_digits > kept)
+        {
+            return -static_cast<int>(std::errc::value_too_large);
+        }
+        if (significant_digits <= integer_digits)
+        {
+            return static_cast<int>(integer_digits);
+        }
+
+        if (significant_digits + 1 > result_size)
+        {
+            return -static_cast<int>(std::errc::value_too_large);
+        }
+
+        std::memmove(result + integer_digits + 1, result + integer_digits, static_cast<std::size_t>(significant_digits - integer_digits));
+        result[integer_digits] = '.';
+        return static_cast<int>(significant_digits + 1);
+    }
+
+    // 0.000ddd
+    const std::ptrdiff_t leading_zeros = static_cast<std::ptrdiff_t>(-exponent) - 1;
+    const std::ptrdiff_t length = 2 + leading_zeros + significant_digits;
+    if (length > result_size)
+    {
+        return -static_cast<int>(std::errc::value_too_large);
+    }
+
+    std::memmove(result + 2 + leading_zeros, result, static_cast<std::size_t>(significant_digits));
+    std::memcpy(result, "0.", 2U);
+    std::memset(result + 2, '0', static_cast<std::size_t>(leading_zeros));
+    return static_cast<int>(length);
+}
+
+// Converts v to chars with the given non-negative precision, with the same output as printf's
+// %.*Le, %.*Lf and %.*Lg. Returns the number of characters written, or -std::errc::value_too_large.
+static inline int generic_to_chars_precision(const struct floating_binary_128 v, char* result, const std::ptrdiff_t result_size,
+                                             chars_format fmt, int precision) noexcept
+{
+    BOOST_CHARCONV_ASSERT(precision >= 0);
+
+    if (v.mantissa == 0)
+    {
+        return generic_zero_to_chars(result, result_size, fmt, precision, v.sign);
+    }
+
+    const auto sign = static_cast<std::ptrdiff_t>(v.sign);
+    if (sign >= result_size)
+    {
+        return -static_cast<int>(std::errc::value_too_large);
+    }
+
+    if (v.sign)
+    {
+        *result++ = '-';
+    }
+
+    generic_digit_generator digits(v.mantissa, v.exponent);
+
+    int num_chars;
+    switch (fmt)
+    {
+        case chars_format::scientific:
+            num_chars = generic_to_chars_scientific_precision(digits, result, result_size - sign, precision);
+            break;
+        case chars_format::fixed:
+            num_chars = generic_to_chars_fixed_precision(digits, result, result_size - sign, precision);
+            break;
+        default:
+            num_chars = generic_to_chars_general_precision(digits, result, result_size - sign, precision);
+            break;
+    }
+
+    return num_chars < 0 ? num_chars : num_chars + static_cast<int>(sign);
+}
+
+#if BOOST_CHARCONV_LDBL_BITS == 80
+
+static inline struct floating_binary_128 long_double_to_fb128(long double d) noexcept
+{
+    #ifdef BOOST_CHARCONV_HAS_INT128
+    unsigned_128_type bits = 0;
+    std::memcpy(&bits, &d, sizeof(long double));
+    #else
+    trivial_uint128 trivial_bits;
+    std::memcpy(&trivial_bits, &d, sizeof(long double));
+    unsigned_128_type bits {trivial_bits};
+    #endif
+
+    return generic_binary_to_fb128(bits, 64, 15, true);
+}
+
+#elif BOOST_CHARCONV_LDBL_BITS == 128
+
+static inline struct floating_binary_128 long_double_to_fb128(long double d) noexcept
+{
+    unsigned_128_type bits = 0;
+    std::memcpy(&bits, &d, sizeof(long double));
+
+    return generic_binary_to_fb128(bits, 112, 15, false);
+}
+
+#endif
+
+}}}} // Namespaces
+
+#endif // BOOST_CHARCONV_DETAIL_RYU_GENERIC_128_PRECISION_HPP
@@ -136,9 +136,7 @@ static inline struct floating_decimal_128 generic_binary_to_decimal(
         const int32_t i = -e2 + static_cast<int32_t>(q) + k;
         uint64_t pow5[4];
         generic_computeInvPow5(q, pow5);
-        vr = mulShift(4 * m2, pow5, i);
-        vp = mulShift(4 * m2 + 2, pow5, i);
-        vm = mulShift(4 * m2 - 1 - mmShift, pow5, i);
+        vr = mulShiftAll(4 * m2, pow5, i, &vp, &vm, mmShift);
 
         #ifdef BOOST_CHARCONV_DEBUG
         printf("%s * 2^%d / 10^%d\n", s(mv), e2, q);
@@ -177,9 +175,7 @@ static inline struct floating_decimal_128 generic_binary_to_decimal(
         const int32_t j = static_cast<int32_t>(q) - k;
         uint64_t pow5[4];
         generic_computePow5(static_cast<uint32_t>(i), pow5);
-        vr = mulShift(4 * m2, pow5, j);
-        vp = mulShift(4 * m2 + 2, pow5, j);
-        vm = mulShift(4 * m2 - 1 - mmShift, pow5, j);
+        vr = mulShiftAll(4 * m2, pow5, j, &vp, &vm, mmShift);
 
         #ifdef BOOST_CHARCONV_DEBUG
         printf("%s * 5^%d / 10^%d\n", s(mv), -e2, q);
@@ -230,47 +226,107 @@ static inline struct floating_decimal_128 generic_binary_to_decimal(
     uint8_t lastRemovedDigit = 0;
     unsigned_128_type output;
 
-    while (vp / 10 > vm / 10)
+    if (vmIsTrailingZeros || vrIsTrailingZeros)
     {
-        vmIsTrailingZeros &= vm % 10 == 0;
-        vrIsTrailingZeros &= lastRemovedDigit == 0;
-        lastRemovedDigit = static_cast<uint8_t>(vr % 10);
-        vr /= 10;
-        vp /= 10;
-        vm /= 10;
-        ++removed;
-    }
+        // General case, which happens rarely.
+        for (;;)
+        {
+            const unsigned_128_type vpDiv10 = div10(vp);
+            const unsigned_128_type vmDiv10 = div10(vm);
+            if (vpDiv10 <= vmDiv10)
+            {
+                break;
+            }
+            const unsigned_128_type vrDiv10 = div10(vr);
+            vmIsTrailingZeros &= static_cast<uint64_t>(vm) - 10 * static_cast<uint64_t>(vmDiv10) == 0;
+            vrIsTrailingZeros &= lastRemovedDigit == 0;
+            lastRemovedDigit = static_cast<uint8_t>(static_cast<uint64_t>(vr) - 10 * static_cast<uint64_t>(vrDiv10));
+            vr = vrDiv10;
+            vp = vpDiv10;
+            vm = vmDiv10;
+            ++removed;
+        }
 
-    #ifdef BOOST_CHARCONV_DEBUG
-    printf("V+=%s\nV =%s\nV-=%s\n", s(vp), s(vr), s(vm));
-    printf("d-10=%s\n", vmIsTrailingZeros ? "true" : "false");
-    #endif
+        #ifdef BOOST_CHARCONV_DEBUG
+        printf("V+=%s\nV =%s\nV-=%s\n", s(vp), s(vr), s(vm));
+        printf("d-10=%s\n", vmIsTrailingZeros ? "true" : "false");
+        #endif
+
+        if (vmIsTrailingZeros)
+        {
+            for (;;)
+            {
+                const unsigned_128_type vmDiv10 = div10(vm);
+                if (static_cast<uint64_t>(vm) - 10 * static_cast<uint64_t>(vmDiv10) != 0)
+                {
+                    break;
+                }
+                const unsigned_128_type vrDiv10 = div10(vr);
+                vrIsTrailingZeros &= lastRemovedDigit == 0;
+                lastRemovedDigit = static_cast<uint8_t>(static_cast<uint64_t>(vr) - 10 * static_cast<uint64_t>(vrDiv10));
+                vr = vrDiv10;
+                vp = div10(vp);
+                vm = vmDiv10;
+                ++removed;
+            }
+        }
+
+        #ifdef BOOST_CHARCONV_DEBUG
+        printf("%s %d\n", s(vr), lastRemovedDigit);
+        printf("vr is trailing zeros=%s\n", vrIsTrailingZeros ? "true" : "false");
+        #endif
 
-    if (vmIsTrailingZeros)
+        if (vrIsTrailingZeros && (lastRemovedDigit == 5) && (vr % 2 == 0))
+        {
+            // Round even if the exact numbers is .....50..0.
+            lastRemovedDigit = 4;
+        }
+        // We need to take vr+1 if vr is outside bounds, or we need to round up.
+        output = vr + static_cast<unsigned_128_type>((vr == vm && (!acceptBounds || !vmIsTrailingZeros)) || (lastRemovedDigit >= 5));
+    }
+    else
     {
-        while (vm % 10 == 0)
+        // Specialized for the common case, where nothing has to be known about the removed digits
+        // except whether the last one rounds up.
+        bool roundUp = false;
+        const unsigned_128_type vpDiv100 = div100(vp);
+        const unsigned_128_type vmDiv100 = div100(vm);
+        if (vpDiv100 > vmDiv100)
         {
-            vrIsTrailingZeros &= lastRemovedDigit == 0;
-            lastRemovedDigit = static_cast<uint8_t>(vr % 10);
-            vr /= 10;
-            vp /= 10;
-            vm /= 10;
+            // Remove two digits at a time.
+            const unsigned_128_type vrDiv100 = div100(vr);
+            const auto vrMod100 = static_cast<uint32_t>(static_cast<uint64_t>(vr) - 100 * static_cast<uint64_t>(vrDiv100));
+            roundUp = vrMod100 >= 50;
+            vr = vrDiv100;
+            vp = vpDiv100;
+            vm = vmDiv100;
+            removed += 2;
+        }
+        for (;;)
+        {
+            const unsigned_128_type vpDiv10 = div10(vp);
+            const unsigned_128_type vmDiv10 = div10(vm);
+            if (vpDiv10 <= vmDiv10)
+            {
+                break;
+            }
+            const unsigned_128_type vrDiv10 = div10(vr);
+            const auto vrMod10 = static_cast<uint32_t>(static_cast<uint64_t>(vr) - 10 * static_cast<uint64_t>(vrDiv10));
+            roundUp = vrMod10 >= 5;
+            vr = vrDiv10;
+            vp = vpDiv10;
+            vm = vmDiv10;
             ++removed;
         }
-    }
 
-    #ifdef BOOST_CHARCONV_DEBUG
-    printf("%s %d\n", s(vr), lastRemovedDigit);
-    printf("vr is trailing zeros=%s\n", vrIsTrailingZeros ? "true" : "false");
-    #endif
+        #ifdef BOOST_CHARCONV_DEBUG
+        printf("V+=%s\nV =%s\nV-=%s\n", s(vp), s(vr), s(vm));
+        #endif
 
-    if (vrIsTrailingZeros && (lastRemovedDigit == 5) && (vr % 2 == 0))
-    {
-        // Round even if the exact numbers is .....50..0.
-        lastRemovedDigit = 4;
+        // We need to take vr+1 if vr is outside bounds, or we need to round up.
+        output = vr + static_cast<unsigned_128_type>(vr == vm || roundUp);
     }
-    // We need to take vr+1 if vr is outside bounds, or we need to round up.
-    output = vr + static_cast<unsigned_128_type>((vr == vm && (!acceptBounds || !vmIsTrailingZeros)) || (lastRemovedDigit >= 5));
+
     const int32_t exp = e10 + static_cast<int32_t>(removed);
 
     #ifdef BOOST_CHARCONV_DEBUG
@@ -361,6 +417,43 @@ static inline int copy_special_str(char* result, const std::ptrdiff_t result_siz
     return -1;
 }
 
+// Writes the olength decimal digits of value to result, nine at a time. Only the parts of value above 2^64
+// need a 128-bit division, which is a library call, and there is at most one of those for 39 digits.
+static inline void generic_print_digits(unsigned_128_type value, char* result, int olength) noexcept
+{
+    constexpr uint64_t ten_9 = UINT64_C(1000000000);
+    constexpr uint64_t ten_18 = ten_9 * ten_9;
+
+    char buffer[10] {};
+    char* end = result + olength;
+
+    while (static_cast<uint64_t>(value >> 64) != 0)
+    {
+        const unsigned_128_type high = value / ten_18;
+        const uint64_t low = static_cast<uint64_t>(value) - static_cast<uint64_t>(high) * ten_18;
+
+        decompose32(static_cast<uint32_t>(low % ten_9), buffer);
+        std::memcpy(end - 9, buffer + 1, 9);
+        decompose32(static_cast<uint32_t>(low / ten_9), buffer);
+        std::memcpy(end - 18, buffer + 1, 9);
+        end -= 18;
+        value = high;
+    }
+
+    auto remaining = static_cast<uint64_t>(value);
+    while (end - result > 9)
+    {
+        decompose32(static_cast<uint32_t>(remaining % ten_9), buffer);
+        std::memcpy(end - 9, buffer + 1, 9);
+        end -= 9;
+        remaining /= ten_9;
+    }
+
+    const auto length = static_cast<std::size_t>(end - result);
+    decompose32(static_cast<uint32_t>(remaining), buffer);
+    std::memcpy(result, buffer + 10 - length, length);
+}
+
 static inline int generic_to_chars_fixed(const struct floating_decimal_128 v, char* result, const ptrdiff_t result_size, int precision) noexcept
 {
     if (v.exponent == fd128_exceptional_exponent)
@@ -374,14 +467,15 @@ static inline int generic_to_chars_fixed(const struct floating_decimal_128 v, ch
         *result++ = '-';
     }
 
-    unsigned_128_type output = v.mantissa;
-    const auto r = to_chars_128integer_impl(result, result + result_size, output);
-    if (r.ec != std::errc())
+    // Zero has no digits according to num_digits but is printed as one
+    const unsigned_128_type output = v.mantissa;
+    auto current_len = output == 0 ? 1 : num_digits(output);
+    if (current_len > result_size)
     {
-        return -static_cast<int>(r.ec);
+        return -static_cast<int>(std::errc::value_too_large);
     }
 
-    auto current_len = static_cast<int>(r.ptr - result);
+    generic_print_digits(output, result, current_len);
 
     #ifdef BOOST_CHARCONV_DEBUG
     char* man_print = s(v.mantissa);
@@ -411,7 +505,7 @@ static inline int generic_to_chars_fixed(const struct floating_decimal_128 v, ch
             return -static_cast<int>(std::errc::value_too_large);
         }
 
-        result = r.ptr;
+        result += current_len;
         memset(result, '0', static_cast<std::size_t>(v.exponent));
         result += static_cast<std::size_t>(v.exponent);
         *result++ = '.';
@@ -430,7 +524,7 @@ static inline int generic_to_chars_fixed(const struct floating_decimal_128 v, ch
         const auto shift_width = (shift - result) + 1;
         memcpy(shift, ".", 1U);
         ++current_len;
-        if (current_len - shift_width > precision)
+        if (precision >= 0 && current_len - shift_width > precision)
         {
             if (precision > 0)
             {
@@ -517,8 +611,8 @@ static inline int generic_to_chars(const struct floating_decimal_128 v, char* re
         return copy_special_str(result, result_size, v);
     }
 
-    unsigned_128_type output = v.mantissa;
-    const uint32_t olength = static_cast<uint32_t>(num_digits(output));
+    const unsigned_128_type output = v.mantissa;
+    const uint32_t olength = output == 0 ? 1U : static_cast<uint32_t>(num_digits(output));
 
     #ifdef BOOST_CHARCONV_DEBUG
     printf("DIGITS=%s\n", s(v.mantissa));
@@ -536,7 +630,7 @@ static inline int generic_to_chars(const struct floating_decimal_128 v, char* re
             if (ptr >= 1 && result[ptr - 1] == '0')
             {
                 --ptr;
-                while (ptr > 0 && result[ptr] == '0')
+                while (ptr > static_cast<int>(v.sign) && result[ptr] == '0')
                 {
                     --ptr;
                 }
@@ -562,14 +656,16 @@ static inline int generic_to_chars(const struct floating_decimal_128 v, char* re
         return -2; // Something has gone horribly wrong
     }
 
-    for (uint32_t i = 0; i < olength - 1; ++i)
+    // Print the digits one place to the right, and then move the first one in front of the decimal point.
+    if (olength > 1)
+    {
+        generic_print_digits(output, result + index + 1, static_cast<int>(olength));
+        result[index] = result[index + 1];
+    }
+    else
     {
-        const auto c = static_cast<uint32_t>(output % 10);
-        output /= 10;
-        result[index + olength - i] = static_cast<char>('0' + c);
+        result[index] = static_cast<char>('0' + static_cast<uint32_t>(output));
     }
-    BOOST_CHARCONV_ASSERT(output < 10);
-    result[index] = static_cast<char>('0' + static_cast<uint32_t>(output % 10)); // output should be < 10 by now.
 
     // Print decimal point if needed.
     if (olength > 1)
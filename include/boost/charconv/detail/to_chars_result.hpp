@@ -6,6 +6,7 @@
 #define BOOST_CHARCONV_DETAIL_TO_CHARS_RESULT_HPP
 
 #include <system_error>
+#include <cstddef>
 
 // 22.13.2, Primitive numerical output conversion
 
@@ -29,6 +30,26 @@ struct to_chars_result
     constexpr explicit operator bool() const noexcept { return ec == std::errc{}; }
 };
 
+// Result of to_chars_batch, where count is the number of values written
+struct to_chars_batch_result
+{
+    char *ptr;
+    std::errc ec;
+    std::size_t count;
+
+    constexpr friend bool operator==(const to_chars_batch_result &lhs, const to_chars_batch_result &rhs) noexcept
+    {
+        return lhs.ptr == rhs.ptr && lhs.ec == rhs.ec && lhs.count == rhs.count;
+    }
+
+    constexpr friend bool operator!=(const to_chars_batch_result &lhs, const to_chars_batch_result &rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+
+    constexpr explicit operator bool() const noexcept { return ec == std::errc{}; }
+};
+
 }} // Namespaces
 
 #endif //BOOST_CHARCONV_DETAIL_TO_CHARS_RESULT_HPP
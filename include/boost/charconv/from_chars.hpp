@@ -12,8 +12,14 @@
 #include <boost/charconv/detail/bit_layouts.hpp>
 #include <boost/charconv/config.hpp>
 #include <boost/charconv/chars_format.hpp>
+#include <boost/charconv/decimal_fp.hpp>
+#include <boost/charconv/decimal_rounding.hpp>
+#include <boost/charconv/json_number.hpp>
+#include <boost/charconv/number_grammar.hpp>
 #include <boost/core/detail/string_view.hpp>
 #include <system_error>
+#include <cstddef>
+#include <cstdint>
 
 namespace boost { namespace charconv {
 
@@ -249,6 +255,81 @@ BOOST_CHARCONV_DECL from_chars_result from_chars(boost::core::string_view sv, st
 BOOST_CHARCONV_DECL from_chars_result from_chars(boost::core::string_view sv, std::bfloat16_t& value, chars_format fmt = chars_format::general) noexcept;
 #endif
 
+// Only accepts numbers spelled as allowed by grammar, e.g. number_grammar::json rejects "01", ".5" and "inf"
+BOOST_CHARCONV_DECL from_chars_result from_chars(const char* first, const char* last, float& value, number_grammar grammar) noexcept;
+BOOST_CHARCONV_DECL from_chars_result from_chars(const char* first, const char* last, double& value, number_grammar grammar) noexcept;
+BOOST_CHARCONV_DECL from_chars_result from_chars(boost::core::string_view sv, float& value, number_grammar grammar) noexcept;
+BOOST_CHARCONV_DECL from_chars_result from_chars(boost::core::string_view sv, double& value, number_grammar grammar) noexcept;
+
+// Never takes the big integer slow path, so the result is within 1 ULP of the correctly rounded value
+BOOST_CHARCONV_DECL from_chars_result from_chars_approximate(const char* first, const char* last, float& value, chars_format fmt = chars_format::general) noexcept;
+BOOST_CHARCONV_DECL from_chars_result from_chars_approximate(const char* first, const char* last, double& value, chars_format fmt = chars_format::general) noexcept;
+BOOST_CHARCONV_DECL from_chars_result from_chars_approximate(boost::core::string_view sv, float& value, chars_format fmt = chars_format::general) noexcept;
+BOOST_CHARCONV_DECL from_chars_result from_chars_approximate(boost::core::string_view sv, double& value, chars_format fmt = chars_format::general) noexcept;
+
+// Fails with std::errc::value_too_large instead of reading more than max_digits digits of the significand or the exponent,
+// which bounds the time and memory spent on a single call. Numbers within the limit are parsed exactly as by from_chars.
+BOOST_CHARCONV_DECL from_chars_result from_chars_bounded(const char* first, const char* last, float& value, std::size_t max_digits, chars_format fmt = chars_format::general) noexcept;
+BOOST_CHARCONV_DECL from_chars_result from_chars_bounded(const char* first, const char* last, double& value, std::size_t max_digits, chars_format fmt = chars_format::general) noexcept;
+
+#ifndef BOOST_CHARCONV_UNSUPPORTED_LONG_DOUBLE
+BOOST_CHARCONV_DECL from_chars_result from_chars_bounded(const char* first, const char* last, long double& value, std::size_t max_digits, chars_format fmt = chars_format::general) noexcept;
+#endif
+
+#ifdef BOOST_CHARCONV_HAS_QUADMATH
+BOOST_CHARCONV_DECL from_chars_result from_chars_bounded(const char* first, const char* last, __float128& value, std::size_t max_digits, chars_format fmt = chars_format::general) noexcept;
+#endif
+
+BOOST_CHARCONV_DECL from_chars_result from_chars_bounded(boost::core::string_view sv, float& value, std::size_t max_digits, chars_format fmt = chars_format::general) noexcept;
+BOOST_CHARCONV_DECL from_chars_result from_chars_bounded(boost::core::string_view sv, double& value, std::size_t max_digits, chars_format fmt = chars_format::general) noexcept;
+
+#ifndef BOOST_CHARCONV_UNSUPPORTED_LONG_DOUBLE
+BOOST_CHARCONV_DECL from_chars_result from_chars_bounded(boost::core::string_view sv, long double& value, std::size_t max_digits, chars_format fmt = chars_format::general) noexcept;
+#endif
+
+#ifdef BOOST_CHARCONV_HAS_QUADMATH
+BOOST_CHARCONV_DECL from_chars_result from_chars_bounded(boost::core::string_view sv, __float128& value, std::size_t max_digits, chars_format fmt = chars_format::general) noexcept;
+#endif
+
+// The correctly rounded value of (is_negative ? -1 : 1) * significand * 10^exponent, computed without going through text.
+// Returns std::errc::result_out_of_range on overflow or underflow, in which case value is left unmodified.
+BOOST_CHARCONV_DECL std::errc from_decimal(std::uint64_t significand, int exponent, bool is_negative, float& value) noexcept;
+BOOST_CHARCONV_DECL std::errc from_decimal(std::uint64_t significand, int exponent, bool is_negative, double& value) noexcept;
+
+// Inverse of to_decimal
+template <typename Unsigned_Integer, typename Real>
+inline std::errc from_decimal(const decimal_fp<Unsigned_Integer>& decimal, Real& value) noexcept
+{
+    return from_decimal(static_cast<std::uint64_t>(decimal.significand), decimal.exponent, decimal.is_negative, value);
+}
+
+// from_decimal of each of the count decimals. On success values[i] is written and errors[i] is std::errc();
+// otherwise values[i] is left unmodified. Returns the number of successful conversions.
+BOOST_CHARCONV_DECL std::size_t from_decimal_batch(const decimal_fp<std::uint32_t>* decimals, std::size_t count, float* values, std::errc* errors) noexcept;
+BOOST_CHARCONV_DECL std::size_t from_decimal_batch(const decimal_fp<std::uint64_t>* decimals, std::size_t count, float* values, std::errc* errors) noexcept;
+BOOST_CHARCONV_DECL std::size_t from_decimal_batch(const decimal_fp<std::uint64_t>* decimals, std::size_t count, double* values, std::errc* errors) noexcept;
+
+// Converts each element of strings, which must be consumed in its entirety.
+// On success values[i] is written and errors[i] is std::errc(); otherwise values[i] is left unmodified.
+// Returns the number of successful conversions.
+BOOST_CHARCONV_DECL std::size_t from_chars_batch(const boost::core::string_view* strings, std::size_t count, float* values, std::errc* errors, chars_format fmt = chars_format::general) noexcept;
+BOOST_CHARCONV_DECL std::size_t from_chars_batch(const boost::core::string_view* strings, std::size_t count, double* values, std::errc* errors, chars_format fmt = chars_format::general) noexcept;
+
+// Parses a decimal number as an integer count of units of 10^-scale, e.g. "1234.56" with scale 4 gives 12345600.
+// Digits below the scale are handled according to round.
+BOOST_CHARCONV_DECL from_chars_result from_chars_decimal(const char* first, const char* last, std::int64_t& scaled, int scale, decimal_rounding round = decimal_rounding::nearest_even) noexcept;
+BOOST_CHARCONV_DECL from_chars_result from_chars_decimal(boost::core::string_view sv, std::int64_t& scaled, int scale, decimal_rounding round = decimal_rounding::nearest_even) noexcept;
+
+#ifdef BOOST_CHARCONV_HAS_INT128
+BOOST_CHARCONV_DECL from_chars_result from_chars_decimal(const char* first, const char* last, boost::int128_type& scaled, int scale, decimal_rounding round = decimal_rounding::nearest_even) noexcept;
+BOOST_CHARCONV_DECL from_chars_result from_chars_decimal(boost::core::string_view sv, boost::int128_type& scaled, int scale, decimal_rounding round = decimal_rounding::nearest_even) noexcept;
+#endif
+
+// Parses one number with the JSON grammar of RFC 8259 and classifies it in the same pass.
+// Integers are stored as int64 or uint64 when they fit, and everything else as double.
+BOOST_CHARCONV_DECL from_chars_result from_chars_json(const char* first, const char* last, json_number& value) noexcept;
+BOOST_CHARCONV_DECL from_chars_result from_chars_json(boost::core::string_view sv, json_number& value) noexcept;
+
 } // namespace charconv
 } // namespace boost
 
@@ -0,0 +1,35 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_CHARCONV_JSON_NUMBER_HPP
+#define BOOST_CHARCONV_JSON_NUMBER_HPP
+
+#include <cstdint>
+
+namespace boost { namespace charconv {
+
+// Which member of json_number holds the value
+enum class json_number_kind : unsigned
+{
+    int64,      // An integer that fits in std::int64_t
+    uint64,     // A positive integer that only fits in std::uint64_t
+    double_     // A number with a fraction or exponent, or an integer too large for either
+};
+
+// The result of from_chars_json
+struct json_number
+{
+    json_number_kind kind;
+
+    union
+    {
+        std::int64_t int64_value;
+        std::uint64_t uint64_value;
+        double double_value;
+    };
+};
+
+}} // Namespaces
+
+#endif // BOOST_CHARCONV_JSON_NUMBER_HPP
@@ -0,0 +1,21 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_CHARCONV_NUMBER_GRAMMAR_HPP
+#define BOOST_CHARCONV_NUMBER_GRAMMAR_HPP
+
+namespace boost { namespace charconv {
+
+// Which spellings of a floating point number from_chars accepts
+enum class number_grammar : unsigned
+{
+    standard,   // Same as std::from_chars with chars_format::general
+    json,       // RFC 8259
+    toml,       // TOML v1.0.0 floats without digit separators
+    csv         // Plain decimal numbers with an optional sign, and no inf or nan
+};
+
+}} // Namespaces
+
+#endif // BOOST_CHARCONV_NUMBER_GRAMMAR_HPP
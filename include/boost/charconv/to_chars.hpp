@@ -11,6 +11,10 @@
 #include <boost/charconv/detail/to_chars_result.hpp>
 #include <boost/charconv/config.hpp>
 #include <boost/charconv/chars_format.hpp>
+#include <boost/charconv/decimal_fp.hpp>
+#include <type_traits>
+#include <cstddef>
+#include <cstdint>
 
 namespace boost {
 namespace charconv {
@@ -73,6 +77,35 @@ BOOST_CHARCONV_CONSTEXPR to_chars_result to_chars(char* first, char* last, boost
 }
 #endif
 
+//----------------------------------------------------------------------------------------------------------------------
+// Fixed-point decimal
+//----------------------------------------------------------------------------------------------------------------------
+
+// Prints scaled * 10^-scale, e.g. 12345600 with scale 4 gives "1234.5600".
+// The overloads taking min_fraction_digits remove trailing zeros of the fraction beyond that count, or pad up to it.
+BOOST_CHARCONV_DECL to_chars_result to_chars_decimal(char* first, char* last, std::int64_t scaled, int scale) noexcept;
+BOOST_CHARCONV_DECL to_chars_result to_chars_decimal(char* first, char* last, std::int64_t scaled, int scale, int min_fraction_digits) noexcept;
+
+#ifdef BOOST_CHARCONV_HAS_INT128
+BOOST_CHARCONV_DECL to_chars_result to_chars_decimal(char* first, char* last, boost::int128_type scaled, int scale) noexcept;
+BOOST_CHARCONV_DECL to_chars_result to_chars_decimal(char* first, char* last, boost::int128_type scaled, int scale, int min_fraction_digits) noexcept;
+
+// Narrower integers would otherwise be ambiguous between the std::int64_t and boost::int128_type overloads
+template <typename Integer, typename std::enable_if<std::is_integral<Integer>::value && !std::is_same<Integer, bool>::value &&
+                                                    (sizeof(Integer) < sizeof(std::int64_t) || (sizeof(Integer) == sizeof(std::int64_t) && std::is_signed<Integer>::value)), bool>::type = true>
+inline to_chars_result to_chars_decimal(char* first, char* last, Integer scaled, int scale) noexcept
+{
+    return to_chars_decimal(first, last, static_cast<std::int64_t>(scaled), scale);
+}
+
+template <typename Integer, typename std::enable_if<std::is_integral<Integer>::value && !std::is_same<Integer, bool>::value &&
+                                                    (sizeof(Integer) < sizeof(std::int64_t) || (sizeof(Integer) == sizeof(std::int64_t) && std::is_signed<Integer>::value)), bool>::type = true>
+inline to_chars_result to_chars_decimal(char* first, char* last, Integer scaled, int scale, int min_fraction_digits) noexcept
+{
+    return to_chars_decimal(first, last, static_cast<std::int64_t>(scaled), scale, min_fraction_digits);
+}
+#endif
+
 //----------------------------------------------------------------------------------------------------------------------
 // Floating Point
 //----------------------------------------------------------------------------------------------------------------------
@@ -141,6 +174,37 @@ BOOST_CHARCONV_DECL to_chars_result to_chars(char* first, char* last, std::bfloa
                                              chars_format fmt, int precision) noexcept;
 #endif
 
+// The output of Number.prototype.toString in ECMAScript (JavaScript): the shortest digits, in fixed notation
+// for magnitudes in [1e-6, 1e21) and in the form 1.5e+21 otherwise, "NaN", "Infinity" and "-Infinity", and 0 for -0.
+BOOST_CHARCONV_DECL to_chars_result to_chars_ecmascript(char* first, char* last, double value) noexcept;
+
+//----------------------------------------------------------------------------------------------------------------------
+// Batches
+//----------------------------------------------------------------------------------------------------------------------
+
+// Prints values[0], ..., values[count - 1] separated by separator, each one as to_chars with the same fmt and precision.
+// If the buffer is too small ec is std::errc::value_too_large, and ptr and count give the end and the number of the values
+// written in full, so the caller can flush [first, ptr), write the separator and continue with values + count.
+BOOST_CHARCONV_DECL to_chars_batch_result to_chars_batch(char* first, char* last, const float* values, std::size_t count,
+                                                         char separator, chars_format fmt = chars_format::general) noexcept;
+BOOST_CHARCONV_DECL to_chars_batch_result to_chars_batch(char* first, char* last, const double* values, std::size_t count,
+                                                         char separator, chars_format fmt = chars_format::general) noexcept;
+
+BOOST_CHARCONV_DECL to_chars_batch_result to_chars_batch(char* first, char* last, const float* values, std::size_t count,
+                                                         char separator, chars_format fmt, int precision) noexcept;
+BOOST_CHARCONV_DECL to_chars_batch_result to_chars_batch(char* first, char* last, const double* values, std::size_t count,
+                                                         char separator, chars_format fmt, int precision) noexcept;
+
+//----------------------------------------------------------------------------------------------------------------------
+// Decimal decomposition
+//----------------------------------------------------------------------------------------------------------------------
+
+// The shortest decimal significand and exponent that round trip, i.e. the digits to_chars would print, without the text.
+// The significand has no trailing zeros. Zero gives a zero significand and exponent, and so do infinity and NaN,
+// so values that may not be finite must be checked before the call.
+BOOST_CHARCONV_DECL decimal_fp<std::uint32_t> to_decimal(float value) noexcept;
+BOOST_CHARCONV_DECL decimal_fp<std::uint64_t> to_decimal(double value) noexcept;
+
 } // namespace charconv
 } // namespace boost
 
@@ -7,6 +7,7 @@
 
 #include <boost/charconv/detail/config.hpp>
 #include <boost/charconv/detail/ryu/ryu_generic_128.hpp>
+#include <boost/charconv/detail/ryu/generic_128_precision.hpp>
 #include <boost/charconv/detail/compute_float80.hpp>
 #include <boost/charconv/detail/fallback_routines.hpp>
 #include <boost/charconv/detail/issignaling.hpp>
@@ -46,6 +47,20 @@ inline struct floating_decimal_128 float128_to_fd128(__float128 d) noexcept
     return generic_binary_to_decimal(bits, 112, 15, false);
 }
 
+inline struct floating_binary_128 float128_to_fb128(__float128 d) noexcept
+{
+#ifdef BOOST_CHARCONV_HAS_INT128
+    unsigned_128_type bits = 0;
+    std::memcpy(&bits, &d, sizeof(__float128));
+#else
+    trivial_uint128 trivial_bits;
+    std::memcpy(&trivial_bits, &d, sizeof(__float128));
+    unsigned_128_type bits {trivial_bits};
+#endif
+
+    return generic_binary_to_fb128(bits, 112, 15, false);
+}
+
 #  ifdef BOOST_CHARCONV_HAS_STDFLOAT128
 
 inline struct floating_decimal_128 stdfloat128_to_fd128(std::float128_t d) noexcept
@@ -273,30 +288,6 @@ inline from_chars_result from_chars_strtod_impl<__float128>(const char* first, c
     return r;
 }
 
-template <>
-inline from_chars_result from_chars_strtod<__float128>(const char* first, const char* last, __float128& value) noexcept
-{
-    if (last - first < 1024)
-    {
-        char buffer[1024];
-        return from_chars_strtod_impl(first, last, value, buffer);
-    }
-
-    // If the string to be parsed does not fit into the 1024 byte static buffer than we have to allocate a buffer.
-    // malloc is used here because it does not throw on allocation failure.
-
-    char* buffer = static_cast<char*>(std::malloc(static_cast<std::size_t>(last - first + 1)));
-    if (buffer == nullptr)
-    {
-        return {first, std::errc::not_enough_memory};
-    }
-
-    auto r = from_chars_strtod_impl(first, last, value, buffer);
-    std::free(buffer);
-
-    return r;
-}
-
 // --------------------------------------------------------------------------------------------------------------------
 // nans
 // --------------------------------------------------------------------------------------------------------------------
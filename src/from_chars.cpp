@@ -13,6 +13,9 @@
 
 #include "float128_impl.hpp"
 #include "from_chars_float_impl.hpp"
+#include "from_chars_decimal_impl.hpp"
+#include "from_chars_json_impl.hpp"
+#include "from_chars_bounded_impl.hpp"
 #include <boost/charconv/detail/fast_float/fast_float.hpp>
 #include <boost/charconv/from_chars.hpp>
 #include <boost/charconv/detail/bit_layouts.hpp>
@@ -21,6 +24,7 @@
 #include <cstdlib>
 #include <cerrno>
 #include <cstring>
+#include <cstddef>
 #include <limits>
 
 #if BOOST_CHARCONV_LDBL_BITS > 64
@@ -137,6 +141,11 @@ boost::charconv::from_chars_result boost::charconv::from_chars_erange(const char
 #ifdef BOOST_CHARCONV_HAS_FLOAT16
 boost::charconv::from_chars_result boost::charconv::from_chars_erange(const char* first, const char* last, std::float16_t& value, boost::charconv::chars_format fmt) noexcept
 {
+    if (fmt != boost::charconv::chars_format::hex)
+    {
+        return boost::charconv::detail::fast_float::from_chars(first, last, value, fmt);
+    }
+
     float f;
     auto r = boost::charconv::from_chars_erange(first, last, f, fmt);
     if (r.ec == std::errc())
@@ -192,6 +201,11 @@ boost::charconv::from_chars_result boost::charconv::from_chars_erange(const char
 #ifdef BOOST_CHARCONV_HAS_BRAINFLOAT16
 boost::charconv::from_chars_result boost::charconv::from_chars_erange(const char* first, const char* last, std::bfloat16_t& value, boost::charconv::chars_format fmt) noexcept
 {
+    if (fmt != boost::charconv::chars_format::hex)
+    {
+        return boost::charconv::detail::fast_float::from_chars(first, last, value, fmt);
+    }
+
     float f;
     auto r = boost::charconv::from_chars_erange(first, last, f, fmt);
     if (r.ec == std::errc())
@@ -235,18 +249,36 @@ boost::charconv::from_chars_result boost::charconv::from_chars_erange(const char
 {
     static_assert(std::numeric_limits<long double>::is_iec559, "Long double must be IEEE 754 compliant");
 
-    bool sign {};
-    std::int64_t exponent {};
-
     #if defined(BOOST_CHARCONV_HAS_INT128) && ((defined(__clang_major__) && __clang_major__ > 12 ) || \
         (defined(BOOST_GCC) && BOOST_GCC > 100000))
 
-    boost::uint128_type significand {};
+    using significand_type = boost::uint128_type;
 
     #else
-    boost::charconv::detail::uint128 significand {};
+    using significand_type = boost::charconv::detail::uint128;
     #endif
 
+    // Most inputs have at most 19 significant digits and a small exponent, which compute_float80 converts exactly.
+    // The fast_float tokenizer gives us those as a 64-bit significand much faster than the general parser below.
+    if (fmt == boost::charconv::chars_format::general || fmt == boost::charconv::chars_format::scientific)
+    {
+        const auto pns = boost::charconv::detail::fast_float::parse_number_string<char>(first, last, boost::charconv::detail::fast_float::parse_options_t<char>{fmt});
+        if (pns.valid && !pns.too_many_digits)
+        {
+            std::errc success {};
+            const auto return_val = boost::charconv::detail::compute_float80<long double>(pns.exponent, static_cast<significand_type>(pns.mantissa), pns.negative, success);
+            if (success == std::errc())
+            {
+                value = return_val;
+                return {pns.lastmatch, std::errc()};
+            }
+        }
+    }
+
+    bool sign {};
+    std::int64_t exponent {};
+    significand_type significand {};
+
     auto r = boost::charconv::detail::parser(first, last, sign, significand, exponent, fmt);
     if (r.ec == std::errc::value_too_large)
     {
@@ -505,3 +537,329 @@ boost::charconv::from_chars_result boost::charconv::from_chars(boost::core::stri
     return from_chars_strict_impl(sv.data(), sv.data() + sv.size(), value, fmt);
 }
 #endif
+
+namespace {
+
+template <typename T>
+boost::charconv::from_chars_result from_chars_grammar_impl(const char* first, const char* last, T& value, boost::charconv::number_grammar grammar) noexcept
+{
+    T temp_value {};
+    const auto r = boost::charconv::detail::fast_float::from_chars_advanced(first, last, temp_value,
+        boost::charconv::detail::fast_float::parse_options_t<char>{boost::charconv::chars_format::general, '.', grammar});
+
+    if (r)
+    {
+        value = temp_value;
+    }
+
+    return r;
+}
+
+}
+
+boost::charconv::from_chars_result boost::charconv::from_chars(const char* first, const char* last, float& value, boost::charconv::number_grammar grammar) noexcept
+{
+    return from_chars_grammar_impl(first, last, value, grammar);
+}
+
+boost::charconv::from_chars_result boost::charconv::from_chars(const char* first, const char* last, double& value, boost::charconv::number_grammar grammar) noexcept
+{
+    return from_chars_grammar_impl(first, last, value, grammar);
+}
+
+boost::charconv::from_chars_result boost::charconv::from_chars(boost::core::string_view sv, float& value, boost::charconv::number_grammar grammar) noexcept
+{
+    return from_chars_grammar_impl(sv.data(), sv.data() + sv.size(), value, grammar);
+}
+
+boost::charconv::from_chars_result boost::charconv::from_chars(boost::core::string_view sv, double& value, boost::charconv::number_grammar grammar) noexcept
+{
+    return from_chars_grammar_impl(sv.data(), sv.data() + sv.size(), value, grammar);
+}
+
+namespace {
+
+template <typename T>
+boost::charconv::from_chars_result from_chars_approximate_impl(const char* first, const char* last, T& value, boost::charconv::chars_format fmt) noexcept
+{
+    // Hexadecimal input is always converted exactly without a slow path
+    if (fmt == boost::charconv::chars_format::hex)
+    {
+        return from_chars_strict_impl(first, last, value, fmt);
+    }
+
+    T temp_value {};
+    const auto r = boost::charconv::detail::fast_float::from_chars_approximate(first, last, temp_value,
+        boost::charconv::detail::fast_float::parse_options_t<char>{fmt});
+
+    if (r)
+    {
+        value = temp_value;
+    }
+
+    return r;
+}
+
+}
+
+boost::charconv::from_chars_result boost::charconv::from_chars_approximate(const char* first, const char* last, float& value, boost::charconv::chars_format fmt) noexcept
+{
+    return from_chars_approximate_impl(first, last, value, fmt);
+}
+
+boost::charconv::from_chars_result boost::charconv::from_chars_approximate(const char* first, const char* last, double& value, boost::charconv::chars_format fmt) noexcept
+{
+    return from_chars_approximate_impl(first, last, value, fmt);
+}
+
+boost::charconv::from_chars_result boost::charconv::from_chars_approximate(boost::core::string_view sv, float& value, boost::charconv::chars_format fmt) noexcept
+{
+    return from_chars_approximate_impl(sv.data(), sv.data() + sv.size(), value, fmt);
+}
+
+boost::charconv::from_chars_result boost::charconv::from_chars_approximate(boost::core::string_view sv, double& value, boost::charconv::chars_format fmt) noexcept
+{
+    return from_chars_approximate_impl(sv.data(), sv.data() + sv.size(), value, fmt);
+}
+
+namespace {
+
+boost::charconv::detail::fast_float::parsed_number_string_t<char> make_decimal_number(std::uint64_t significand, int exponent, bool is_negative) noexcept
+{
+    boost::charconv::detail::fast_float::parsed_number_string_t<char> pns;
+    pns.exponent = exponent;
+    pns.mantissa = significand;
+    pns.negative = is_negative;
+    pns.valid = true;
+    return pns;
+}
+
+// Finishes the conversion once Eisel-Lemire has given am. compute_float rounds every untruncated 64-bit
+// significand correctly, so the digit comparison of from_chars, which needs the digits in pns.integer, is never reached
+template <typename T>
+std::errc finish_from_decimal(boost::charconv::detail::fast_float::parsed_number_string_t<char>& pns,
+                              boost::charconv::detail::fast_float::adjusted_mantissa am, T& value) noexcept
+{
+    BOOST_CHARCONV_ASSERT(am.power2 >= 0);
+    return boost::charconv::detail::fast_float::detail::finish_compute_float(pns, am, value);
+}
+
+template <typename T>
+std::errc from_decimal_impl(std::uint64_t significand, int exponent, bool is_negative, T& value) noexcept
+{
+    namespace fast_float = boost::charconv::detail::fast_float;
+
+    auto pns = make_decimal_number(significand, exponent, is_negative);
+
+    T temp_value {};
+    if (fast_float::detail::clinger_fast_path(pns, []() { return fast_float::detail::rounds_to_nearest(); }, temp_value))
+    {
+        value = temp_value;
+        return std::errc();
+    }
+
+    const auto ec = finish_from_decimal(pns, fast_float::compute_float<fast_float::binary_format<T>>(pns.exponent, pns.mantissa), temp_value);
+    if (ec == std::errc())
+    {
+        value = temp_value;
+    }
+
+    return ec;
+}
+
+// The rounding mode is probed once for the whole batch rather than once per element. Since compute_float
+// rounds every 64-bit significand correctly, there are no rare cases to set aside for a second pass,
+// and the loop has no state carried between elements other than the success count.
+template <typename Unsigned_Integer, typename T>
+std::size_t from_decimal_batch_impl(const boost::charconv::decimal_fp<Unsigned_Integer>* decimals, std::size_t count, T* values, std::errc* errors) noexcept
+{
+    namespace fast_float = boost::charconv::detail::fast_float;
+
+    const bool nearest = fast_float::detail::rounds_to_nearest();
+    const auto rounding_probe = [nearest]() { return nearest; };
+
+    std::size_t successes {};
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        auto pns = make_decimal_number(decimals[i].significand, decimals[i].exponent, decimals[i].is_negative);
+        T value {};
+
+        const auto ec = fast_float::detail::clinger_fast_path(pns, rounding_probe, value) ? std::errc() :
+                        finish_from_decimal(pns, fast_float::compute_float<fast_float::binary_format<T>>(pns.exponent, pns.mantissa), value);
+
+        errors[i] = ec;
+        if (ec == std::errc())
+        {
+            values[i] = value;
+            ++successes;
+        }
+    }
+
+    return successes;
+}
+
+}
+
+std::errc boost::charconv::from_decimal(std::uint64_t significand, int exponent, bool is_negative, float& value) noexcept
+{
+    return from_decimal_impl(significand, exponent, is_negative, value);
+}
+
+std::errc boost::charconv::from_decimal(std::uint64_t significand, int exponent, bool is_negative, double& value) noexcept
+{
+    return from_decimal_impl(significand, exponent, is_negative, value);
+}
+
+std::size_t boost::charconv::from_decimal_batch(const decimal_fp<std::uint32_t>* decimals, std::size_t count, float* values, std::errc* errors) noexcept
+{
+    return from_decimal_batch_impl(decimals, count, values, errors);
+}
+
+std::size_t boost::charconv::from_decimal_batch(const decimal_fp<std::uint64_t>* decimals, std::size_t count, float* values, std::errc* errors) noexcept
+{
+    return from_decimal_batch_impl(decimals, count, values, errors);
+}
+
+std::size_t boost::charconv::from_decimal_batch(const decimal_fp<std::uint64_t>* decimals, std::size_t count, double* values, std::errc* errors) noexcept
+{
+    return from_decimal_batch_impl(decimals, count, values, errors);
+}
+
+boost::charconv::from_chars_result boost::charconv::from_chars_bounded(const char* first, const char* last, float& value, std::size_t max_digits, boost::charconv::chars_format fmt) noexcept
+{
+    return boost::charconv::detail::from_chars_bounded_impl(first, last, value, max_digits, fmt);
+}
+
+boost::charconv::from_chars_result boost::charconv::from_chars_bounded(const char* first, const char* last, double& value, std::size_t max_digits, boost::charconv::chars_format fmt) noexcept
+{
+    return boost::charconv::detail::from_chars_bounded_impl(first, last, value, max_digits, fmt);
+}
+
+#ifndef BOOST_CHARCONV_UNSUPPORTED_LONG_DOUBLE
+boost::charconv::from_chars_result boost::charconv::from_chars_bounded(const char* first, const char* last, long double& value, std::size_t max_digits, boost::charconv::chars_format fmt) noexcept
+{
+    return boost::charconv::detail::from_chars_bounded_impl(first, last, value, max_digits, fmt);
+}
+#endif
+
+#ifdef BOOST_CHARCONV_HAS_QUADMATH
+boost::charconv::from_chars_result boost::charconv::from_chars_bounded(const char* first, const char* last, __float128& value, std::size_t max_digits, boost::charconv::chars_format fmt) noexcept
+{
+    return boost::charconv::detail::from_chars_bounded_impl(first, last, value, max_digits, fmt);
+}
+#endif
+
+boost::charconv::from_chars_result boost::charconv::from_chars_bounded(boost::core::string_view sv, float& value, std::size_t max_digits, boost::charconv::chars_format fmt) noexcept
+{
+    return boost::charconv::detail::from_chars_bounded_impl(sv.data(), sv.data() + sv.size(), value, max_digits, fmt);
+}
+
+boost::charconv::from_chars_result boost::charconv::from_chars_bounded(boost::core::string_view sv, double& value, std::size_t max_digits, boost::charconv::chars_format fmt) noexcept
+{
+    return boost::charconv::detail::from_chars_bounded_impl(sv.data(), sv.data() + sv.size(), value, max_digits, fmt);
+}
+
+#ifndef BOOST_CHARCONV_UNSUPPORTED_LONG_DOUBLE
+boost::charconv::from_chars_result boost::charconv::from_chars_bounded(boost::core::string_view sv, long double& value, std::size_t max_digits, boost::charconv::chars_format fmt) noexcept
+{
+    return boost::charconv::detail::from_chars_bounded_impl(sv.data(), sv.data() + sv.size(), value, max_digits, fmt);
+}
+#endif
+
+#ifdef BOOST_CHARCONV_HAS_QUADMATH
+boost::charconv::from_chars_result boost::charconv::from_chars_bounded(boost::core::string_view sv, __float128& value, std::size_t max_digits, boost::charconv::chars_format fmt) noexcept
+{
+    return boost::charconv::detail::from_chars_bounded_impl(sv.data(), sv.data() + sv.size(), value, max_digits, fmt);
+}
+#endif
+
+namespace {
+
+template <typename T>
+std::size_t from_chars_batch_impl(const boost::core::string_view* strings, std::size_t count, T* values, std::errc* errors, boost::charconv::chars_format fmt) noexcept
+{
+    if (fmt != boost::charconv::chars_format::hex)
+    {
+        return boost::charconv::detail::fast_float::from_chars_batch(strings, count, values, errors, fmt);
+    }
+
+    std::size_t successes {};
+    for (std::size_t i {}; i < count; ++i)
+    {
+        const auto first = strings[i].data();
+        const auto last = first + strings[i].size();
+        T temp_value {};
+        const auto r = boost::charconv::from_chars(first, last, temp_value, fmt);
+        errors[i] = (r.ec == std::errc() && r.ptr != last) ? std::errc::invalid_argument : r.ec;
+        if (errors[i] == std::errc())
+        {
+            values[i] = temp_value;
+            ++successes;
+        }
+    }
+
+    return successes;
+}
+
+}
+
+std::size_t boost::charconv::from_chars_batch(const boost::core::string_view* strings, std::size_t count, float* values, std::errc* errors, boost::charconv::chars_format fmt) noexcept
+{
+    return from_chars_batch_impl(strings, count, values, errors, fmt);
+}
+
+std::size_t boost::charconv::from_chars_batch(const boost::core::string_view* strings, std::size_t count, double* values, std::errc* errors, boost::charconv::chars_format fmt) noexcept
+{
+    return from_chars_batch_impl(strings, count, values, errors, fmt);
+}
+
+namespace {
+
+// Adheres to the from_chars convention of leaving the value unmodified on failure
+template <typename Integer>
+boost::charconv::from_chars_result from_chars_decimal_strict_impl(const char* first, const char* last, Integer& value, int scale, boost::charconv::decimal_rounding round) noexcept
+{
+    Integer temp_value {};
+    const auto r = boost::charconv::detail::from_chars_decimal_impl(first, last, temp_value, scale, round);
+
+    if (r)
+    {
+        value = temp_value;
+    }
+
+    return r;
+}
+
+}
+
+boost::charconv::from_chars_result boost::charconv::from_chars_decimal(const char* first, const char* last, std::int64_t& scaled, int scale, boost::charconv::decimal_rounding round) noexcept
+{
+    return from_chars_decimal_strict_impl(first, last, scaled, scale, round);
+}
+
+boost::charconv::from_chars_result boost::charconv::from_chars_decimal(boost::core::string_view sv, std::int64_t& scaled, int scale, boost::charconv::decimal_rounding round) noexcept
+{
+    return from_chars_decimal_strict_impl(sv.data(), sv.data() + sv.size(), scaled, scale, round);
+}
+
+#ifdef BOOST_CHARCONV_HAS_INT128
+boost::charconv::from_chars_result boost::charconv::from_chars_decimal(const char* first, const char* last, boost::int128_type& scaled, int scale, boost::charconv::decimal_rounding round) noexcept
+{
+    return from_chars_decimal_strict_impl(first, last, scaled, scale, round);
+}
+
+boost::charconv::from_chars_result boost::charconv::from_chars_decimal(boost::core::string_view sv, boost::int128_type& scaled, int scale, boost::charconv::decimal_rounding round) noexcept
+{
+    return from_chars_decimal_strict_impl(sv.data(), sv.data() + sv.size(), scaled, scale, round);
+}
+#endif
+
+boost::charconv::from_chars_result boost::charconv::from_chars_json(const char* first, const char* last, boost::charconv::json_number& value) noexcept
+{
+    return boost::charconv::detail::from_chars_json_impl(first, last, value);
+}
+
+boost::charconv::from_chars_result boost::charconv::from_chars_json(boost::core::string_view sv, boost::charconv::json_number& value) noexcept
+{
+    return boost::charconv::detail::from_chars_json_impl(sv.data(), sv.data() + sv.size(), value);
+}
@@ -0,0 +1,128 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_CHARCONV_DETAIL_FROM_CHARS_BOUNDED_IMPL_HPP
+#define BOOST_CHARCONV_DETAIL_FROM_CHARS_BOUNDED_IMPL_HPP
+
+#include <boost/charconv/detail/config.hpp>
+#include <boost/charconv/detail/from_chars_result.hpp>
+#include <boost/charconv/from_chars.hpp>
+#include <boost/charconv/chars_format.hpp>
+#include <system_error>
+#include <cstddef>
+
+namespace boost { namespace charconv { namespace detail {
+
+// Finds the end of the number at the start of [first, last) without looking at more than max_digits digits
+// of its significand or of its exponent, or at more than max_digits characters of a NaN payload.
+// The range it returns contains every character from_chars could consume, so parsing it gives the same result
+// as parsing [first, last), but the work done no longer depends on how long the input is.
+//
+// If the limit is exceeded the error is value_too_large and ptr points at the first digit over the limit.
+inline from_chars_result scan_bounded_number(const char* first, const char* last, std::size_t max_digits, chars_format fmt) noexcept
+{
+    const bool hex = fmt == chars_format::hex;
+    const auto is_digit = [hex](char c) noexcept
+    {
+        return (c >= '0' && c <= '9') || (hex && ((c >= 'a' && c <= 'f') || (c >= 'A' && c <= 'F')));
+    };
+
+    auto next = first;
+    if (next != last && (*next == '-' || *next == '+'))
+    {
+        ++next;
+    }
+
+    // inf, infinity, nan and nan(n-char-sequence)
+    if (next != last && !is_digit(*next) && *next != '.')
+    {
+        for (std::size_t letters = 0; letters < 8 && next != last && ((*next >= 'a' && *next <= 'z') || (*next >= 'A' && *next <= 'Z')); ++letters)
+        {
+            ++next;
+        }
+
+        if (next != last && *next == '(')
+        {
+            ++next;
+            std::size_t payload = 0;
+            while (next != last && ((*next >= 'a' && *next <= 'z') || (*next >= 'A' && *next <= 'Z') || (*next >= '0' && *next <= '9') || *next == '_'))
+            {
+                if (++payload > max_digits)
+                {
+                    return {next, std::errc::value_too_large};
+                }
+                ++next;
+            }
+
+            if (next != last && *next == ')')
+            {
+                ++next;
+            }
+        }
+
+        return {next, std::errc()};
+    }
+
+    std::size_t digits = 0;
+    while (next != last && is_digit(*next))
+    {
+        if (++digits > max_digits)
+        {
+            return {next, std::errc::value_too_large};
+        }
+        ++next;
+    }
+
+    if (next != last && *next == '.')
+    {
+        ++next;
+        while (next != last && is_digit(*next))
+        {
+            if (++digits > max_digits)
+            {
+                return {next, std::errc::value_too_large};
+            }
+            ++next;
+        }
+    }
+
+    const char exp_char = hex ? 'p' : 'e';
+    const char capital_exp_char = hex ? 'P' : 'E';
+    if (next != last && (*next == exp_char || *next == capital_exp_char))
+    {
+        ++next;
+        if (next != last && (*next == '-' || *next == '+'))
+        {
+            ++next;
+        }
+
+        std::size_t exp_digits = 0;
+        while (next != last && *next >= '0' && *next <= '9')
+        {
+            if (++exp_digits > max_digits)
+            {
+                return {next, std::errc::value_too_large};
+            }
+            ++next;
+        }
+    }
+
+    return {next, std::errc()};
+}
+
+template <typename T>
+from_chars_result from_chars_bounded_impl(const char* first, const char* last, T& value, std::size_t max_digits, chars_format fmt) noexcept
+{
+    const auto r = scan_bounded_number(first, last, max_digits, fmt);
+    if (r.ec != std::errc())
+    {
+        return r;
+    }
+
+    return boost::charconv::from_chars(first, r.ptr, value, fmt);
+}
+
+}}} // Namespaces
+
+#endif // BOOST_CHARCONV_DETAIL_FROM_CHARS_BOUNDED_IMPL_HPP
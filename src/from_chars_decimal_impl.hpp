@@ -0,0 +1,201 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_CHARCONV_DETAIL_FROM_CHARS_DECIMAL_IMPL_HPP
+#define BOOST_CHARCONV_DETAIL_FROM_CHARS_DECIMAL_IMPL_HPP
+
+#include <boost/charconv/detail/config.hpp>
+#include <boost/charconv/detail/from_chars_result.hpp>
+#include <boost/charconv/detail/type_traits.hpp>
+#include <boost/charconv/detail/integer_search_trees.hpp>
+#include <boost/charconv/detail/fast_float/ascii_number.hpp>
+#include <boost/charconv/decimal_rounding.hpp>
+#include <boost/charconv/chars_format.hpp>
+#include <system_error>
+#include <limits>
+#include <cstdint>
+
+namespace boost { namespace charconv { namespace detail {
+
+// Parses a decimal number into value * 10^scale using only integer arithmetic.
+//
+// The number is tokenized by the fast_float parser which for up to 19 significant digits also accumulates
+// them into a 64-bit integer, so the common case is one multiplication or one division by a power of 10.
+// Longer inputs are handled exactly by walking the digit spans the tokenizer found.
+template <typename Integer>
+from_chars_result from_chars_decimal_impl(const char* first, const char* last, Integer& value, int scale, decimal_rounding round) noexcept
+{
+    using Unsigned_Integer = detail::make_unsigned_t<Integer>;
+
+    if (first == last)
+    {
+        return {first, std::errc::invalid_argument};
+    }
+
+    const auto pns = fast_float::parse_number_string<char>(first, last, fast_float::parse_options_t<char>{chars_format::general});
+    if (!pns.valid)
+    {
+        return {first, std::errc::invalid_argument};
+    }
+
+    const from_chars_result overflow {pns.lastmatch, std::errc::result_out_of_range};
+
+    const Unsigned_Integer limit = static_cast<Unsigned_Integer>((std::numeric_limits<Integer>::max)()) + static_cast<Unsigned_Integer>(pns.negative);
+    const Unsigned_Integer limit_div_10 = limit / 10U;
+
+    Unsigned_Integer result {};
+    bool round_up {};
+
+    // Multiplies result by 10^n checking for overflow
+    const auto scale_up = [&](std::int64_t n) noexcept
+    {
+        for (; n > 0 && result != 0; --n)
+        {
+            if (result > limit_div_10)
+            {
+                return false;
+            }
+            result *= 10U;
+        }
+        return true;
+    };
+
+    // Decides if the magnitude has to be rounded up given how the discarded digits
+    // compare to one half: -1 for less, 0 for exactly half and 1 for more
+    const auto rounds_up = [&](int compared_to_half) noexcept
+    {
+        switch (round)
+        {
+            case decimal_rounding::truncate:
+                return false;
+            case decimal_rounding::nearest_away:
+                return compared_to_half >= 0;
+            default:
+                return compared_to_half > 0 || (compared_to_half == 0 && (result & 1U) == 1U);
+        }
+    };
+
+    if (!pns.too_many_digits)
+    {
+        // pns.mantissa holds every digit, and pns.exponent is exact
+        const std::int64_t shift = pns.exponent + scale;
+        result = static_cast<Unsigned_Integer>(pns.mantissa);
+
+        if (shift >= 0)
+        {
+            if (pns.mantissa > limit || !scale_up(shift))
+            {
+                return overflow;
+            }
+        }
+        else if (shift >= -19)
+        {
+            const std::uint64_t divisor = powers_of_10[static_cast<std::size_t>(-shift)];
+            const std::uint64_t quotient = pns.mantissa / divisor;
+            const std::uint64_t remainder = pns.mantissa % divisor;
+            const std::uint64_t half = divisor / 2U;
+
+            result = static_cast<Unsigned_Integer>(quotient);
+            if (remainder != 0)
+            {
+                round_up = rounds_up(remainder < half ? -1 : remainder == half ? 0 : 1);
+            }
+        }
+        else
+        {
+            // Fewer than 20 digits shifted at least 20 places: less than 0.1
+            result = 0;
+        }
+    }
+    else
+    {
+        // The digits are integer ++ fraction, and the explicit exponent follows them in the input
+        const char* digits_end = pns.fraction.len() != 0 ? pns.fraction.ptr + pns.fraction.len() : pns.integer.ptr + pns.integer.len();
+        if (digits_end != pns.lastmatch && *digits_end == '.')
+        {
+            ++digits_end;
+        }
+
+        std::int64_t exp_number {};
+        if (digits_end != pns.lastmatch)
+        {
+            const char* p = digits_end + 1; // Skip e or E
+            const bool neg_exp = *p == '-';
+            if (*p == '-' || *p == '+')
+            {
+                ++p;
+            }
+            for (; p != pns.lastmatch; ++p)
+            {
+                if (exp_number < 0x10000000)
+                {
+                    exp_number = 10 * exp_number + (*p - '0');
+                }
+            }
+            if (neg_exp)
+            {
+                exp_number = -exp_number;
+            }
+        }
+
+        const auto integer_digits = static_cast<std::int64_t>(pns.integer.len());
+        const auto total_digits = integer_digits + static_cast<std::int64_t>(pns.fraction.len());
+        const auto digit_at = [&](std::int64_t i) noexcept
+        {
+            const char c = i < integer_digits ? pns.integer[static_cast<std::size_t>(i)] : pns.fraction[static_cast<std::size_t>(i - integer_digits)];
+            return static_cast<unsigned>(c - '0');
+        };
+
+        // Number of leading digits whose weight is at least 10^-scale
+        const std::int64_t keep = integer_digits + exp_number + scale;
+        const std::int64_t kept = keep < total_digits ? keep : total_digits;
+
+        for (std::int64_t i = 0; i < kept; ++i)
+        {
+            const unsigned digit = digit_at(i);
+            if (result > limit_div_10 || (result == limit_div_10 && digit > limit % 10U))
+            {
+                return overflow;
+            }
+            result = static_cast<Unsigned_Integer>(result * 10U + digit);
+        }
+
+        if (keep > total_digits)
+        {
+            if (!scale_up(keep - total_digits))
+            {
+                return overflow;
+            }
+        }
+        else if (keep >= 0 && keep < total_digits)
+        {
+            const unsigned digit = digit_at(keep);
+            int compared_to_half = digit < 5U ? -1 : digit > 5U ? 1 : 0;
+            for (std::int64_t i = keep + 1; i < total_digits && compared_to_half == 0; ++i)
+            {
+                if (digit_at(i) != 0)
+                {
+                    compared_to_half = 1;
+                }
+            }
+            round_up = rounds_up(compared_to_half);
+        }
+    }
+
+    if (round_up)
+    {
+        if (result == limit)
+        {
+            return overflow;
+        }
+        ++result;
+    }
+
+    value = pns.negative ? static_cast<Integer>(0U - result) : static_cast<Integer>(result);
+    return {pns.lastmatch, std::errc()};
+}
+
+}}} // Namespaces
+
+#endif // BOOST_CHARCONV_DETAIL_FROM_CHARS_DECIMAL_IMPL_HPP
@@ -0,0 +1,98 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_CHARCONV_DETAIL_FROM_CHARS_JSON_IMPL_HPP
+#define BOOST_CHARCONV_DETAIL_FROM_CHARS_JSON_IMPL_HPP
+
+#include <boost/charconv/detail/config.hpp>
+#include <boost/charconv/detail/from_chars_result.hpp>
+#include <boost/charconv/detail/fast_float/fast_float.hpp>
+#include <boost/charconv/json_number.hpp>
+#include <boost/charconv/number_grammar.hpp>
+#include <boost/charconv/chars_format.hpp>
+#include <system_error>
+#include <limits>
+#include <cstdint>
+
+namespace boost { namespace charconv { namespace detail {
+
+// Parses a JSON number, deciding between int64, uint64 and double from the tokenizer's output.
+//
+// The fast_float tokenizer accumulates up to 19 significant digits into a 64-bit integer while scanning,
+// which is exactly the integer we need when the number has no fraction or exponent.
+// The only integers it cannot hold are those with 20 digits, which are completed from the last digit.
+// Anything else is converted to double from the same mantissa and exponent, so the digits are never rescanned.
+inline from_chars_result from_chars_json_impl(const char* first, const char* last, json_number& value) noexcept
+{
+    if (first == last)
+    {
+        return {first, std::errc::invalid_argument};
+    }
+
+    auto pns = fast_float::parse_number_string<char>(first, last, fast_float::parse_options_t<char>{chars_format::general, '.', number_grammar::json});
+    if (!pns.valid)
+    {
+        return {first, std::errc::invalid_argument};
+    }
+
+    // No fraction and no exponent
+    if (pns.lastmatch == pns.integer.ptr + pns.integer.len())
+    {
+        constexpr auto int64_max = static_cast<std::uint64_t>((std::numeric_limits<std::int64_t>::max)());
+
+        if (!pns.too_many_digits)
+        {
+            if (!pns.negative)
+            {
+                if (pns.mantissa <= int64_max)
+                {
+                    value.kind = json_number_kind::int64;
+                    value.int64_value = static_cast<std::int64_t>(pns.mantissa);
+                }
+                else
+                {
+                    value.kind = json_number_kind::uint64;
+                    value.uint64_value = pns.mantissa;
+                }
+
+                return {pns.lastmatch, std::errc()};
+            }
+            else if (pns.mantissa <= int64_max + 1U)
+            {
+                value.kind = json_number_kind::int64;
+                value.int64_value = static_cast<std::int64_t>(0U - pns.mantissa);
+                return {pns.lastmatch, std::errc()};
+            }
+        }
+        else if (!pns.negative && pns.integer.len() == 20U)
+        {
+            // pns.mantissa holds the leading 19 digits
+            const auto last_digit = static_cast<std::uint64_t>(pns.integer.ptr[19] - '0');
+            if (pns.mantissa <= ((std::numeric_limits<std::uint64_t>::max)() - last_digit) / 10U)
+            {
+                value.kind = json_number_kind::uint64;
+                value.uint64_value = pns.mantissa * 10U + last_digit;
+                return {pns.lastmatch, std::errc()};
+            }
+        }
+    }
+
+    double result {};
+    if (!fast_float::detail::clinger_fast_path(pns, []() { return fast_float::detail::rounds_to_nearest(); }, result))
+    {
+        const auto ec = fast_float::detail::finish_compute_float(pns, fast_float::compute_float<fast_float::binary_format<double>>(pns.exponent, pns.mantissa), result);
+        if (ec != std::errc())
+        {
+            return {pns.lastmatch, ec};
+        }
+    }
+
+    value.kind = json_number_kind::double_;
+    value.double_value = result;
+    return {pns.lastmatch, std::errc()};
+}
+
+}}} // Namespaces
+
+#endif // BOOST_CHARCONV_DETAIL_FROM_CHARS_JSON_IMPL_HPP
@@ -6,14 +6,22 @@
 
 #include "float128_impl.hpp"
 #include "to_chars_float_impl.hpp"
+#include "to_chars_decimal_impl.hpp"
 #include <boost/charconv/to_chars.hpp>
 #include <boost/charconv/chars_format.hpp>
+#include <algorithm>
+#include <type_traits>
 #include <limits>
 #include <cstring>
 #include <cstdio>
+#include <cstddef>
 #include <cstdint>
 #include <cmath>
 
+#ifdef BOOST_CHARCONV_HAS_SSE2
+#  include <emmintrin.h>
+#endif
+
 namespace boost { namespace charconv { namespace detail { namespace to_chars_detail {
 
 #ifdef BOOST_MSVC
@@ -265,12 +273,127 @@ namespace boost { namespace charconv { namespace detail { namespace to_chars_det
         }
     }
 
+#ifdef BOOST_CHARCONV_HAS_SSE2
+
+    // Converts two values below 10^8 into their 16 decimal digits as characters, following the SSE2 method
+    // of Wojciech Mula: http://0x80.pl/articles/sse-itoa.html
+    // Each value is split into two 4-digit halves, e.g. abcd and efgh, and each half is copied into four
+    // 16-bit lanes. Dividing the lanes by 1000, 100, 10 and 1 gives a, ab, abc and abcd, and subtracting
+    // 10 times the lane to the left leaves a single digit in each lane.
+    BOOST_FORCEINLINE static __m128i digits_16_sse2(std::uint32_t high, std::uint32_t low) noexcept
+    {
+        // 3518437209 = ceil(2^45 / 1'0000)
+        const __m128i values = _mm_unpacklo_epi64(_mm_cvtsi32_si128(static_cast<int>(high)), _mm_cvtsi32_si128(static_cast<int>(low)));
+        const __m128i upper_halves = _mm_srli_epi64(_mm_mul_epu32(values, _mm_set1_epi32(static_cast<int>(3518437209U))), 45);
+        const __m128i lower_halves = _mm_sub_epi32(values, _mm_mul_epu32(upper_halves, _mm_set1_epi32(10000)));
+
+        // The four halves times 4, so that the multipliers below fit in 16 bits, each copied into four lanes
+        const __m128i halves = _mm_slli_epi16(_mm_packs_epi32(_mm_or_si128(upper_halves, _mm_slli_epi64(lower_halves, 32)), _mm_setzero_si128()), 2);
+        const __m128i pairs = _mm_unpacklo_epi16(halves, halves);
+        const __m128i high_lanes = _mm_unpacklo_epi32(pairs, pairs);
+        const __m128i low_lanes = _mm_unpackhi_epi32(pairs, pairs);
+
+        // Division by 1000, 100, 10 and 1 as two high multiplications: by a rounded up reciprocal of 10^k, then by a power of 2
+        const __m128i multipliers = _mm_setr_epi16(8389, 5243, 13108, -32768, 8389, 5243, 13108, -32768);
+        const __m128i shifts = _mm_setr_epi16(1 << 7, 1 << 11, 1 << 13, -32768, 1 << 7, 1 << 11, 1 << 13, -32768);
+        const __m128i high_prefixes = _mm_mulhi_epu16(_mm_mulhi_epu16(high_lanes, multipliers), shifts);
+        const __m128i low_prefixes = _mm_mulhi_epu16(_mm_mulhi_epu16(low_lanes, multipliers), shifts);
+
+        const __m128i ten = _mm_set1_epi16(10);
+        const __m128i high_digits = _mm_sub_epi16(high_prefixes, _mm_slli_epi64(_mm_mullo_epi16(high_prefixes, ten), 16));
+        const __m128i low_digits = _mm_sub_epi16(low_prefixes, _mm_slli_epi64(_mm_mullo_epi16(low_prefixes, ten), 16));
+
+        return _mm_add_epi8(_mm_packus_epi16(high_digits, low_digits), _mm_set1_epi8('0'));
+    }
+
+    // Prints a significand of at most 17 digits as d.ddd...d with the trailing zeros removed, and adds
+    // the number of digits after the first one to the exponent.
+    // The significand is scaled to exactly 17 digits so that the first digit and the decimal point are at
+    // fixed positions, and the other 16 digits are converted at once.
+    BOOST_FORCEINLINE static void print_17_digits_sse2(std::uint64_t significand, int& exponent, char*& buffer) noexcept
+    {
+        // Number of digits from the bit length, where 1233 / 4096 approximates log10(2)
+        const int bit_length = 64 - boost::core::countl_zero(significand);
+        int digits = (bit_length * 1233) >> 12;
+        digits += static_cast<int>(significand >= power_of_10[digits]);
+
+        significand *= power_of_10[17 - digits];
+        exponent += digits - 1;
+
+        // Split the 17 digits into 1, 8 and 8
+        const auto head = static_cast<std::uint32_t>(significand / 100000000);
+        const auto low = static_cast<std::uint32_t>(significand - std::uint64_t(head) * 100000000);
+        const auto head_digit = head / 100000000;
+        const auto high = head - head_digit * 100000000;
+
+        const __m128i tail_digits = digits_16_sse2(high, low);
+
+        // Bit i is set when digit i after the decimal point is not zero
+        const auto nonzero_digits = ~static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(tail_digits, _mm_set1_epi8('0')))) & 0xFFFFU;
+
+        buffer[0] = static_cast<char>('0' + head_digit);
+        if (nonzero_digits == 0)
+        {
+            buffer += 1;
+            return;
+        }
+
+        buffer[1] = '.';
+        buffer += 2;
+
+        // Nothing past the last nonzero digit may be written, so the digits are copied in two overlapping pieces
+        alignas(16) char fraction[16];
+        _mm_store_si128(reinterpret_cast<__m128i*>(fraction), tail_digits);
+
+        const int fraction_digits = 32 - boost::core::countl_zero(nonzero_digits);
+        const auto length = static_cast<std::size_t>(fraction_digits);
+        if (length >= 8)
+        {
+            std::memcpy(buffer, fraction, 8);
+            std::memcpy(buffer + length - 8, fraction + length - 8, 8);
+        }
+        else if (length >= 4)
+        {
+            std::memcpy(buffer, fraction, 4);
+            std::memcpy(buffer + length - 4, fraction + length - 4, 4);
+        }
+        else
+        {
+            buffer[0] = fraction[0];
+            buffer[length / 2] = fraction[length / 2];
+            buffer[length - 1] = fraction[length - 1];
+        }
+
+        buffer += fraction_digits;
+    }
+
+#endif // BOOST_CHARCONV_HAS_SSE2
+
+    // Length of the output of dragon_box_print_chars, with the exponent that is printed rather than the one of the
+    // integer significand, e.g. 10193297423204352 * 10^0 gives "1.0193297423204352e+16".
+    // Trailing zeros of the significand are counted as digits, and at least 3 characters are required,
+    // which covers what the digit printers may write past the last digit.
+    template <typename Unsigned_Integer>
+    std::ptrdiff_t shortest_scientific_length(Unsigned_Integer significand, int exponent, chars_format fmt) noexcept
+    {
+        const int digits = num_digits(significand);
+        const int printed_exponent = exponent + digits - 1;
+
+        int length = digits == 1 ? 1 : digits + 1;
+        if (printed_exponent != 0 || fmt == chars_format::scientific)
+        {
+            length += (printed_exponent >= 100 || printed_exponent <= -100) ? 5 : 4;
+        }
+
+        return (std::max)(length, 3);
+    }
+
     template <>
     to_chars_result dragon_box_print_chars<float, dragonbox_float_traits<float>>(std::uint32_t s32, int exponent, char* first, char* last, chars_format fmt) noexcept
     {
         auto buffer = first;
 
-        const std::ptrdiff_t total_length = total_buffer_length(9, exponent, false);
+        const std::ptrdiff_t total_length = shortest_scientific_length(s32, exponent, fmt);
         if (total_length > (last - first))
         {
             return {last, std::errc::value_too_large};
@@ -308,17 +431,22 @@ namespace boost { namespace charconv { namespace detail { namespace to_chars_det
         return {buffer, std::errc()};
     }
 
-    template <>
-    to_chars_result dragon_box_print_chars<double, dragonbox_float_traits<double>>(const std::uint64_t significand, int exponent, char* first, char* last, chars_format fmt) noexcept
+    // Prints a significand of at most 17 digits as d.ddd...d with the trailing zeros removed, and adds
+    // the number of digits after the first one to the exponent.
+    // Up to two characters past the last digit may be overwritten.
+    BOOST_FORCEINLINE static void print_double_significand(std::uint64_t significand, int& exponent, char*& buffer) noexcept
     {
-        auto buffer = first;
-
-        const std::ptrdiff_t total_length = total_buffer_length(17, exponent, false);
-        if (total_length > (last - first))
+#ifdef BOOST_CHARCONV_HAS_SSE2
+        // Up to 8 digits the scalar routine is faster, as it stops at the last nonzero digit
+        if (significand >= 100000000)
         {
-            return {last, std::errc::value_too_large};
+            print_17_digits_sse2(significand, exponent, buffer);
         }
-
+        else
+        {
+            print_9_digits(static_cast<std::uint32_t>(significand), exponent, buffer);
+        }
+#else
         // Print significand by decomposing it into a 9-digit block and a 8-digit block.
         std::uint32_t first_block;
         std::uint32_t second_block {};
@@ -500,6 +628,22 @@ namespace boost { namespace charconv { namespace detail { namespace to_chars_det
                 }
             }
         }
+#endif
+    }
+
+    template <>
+    to_chars_result dragon_box_print_chars<double, dragonbox_float_traits<double>>(const std::uint64_t significand, int exponent, char* first, char* last, chars_format fmt) noexcept
+    {
+        auto buffer = first;
+
+        const std::ptrdiff_t total_length = shortest_scientific_length(significand, exponent, fmt);
+        if (total_length > (last - first))
+        {
+            return {last, std::errc::value_too_large};
+        }
+
+        print_double_significand(significand, exponent, buffer);
+
         if (exponent < 0)
         {
             std::memcpy(buffer, "e-", 2);
@@ -543,6 +687,90 @@ namespace boost { namespace charconv { namespace detail { namespace to_chars_det
         return {buffer, std::errc()};
     }
 
+    // Lays out the shortest digits of a positive double the way ECMAScript Number::toString does:
+    // https://tc39.es/ecma262/#sec-numeric-types-number-tostring
+    // With k digits and the value below 10^n, the output is the plain number for -6 < n <= 21, otherwise
+    // d.ddd...d followed by the exponent n - 1 with its sign and without leading zeros, e.g. 1e+21 or 1.5e-7.
+    to_chars_result ecmascript_print_chars(std::uint64_t significand, int exponent, char* first, char* last) noexcept
+    {
+        const int k = num_digits(significand);
+        const int n = k + exponent;
+
+        // d...d000
+        if (exponent >= 0 && n <= 21)
+        {
+            if (n > last - first)
+            {
+                return {last, std::errc::value_too_large};
+            }
+
+            first = print_zero_padded(first, significand, k);
+            std::memset(first, '0', static_cast<std::size_t>(exponent));
+            return {first + exponent, std::errc()};
+        }
+
+        // d...d.d...d
+        if (n > 0 && n <= 21)
+        {
+            if (k + 1 > last - first)
+            {
+                return {last, std::errc::value_too_large};
+            }
+
+            const auto integer_part = divide_by_pow10(significand, -exponent);
+            const auto fractional_part = significand - integer_part * power_of_10[-exponent];
+
+            first = print_zero_padded(first, integer_part, n);
+            *first++ = '.';
+            return {print_zero_padded(first, fractional_part, -exponent), std::errc()};
+        }
+
+        // 0.00...0d...d
+        if (n > -6 && n <= 0)
+        {
+            if (2 - n + k > last - first)
+            {
+                return {last, std::errc::value_too_large};
+            }
+
+            std::memcpy(first, "0.", 2U);
+            std::memset(first + 2, '0', static_cast<std::size_t>(-n));
+            first += 2 - n;
+            return {print_zero_padded(first, significand, k), std::errc()};
+        }
+
+        // d.ddd...de+x, where the exponent suffix is always long enough to absorb what
+        // print_double_significand writes past the last digit
+        const auto abs_exponent = static_cast<std::uint32_t>(n > 0 ? n - 1 : 1 - n);
+        const int exponent_digits = abs_exponent >= 100 ? 3 : abs_exponent >= 10 ? 2 : 1;
+        if (k + static_cast<int>(k > 1) + 2 + exponent_digits > last - first)
+        {
+            return {last, std::errc::value_too_large};
+        }
+
+        auto buffer = first;
+        print_double_significand(significand, exponent, buffer);
+
+        std::memcpy(buffer, n > 0 ? "e+" : "e-", 2);
+        buffer += 2;
+
+        if (exponent_digits == 3)
+        {
+            print_1_digit(abs_exponent / 100, buffer);
+            print_2_digits(abs_exponent % 100, buffer + 1);
+        }
+        else if (exponent_digits == 2)
+        {
+            print_2_digits(abs_exponent, buffer);
+        }
+        else
+        {
+            print_1_digit(abs_exponent, buffer);
+        }
+
+        return {buffer + exponent_digits, std::errc()};
+    }
+
 #ifdef BOOST_MSVC
 # pragma warning(pop)
 #endif
@@ -753,3 +981,212 @@ boost::charconv::to_chars_result boost::charconv::to_chars(char* first, char* la
     return boost::charconv::detail::to_chars_float_impl(first, last, static_cast<float>(value), fmt, precision);
 }
 #endif
+
+boost::charconv::to_chars_result boost::charconv::to_chars_decimal(char* first, char* last, std::int64_t scaled, int scale) noexcept
+{
+    return boost::charconv::detail::to_chars_decimal_impl(first, last, scaled, scale, scale > 0 ? scale : 0);
+}
+
+boost::charconv::to_chars_result boost::charconv::to_chars_decimal(char* first, char* last, std::int64_t scaled, int scale, int min_fraction_digits) noexcept
+{
+    return boost::charconv::detail::to_chars_decimal_impl(first, last, scaled, scale, min_fraction_digits);
+}
+
+#ifdef BOOST_CHARCONV_HAS_INT128
+boost::charconv::to_chars_result boost::charconv::to_chars_decimal(char* first, char* last, boost::int128_type scaled, int scale) noexcept
+{
+    return boost::charconv::detail::to_chars_decimal_impl(first, last, scaled, scale, scale > 0 ? scale : 0);
+}
+
+boost::charconv::to_chars_result boost::charconv::to_chars_decimal(char* first, char* last, boost::int128_type scaled, int scale, int min_fraction_digits) noexcept
+{
+    return boost::charconv::detail::to_chars_decimal_impl(first, last, scaled, scale, min_fraction_digits);
+}
+#endif
+
+boost::charconv::to_chars_result boost::charconv::to_chars_ecmascript(char* first, char* last, double value) noexcept
+{
+    if (std::isnan(value))
+    {
+        if (last - first < 3)
+        {
+            return {last, std::errc::value_too_large};
+        }
+
+        std::memcpy(first, "NaN", 3); // NOLINT : No null terminator is purposeful
+        return {first + 3, std::errc()};
+    }
+
+    // Negative zero is printed as 0
+    if (value == 0)
+    {
+        if (first >= last)
+        {
+            return {last, std::errc::value_too_large};
+        }
+
+        *first = '0';
+        return {first + 1, std::errc()};
+    }
+
+    if (value < 0)
+    {
+        if (first >= last)
+        {
+            return {last, std::errc::value_too_large};
+        }
+
+        *first++ = '-';
+    }
+
+    if (std::isinf(value))
+    {
+        if (last - first < 8)
+        {
+            return {last, std::errc::value_too_large};
+        }
+
+        std::memcpy(first, "Infinity", 8); // NOLINT : No null terminator is purposeful
+        return {first + 8, std::errc()};
+    }
+
+    const auto result = boost::charconv::detail::to_decimal(value);
+    return boost::charconv::detail::to_chars_detail::ecmascript_print_chars(result.significand, result.exponent, first, last);
+}
+
+namespace {
+
+template <typename Unsigned_Integer, typename Real>
+boost::charconv::decimal_fp<Unsigned_Integer> to_decimal_impl(Real value) noexcept
+{
+    const bool is_negative = std::signbit(value);
+    if (value == 0 || !std::isfinite(value))
+    {
+        return {0, 0, is_negative};
+    }
+
+    const auto result = boost::charconv::detail::to_decimal(value);
+    return {result.significand, result.exponent, result.is_negative};
+}
+
+}
+
+boost::charconv::decimal_fp<std::uint32_t> boost::charconv::to_decimal(float value) noexcept
+{
+    return to_decimal_impl<std::uint32_t>(value);
+}
+
+boost::charconv::decimal_fp<std::uint64_t> boost::charconv::to_decimal(double value) noexcept
+{
+    return to_decimal_impl<std::uint64_t>(value);
+}
+
+namespace {
+
+// Bounds the length of any output of to_chars_float_impl with the given format and precision
+template <typename Real>
+std::size_t max_float_length(boost::charconv::chars_format fmt, int precision) noexcept
+{
+    // Sign, leading digit, point and exponent around the remaining significand digits
+    constexpr std::size_t scientific_overhead = 10;
+    constexpr auto max_significand_digits = static_cast<std::size_t>(std::numeric_limits<Real>::max_digits10);
+
+    if (precision == -1)
+    {
+        // Shortest fixed output is longest for the smallest normal and subnormal values, e.g. "-0.000...00494" for double
+        constexpr std::size_t max_shortest_fixed_length = std::is_same<Real, double>::value ? 330 : 50;
+        return fmt == boost::charconv::chars_format::fixed ? max_shortest_fixed_length : max_significand_digits + scientific_overhead;
+    }
+
+    const auto digits = static_cast<std::size_t>(precision);
+    if (fmt == boost::charconv::chars_format::fixed)
+    {
+        constexpr auto max_integer_digits = static_cast<std::size_t>(std::numeric_limits<Real>::max_exponent10 + 1);
+        return max_integer_digits + digits + 2;
+    }
+
+    // Hex pads the precision with zeros, and otherwise has at most max_significand_digits digits
+    return (digits > max_significand_digits ? digits : max_significand_digits) + scientific_overhead;
+}
+
+template <typename Real>
+boost::charconv::to_chars_batch_result to_chars_batch_impl(char* first, char* last, const Real* values, std::size_t count,
+                                                           char separator, boost::charconv::chars_format fmt, int precision) noexcept
+{
+    const std::size_t max_length = max_float_length<Real>(fmt, precision) + 1;
+
+    std::size_t i {};
+    while (i < count)
+    {
+        // Every value of a block fits, so the capacity is checked once for the whole block
+        const auto block_size = first < last ? (std::min)(static_cast<std::size_t>(last - first) / max_length, count - i) : 0;
+        for (const auto block_end = i + block_size; i < block_end; ++i)
+        {
+            char* ptr = first;
+            if (i != 0)
+            {
+                *ptr++ = separator;
+            }
+
+            const auto r = boost::charconv::detail::to_chars_float_impl(ptr, last, values[i], fmt, precision);
+            if (r.ec != std::errc() || r.ptr > last)
+            {
+                return {first, r.ec == std::errc() ? std::errc::value_too_large : r.ec, i};
+            }
+
+            first = r.ptr;
+        }
+
+        // Near the end of the buffer the values are checked one at a time
+        if (i < count && block_size == 0)
+        {
+            char* ptr = first;
+            if (i != 0)
+            {
+                if (ptr == last)
+                {
+                    return {first, std::errc::value_too_large, i};
+                }
+
+                *ptr++ = separator;
+            }
+
+            const auto r = boost::charconv::detail::to_chars_float_impl(ptr, last, values[i], fmt, precision);
+            if (r.ec != std::errc() || r.ptr > last)
+            {
+                return {first, r.ec == std::errc() ? std::errc::value_too_large : r.ec, i};
+            }
+
+            first = r.ptr;
+            ++i;
+        }
+    }
+
+    return {first, std::errc(), count};
+}
+
+}
+
+boost::charconv::to_chars_batch_result boost::charconv::to_chars_batch(char* first, char* last, const float* values, std::size_t count,
+                                                                       char separator, boost::charconv::chars_format fmt) noexcept
+{
+    return to_chars_batch_impl(first, last, values, count, separator, fmt, -1);
+}
+
+boost::charconv::to_chars_batch_result boost::charconv::to_chars_batch(char* first, char* last, const double* values, std::size_t count,
+                                                                       char separator, boost::charconv::chars_format fmt) noexcept
+{
+    return to_chars_batch_impl(first, last, values, count, separator, fmt, -1);
+}
+
+boost::charconv::to_chars_batch_result boost::charconv::to_chars_batch(char* first, char* last, const float* values, std::size_t count,
+                                                                       char separator, boost::charconv::chars_format fmt, int precision) noexcept
+{
+    return to_chars_batch_impl(first, last, values, count, separator, fmt, precision < 0 ? 6 : precision);
+}
+
+boost::charconv::to_chars_batch_result boost::charconv::to_chars_batch(char* first, char* last, const double* values, std::size_t count,
+                                                                       char separator, boost::charconv::chars_format fmt, int precision) noexcept
+{
+    return to_chars_batch_impl(first, last, values, count, separator, fmt, precision < 0 ? 6 : precision);
+}
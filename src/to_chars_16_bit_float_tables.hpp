@@ -0,0 +1,4113 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_CHARCONV_DETAIL_TO_CHARS_16_BIT_FLOAT_TABLES_HPP
+#define BOOST_CHARCONV_DETAIL_TO_CHARS_16_BIT_FLOAT_TABLES_HPP
+
+#include <boost/charconv/detail/config.hpp>
+#include <boost/charconv/detail/ryu/ryu_generic_128.hpp>
+#include <boost/charconv/detail/dragonbox/dragonbox_common.hpp>
+#include <boost/charconv/detail/integer_search_trees.hpp>
+#include <boost/core/bit.hpp>
+#include <cstdint>
+
+// Only included by to_chars_float_impl.hpp, and so only compiled into to_chars.cpp, when the library is built
+// with BOOST_CHARCONV_16_BIT_FLOAT_TABLES
+
+namespace boost { namespace charconv { namespace detail {
+
+// There are few enough 16-bit floating point values to store the shortest representation of each of them.
+// The entry of a positive finite value holds its decimal significand shifted left by one. The low bit tells
+// whether its decimal exponent in scientific notation is floor(e * log10(2)) or one more, where the value is in
+// [2^e, 2^(e + 1)). The significands have at most 5 digits for std::float16_t and 4 for std::bfloat16_t, so
+// every entry fits in 16 bits.
+// The tables were generated with ryu::generic_binary_to_decimal, and test/to_chars_16_bit_float_tables.cpp
+// checks every entry against it.
+
+static constexpr std::uint16_t float16_decimal_table[31744] = {
+    0, 12, 2, 4, 48, 6, 72, 8, 10, 108, 12, 132, 14, 16, 166, 18,
+    190, 3, 23, 227, 25, 251, 27, 29, 287, 31, 311, 33, 335, 35, 37, 371,
+    38, 394, 4, 42, 430, 44, 452, 46, 48, 488, 50, 512, 52, 54, 548, 56,
+    572, 58, 6, 608, 62, 632, 64, 66, 668, 68, 692, 70, 72, 728, 74, 752,
+    76, 78, 786, 8, 810, 82, 84, 846, 86, 870, 88, 90, 906, 92, 930, 94,
+    954, 96, 98, 990, 10, 1014, 102, 104, 1050, 106, 1072, 108, 110, 1108, 112, 1132,
+    114, 116, 1168, 118, 1192, 12, 122, 1228, 124, 1252, 126, 128, 1288, 130, 1312, 132,
+    134, 1348, 136, 1370, 138, 14, 1406, 142, 1430, 144, 146, 1466, 148, 1490, 150, 1514,
+    152, 154, 1550, 156, 1574, 158, 16, 1610, 162, 1634, 164, 166, 1668, 168, 1692, 170,
+    172, 1728, 174, 1752, 176, 178, 1788, 18, 1812, 182, 184, 1848, 186, 1872, 188, 190,
+    1908, 192, 1932, 194, 196, 1966, 198, 1990, 3, 203, 2027, 205, 2051, 207, 209, 2087,
+    211, 2111, 213, 2135, 215, 217, 2171, 219, 2195, 23, 223, 2231, 225, 2255, 227, 229,
+    2289, 231, 2313, 233, 235, 2349, 237, 2373, 239, 25, 2409, 243, 2433, 245, 247, 2469,
+    249, 2493, 251, 253, 2529, 255, 2553, 257, 259, 2587, 27, 2611, 263, 265, 2647, 267,
+    2671, 269, 271, 2707, 273, 2731, 275, 2755, 277, 279, 2791, 29, 2815, 283, 285, 2851,
+    287, 2873, 289, 291, 2909, 293, 2933, 295, 297, 2969, 299, 2993, 31, 303, 3029, 305,
+    3052, 306, 308, 3088, 310, 3112, 312, 314, 3148, 316, 3170, 318, 32, 3206, 322, 3230,
+    324, 326, 3266, 328, 3290, 330, 3314, 332, 334, 3350, 336, 3374, 338, 34, 3410, 342,
+    3434, 344, 346, 3468, 348, 3492, 350, 352, 3528, 354, 3552, 356, 358, 3588, 36, 3612,
+    362, 364, 3648, 366, 3672, 368, 370, 3708, 372, 3732, 374, 376, 3768, 378, 3790, 38,
+    382, 3826, 384, 3850, 386, 388, 3886, 390, 3910, 392, 3934, 394, 396, 3970, 398, 3994,
+    4, 402, 4030, 404, 4054, 406, 408, 4088, 410, 4112, 412, 414, 4148, 416, 4172, 418,
+    42, 4208, 422, 4232, 424, 426, 4268, 428, 4292, 430, 432, 4328, 434, 4352, 436, 438,
+    4386, 44, 4410, 442, 444, 4446, 446, 4470, 448, 450, 4506, 452, 4530, 454, 4554, 456,
+    458, 4590, 46, 4614, 462, 464, 4650, 466, 4674, 468, 470, 4708, 472, 4732, 474, 476,
+    4768, 478, 4792, 48, 482, 4828, 484, 4852, 486, 488, 4888, 490, 4912, 492, 494, 4948,
+    496, 4972, 498, 50, 5006, 502, 5030, 504, 506, 5066, 508, 5090, 510, 512, 5126, 514,
+    5150, 516, 5174, 518, 52, 5210, 522, 5234, 524, 526, 5270, 528, 5292, 530, 532, 5328,
+    534, 5352, 536, 538, 5388, 54, 5412, 542, 544, 5448, 546, 5472, 548, 550, 5508, 552,
+    5532, 554, 556, 5568, 558, 5590, 56, 562, 5626, 564, 5650, 566, 568, 5686, 570, 5710,
+    572, 5734, 574, 576, 5770, 578, 5794, 58, 582, 5830, 584, 5854, 586, 588, 5888, 590,
+    5912, 592, 594, 5948, 596, 5972, 598, 6, 6008, 602, 6032, 604, 606, 6068, 608, 6092,
+    610, 612, 6128, 614, 6152, 616, 618, 6186, 62, 6210, 622, 624, 6246, 626, 6270, 628,
+    630, 6306, 632, 6330, 634, 6354, 636, 638, 6390, 64, 6414, 642, 644, 6450, 646, 6474,
+    648, 650, 6508, 652, 6532, 654, 656, 6568, 658, 6592, 66, 662, 6628, 664, 6652, 666,
+    668, 6688, 670, 6712, 672, 674, 6748, 676, 6772, 678, 68, 6806, 682, 6830, 684, 686,
+    6866, 688, 6890, 690, 692, 6926, 694, 6950, 696, 6974, 698, 70, 7010, 702, 7034, 704,
+    706, 7070, 708, 7092, 710, 712, 7128, 714, 7152, 716, 718, 7188, 72, 7212, 722, 724,
+    7248, 726, 7272, 728, 730, 7308, 732, 7332, 734, 736, 7368, 738, 7390, 74, 742, 7426,
+    744, 7450, 746, 748, 7486, 750, 7510, 752, 7534, 754, 756, 7570, 758, 7594, 76, 762,
+    7630, 764, 7654, 766, 768, 7688, 770, 7712, 772, 774, 7748, 776, 7772, 778, 78, 7808,
+    782, 7832, 784, 786, 7868, 788, 7892, 790, 792, 7928, 794, 7952, 796, 798, 7988, 8,
+    8010, 802, 804, 8046, 806, 8070, 808, 810, 8106, 812, 8130, 814, 8154, 816, 818, 8190,
+    82, 8214, 822, 824, 8250, 826, 8274, 828, 830, 8308, 832, 8332, 834, 836, 8368, 838,
+    8392, 84, 842, 8428, 844, 8452, 846, 848, 8488, 850, 8512, 852, 854, 8548, 856, 8572,
+    858, 86, 8606, 862, 8630, 864, 866, 8666, 868, 8690, 870, 872, 8726, 874, 8750, 876,
+    8774, 878, 88, 8810, 882, 8834, 884, 886, 8870, 888, 8894, 890, 892, 8928, 894, 8952,
+    896, 898, 8988, 90, 9012, 902, 904, 9048, 906, 9072, 908, 910, 9108, 912, 9132, 914,
+    916, 9168, 918, 9192, 92, 922, 9226, 924, 9250, 926, 928, 9286, 930, 9310, 932, 934,
+    9346, 936, 9370, 938, 9394, 94, 942, 9430, 944, 9454, 946, 948, 9490, 950, 9512, 952,
+    954, 9548, 956, 9572, 958, 96, 9608, 962, 9632, 964, 966, 9668, 968, 9692, 970, 972,
+    9728, 974, 9752, 976, 978, 9788, 98, 9810, 982, 984, 9846, 986, 9870, 988, 990, 9906,
+    992, 9930, 994, 9954, 996, 998, 9990, 10, 10014, 1002, 1004, 10050, 1006, 10074, 1008, 1010,
+    10108, 1012, 10132, 1014, 1016, 10168, 1018, 10192, 102, 1022, 10228, 1024, 10252, 1026, 1028, 10288,
+    1030, 10312, 1032, 1034, 10348, 1036, 10372, 1038, 104, 10406, 1042, 10430, 1044, 1046, 10466, 1048,
+    10490, 1050, 1052, 10526, 1054, 10550, 1056, 10574, 1058, 106, 10610, 1062, 10634, 1064, 1066, 10670,
+    1068, 10694, 1070, 1072, 10728, 1074, 10752, 1076, 1078, 10788, 108, 10812, 1082, 1084, 10848, 1086,
+    10872, 1088, 1090, 10908, 1092, 10932, 1094, 1096, 10968, 1098, 10992, 110, 1102, 11026, 1104, 11050,
+    1106, 1108, 11086, 1110, 11110, 1112, 1114, 11146, 1116, 11170, 1118, 11194, 112, 1122, 11230, 1124,
+    11254, 1126, 1128, 11290, 1130, 11312, 1132, 1134, 11348, 1136, 11372, 1138, 114, 11408, 1142, 11432,
+    1144, 1146, 11468, 1148, 11492, 1150, 1152, 11528, 1154, 11552, 1156, 1158, 11588, 116, 11610, 1162,
+    1164, 11646, 1166, 11670, 1168, 1170, 11706, 1172, 11730, 1174, 11754, 1176, 1178, 11790, 118, 11814,
+    1182, 1184, 11850, 1186, 11874, 1188, 1190, 11910, 1192, 11932, 1194, 1196, 11968, 1198, 11992, 12,
+    1202, 12028, 1204, 12052, 1206, 1208, 12088, 1210, 12112, 1212, 1214, 12148, 1216, 12172, 1218, 122,
+    12208, 1222, 12230, 1224, 1226, 12266, 1228, 12290, 1230, 1232, 12326, 1234, 12350, 1236, 12374, 1238,
+    124, 12410, 1242, 12434, 1244, 1246, 12470, 1248, 12494, 1250, 1252, 12528, 1254, 12552, 1256, 1258,
+    12588, 126, 12612, 1262, 1264, 12648, 1266, 12672, 1268, 1270, 12708, 1272, 12732, 1274, 1276, 12768,
+    1278, 12792, 128, 1282, 12826, 1284, 12850, 1286, 1288, 12886, 1290, 12910, 1292, 1294, 12946, 1296,
+    12970, 1298, 12994, 130, 1302, 13030, 1304, 13054, 1306, 1308, 13090, 1310, 13114, 1312, 1314, 13148,
+    1316, 13172, 1318, 132, 13208, 1322, 13232, 1324, 1326, 13268, 1328, 13292, 1330, 1332, 13328, 1334,
+    13352, 1336, 1338, 13388, 134, 13412, 1342, 1344, 13446, 1346, 13470, 1348, 1350, 13506, 1352, 13530,
+    1354, 1356, 13566, 1358, 13590, 136, 13614, 1362, 1364, 13650, 1366, 13674, 1368, 1370, 13710, 1372,
+    13732, 1374, 1376, 13768, 1378, 13792, 138, 1382, 13828, 1384, 13852, 1386, 1388, 13888, 1390, 13912,
+    1392, 1394, 13948, 1396, 13972, 1398, 14, 14008, 1402, 14030, 1404, 1406, 14066, 1408, 14090, 1410,
+    1412, 14126, 1414, 14150, 1416, 14174, 1418, 142, 14210, 1422, 14234, 1424, 1426, 14270, 1428, 14294,
+    1430, 1432, 14328, 1434, 14352, 1436, 1438, 14388, 144, 14412, 1442, 1444, 14448, 1446, 14472, 1448,
+    1450, 14508, 1452, 14532, 1454, 1456, 14568, 1458, 14592, 146, 1462, 14626, 1464, 14650, 1466, 1468,
+    14686, 1470, 14710, 1472, 1474, 14746, 1476, 14770, 1478, 14794, 148, 1482, 14830, 1484, 14854, 1486,
+    1488, 14890, 1490, 14914, 1492, 1494, 14948, 1496, 14972, 1498, 150, 15008, 1502, 15032, 1504, 1506,
+    15068, 1508, 15092, 1510, 1512, 15128, 1514, 15152, 1516, 1518, 15188, 152, 15212, 1522, 1524, 15246,
+    1526, 15270, 1528, 1530, 15306, 1532, 15330, 1534, 1536, 15366, 1538, 15390, 154, 15414, 1542, 1544,
+    15450, 1546, 15474, 1548, 1550, 15510, 1552, 15532, 1554, 1556, 15568, 1558, 15592, 156, 1562, 15628,
+    1564, 15652, 1566, 1568, 15688, 1570, 15712, 1572, 1574, 15748, 1576, 15772, 1578, 158, 15808, 1582,
+    15830, 1584, 1586, 15866, 1588, 15890, 1590, 1592, 15926, 1594, 15950, 1596, 1598, 15986, 16, 16010,
+    1602, 16034, 1604, 1606, 16070, 1608, 16094, 1610, 1612, 16130, 1614, 16152, 1616, 1618, 16188, 162,
+    16212, 1622, 1624, 16248, 1626, 16272, 1628, 1630, 16308, 1632, 16332, 1634, 1636, 16368, 1638, 16392,
+    164, 1642, 16428, 1644, 16450, 1646, 1648, 16486, 1650, 16510, 1652, 1654, 16546, 1656, 16570, 1658,
+    16594, 166, 1662, 16630, 1664, 16654, 1666, 1668, 16690, 1670, 16714, 1672, 1674, 16748, 1676, 16772,
+    1678, 168, 16808, 1682, 16832, 1684, 1686, 16868, 1688, 16892, 1690, 1692, 16928, 1694, 16952, 1696,
+    1698, 16988, 170, 17012, 1702, 1704, 17046, 1706, 17070, 1708, 1710, 17106, 1712, 17130, 1714, 1716,
+    17166, 1718, 17190, 172, 17214, 1722, 1724, 17250, 1726, 17274, 1728, 1730, 17310, 1732, 17334, 1734,
+    1736, 17368, 1738, 17392, 174, 1742, 17428, 1744, 17452, 1746, 1748, 17488, 1750, 17512, 1752, 1754,
+    17548, 1756, 17572, 1758, 176, 17608, 1762, 17632, 1764, 1766, 17666, 1768, 17690, 1770, 1772, 17726,
+    1774, 17750, 1776, 1778, 17786, 178, 17810, 1782, 17834, 1784, 1786, 17870, 1788, 17894, 1790, 1792,
+    17930, 1794, 17952, 1796, 1798, 17988, 18, 18012, 1802, 1804, 18048, 1806, 18072, 1808, 1810, 18108,
+    1812, 18132, 1814, 1816, 18168, 1818, 18192, 182, 1822, 18228, 1824, 18250, 1826, 1828, 18286, 1830,
+    18310, 1832, 1834, 18346, 1836, 18370, 1838, 18394, 184, 1842, 18430, 1844, 18454, 1846, 1848, 18490,
+    1850, 18514, 1852, 1854, 18548, 1856, 18572, 1858, 186, 18608, 1862, 18632, 1864, 1866, 18668, 1868,
+    18692, 1870, 1872, 18728, 1874, 18752, 1876, 1878, 18788, 188, 18812, 1882, 1884, 18846, 1886, 18870,
+    1888, 1890, 18906, 1892, 18930, 1894, 1896, 18966, 1898, 18990, 190, 19014, 1902, 1904, 19050, 1906,
+    19074, 1908, 1910, 19110, 1912, 19134, 1914, 1916, 19168, 1918, 19192, 192, 1922, 19228, 1924, 19252,
+    1926, 1928, 19288, 1930, 19312, 1932, 1934, 19348, 1936, 19372, 1938, 194, 19408, 1942, 19432, 1944,
+    1946, 19466, 1948, 19490, 1950, 1952, 19526, 1954, 19550, 1956, 1958, 19586, 196, 19610, 1962, 19634,
+    1964, 1966, 19670, 1968, 19694, 1970, 1972, 19730, 1974, 19752, 1976, 1978, 19788, 198, 19812, 1982,
+    1984, 19848, 1986, 19872, 1988, 1990, 19908, 1992, 19932, 1994, 1996, 19968, 1998, 19992, 3, 2003,
+    20029, 2005, 20053, 2007, 2009, 20087, 2011, 20111, 2013, 2015, 20147, 2017, 20171, 2019, 203, 20207,
+    2023, 20231, 2025, 20255, 2027, 2029, 20291, 2031, 20315, 2033, 2035, 20351, 2037, 20373, 2039, 205,
+    20409, 2043, 20433, 2045, 2047, 20469, 2049, 20493, 2051, 2053, 20529, 2055, 20553, 2057, 2059, 20589,
+    207, 20613, 2063, 2065, 20649, 2067, 20671, 2069, 2071, 20707, 2073, 20731, 2075, 2077, 20767, 2079,
+    20791, 209, 20815, 2083, 2085, 20851, 2087, 20875, 2089, 2091, 20911, 2093, 20935, 2095, 2097, 20969,
+    2099, 20993, 211, 2103, 21029, 2105, 21053, 2107, 2109, 21089, 2111, 21113, 2113, 2115, 21149, 2117,
+    21173, 2119, 213, 21209, 2123, 21233, 2125, 2127, 21267, 2129, 21291, 2131, 2133, 21327, 2135, 21351,
+    2137, 2139, 21387, 215, 21411, 2143, 21435, 2145, 2147, 21471, 2149, 21495, 2151, 2153, 21531, 2155,
+    21555, 2157, 2159, 21589, 217, 21613, 2163, 2165, 21649, 2167, 21673, 2169, 2171, 21709, 2173, 21733,
+    2175, 2177, 21769, 2179, 21793, 219, 2183, 21829, 2185, 21853, 2187, 2189, 21887, 2191, 21911, 2193,
+    2195, 21947, 2197, 21971, 2199, 23, 22007, 2203, 22031, 2205, 22055, 2207, 2209, 22091, 2211, 22115,
+    2213, 2215, 22151, 2217, 22173, 2219, 223, 22209, 2223, 22233, 2225, 2227, 22269, 2229, 22293, 2231,
+    2233, 22329, 2235, 22353, 2237, 2239, 22389, 225, 22413, 2243, 2245, 22449, 2247, 22471, 2249, 2251,
+    22507, 2253, 22531, 2255, 2257, 22567, 2259, 22591, 227, 22615, 2263, 2265, 22651, 2267, 22675, 2269,
+    2271, 22711, 2273, 22735, 2275, 2277, 22769, 2279, 22793, 229, 2283, 22829, 2285, 22853, 2287, 2289,
+    22889, 2291, 22913, 2293, 2295, 22949, 2297, 22973, 2299, 231, 23009, 2303, 23033, 2305, 2307, 23067,
+    2309, 23091, 2311, 2313, 23127, 2315, 23151, 2317, 2319, 23187, 233, 23211, 2323, 23235, 2325, 2327,
+    23271, 2329, 23295, 2331, 2333, 23331, 2335, 23355, 2337, 2339, 23389, 235, 23413, 2343, 2345, 23449,
+    2347, 23473, 2349, 2351, 23509, 2353, 23533, 2355, 2357, 23569, 2359, 23593, 237, 2363, 23629, 2365,
+    23653, 2367, 2369, 23687, 2371, 23711, 2373, 2375, 23747, 2377, 23771, 2379, 239, 23807, 2383, 23831,
+    2385, 23855, 2387, 2389, 23891, 2391, 23915, 2393, 2395, 23951, 2397, 23973, 2399, 25, 24009, 2403,
+    24033, 2405, 2407, 24069, 2409, 24093, 2411, 2413, 24129, 2415, 24153, 2417, 2419, 24189, 243, 24213,
+    2423, 2425, 24249, 2427, 24273, 2429, 2431, 24307, 2433, 24331, 2435, 2437, 24367, 2439, 24391, 245,
+    2442, 2444, 2446, 2448, 2450, 2454, 2456, 2458, 246, 2462, 2466, 2468, 2470, 2472, 2474, 2478,
+    248, 2482, 2484, 2486, 2490, 2492, 2494, 2496, 2498, 250, 2504, 2506, 2508, 2510, 2512, 2516,
+    2518, 252, 2522, 2524, 2528, 2530, 2532, 2534, 2536, 254, 2542, 2544, 2546, 2548, 2552, 2554,
+    2556, 2558, 256, 2562, 2566, 2568, 2570, 2572, 2574, 2578, 258, 2582, 2584, 2586, 2590, 2592,
+    2594, 2596, 2598, 26, 2604, 2606, 2608, 2610, 2614, 2616, 2618, 262, 2622, 2624, 2628, 2630,
+    2632, 2634, 2636, 264, 2642, 2644, 2646, 2648, 2652, 2654, 2656, 2658, 266, 2664, 2666, 2668,
+    2670, 2672, 2676, 2678, 268, 2682, 2684, 2686, 2690, 2692, 2694, 2696, 270, 2702, 2704, 2706,
+    2708, 2710, 2714, 2716, 2718, 272, 2722, 2726, 2728, 2730, 2732, 2734, 2738, 274, 2742, 2744,
+    2746, 2748, 2752, 2754, 2756, 2758, 276, 2764, 2766, 2768, 2770, 2772, 2776, 2778, 278, 2782,
+    2784, 2788, 2790, 2792, 2794, 2796, 28, 2802, 2804, 2806, 2808, 2810, 2814, 2816, 2818, 282,
+    2822, 2826, 2828, 2830, 2832, 2834, 2838, 284, 2842, 2844, 2846, 2850, 2852, 2854, 2856, 2858,
+    286, 2864, 2866, 2868, 2870, 2872, 2876, 2878, 288, 2882, 2884, 2888, 2890, 2892, 2894, 2896,
+    290, 2902, 2904, 2906, 2908, 2912, 2914, 2916, 2918, 292, 2924, 2926, 2928, 2930, 2932, 2934,
+    2938, 294, 2942, 2944, 2946, 2950, 2952, 2954, 2956, 2958, 296, 2964, 2966, 2968, 2970, 2974,
+    2976, 2978, 298, 2982, 2986, 2988, 2990, 2992, 2994, 2996, 30, 3002, 3004, 3006, 3008, 3012,
+    3014, 3016, 3018, 302, 3024, 3026, 3028, 3030, 3032, 3036, 3038, 304, 3042, 3044, 3046, 3050,
+    3052, 3054, 3056, 306, 3062, 3064, 3066, 3068, 3070, 3074, 3076, 3078, 308, 3082, 3086, 3088,
+    3090, 3092, 3094, 3098, 310, 3102, 3104, 3106, 3108, 3112, 3114, 3116, 3118, 312, 3124, 3126,
+    3128, 3130, 3132, 3136, 3138, 314, 3142, 3144, 3148, 3150, 3152, 3154, 3156, 316, 3162, 3164,
+    3166, 3168, 3170, 3174, 3176, 3178, 318, 3182, 3186, 3188, 3190, 3192, 3194, 3198, 32, 3202,
+    3204, 3206, 3210, 3212, 3214, 3216, 3218, 322, 3224, 3226, 3228, 3230, 3232, 3236, 3238, 324,
+    3242, 3244, 3248, 3250, 3252, 3254, 3256, 326, 3262, 3264, 3266, 3268, 3272, 3274, 3276, 3278,
+    328, 3284, 3286, 3288, 3290, 3292, 3294, 3298, 330, 3302, 3304, 3306, 3310, 3312, 3314, 3316,
+    3318, 332, 3324, 3326, 3328, 3330, 3334, 3336, 3338, 334, 3342, 3346, 3348, 3350, 3352, 3354,
+    3356, 336, 3362, 3364, 3366, 3368, 3372, 3374, 3376, 3378, 338, 3384, 3386, 3388, 3390, 3392,
+    3396, 3398, 34, 3402, 3404, 3408, 3410, 3412, 3414, 3416, 342, 3422, 3424, 3426, 3428, 3430,
+    3434, 3436, 3438, 344, 3442, 3446, 3448, 3450, 3452, 3454, 3458, 346, 3462, 3464, 3466, 3468,
+    3472, 3474, 3476, 3478, 348, 3484, 3486, 3488, 3490, 3492, 3496, 3498, 350, 3502, 3504, 3508,
+    3510, 3512, 3514, 3516, 352, 3522, 3524, 3526, 3528, 3530, 3534, 3536, 3538, 354, 3542, 3546,
+    3548, 3550, 3552, 3554, 3558, 356, 3562, 3564, 3566, 3570, 3572, 3574, 3576, 3578, 358, 3584,
+    3586, 3588, 3590, 3592, 3596, 3598, 36, 3602, 3604, 3608, 3610, 3612, 3614, 3616, 362, 3622,
+    3624, 3626, 3628, 3632, 3634, 3636, 3638, 364, 3644, 3646, 3648, 3650, 3652, 3654, 3658, 366,
+    3662, 3664, 3666, 3670, 3672, 3674, 3676, 3678, 368, 3684, 3686, 3688, 3690, 3694, 3696, 3698,
+    370, 3702, 3706, 3708, 3710, 3712, 3714, 3716, 372, 3722, 3724, 3726, 3728, 3732, 3734, 3736,
+    3738, 374, 3744, 3746, 3748, 3750, 3752, 3756, 3758, 376, 3762, 3764, 3768, 3770, 3772, 3774,
+    3776, 378, 3782, 3784, 3786, 3788, 3790, 3794, 3796, 3798, 38, 3802, 3806, 3808, 3810, 3812,
+    3814, 3818, 382, 3822, 3824, 3826, 3830, 3832, 3834, 3836, 3838, 384, 3844, 3846, 3848, 3850,
+    3852, 3856, 3858, 386, 3862, 3864, 3868, 3870, 3872, 3874, 3876, 388, 3882, 3884, 3886, 3888,
+    3890, 3894, 3896, 3898, 390, 3902, 3906, 3908, 3910, 3912, 3914, 3918, 392, 3922, 3924, 3926,
+    3930, 3932, 3934, 3936, 3938, 394, 3944, 3946, 3948, 3950, 3952, 3956, 3958, 396, 3962, 3964,
+    3968, 3970, 3972, 3974, 3976, 398, 3982, 3984, 3986, 3988, 3992, 3994, 3996, 3998, 4, 4004,
+    4006, 4008, 4010, 4012, 4014, 4018, 402, 4022, 4024, 4026, 4030, 4032, 4034, 4036, 404, 4042,
+    4044, 4046, 4048, 4050, 4054, 4056, 4058, 406, 4062, 4066, 4068, 4070, 4072, 4074, 4076, 408,
+    4082, 4084, 4086, 4088, 4092, 4094, 4096, 4098, 410, 4104, 4106, 4108, 4110, 4112, 4116, 4118,
+    412, 4122, 4124, 4128, 4130, 4132, 4134, 4136, 414, 4142, 4144, 4146, 4148, 4150, 4154, 4156,
+    4158, 416, 4162, 4166, 4168, 4170, 4172, 4174, 4178, 418, 4182, 4184, 4186, 4190, 4192, 4194,
+    4196, 4198, 42, 4204, 4206, 4208, 4210, 4212, 4216, 4218, 422, 4222, 4224, 4228, 4230, 4232,
+    4234, 4236, 424, 4242, 4244, 4246, 4248, 4252, 4254, 4256, 4258, 426, 4262, 4266, 4268, 4270,
+    4272, 4274, 4278, 428, 4282, 4284, 4286, 4290, 4292, 4294, 4296, 4298, 430, 4304, 4306, 4308,
+    4310, 4312, 4316, 4318, 432, 4322, 4324, 4328, 4330, 4332, 4334, 4336, 434, 4342, 4344, 4346,
+    4348, 4352, 4354, 4356, 4358, 436, 4364, 4366, 4368, 4370, 4372, 4374, 4378, 438, 4382, 4384,
+    4386, 4390, 4392, 4394, 4396, 44, 4402, 4404, 4406, 4408, 4410, 4414, 4416, 4418, 442, 4422,
+    4426, 4428, 4430, 4432, 4434, 4436, 444, 4442, 4444, 4446, 4448, 4452, 4454, 4456, 4458, 446,
+    4464, 4466, 4468, 4470, 4472, 4476, 4478, 448, 4482, 4484, 4488, 4490, 4492, 4494, 4496, 450,
+    4502, 4504, 4506, 4508, 4510, 4514, 4516, 4518, 452, 4522, 4526, 4528, 4530, 4532, 4534, 4538,
+    454, 4542, 4544, 4546, 4550, 4552, 4554, 4556, 4558, 456, 4564, 4566, 4568, 4570, 4572, 4576,
+    4578, 458, 4582, 4584, 4588, 4590, 4592, 4594, 4596, 46, 4602, 4604, 4606, 4608, 4612, 4614,
+    4616, 4618, 462, 4622, 4626, 4628, 4630, 4632, 4634, 4638, 464, 4642, 4644, 4646, 4650, 4652,
+    4654, 4656, 4658, 466, 4664, 4666, 4668, 4670, 4674, 4676, 4678, 468, 4682, 4684, 4688, 4690,
+    4692, 4694, 4696, 470, 4702, 4704, 4706, 4708, 4712, 4714, 4716, 4718, 472, 4724, 4726, 4728,
+    4730, 4732, 4734, 4738, 474, 4742, 4744, 4746, 4750, 4752, 4754, 4756, 476, 4762, 4764, 4766,
+    4768, 4770, 4774, 4776, 4778, 478, 4782, 4786, 4788, 4790, 4792, 4794, 4796, 48, 4802, 4804,
+    4806, 4808, 4812, 4814, 4816, 4818, 482, 4824, 4826, 4828, 4830, 4832, 4836, 4838, 484, 4842,
+    4844, 4848, 4850, 4852, 4854, 4856, 486, 4862, 4864, 4866, 4868, 4870, 4874, 4876, 4878, 488,
+    4882, 4888, 4892, 4898, 490, 4906, 4912, 4916, 492, 4926, 4930, 4936, 494, 4944, 4950, 4954,
+    496, 4964, 4968, 4974, 498, 4982, 4988, 4992, 4998, 50, 5006, 5012, 5016, 502, 5026, 5030,
+    5036, 504, 5044, 5050, 5054, 506, 5064, 5068, 5074, 508, 5084, 5088, 5092, 5098, 510, 5106,
+    5112, 5116, 512, 5126, 5130, 5136, 514, 5146, 5150, 5154, 516, 5164, 5168, 5174, 518, 5184,
+    5188, 5192, 5198, 52, 5208, 5212, 5216, 522, 5226, 5230, 5236, 524, 5246, 5250, 5254, 526,
+    5264, 5270, 5274, 528, 5284, 5288, 5292, 530, 5302, 5308, 5312, 5316, 532, 5326, 5332, 5336,
+    534, 5346, 5350, 5354, 536, 5364, 5370, 5374, 538, 5384, 5388, 5394, 54, 5402, 5408, 5412,
+    5416, 542, 5426, 5432, 5436, 544, 5446, 5450, 5456, 546, 5464, 5470, 5474, 548, 5484, 5488,
+    5494, 550, 5502, 5508, 5512, 5518, 552, 5526, 5532, 5536, 554, 5546, 5550, 5556, 556, 5564,
+    5570, 5574, 558, 5584, 5588, 5594, 56, 5602, 5608, 5612, 5618, 562, 5626, 5632, 5636, 564,
+    5646, 5650, 5656, 566, 5664, 5670, 5674, 568, 5684, 5688, 5694, 570, 5702, 5708, 5712, 5718,
+    572, 5726, 5732, 5736, 574, 5746, 5750, 5756, 576, 5764, 5770, 5774, 578, 5784, 5788, 5794,
+    58, 5804, 5808, 5812, 5818, 582, 5826, 5832, 5836, 584, 5846, 5850, 5856, 586, 5866, 5870,
+    5874, 588, 5884, 5888, 5894, 590, 5904, 5908, 5912, 5918, 592, 5928, 5932, 5936, 594, 5946,
+    5950, 5956, 596, 5966, 5970, 5974, 598, 5984, 5990, 5994, 6, 6004, 6008, 6012, 602, 6022,
+    6028, 6032, 6036, 604, 6046, 6052, 6056, 606, 6066, 6070, 6074, 608, 6084, 6090, 6094, 610,
+    6104, 6108, 6114, 612, 6122, 6128, 6132, 6136, 614, 6146, 6152, 6156, 616, 6166, 6170, 6176,
+    618, 6184, 6190, 6194, 62, 6204, 6208, 6214, 622, 6222, 6228, 6232, 6238, 624, 6246, 6252,
+    6256, 626, 6266, 6270, 6276, 628, 6284, 6290, 6294, 630, 6304, 6308, 6314, 632, 6322, 6328,
+    6332, 6338, 634, 6346, 6352, 6356, 636, 6366, 6370, 6376, 638, 6384, 6390, 6394, 64, 6404,
+    6408, 6414, 642, 6422, 6428, 6432, 6438, 644, 6446, 6452, 6456, 646, 6466, 6470, 6476, 648,
+    6484, 6490, 6494, 650, 6504, 6508, 6514, 652, 6524, 6528, 6532, 6538, 654, 6546, 6552, 6556,
+    656, 6566, 6570, 6576, 658, 6586, 6590, 6594, 66, 6604, 6608, 6614, 662, 6624, 6628, 6632,
+    6638, 664, 6648, 6652, 6656, 666, 6666, 6670, 6676, 668, 6686, 6690, 6694, 670, 6704, 6710,
+    6714, 672, 6724, 6728, 6732, 674, 6742, 6748, 6752, 6756, 676, 6766, 6772, 6776, 678, 6786,
+    6790, 6794, 68, 6804, 6810, 6814, 682, 6824, 6828, 6834, 684, 6842, 6848, 6852, 6856, 686,
+    6866, 6872, 6876, 688, 6886, 6890, 6896, 690, 6904, 6910, 6914, 692, 6924, 6928, 6934, 694,
+    6942, 6948, 6952, 6958, 696, 6966, 6972, 6976, 698, 6986, 6990, 6996, 70, 7004, 7010, 7014,
+    702, 7024, 7028, 7034, 704, 7042, 7048, 7052, 7058, 706, 7066, 7072, 7076, 708, 7086, 7090,
+    7096, 710, 7104, 7110, 7114, 712, 7124, 7128, 7134, 714, 7144, 7148, 7152, 7158, 716, 7166,
+    7172, 7176, 718, 7186, 7190, 7196, 72, 7206, 7210, 7214, 722, 7224, 7228, 7234, 724, 7244,
+    7248, 7252, 7258, 726, 7266, 7272, 7276, 728, 7286, 7290, 7296, 730, 7306, 7310, 7314, 732,
+    7324, 7328, 7334, 734, 7344, 7348, 7352, 7358, 736, 7368, 7372, 7376, 738, 7386, 7390, 7396,
+    74, 7406, 7410, 7414, 742, 7424, 7430, 7434, 744, 7444, 7448, 7452, 746, 7462, 7468, 7472,
+    7476, 748, 7486, 7492, 7496, 750, 7506, 7510, 7514, 752, 7524, 7530, 7534, 754, 7544, 7548,
+    7554, 756, 7562, 7568, 7572, 7576, 758, 7586, 7592, 7596, 76, 7606, 7610, 7616, 762, 7624,
+    7630, 7634, 764, 7644, 7648, 7654, 766, 7662, 7668, 7672, 7678, 768, 7686, 7692, 7696, 770,
+    7706, 7710, 7716, 772, 7724, 7730, 7734, 774, 7744, 7748, 7754, 776, 7762, 7768, 7772, 7778,
+    778, 7786, 7792, 7796, 78, 7806, 7810, 7816, 782, 7824, 7830, 7834, 784, 7844, 7848, 7854,
+    786, 7864, 7868, 7872, 7878, 788, 7886, 7892, 7896, 790, 7906, 7910, 7916, 792, 7926, 7930,
+    7934, 794, 7944, 7948, 7954, 796, 7964, 7968, 7972, 7978, 798, 7988, 7992, 7996, 8, 8006,
+    8010, 8016, 802, 8026, 8030, 8034, 804, 8044, 8050, 8054, 806, 8064, 8068, 8072, 808, 8082,
+    8088, 8092, 8096, 810, 8106, 8112, 8116, 812, 8126, 8130, 8134, 814, 8144, 8150, 8154, 816,
+    8164, 8168, 8172, 818, 8182, 8188, 8192, 8196, 82, 8206, 8212, 8216, 822, 8226, 8230, 8234,
+    824, 8244, 8250, 8254, 826, 8264, 8268, 8274, 828, 8282, 8288, 8292, 8296, 830, 8306, 8312,
+    8316, 832, 8326, 8330, 8336, 834, 8344, 8350, 8354, 836, 8364, 8368, 8374, 838, 8382, 8388,
+    8392, 8398, 84, 8406, 8412, 8416, 842, 8426, 8430, 8436, 844, 8444, 8450, 8454, 846, 8464,
+    8468, 8474, 848, 8482, 8488, 8492, 8498, 850, 8506, 8512, 8516, 852, 8526, 8530, 8536, 854,
+    8544, 8550, 8554, 856, 8564, 8568, 8574, 858, 8584, 8588, 8592, 8598, 86, 8606, 8612, 8616,
+    862, 8626, 8630, 8636, 864, 8646, 8650, 8654, 866, 8664, 8668, 8674, 868, 8684, 8688, 8692,
+    8698, 870, 8708, 8712, 8716, 872, 8726, 8730, 8736, 874, 8746, 8750, 8754, 876, 8764, 8770,
+    8774, 878, 8784, 8788, 8792, 88, 8802, 8808, 8812, 8816, 882, 8826, 8832, 8836, 884, 8846,
+    8850, 8854, 886, 8864, 8870, 8874, 888, 8884, 8888, 8894, 890, 8902, 8908, 8912, 8916, 892,
+    8926, 8932, 8936, 894, 8946, 8950, 8956, 896, 8964, 8970, 8974, 898, 8984, 8988, 8994, 90,
+    9002, 9008, 9012, 9016, 902, 9026, 9032, 9036, 904, 9046, 9050, 9056, 906, 9064, 9070, 9074,
+    908, 9084, 9088, 9094, 910, 9102, 9108, 9112, 9118, 912, 9126, 9132, 9136, 914, 9146, 9150,
+    9156, 916, 9164, 9170, 9174, 918, 9184, 9188, 9194, 92, 9202, 9208, 9212, 9218, 922, 9226,
+    9232, 9236, 924, 9246, 9250, 9256, 926, 9264, 9270, 9274, 928, 9284, 9288, 9294, 930, 9304,
+    9308, 9312, 9318, 932, 9326, 9332, 9336, 934, 9346, 9350, 9356, 936, 9366, 9370, 9374, 938,
+    9384, 9388, 9394, 94, 9404, 9408, 9412, 9418, 942, 9428, 9432, 9436, 944, 9446, 9450, 9456,
+    946, 9466, 9470, 9474, 948, 9484, 9490, 9494, 950, 9504, 9508, 9512, 952, 9522, 9528, 9532,
+    9536, 954, 9546, 9552, 9556, 956, 9566, 9570, 9574, 958, 9584, 9590, 9594, 96, 9604, 9608,
+    9614, 962, 9622, 9628, 9632, 9636, 964, 9646, 9652, 9656, 966, 9666, 9670, 9676, 968, 9684,
+    9690, 9694, 970, 9704, 9708, 9714, 972, 9722, 9728, 9732, 9738, 974, 9746, 9752, 9756, 976,
+    9766, 9776, 978, 9794, 98, 9814, 982, 9832, 984, 9852, 986, 9870, 988, 9890, 990, 9908,
+    992, 9928, 994, 9946, 996, 9966, 998, 9984, 9994, 10, 10014, 1002, 10032, 1004, 10052, 1006,
+    10070, 1008, 10090, 1010, 10108, 1012, 10128, 1014, 10148, 1016, 10166, 1018, 10186, 10194, 102, 10214,
+    1022, 10232, 1024, 10252, 1026, 10272, 1028, 10290, 1030, 10310, 1032, 10328, 1034, 10348, 1036, 10366,
+    1038, 10386, 10396, 104, 10414, 1042, 10434, 1044, 10452, 1046, 10472, 1048, 10490, 1050, 10510, 1052,
+    10528, 1054, 10548, 1056, 10566, 1058, 10586, 106, 10604, 10614, 1062, 10634, 1064, 10652, 1066, 10672,
+    1068, 10690, 1070, 10710, 1072, 10728, 1074, 10748, 1076, 10766, 1078, 10786, 108, 10806, 10814, 1082,
+    10834, 1084, 10852, 1086, 10872, 1088, 10890, 1090, 10910, 1092, 10930, 1094, 10948, 1096, 10968, 1098,
+    10986, 110, 11006, 11014, 1102, 11034, 1104, 11054, 1106, 11072, 1108, 11092, 1110, 11110, 1112, 11130,
+    1114, 11148, 1116, 11168, 1118, 11186, 112, 11206, 11216, 1122, 11234, 1124, 11254, 1126, 11272, 1128,
+    11292, 1130, 11310, 1132, 11330, 1134, 11348, 1136, 11368, 1138, 11386, 114, 11406, 1142, 11426, 11434,
+    1144, 11454, 1146, 11472, 1148, 11492, 1150, 11510, 1152, 11530, 1154, 11548, 1156, 11568, 1158, 11588,
+    116, 11606, 1162, 11626, 11634, 1164, 11654, 1166, 11672, 1168, 11692, 1170, 11712, 1172, 11730, 1174,
+    11750, 1176, 11768, 1178, 11788, 118, 11806, 1182, 11826, 11836, 1184, 11854, 1186, 11874, 1188, 11892,
+    1190, 11912, 1192, 11930, 1194, 11950, 1196, 11968, 1198, 11988, 12, 12006, 1202, 12026, 1204, 12044,
+    12054, 1206, 12074, 1208, 12092, 1210, 12112, 1212, 12130, 1214, 12150, 1216, 12168, 1218, 12188, 122,
+    12208, 1222, 12226, 1224, 12246, 12254, 1226, 12274, 1228, 12292, 1230, 12312, 1232, 12332, 1234, 12350,
+    1236, 12370, 1238, 12388, 124, 12408, 1242, 12426, 1244, 12446, 12454, 1246, 12474, 1248, 12494, 1250,
+    12512, 1252, 12532, 1254, 12550, 1256, 12570, 1258, 12588, 126, 12608, 1262, 12626, 1264, 12646, 1266,
+    12664, 12674, 1268, 12694, 1270, 12712, 1272, 12732, 1274, 12750, 1276, 12770, 1278, 12788, 128, 12808,
+    1282, 12826, 1284, 12846, 1286, 12866, 12874, 1288, 12894, 1290, 12912, 1292, 12932, 1294, 12950, 1296,
+    12970, 1298, 12990, 130, 13008, 1302, 13028, 1304, 13046, 1306, 13066, 13074, 1308, 13094, 1310, 13114,
+    1312, 13132, 1314, 13152, 1316, 13170, 1318, 13190, 132, 13208, 1322, 13228, 1324, 13246, 1326, 13266,
+    13276, 1328, 13294, 1330, 13314, 1332, 13332, 1334, 13352, 1336, 13370, 1338, 13390, 134, 13408, 1342,
+    13428, 1344, 13446, 1346, 13466, 1348, 13484, 13494, 1350, 13514, 1352, 13532, 1354, 13552, 1356, 13570,
+    1358, 13590, 136, 13608, 1362, 13628, 1364, 13648, 1366, 13666, 1368, 13686, 13694, 1370, 13714, 1372,
+    13732, 1374, 13752, 1376, 13772, 1378, 13790, 138, 13810, 1382, 13828, 1384, 13848, 1386, 13866, 1388,
+    13886, 13896, 1390, 13914, 1392, 13934, 1394, 13952, 1396, 13972, 1398, 13990, 14, 14010, 1402, 14028,
+    1404, 14048, 1406, 14066, 1408, 14086, 1410, 14104, 14114, 1412, 14134, 1414, 14152, 1416, 14172, 1418,
+    14190, 142, 14210, 1422, 14228, 1424, 14248, 1426, 14266, 1428, 14286, 1430, 14306, 14314, 1432, 14334,
+    1434, 14352, 1436, 14372, 1438, 14390, 144, 14410, 1442, 14430, 1444, 14448, 1446, 14468, 1448, 14486,
+    1450, 14506, 14514, 1452, 14534, 1454, 14554, 1456, 14572, 1458, 14592, 146, 14610, 1462, 14630, 1464,
+    14648, 1466, 14668, 1468, 14686, 1470, 14706, 14716, 1472, 14734, 1474, 14754, 1476, 14772, 1478, 14792,
+    148, 14810, 1482, 14830, 1484, 14848, 1486, 14868, 1488, 14886, 1490, 14906, 1492, 14926, 14934, 1494,
+    14954, 1496, 14972, 1498, 14992, 150, 15010, 1502, 15030, 1504, 15048, 1506, 15068, 1508, 15088, 1510,
+    15106, 1512, 15126, 15134, 1514, 15154, 1516, 15172, 1518, 15192, 152, 15212, 1522, 15230, 1524, 15250,
+    1526, 15268, 1528, 15288, 1530, 15306, 1532, 15326, 15336, 1534, 15354, 1536, 15374, 1538, 15392, 154,
+    15412, 1542, 15430, 1544, 15450, 1546, 15468, 1548, 15488, 1550, 15506, 1552, 15526, 1554, 15544, 15554,
+    1556, 15574, 1558, 15592, 156, 15612, 1562, 15630, 1564, 15650, 1566, 15668, 1568, 15688, 1570, 15708,
+    1572, 15726, 1574, 15746, 15754, 1576, 15774, 1578, 15792, 158, 15812, 1582, 15830, 1584, 15850, 1586,
+    15870, 1588, 15888, 1590, 15908, 1592, 15926, 1594, 15946, 15954, 1596, 15974, 1598, 15994, 16, 16012,
+    1602, 16032, 1604, 16050, 1606, 16070, 1608, 16088, 1610, 16108, 1612, 16126, 1614, 16146, 1616, 16164,
+    16174, 1618, 16194, 162, 16212, 1622, 16232, 1624, 16250, 1626, 16270, 1628, 16288, 1630, 16308, 1632,
+    16326, 1634, 16346, 1636, 16366, 16374, 1638, 16394, 164, 16412, 1642, 16432, 1644, 16450, 1646, 16470,
+    1648, 16490, 1650, 16508, 1652, 16528, 1654, 16546, 1656, 16566, 16574, 1658, 16594, 166, 16614, 1662,
+    16632, 1664, 16652, 1666, 16670, 1668, 16690, 1670, 16708, 1672, 16728, 1674, 16746, 1676, 16766, 16776,
+    1678, 16794, 168, 16814, 1682, 16832, 1684, 16852, 1686, 16870, 1688, 16890, 1690, 16908, 1692, 16928,
+    1694, 16946, 1696, 16966, 1698, 16984, 16994, 170, 17014, 1702, 17032, 1704, 17052, 1706, 17070, 1708,
+    17090, 1710, 17108, 1712, 17128, 1714, 17148, 1716, 17166, 1718, 17186, 17194, 172, 17214, 1722, 17232,
+    1724, 17252, 1726, 17272, 1728, 17290, 1730, 17310, 1732, 17328, 1734, 17348, 1736, 17366, 1738, 17386,
+    17396, 174, 17414, 1742, 17434, 1744, 17452, 1746, 17472, 1748, 17490, 1750, 17510, 1752, 17528, 1754,
+    17548, 1756, 17566, 1758, 17586, 176, 17604, 17614, 1762, 17634, 1764, 17652, 1766, 17672, 1768, 17690,
+    1770, 17710, 1772, 17728, 1774, 17748, 1776, 17766, 1778, 17786, 178, 17806, 17814, 1782, 17834, 1784,
+    17852, 1786, 17872, 1788, 17890, 1790, 17910, 1792, 17930, 1794, 17948, 1796, 17968, 1798, 17986, 18,
+    18006, 18014, 1802, 18034, 1804, 18054, 1806, 18072, 1808, 18092, 1810, 18110, 1812, 18130, 1814, 18148,
+    1816, 18168, 1818, 18186, 182, 18206, 18216, 1822, 18234, 1824, 18254, 1826, 18272, 1828, 18292, 1830,
+    18310, 1832, 18330, 1834, 18348, 1836, 18368, 1838, 18386, 184, 18406, 1842, 18424, 18434, 1844, 18454,
+    1846, 18472, 1848, 18492, 1850, 18510, 1852, 18530, 1854, 18548, 1856, 18568, 1858, 18588, 186, 18606,
+    1862, 18626, 18634, 1864, 18654, 1866, 18672, 1868, 18692, 1870, 18712, 1872, 18730, 1874, 18750, 1876,
+    18768, 1878, 18788, 188, 18806, 1882, 18826, 18836, 1884, 18854, 1886, 18874, 1888, 18892, 1890, 18912,
+    1892, 18930, 1894, 18950, 1896, 18968, 1898, 18988, 190, 19006, 1902, 19026, 1904, 19044, 19054, 1906,
+    19074, 1908, 19092, 1910, 19112, 1912, 19130, 1914, 19150, 1916, 19168, 1918, 19188, 192, 19208, 1922,
+    19226, 1924, 19246, 19254, 1926, 19274, 1928, 19292, 1930, 19312, 1932, 19330, 1934, 19350, 1936, 19370,
+    1938, 19388, 194, 19408, 1942, 19426, 1944, 19446, 19454, 1946, 19474, 1948, 19494, 1950, 19512, 1952,
+    1954, 19550, 1956, 1958, 196, 1962, 1964, 1966, 1968, 1970, 1972, 1974, 1976, 1978, 198, 1982,
+    1984, 1986, 1988, 1990, 1992, 1994, 1996, 19970, 1998, 3, 2003, 2005, 2007, 2009, 2011, 2013,
+    2015, 2017, 2019, 203, 2023, 2025, 2027, 2029, 2031, 2033, 2035, 2037, 2039, 20391, 205, 2043,
+    2045, 2047, 2049, 2051, 2053, 2055, 2057, 2059, 207, 2063, 2065, 2067, 2069, 2071, 2073, 2075,
+    2077, 2079, 20791, 209, 2083, 2085, 2087, 2089, 2091, 2093, 2095, 2097, 2099, 211, 2103, 2105,
+    2107, 2109, 2111, 2113, 2115, 2117, 2119, 213, 21211, 2123, 2125, 2127, 2129, 2131, 2133, 2135,
+    2137, 2139, 215, 2143, 2145, 2147, 2149, 2151, 2153, 2155, 2157, 2159, 217, 21611, 2163, 2165,
+    2167, 2169, 2171, 2173, 2175, 2177, 2179, 219, 2183, 2185, 2187, 2189, 2191, 2193, 2195, 2197,
+    2199, 23, 2203, 22031, 2205, 2207, 2209, 2211, 2213, 2215, 2217, 2219, 223, 2223, 2225, 2227,
+    2229, 2231, 2233, 2235, 2237, 2239, 225, 2243, 22431, 2245, 2247, 2249, 2251, 2253, 2255, 2257,
+    2259, 227, 2263, 2265, 2267, 2269, 2271, 2273, 2275, 2277, 2279, 229, 2283, 2285, 22851, 2287,
+    2289, 2291, 2293, 2295, 2297, 2299, 231, 2303, 2305, 2307, 2309, 2311, 2313, 2315, 2317, 2319,
+    233, 2323, 2325, 2327, 23271, 2329, 2331, 2333, 2335, 2337, 2339, 235, 2343, 2345, 2347, 2349,
+    2351, 2353, 2355, 2357, 2359, 237, 2363, 2365, 2367, 23671, 2369, 2371, 2373, 2375, 2377, 2379,
+    239, 2383, 2385, 2387, 2389, 2391, 2393, 2395, 2397, 2399, 25, 2403, 2405, 2407, 2409, 24091,
+    2411, 2413, 2415, 2417, 2419, 243, 2423, 2425, 2427, 2429, 2431, 2433, 2435, 2437, 2439, 245,
+    2443, 2445, 2447, 2449, 24491, 2451, 2453, 2455, 2457, 2459, 247, 2463, 2465, 2467, 2469, 2471,
+    2473, 2475, 2477, 2479, 249, 2483, 2485, 2487, 2489, 2491, 24911, 2493, 2495, 2497, 2499, 251,
+    2503, 2505, 2507, 2509, 2511, 2513, 2515, 2517, 2519, 253, 2523, 2525, 2527, 2529, 2531, 2533,
+    25331, 2535, 2537, 2539, 255, 2543, 2545, 2547, 2549, 2551, 2553, 2555, 2557, 2559, 257, 2563,
+    2565, 2567, 2569, 2571, 2573, 25731, 2575, 2577, 2579, 259, 2583, 2585, 2587, 2589, 2591, 2593,
+    2595, 2597, 2599, 27, 2603, 2605, 2607, 2609, 2611, 2613, 2615, 26151, 2617, 2619, 263, 2623,
+    2625, 2627, 2629, 2631, 2633, 2635, 2637, 2639, 265, 2643, 2645, 2647, 2649, 2651, 2653, 2655,
+    26551, 2657, 2659, 267, 2663, 2665, 2667, 2669, 2671, 2673, 2675, 2677, 2679, 269, 2683, 2685,
+    2687, 2689, 2691, 2693, 2695, 2697, 26971, 2699, 271, 2703, 2705, 2707, 2709, 2711, 2713, 2715,
+    2717, 2719, 273, 2723, 2725, 2727, 2729, 2731, 2733, 2735, 2737, 27371, 2739, 275, 2743, 2745,
+    2747, 2749, 2751, 2753, 2755, 2757, 2759, 277, 2763, 2765, 2767, 2769, 2771, 2773, 2775, 2777,
+    2779, 27791, 279, 2783, 2785, 2787, 2789, 2791, 2793, 2795, 2797, 2799, 29, 2803, 2805, 2807,
+    2809, 2811, 2813, 2815, 2817, 2819, 283, 28211, 2823, 2825, 2827, 2829, 2831, 2833, 2835, 2837,
+    2839, 285, 2843, 2845, 2847, 2849, 2851, 2853, 2855, 2857, 2859, 287, 28611, 2863, 2865, 2867,
+    2869, 2871, 2873, 2875, 2877, 2879, 289, 2883, 2885, 2887, 2889, 2891, 2893, 2895, 2897, 2899,
+    291, 2903, 29031, 2905, 2907, 2909, 2911, 2913, 2915, 2917, 2919, 293, 2923, 2925, 2927, 2929,
+    2931, 2933, 2935, 2937, 2939, 295, 2943, 29431, 2945, 2947, 2949, 2951, 2953, 2955, 2957, 2959,
+    297, 2963, 2965, 2967, 2969, 2971, 2973, 2975, 2977, 2979, 299, 2983, 2985, 29851, 2987, 2989,
+    2991, 2993, 2995, 2997, 2999, 31, 3003, 3005, 3007, 3009, 3011, 3013, 3015, 3017, 3019, 303,
+    3023, 3025, 3027, 30271, 3029, 3031, 3033, 3035, 3037, 3039, 305, 3043, 3045, 3047, 3049, 3051,
+    3053, 3055, 3057, 3059, 307, 3063, 3065, 3067, 30671, 3069, 3071, 3073, 3075, 3077, 3079, 309,
+    3083, 3085, 3087, 3089, 3091, 3093, 3095, 3097, 3099, 311, 3103, 3105, 3107, 3109, 31091, 3111,
+    3113, 3115, 3117, 3119, 313, 3123, 3125, 3127, 3129, 3131, 3133, 3135, 3137, 3139, 315, 3143,
+    3145, 3147, 3149, 31491, 3151, 3153, 3155, 3157, 3159, 317, 3163, 3165, 3167, 3169, 3171, 3173,
+    3175, 3177, 3179, 319, 3183, 3185, 3187, 3189, 3191, 31911, 3193, 3195, 3197, 3199, 33, 3203,
+    3205, 3207, 3209, 3211, 3213, 3215, 3217, 3219, 323, 3223, 3225, 3227, 3229, 3231, 3233, 32331,
+    3235, 3237, 3239, 325, 3243, 3245, 3247, 3249, 3251, 3253, 3255, 3257, 3259, 327, 3263, 3265,
+    3267, 3269, 3271, 3273, 32731, 3275, 3277, 3279, 329, 3283, 3285, 3287, 3289, 3291, 3293, 3295,
+    3297, 3299, 331, 3303, 3305, 3307, 3309, 3311, 3313, 3315, 33151, 3317, 3319, 333, 3323, 3325,
+    3327, 3329, 3331, 3333, 3335, 3337, 3339, 335, 3343, 3345, 3347, 3349, 3351, 3353, 3355, 33551,
+    3357, 3359, 337, 3363, 3365, 3367, 3369, 3371, 3373, 3375, 3377, 3379, 339, 3383, 3385, 3387,
+    3389, 3391, 3393, 3395, 3397, 33971, 3399, 35, 3403, 3405, 3407, 3409, 3411, 3413, 3415, 3417,
+    3419, 343, 3423, 3425, 3427, 3429, 3431, 3433, 3435, 3437, 34371, 3439, 345, 3443, 3445, 3447,
+    3449, 3451, 3453, 3455, 3457, 3459, 347, 3463, 3465, 3467, 3469, 3471, 3473, 3475, 3477, 3479,
+    34791, 349, 3483, 3485, 3487, 3489, 3491, 3493, 3495, 3497, 3499, 351, 3503, 3505, 3507, 3509,
+    3511, 3513, 3515, 3517, 3519, 353, 35211, 3523, 3525, 3527, 3529, 3531, 3533, 3535, 3537, 3539,
+    355, 3543, 3545, 3547, 3549, 3551, 3553, 3555, 3557, 3559, 357, 35611, 3563, 3565, 3567, 3569,
+    3571, 3573, 3575, 3577, 3579, 359, 3583, 3585, 3587, 3589, 3591, 3593, 3595, 3597, 3599, 37,
+    3603, 36031, 3605, 3607, 3609, 3611, 3613, 3615, 3617, 3619, 363, 3623, 3625, 3627, 3629, 3631,
+    3633, 3635, 3637, 3639, 365, 3643, 36431, 3645, 3647, 3649, 3651, 3653, 3655, 3657, 3659, 367,
+    3663, 3665, 3667, 3669, 3671, 3673, 3675, 3677, 3679, 369, 3683, 3685, 36851, 3687, 3689, 3691,
+    3693, 3695, 3697, 3699, 371, 3703, 3705, 3707, 3709, 3711, 3713, 3715, 3717, 3719, 373, 3723,
+    3725, 3727, 37271, 3729, 3731, 3733, 3735, 3737, 3739, 375, 3743, 3745, 3747, 3749, 3751, 3753,
+    3755, 3757, 3759, 377, 3763, 3765, 3767, 37671, 3769, 3771, 3773, 3775, 3777, 3779, 379, 3783,
+    3785, 3787, 3789, 3791, 3793, 3795, 3797, 3799, 39, 3803, 3805, 3807, 3809, 38091, 3811, 3813,
+    3815, 3817, 3819, 383, 3823, 3825, 3827, 3829, 3831, 3833, 3835, 3837, 3839, 385, 3843, 3845,
+    3847, 3849, 38491, 3851, 3853, 3855, 3857, 3859, 387, 3863, 3865, 3867, 3869, 3871, 3873, 3875,
+    3877, 3879, 389, 3883, 3885, 3887, 3889, 3891, 38911, 3893, 3895, 3897, 3899, 391, 3903, 3905,
+    3906, 3910, 3914, 3918, 392, 3926, 3930, 3932, 3936, 394, 3944, 3948, 3952, 3956, 396, 3964,
+    3968, 3972, 3974, 398, 3982, 3986, 3990, 3994, 3998, 4, 4006, 4010, 4014, 4016, 402, 4024,
+    4028, 4032, 4036, 404, 4044, 4048, 4052, 4056, 406, 4062, 4066, 4070, 4074, 4078, 408, 4086,
+    4090, 4094, 4096, 410, 4104, 4108, 4112, 4116, 412, 4124, 4128, 4132, 4136, 414, 4142, 4146,
+    4150, 4154, 4158, 416, 4166, 4170, 4174, 4178, 418, 4184, 4188, 4192, 4196, 42, 4204, 4208,
+    4212, 4216, 422, 4222, 4226, 4230, 4234, 424, 4242, 4246, 4250, 4254, 4258, 426, 4264, 4268,
+    4272, 4276, 428, 4284, 4288, 4292, 4296, 430, 4302, 4306, 4310, 4314, 432, 4322, 4326, 4330,
+    4334, 4338, 434, 4344, 4348, 4352, 4356, 436, 4364, 4368, 4372, 4376, 438, 4384, 4386, 4390,
+    4394, 44, 4402, 4406, 4410, 4414, 4418, 442, 4426, 4428, 4432, 4436, 444, 4444, 4448, 4452,
+    4456, 446, 4464, 4468, 4470, 4474, 448, 4482, 4486, 4490, 4494, 4498, 450, 4506, 4508, 4512,
+    4516, 452, 4524, 4528, 4532, 4536, 454, 4544, 4548, 4550, 4554, 456, 4562, 4566, 4570, 4574,
+    4578, 458, 4586, 4590, 4592, 4596, 46, 4604, 4608, 4612, 4616, 462, 4624, 4628, 4632, 4634,
+    464, 4642, 4646, 4650, 4654, 4658, 466, 4666, 4670, 4674, 4676, 468, 4684, 4688, 4692, 4696,
+    470, 4704, 4708, 4712, 4714, 472, 4722, 4726, 4730, 4734, 4738, 474, 4746, 4750, 4754, 4756,
+    476, 4764, 4768, 4772, 4776, 478, 4784, 4788, 4792, 4796, 48, 4802, 4806, 4810, 4814, 4818,
+    482, 4826, 4830, 4834, 4838, 484, 4844, 4848, 4852, 4856, 486, 4864, 4868, 4872, 4876, 488,
+    4882, 4886, 4890, 4894, 4898, 490, 4906, 4910, 4914, 4918, 492, 4924, 4928, 4932, 4936, 494,
+    4944, 4948, 4952, 4956, 496, 4962, 4966, 4970, 4974, 498, 4982, 4986, 4990, 4994, 4998, 50,
+    5004, 5008, 5012, 5016, 502, 5024, 5028, 5032, 5036, 504, 5044, 5046, 5050, 5054, 506, 5062,
+    5066, 5070, 5074, 5078, 508, 5084, 5088, 5092, 5096, 510, 5104, 5108, 5112, 5116, 512, 5124,
+    5126, 5130, 5134, 514, 5142, 5146, 5150, 5154, 5158, 516, 5166, 5168, 5172, 5176, 518, 5184,
+    5188, 5192, 5196, 52, 5204, 5208, 5210, 5214, 522, 5222, 5226, 5230, 5234, 5238, 524, 5246,
+    5250, 5252, 5256, 526, 5264, 5268, 5272, 5276, 528, 5284, 5288, 5290, 5294, 530, 5302, 5306,
+    5310, 5314, 5318, 532, 5326, 5330, 5332, 5336, 534, 5344, 5348, 5352, 5356, 536, 5364, 5368,
+    5372, 5374, 538, 5382, 5386, 5390, 5394, 5398, 54, 5406, 5410, 5414, 5416, 542, 5424, 5428,
+    5432, 5436, 544, 5444, 5448, 5452, 5456, 546, 5462, 5466, 5470, 5474, 5478, 548, 5486, 5490,
+    5494, 5496, 550, 5504, 5508, 5512, 5516, 552, 5524, 5528, 5532, 5536, 554, 5542, 5546, 5550,
+    5554, 5558, 556, 5566, 5570, 5574, 5578, 558, 5584, 5588, 5592, 5596, 56, 5604, 5608, 5612,
+    5616, 562, 5622, 5626, 5630, 5634, 564, 5642, 5646, 5650, 5654, 5658, 566, 5664, 5668, 5672,
+    5676, 568, 5684, 5688, 5692, 5696, 570, 5702, 5706, 5710, 5714, 572, 5722, 5726, 5730, 5734,
+    5738, 574, 5744, 5748, 5752, 5756, 576, 5764, 5768, 5772, 5776, 578, 5784, 5786, 5790, 5794,
+    58, 5802, 5806, 5810, 5814, 5818, 582, 5826, 5828, 5832, 5836, 584, 5844, 5848, 5852, 5856,
+    586, 5864, 5868, 5870, 5874, 588, 5882, 5886, 5890, 5894, 5898, 590, 5906, 5908, 5912, 5916,
+    592, 5924, 5928, 5932, 5936, 594, 5944, 5948, 5950, 5954, 596, 5962, 5966, 5970, 5974, 5978,
+    598, 5986, 5990, 5992, 5996, 6, 6004, 6008, 6012, 6016, 602, 6024, 6028, 6032, 6034, 604,
+    6042, 6046, 6050, 6054, 6058, 606, 6066, 6070, 6072, 6076, 608, 6084, 6088, 6092, 6096, 610,
+    6104, 6108, 6112, 6114, 612, 6122, 6126, 6130, 6134, 6138, 614, 6146, 6150, 6154, 6156, 616,
+    6164, 6168, 6172, 6176, 618, 6184, 6188, 6192, 6196, 62, 6202, 6206, 6210, 6214, 6218, 622,
+    6226, 6230, 6234, 6238, 624, 6244, 6248, 6252, 6256, 626, 6264, 6268, 6272, 6276, 628, 6282,
+    6286, 6290, 6294, 6298, 630, 6306, 6310, 6314, 6318, 632, 6324, 6328, 6332, 6336, 634, 6344,
+    6348, 6352, 6356, 636, 6362, 6366, 6370, 6374, 638, 6382, 6386, 6390, 6394, 6398, 64, 6404,
+    6408, 6412, 6416, 642, 6424, 6428, 6432, 6436, 644, 6444, 6446, 6450, 6454, 646, 6462, 6466,
+    6470, 6474, 6478, 648, 6484, 6488, 6492, 6496, 650, 6504, 6508, 6512, 6516, 652, 6524, 6526,
+    6530, 6534, 654, 6542, 6546, 6550, 6554, 6558, 656, 6566, 6568, 6572, 6576, 658, 6584, 6588,
+    6592, 6596, 66, 6604, 6608, 6610, 6614, 662, 6622, 6626, 6630, 6634, 6638, 664, 6646, 6650,
+    6652, 6656, 666, 6664, 6668, 6672, 6676, 668, 6684, 6688, 6690, 6694, 670, 6702, 6706, 6710,
+    6714, 6718, 672, 6726, 6730, 6732, 6736, 674, 6744, 6748, 6752, 6756, 676, 6764, 6768, 6772,
+    6774, 678, 6782, 6786, 6790, 6794, 6798, 68, 6806, 6810, 6814, 6816, 682, 6824, 6828, 6832,
+    6836, 684, 6844, 6848, 6852, 6856, 686, 6862, 6866, 6870, 6874, 6878, 688, 6886, 6890, 6894,
+    6896, 690, 6904, 6908, 6912, 6916, 692, 6924, 6928, 6932, 6936, 694, 6942, 6946, 6950, 6954,
+    6958, 696, 6966, 6970, 6974, 6978, 698, 6984, 6988, 6992, 6996, 70, 7004, 7008, 7012, 7016,
+    702, 7022, 7026, 7030, 7034, 704, 7042, 7046, 7050, 7054, 7058, 706, 7064, 7068, 7072, 7076,
+    708, 7084, 7088, 7092, 7096, 710, 7102, 7106, 7110, 7114, 712, 7122, 7126, 7130, 7134, 7138,
+    714, 7144, 7148, 7152, 7156, 716, 7164, 7168, 7172, 7176, 718, 7184, 7186, 7190, 7194, 72,
+    7202, 7206, 7210, 7214, 7218, 722, 7226, 7228, 7232, 7236, 724, 7244, 7248, 7252, 7256, 726,
+    7264, 7266, 7270, 7274, 728, 7282, 7286, 7290, 7294, 7298, 730, 7306, 7308, 7312, 7316, 732,
+    7324, 7328, 7332, 7336, 734, 7344, 7348, 7350, 7354, 736, 7362, 7366, 7370, 7374, 7378, 738,
+    7386, 7390, 7392, 7396, 74, 7404, 7408, 7412, 7416, 742, 7424, 7428, 7432, 7434, 744, 7442,
+    7446, 7450, 7454, 7458, 746, 7466, 7470, 7472, 7476, 748, 7484, 7488, 7492, 7496, 750, 7504,
+    7508, 7512, 7514, 752, 7522, 7526, 7530, 7534, 7538, 754, 7546, 7550, 7554, 7556, 756, 7564,
+    7568, 7572, 7576, 758, 7584, 7588, 7592, 7596, 76, 7602, 7606, 7610, 7614, 7618, 762, 7626,
+    7630, 7634, 7638, 764, 7644, 7648, 7652, 7656, 766, 7664, 7668, 7672, 7676, 768, 7682, 7686,
+    7690, 7694, 7698, 770, 7706, 7710, 7714, 7718, 772, 7724, 7728, 7732, 7736, 774, 7744, 7748,
+    7752, 7756, 776, 7762, 7766, 7770, 7774, 778, 7782, 7786, 7790, 7794, 7798, 78, 7804, 7808,
+    7812, 782, 7828, 7836, 784, 7850, 786, 7866, 7874, 788, 7888, 790, 7904, 7912, 792, 7926,
+    7934, 794, 7950, 796, 7966, 7972, 798, 7988, 7996, 8, 8010, 802, 8026, 8034, 804, 8050,
+    806, 8064, 8072, 808, 8088, 8094, 810, 8110, 812, 8126, 8132, 814, 8148, 8156, 816, 8172,
+    818, 8186, 8194, 82, 8210, 822, 8224, 8232, 824, 8248, 8256, 826, 8270, 828, 8286, 8294,
+    830, 8308, 8316, 832, 8332, 834, 8346, 8354, 836, 8370, 838, 8384, 8392, 84, 8408, 8416,
+    842, 8430, 844, 8446, 8454, 846, 8468, 848, 8484, 8492, 850, 8506, 8514, 852, 8530, 854,
+    8544, 8552, 856, 8568, 8576, 858, 8590, 86, 8606, 8614, 862, 8628, 864, 8644, 8652, 866,
+    8666, 8674, 868, 8690, 870, 8706, 8712, 872, 8728, 8736, 874, 8750, 876, 8766, 8774, 878,
+    8790, 88, 8804, 8812, 882, 8828, 8834, 884, 8850, 886, 8866, 8872, 888, 8888, 8896, 890,
+    8912, 892, 8926, 8934, 894, 8950, 896, 8964, 8972, 898, 8988, 8996, 90, 9010, 902, 9026,
+    9034, 904, 9048, 9056, 906, 9072, 908, 9086, 9094, 910, 9110, 912, 9124, 9132, 914, 9148,
+    9156, 916, 9170, 918, 9186, 9194, 92, 9208, 922, 9224, 9232, 924, 9246, 9254, 926, 9270,
+    928, 9284, 9292, 930, 9308, 9316, 932, 9330, 934, 9346, 9354, 936, 9368, 938, 9384, 9392,
+    94, 9408, 9414, 942, 9430, 944, 9446, 9452, 946, 9468, 9476, 948, 9490, 950, 9506, 9514,
+    952, 9530, 954, 9544, 9552, 956, 9568, 9574, 958, 9590, 96, 9606, 9614, 962, 9628, 9636,
+    964, 9652, 966, 9666, 9674, 968, 9690, 970, 9704, 9712, 972, 9728, 9736, 974, 9750, 976,
+    9766, 9774, 978, 9788, 9796, 98, 9812, 982, 9826, 9834, 984, 9850, 986, 9864, 9872, 988,
+    9888, 9896, 990, 9910, 992, 9926, 9934, 994, 9948, 996, 9964, 9972, 998, 9986, 9994, 10,
+    10010, 1002, 10026, 10032, 1004, 10048, 10056, 1006, 10070, 1008, 10086, 10094, 1010, 10108, 1012, 10124,
+    10132, 1014, 10148, 10154, 1016, 10170, 1018, 10186, 10192, 102, 10208, 10216, 1022, 10232, 1024, 10246,
+    10254, 1026, 10270, 1028, 10284, 10292, 1030, 10308, 10314, 1032, 10330, 1034, 10346, 10354, 1036, 10368,
+    10376, 1038, 10392, 104, 10406, 10414, 1042, 10430, 1044, 10444, 10452, 1046, 10468, 10476, 1048, 10490,
+    1050, 10506, 10514, 1052, 10528, 1054, 10544, 10552, 1056, 10566, 10574, 1058, 10590, 106, 10604, 10612,
+    1062, 10628, 10636, 1064, 10650, 1066, 10666, 10674, 1068, 10688, 1070, 10704, 10712, 1072, 10726, 10734,
+    1074, 10750, 1076, 10766, 10772, 1078, 10788, 10796, 108, 10810, 1082, 10826, 10834, 1084, 10848, 1086,
+    10864, 10872, 1088, 10888, 10894, 1090, 10910, 1092, 10926, 10932, 1094, 10948, 10956, 1096, 10972, 1098,
+    10986, 10994, 110, 11010, 1102, 11024, 11032, 1104, 11048, 11054, 1106, 11070, 1108, 11086, 11094, 1110,
+    11108, 11116, 1112, 11132, 1114, 11146, 11154, 1116, 11170, 1118, 11184, 11192, 112, 11208, 11216, 1122,
+    11230, 1124, 11246, 11254, 1126, 11268, 1128, 11284, 11292, 1130, 11306, 11314, 1132, 11330, 1134, 11344,
+    11352, 1136, 11368, 11376, 1138, 11390, 114, 11406, 11414, 1142, 11428, 1144, 11444, 11452, 1146, 11466,
+    11474, 1148, 11490, 1150, 11506, 11512, 1152, 11528, 11536, 1154, 11550, 1156, 11566, 11574, 1158, 11590,
+    116, 11604, 11612, 1162, 11628, 11634, 1164, 11650, 1166, 11666, 11672, 1168, 11688, 11696, 1170, 11712,
+    1172, 11726, 11734, 1174, 11750, 1176, 11764, 11772, 1178, 11788, 11796, 118, 11810, 1182, 11826, 11834,
+    1184, 11848, 11856, 1186, 11872, 1188, 11886, 11894, 1190, 11910, 1192, 11924, 11932, 1194, 11948, 11956,
+    1196, 11970, 1198, 11986, 11994, 12, 12008, 1202, 12024, 12032, 1204, 12046, 12054, 1206, 12070, 1208,
+    12084, 12092, 1210, 12108, 12116, 1212, 12130, 1214, 12146, 12154, 1216, 12168, 1218, 12184, 12192, 122,
+    12208, 12214, 1222, 12230, 1224, 12246, 12252, 1226, 12268, 12276, 1228, 12290, 1230, 12306, 12314, 1232,
+    12330, 1234, 12344, 12352, 1236, 12368, 12374, 1238, 12390, 124, 12406, 12414, 1242, 12428, 12436, 1244,
+    12452, 1246, 12466, 12474, 1248, 12490, 1250, 12504, 12512, 1252, 12528, 12536, 1254, 12550, 1256, 12566,
+    12574, 1258, 12588, 12596, 126, 12612, 1262, 12626, 12634, 1264, 12650, 1266, 12664, 12672, 1268, 12688,
+    12696, 1270, 12710, 1272, 12726, 12734, 1274, 12748, 1276, 12764, 12772, 1278, 12786, 12794, 128, 12810,
+    1282, 12826, 12832, 1284, 12848, 12856, 1286, 12870, 1288, 12886, 12894, 1290, 12908, 1292, 12924, 12932,
+    1294, 12948, 12954, 1296, 12970, 1298, 12986, 12992, 130, 13008, 13016, 1302, 13032, 1304, 13046, 13054,
+    1306, 13070, 1308, 13084, 13092, 1310, 13108, 13114, 1312, 13130, 1314, 13146, 13154, 1316, 13168, 13176,
+    1318, 13192, 132, 13206, 13214, 1322, 13230, 1324, 13244, 13252, 1326, 13268, 13276, 1328, 13290, 1330,
+    13306, 13314, 1332, 13328, 13336, 1334, 13352, 1336, 13366, 13374, 1338, 13390, 134, 13404, 13412, 1342,
+    13428, 13436, 1344, 13450, 1346, 13466, 13474, 1348, 13488, 1350, 13504, 13512, 1352, 13526, 13534, 1354,
+    13550, 1356, 13566, 13572, 1358, 13588, 13596, 136, 13610, 1362, 13626, 13634, 1364, 13648, 1366, 13664,
+    13672, 1368, 13688, 13694, 1370, 13710, 1372, 13726, 13732, 1374, 13748, 13756, 1376, 13772, 1378, 13786,
+    13794, 138, 13810, 1382, 13824, 13832, 1384, 13848, 13854, 1386, 13870, 1388, 13886, 13894, 1390, 13908,
+    13916, 1392, 13932, 1394, 13946, 13954, 1396, 13970, 1398, 13984, 13992, 14, 14008, 14016, 1402, 14030,
+    1404, 14046, 14054, 1406, 14068, 1408, 14084, 14092, 1410, 14106, 14114, 1412, 14130, 1414, 14144, 14152,
+    1416, 14168, 14176, 1418, 14190, 142, 14206, 14214, 1422, 14228, 1424, 14244, 14252, 1426, 14266, 14274,
+    1428, 14290, 1430, 14306, 14312, 1432, 14328, 14336, 1434, 14350, 1436, 14366, 14374, 1438, 14390, 144,
+    14404, 14412, 1442, 14428, 14434, 1444, 14450, 1446, 14466, 14472, 1448, 14488, 14496, 1450, 14512, 1452,
+    14526, 14534, 1454, 14550, 1456, 14564, 14572, 1458, 14588, 14596, 146, 14610, 1462, 14626, 14634, 1464,
+    14648, 14656, 1466, 14672, 1468, 14686, 14694, 1470, 14710, 1472, 14724, 14732, 1474, 14748, 14756, 1476,
+    14770, 1478, 14786, 14794, 148, 14808, 1482, 14824, 14832, 1484, 14846, 14854, 1486, 14870, 1488, 14884,
+    14892, 1490, 14908, 14916, 1492, 14930, 1494, 14946, 14954, 1496, 14968, 1498, 14984, 14992, 150, 15008,
+    15014, 1502, 15030, 1504, 15046, 15052, 1506, 15068, 15076, 1508, 15090, 1510, 15106, 15114, 1512, 15130,
+    1514, 15144, 15152, 1516, 15168, 15174, 1518, 15190, 152, 15206, 15214, 1522, 15228, 15236, 1524, 15252,
+    1526, 15266, 15274, 1528, 15290, 1530, 15304, 15312, 1532, 15328, 15336, 1534, 15350, 1536, 15366, 15374,
+    1538, 15388, 15396, 154, 15412, 1542, 15426, 15434, 1544, 15450, 1546, 15464, 15472, 1548, 15488, 15496,
+    1550, 15510, 1552, 15526, 15534, 1554, 15548, 1556, 15564, 15572, 1558, 15586, 15594, 156, 15610, 1562,
+    15624, 1564, 1566, 15670, 1568, 1570, 1572, 15732, 1574, 1576, 1578, 158, 15808, 1582, 1584, 1586,
+    15870, 1588, 1590, 1592, 15930, 1594, 1596, 1598, 15992, 16, 1602, 1604, 16052, 1606, 1608, 1610,
+    1612, 16128, 1614, 1616, 1618, 16190, 162, 1622, 1624, 16250, 1626, 1628, 1630, 16312, 1632, 1634,
+    1636, 1638, 16388, 164, 1642, 1644, 16448, 1646, 1648, 1650, 16510, 1652, 1654, 1656, 16572, 1658,
+    166, 1662, 16632, 1664, 1666, 1668, 1670, 16708, 1672, 1674, 1676, 16770, 1678, 168, 1682, 16830,
+    1684, 1686, 1688, 16892, 1690, 1692, 1694, 1696, 16968, 1698, 170, 1702, 17028, 1704, 1706, 1708,
+    17090, 1710, 1712, 1714, 17150, 1716, 1718, 172, 17212, 1722, 1724, 1726, 1728, 17288, 1730, 1732,
+    1734, 17350, 1736, 1738, 174, 17410, 1742, 1744, 1746, 17472, 1748, 1750, 1752, 17532, 1754, 1756,
+    1758, 176, 17608, 1762, 1764, 1766, 17670, 1768, 1770, 1772, 17730, 1774, 1776, 1778, 17792, 178,
+    1782, 1784, 1786, 17868, 1788, 1790, 1792, 17930, 1794, 1796, 1798, 17990, 18, 1802, 1804, 18052,
+    1806, 1808, 1810, 18112, 1812, 1814, 1816, 1818, 18188, 182, 1822, 1824, 18250, 1826, 1828, 1830,
+    18310, 1832, 1834, 1836, 18372, 1838, 184, 1842, 1844, 18448, 1846, 1848, 1850, 18508, 1852, 1854,
+    1856, 18570, 1858, 186, 1862, 18630, 1864, 1866, 1868, 18692, 1870, 1872, 1874, 1876, 18768, 1878,
+    188, 1882, 18830, 1884, 1886, 1888, 18890, 1890, 1892, 1894, 18952, 1896, 1898, 190, 1902, 19028,
+    1904, 1906, 1908, 19088, 1910, 1912, 1914, 19150, 1916, 1918, 192, 19210, 1922, 1924, 1926, 19272,
+    1928, 1930, 1932, 1934, 19348, 1936, 1938, 194, 19410, 1942, 1944, 1946, 19470, 1948, 1950, 1952,
+    19532, 1954, 1956, 1958, 19592, 196, 1962, 1964, 1966, 19668, 1968, 1970, 1972, 19730, 1974, 1976,
+    1978, 19790, 198, 1982, 1984, 19852, 1986, 1988, 1990, 1992, 19928, 1994, 1996, 1998, 19990, 3,
+    2003, 2005, 20051, 2007, 2009, 2011, 20113, 2013, 2015, 2017, 20173, 2019, 203, 2023, 2025, 20249,
+    2027, 2029, 2031, 20311, 2033, 2035, 2037, 20371, 2039, 205, 2043, 20433, 2045, 2047, 2049, 2051,
+    20509, 2053, 2055, 2057, 20569, 2059, 207, 2063, 20631, 2065, 2067, 2069, 20691, 2071, 2073, 2075,
+    20753, 2077, 2079, 209, 2083, 20829, 2085, 2087, 2089, 20891, 2091, 2093, 2095, 20951, 2097, 2099,
+    211, 21013, 2103, 2105, 2107, 2109, 21089, 2111, 2113, 2115, 21149, 2117, 2119, 213, 21211, 2123,
+    2125, 2127, 21271, 2129, 2131, 2133, 21333, 2135, 2137, 2139, 215, 21409, 2143, 2145, 2147, 21471,
+    2149, 2151, 2153, 21531, 2155, 2157, 2159, 21593, 217, 2163, 2165, 21653, 2167, 2169, 2171, 2173,
+    21729, 2175, 2177, 2179, 21791, 219, 2183, 2185, 21851, 2187, 2189, 2191, 21913, 2193, 2195, 2197,
+    2199, 21989, 23, 2203, 2205, 22049, 2207, 2209, 2211, 22111, 2213, 2215, 2217, 22173, 2219, 223,
+    2223, 22233, 2225, 2227, 2229, 2231, 22309, 2233, 2235, 2237, 22371, 2239, 225, 2243, 22431, 2245,
+    2247, 2249, 22493, 2251, 2253, 2255, 2257, 22569, 2259, 227, 2263, 22629, 2265, 2267, 2269, 22691,
+    2271, 2273, 2275, 22751, 2277, 2279, 229, 22813, 2283, 2285, 2287, 2289, 22889, 2291, 2293, 2295,
+    22951, 2297, 2299, 231, 23011, 2303, 2305, 2307, 23073, 2309, 2311, 2313, 23133, 2315, 2317, 2319,
+    233, 23209, 2323, 2325, 2327, 23271, 2329, 2331, 2333, 23331, 2335, 2337, 2339, 23393, 235, 2343,
+    2345, 2347, 23469, 2349, 2351, 2353, 23531, 2355, 2357, 2359, 23591, 237, 2363, 2365, 23653, 2367,
+    2369, 2371, 23713, 2373, 2375, 2377, 2379, 23789, 239, 2383, 2385, 23851, 2387, 2389, 2391, 23911,
+    2393, 2395, 2397, 23973, 2399, 25, 2403, 2405, 24049, 2407, 2409, 2411, 24109, 2413, 2415, 2417,
+    24171, 2419, 243, 2423, 24231, 2425, 2427, 2429, 24293, 2431, 2433, 2435, 2437, 24369, 2439, 245,
+    2443, 24431, 2445, 2447, 2449, 24491, 2451, 2453, 2455, 24553, 2457, 2459, 247, 2463, 24629, 2465,
+    2467, 2469, 24689, 2471, 2473, 2475, 24751, 2477, 2479, 249, 24811, 2483, 2485, 2487, 24873, 2489,
+    2491, 2493, 2495, 24949, 2497, 2499, 251, 25011, 2503, 2505, 2507, 25071, 2509, 2511, 2513, 25133,
+    2515, 2517, 2519, 25193, 253, 2523, 2525, 2527, 25269, 2529, 2531, 2533, 25331, 2535, 2537, 2539,
+    25391, 255, 2543, 2545, 25453, 2547, 2549, 2551, 2553, 25529, 2555, 2557, 2559, 25589, 257, 2563,
+    2565, 25651, 2567, 2569, 2571, 25713, 2573, 2575, 2577, 25773, 2579, 259, 2583, 2585, 25849, 2587,
+    2589, 2591, 25911, 2593, 2595, 2597, 25971, 2599, 27, 2603, 26033, 2605, 2607, 2609, 2611, 26109,
+    2613, 2615, 2617, 26169, 2619, 263, 2623, 26231, 2625, 2627, 2629, 26291, 2631, 2633, 2635, 26353,
+    2637, 2639, 265, 2643, 26429, 2645, 2647, 2649, 26491, 2651, 2653, 2655, 26551, 2657, 2659, 267,
+    26613, 2663, 2665, 2667, 26673, 2669, 2671, 2673, 2675, 26749, 2677, 2679, 269, 26811, 2683, 2685,
+    2687, 26871, 2689, 2691, 2693, 26933, 2695, 2697, 2699, 271, 27009, 2703, 2705, 2707, 27071, 2709,
+    2711, 2713, 27131, 2715, 2717, 2719, 27193, 273, 2723, 2725, 27253, 2727, 2729, 2731, 2733, 27329,
+    2735, 2737, 2739, 27391, 275, 2743, 2745, 27451, 2747, 2749, 2751, 27513, 2753, 2755, 2757, 2759,
+    27589, 277, 2763, 2765, 27649, 2767, 2769, 2771, 27711, 2773, 2775, 2777, 27771, 2779, 279, 2783,
+    27833, 2785, 2787, 2789, 2791, 27909, 2793, 2795, 2797, 27971, 2799, 29, 2803, 28031, 2805, 2807,
+    2809, 28093, 2811, 2813, 2815, 2817, 28169, 2819, 283, 2823, 28229, 2825, 2827, 2829, 28291, 2831,
+    2833, 2835, 28351, 2837, 2839, 285, 28413, 2843, 2845, 2847, 2849, 28489, 2851, 2853, 2855, 28551,
+    2857, 2859, 287, 28611, 2863, 2865, 2867, 28673, 2869, 2871, 2873, 28733, 2875, 2877, 2879, 289,
+    28809, 2883, 2885, 2887, 28871, 2889, 2891, 2893, 28931, 2895, 2897, 2899, 28993, 291, 2903, 2905,
+    2907, 29069, 2909, 2911, 2913, 29131, 2915, 2917, 2919, 29191, 293, 2923, 2925, 29253, 2927, 2929,
+    2931, 29313, 2933, 2935, 2937, 2939, 29389, 295, 2943, 2945, 29451, 2947, 2949, 2951, 29511, 2953,
+    2955, 2957, 29573, 2959, 297, 2963, 2965, 29649, 2967, 2969, 2971, 29709, 2973, 2975, 2977, 29771,
+    2979, 299, 2983, 29831, 2985, 2987, 2989, 29893, 2991, 2993, 2995, 2997, 29969, 2999, 31, 3003,
+    30031, 3005, 3007, 3009, 30091, 3011, 3013, 3015, 30153, 3017, 3019, 303, 3023, 30229, 3025, 3027,
+    3029, 30289, 3031, 3033, 3035, 30351, 3037, 3039, 305, 30411, 3043, 3045, 3047, 30473, 3049, 3051,
+    3053, 3055, 30549, 3057, 3059, 307, 30611, 3063, 3065, 3067, 30671, 3069, 3071, 3073, 30733, 3075,
+    3077, 3079, 30793, 309, 3083, 3085, 3087, 30869, 3089, 3091, 3093, 30931, 3095, 3097, 3099, 30991,
+    311, 3103, 3105, 31053, 3107, 3109, 3111, 3113, 31129, 3115, 3117, 3119, 31189, 313, 3123, 3125,
+    3126, 3128, 3132, 3134, 3138, 314, 3144, 3146, 3150, 3152, 3156, 316, 3162, 3164, 3168, 3170,
+    3174, 3176, 318, 3182, 3186, 3190, 3192, 3196, 3198, 32, 3204, 3208, 3210, 3214, 3216, 322,
+    3222, 3226, 3228, 3232, 3234, 3238, 324, 3244, 3248, 3250, 3254, 3256, 326, 3262, 3266, 3268,
+    3272, 3274, 3278, 328, 3284, 3286, 3290, 3292, 3296, 330, 3302, 3306, 3308, 3312, 3314, 3318,
+    332, 3324, 3326, 3330, 3332, 3336, 334, 3342, 3344, 3348, 3350, 3354, 3356, 336, 3364, 3366,
+    3370, 3372, 3376, 3378, 338, 3384, 3388, 3390, 3394, 3396, 34, 3402, 3406, 3408, 3412, 3414,
+    3418, 342, 3424, 3428, 3430, 3434, 3436, 344, 3442, 3446, 3448, 3452, 3454, 3458, 346, 3464,
+    3466, 3470, 3472, 3476, 348, 3482, 3486, 3488, 3492, 3494, 3498, 350, 3504, 3506, 3510, 3512,
+    3516, 352, 3522, 3524, 3528, 3530, 3534, 3536, 354, 3544, 3546, 3550, 3552, 3556, 3558, 356,
+    3564, 3568, 3570, 3574, 3576, 358, 3582, 3586, 3588, 3592, 3594, 3598, 36, 3604, 3608, 3610,
+    3614, 3616, 362, 3622, 3626, 3628, 3632, 3634, 3638, 364, 3644, 3646, 3650, 3652, 3656, 366,
+    3662, 3666, 3668, 3672, 3674, 3678, 368, 3684, 3686, 3690, 3692, 3696, 370, 3702, 3704, 3708,
+    3710, 3714, 3718, 372, 3724, 3726, 3730, 3732, 3736, 3738, 374, 3744, 3748, 3750, 3754, 3756,
+    376, 3762, 3766, 3768, 3772, 3776, 3778, 378, 3784, 3788, 3790, 3794, 3796, 38, 3802, 3806,
+    3808, 3812, 3814, 3818, 382, 3824, 3826, 3830, 3834, 3836, 384, 3842, 3846, 3848, 3852, 3854,
+    3858, 386, 3864, 3866, 3870, 3872, 3876, 388, 3882, 3884, 3888, 3890, 3894, 3898, 390, 3904,
+    3906, 3910, 3912, 3916, 3918, 392, 3924, 3928, 3930, 3934, 3936, 394, 3942, 3946, 3948, 3952,
+    3956, 3958, 396, 3964, 3968, 3970, 3974, 3976, 398, 3982, 3986, 3988, 3992, 3994, 3998, 4,
+    4004, 4006, 4010, 4014, 4016, 402, 4022, 4026, 4028, 4032, 4034, 4038, 404, 4044, 4046, 4050,
+    4052, 4056, 406, 4062, 4064, 4068, 4072, 4074, 4078, 408, 4084, 4086, 4090, 4092, 4096, 410,
+    4102, 4104, 4108, 4110, 4114, 4116, 412, 4122, 4126, 4130, 4132, 4136, 4138, 414, 4144, 4148,
+    4150, 4154, 4156, 416, 4162, 4166, 4168, 4172, 4174, 4178, 418, 4184, 4188, 4190, 4194, 4196,
+    42, 4202, 4206, 4208, 4212, 4214, 4218, 422, 4224, 4226, 4230, 4232, 4236, 424, 4242, 4244,
+    4248, 4252, 4254, 4258, 426, 4264, 4266, 4270, 4272, 4276, 428, 4282, 4284, 4288, 4290, 4294,
+    4296, 430, 4302, 4306, 4310, 4312, 4316, 4318, 432, 4324, 4328, 4330, 4334, 4336, 434, 4342,
+    4346, 4348, 4352, 4354, 4358, 436, 4364, 4368, 4370, 4374, 4376, 438, 4382, 4386, 4388, 4392,
+    4394, 4398, 44, 4404, 4406, 4410, 4412, 4416, 442, 4422, 4426, 4428, 4432, 4434, 4438, 444,
+    4444, 4446, 4450, 4452, 4456, 446, 4462, 4464, 4468, 4470, 4474, 4476, 448, 4484, 4486, 4490,
+    4492, 4496, 4498, 450, 4504, 4508, 4510, 4514, 4516, 452, 4522, 4526, 4528, 4532, 4534, 4538,
+    454, 4544, 4548, 4550, 4554, 4556, 456, 4562, 4566, 4568, 4572, 4574, 4578, 458, 4584, 4586,
+    4590, 4592, 4596, 46, 4602, 4606, 4608, 4612, 4614, 4618, 462, 4624, 4626, 4630, 4632, 4636,
+    464, 4642, 4644, 4648, 4650, 4654, 4656, 466, 4664, 4666, 4670, 4672, 4676, 4678, 468, 4684,
+    4688, 4690, 4694, 4696, 470, 4702, 4706, 4708, 4712, 4714, 4718, 472, 4724, 4728, 4730, 4734,
+    4736, 474, 4742, 4746, 4748, 4752, 4754, 4758, 476, 4764, 4766, 4770, 4772, 4776, 478, 4782,
+    4786, 4788, 4792, 4794, 4798, 48, 4804, 4806, 4810, 4812, 4816, 482, 4822, 4824, 4828, 4830,
+    4834, 4838, 484, 4844, 4846, 4850, 4852, 4856, 4858, 486, 4864, 4868, 4870, 4874, 4876, 488,
+    4882, 4886, 4888, 4892, 4896, 4898, 490, 4904, 4908, 4910, 4914, 4916, 492, 4922, 4926, 4928,
+    4932, 4934, 4938, 494, 4944, 4946, 4950, 4954, 4956, 496, 4962, 4966, 4968, 4972, 4974, 4978,
+    498, 4984, 4986, 4990, 4992, 4996, 50, 5002, 5004, 5008, 5010, 5014, 5018, 502, 5024, 5026,
+    5030, 5032, 5036, 5038, 504, 5044, 5048, 5050, 5054, 5056, 506, 5062, 5066, 5068, 5072, 5076,
+    5078, 508, 5084, 5088, 5090, 5094, 5096, 510, 5102, 5106, 5108, 5112, 5114, 5118, 512, 5124,
+    5126, 5130, 5134, 5136, 514, 5142, 5146, 5148, 5152, 5154, 5158, 516, 5164, 5166, 5170, 5172,
+    5176, 518, 5182, 5184, 5188, 5192, 5194, 5198, 52, 5204, 5206, 5210, 5212, 5216, 522, 5222,
+    5224, 5228, 5230, 5234, 5236, 524, 5242, 5246, 5250, 5252, 5256, 5258, 526, 5264, 5268, 5270,
+    5274, 5276, 528, 5282, 5286, 5288, 5292, 5294, 5298, 530, 5304, 5308, 5310, 5314, 5316, 532,
+    5322, 5326, 5328, 5332, 5334, 5338, 534, 5344, 5346, 5350, 5352, 5356, 536, 5362, 5364, 5368,
+    5372, 5374, 5378, 538, 5384, 5386, 5390, 5392, 5396, 54, 5402, 5404, 5408, 5410, 5414, 5416,
+    542, 5422, 5426, 5430, 5432, 5436, 5438, 544, 5444, 5448, 5450, 5454, 5456, 546, 5462, 5466,
+    5468, 5472, 5474, 5478, 548, 5484, 5488, 5490, 5494, 5496, 550, 5502, 5506, 5508, 5512, 5514,
+    5518, 552, 5524, 5526, 5530, 5532, 5536, 554, 5542, 5546, 5548, 5552, 5554, 5558, 556, 5564,
+    5566, 5570, 5572, 5576, 558, 5582, 5584, 5588, 5590, 5594, 5596, 56, 5604, 5606, 5610, 5612,
+    5616, 5618, 562, 5624, 5628, 5630, 5634, 5636, 564, 5642, 5646, 5648, 5652, 5654, 5658, 566,
+    5664, 5668, 5670, 5674, 5676, 568, 5682, 5686, 5688, 5692, 5694, 5698, 570, 5704, 5706, 5710,
+    5712, 5716, 572, 5722, 5726, 5728, 5732, 5734, 5738, 574, 5744, 5746, 5750, 5752, 5756, 576,
+    5762, 5764, 5768, 5770, 5774, 5776, 578, 5784, 5786, 5790, 5792, 5796, 5798, 58, 5804, 5808,
+    5810, 5814, 5816, 582, 5822, 5826, 5828, 5832, 5834, 5838, 584, 5844, 5848, 5850, 5854, 5856,
+    586, 5862, 5866, 5868, 5872, 5874, 5878, 588, 5884, 5886, 5890, 5892, 5896, 590, 5902, 5906,
+    5908, 5912, 5914, 5918, 592, 5924, 5926, 5930, 5932, 5936, 594, 5942, 5944, 5948, 5950, 5954,
+    5958, 596, 5964, 5966, 5970, 5972, 5976, 5978, 598, 5984, 5988, 5990, 5994, 5996, 6, 6002,
+    6006, 6008, 6012, 6016, 6018, 602, 6024, 6028, 6030, 6034, 6036, 604, 6042, 6046, 6048, 6052,
+    6054, 6058, 606, 6064, 6066, 6070, 6072, 6076, 608, 6082, 6086, 6088, 6092, 6094, 6098, 610,
+    6104, 6106, 6110, 6112, 6116, 612, 6122, 6124, 6128, 6130, 6134, 6138, 614, 6144, 6146, 6150,
+    6152, 6156, 6158, 616, 6164, 6168, 6170, 6174, 6176, 618, 6182, 6186, 6188, 6192, 6196, 6198,
+    62, 6204, 6208, 6210, 6214, 6216, 622, 6222, 6226, 6228, 6232, 6234, 6238, 624, 6244, 6246,
+    6250, 6256, 626, 6268, 6274, 628, 6286, 6292, 630, 6304, 6312, 632, 6324, 6330, 6336, 634,
+    6348, 6354, 636, 6366, 6372, 638, 6384, 6390, 6396, 64, 6408, 6414, 642, 6428, 6434, 644,
+    6446, 6452, 646, 6464, 6470, 6476, 648, 6488, 6494, 650, 6506, 6512, 652, 6524, 6530, 6536,
+    654, 6550, 6556, 656, 6568, 6574, 658, 6586, 6592, 66, 6604, 6610, 6616, 662, 6628, 6634,
+    664, 6646, 6652, 666, 6666, 6672, 668, 6684, 6690, 6696, 670, 6708, 6714, 672, 6726, 6732,
+    674, 6744, 6750, 6756, 676, 6768, 6774, 678, 6788, 6794, 68, 6806, 6812, 682, 6824, 6830,
+    6836, 684, 6848, 6854, 686, 6866, 6872, 688, 6884, 6890, 690, 6904, 6910, 6916, 692, 6928,
+    6934, 694, 6946, 6952, 696, 6964, 6970, 6976, 698, 6988, 6994, 70, 7006, 7012, 702, 7026,
+    7032, 704, 7044, 7050, 7056, 706, 7068, 7074, 708, 7086, 7092, 710, 7104, 7110, 7116, 712,
+    7128, 7136, 714, 7148, 7154, 716, 7166, 7172, 718, 7184, 7190, 7196, 72, 7208, 7214, 722,
+    7226, 7232, 724, 7244, 7250, 726, 7264, 7270, 7276, 728, 7288, 7294, 730, 7306, 7312, 732,
+    7324, 7330, 7336, 734, 7348, 7354, 736, 7366, 7374, 738, 7386, 7392, 74, 7404, 7410, 7416,
+    742, 7428, 7434, 744, 7446, 7452, 746, 7464, 7470, 7476, 748, 7490, 7496, 750, 7508, 7514,
+    752, 7526, 7532, 754, 7544, 7550, 7556, 756, 7568, 7574, 758, 7586, 7592, 76, 7604, 7612,
+    762, 7624, 7630, 7636, 764, 7648, 7654, 766, 7666, 7672, 768, 7684, 7690, 7696, 770, 7708,
+    7714, 772, 7728, 7734, 774, 7746, 7752, 776, 7764, 7770, 7776, 778, 7788, 7794, 78, 7806,
+    7812, 782, 7824, 7830, 7836, 784, 7850, 7856, 786, 7868, 7874, 788, 7886, 7892, 790, 7904,
+    7910, 7916, 792, 7928, 7934, 794, 7946, 7952, 796, 7966, 7972, 798, 7984, 7990, 7996, 8,
+    8008, 8014, 802, 8026, 8032, 804, 8044, 8050, 8056, 806, 8068, 8074, 808, 8088, 8094, 810,
+    8106, 8112, 812, 8124, 8130, 8136, 814, 8148, 8154, 816, 8166, 8172, 818, 8184, 8190, 82,
+    8204, 8210, 8216, 822, 8228, 8234, 824, 8246, 8252, 826, 8264, 8270, 8276, 828, 8288, 8294,
+    830, 8306, 8312, 832, 8326, 8332, 834, 8344, 8350, 8356, 836, 8368, 8374, 838, 8386, 8392,
+    84, 8404, 8410, 8416, 842, 8428, 8436, 844, 8448, 8454, 846, 8466, 8472, 848, 8484, 8490,
+    8496, 850, 8508, 8514, 852, 8526, 8532, 854, 8544, 8552, 856, 8564, 8570, 8576, 858, 8588,
+    8594, 86, 8606, 8612, 862, 8624, 8630, 8636, 864, 8648, 8654, 866, 8666, 8674, 868, 8686,
+    8692, 870, 8704, 8710, 8716, 872, 8728, 8734, 874, 8746, 8752, 876, 8764, 8770, 8776, 878,
+    8790, 8796, 88, 8808, 8814, 882, 8826, 8832, 884, 8844, 8850, 8856, 886, 8868, 8874, 888,
+    8886, 8892, 890, 8906, 8912, 892, 8924, 8930, 8936, 894, 8948, 8954, 896, 8966, 8972, 898,
+    8984, 8990, 8996, 90, 9008, 9014, 902, 9028, 9034, 904, 9046, 9052, 906, 9064, 9070, 9076,
+    908, 9088, 9094, 910, 9106, 9112, 912, 9124, 9130, 914, 9144, 9150, 9156, 916, 9168, 9174,
+    918, 9186, 9192, 92, 9204, 9210, 9216, 922, 9228, 9234, 924, 9246, 9252, 926, 9266, 9272,
+    928, 9284, 9290, 9296, 930, 9308, 9314, 932, 9326, 9332, 934, 9344, 9350, 9356, 936, 9368,
+    9376, 938, 9388, 9394, 94, 9406, 9412, 942, 9424, 9430, 9436, 944, 9448, 9454, 946, 9466,
+    9472, 948, 9484, 9490, 950, 9504, 9510, 9516, 952, 9528, 9534, 954, 9546, 9552, 956, 9564,
+    9570, 9576, 958, 9588, 9594, 96, 9606, 9614, 962, 9626, 9632, 964, 9644, 9650, 9656, 966,
+    9668, 9674, 968, 9686, 9692, 970, 9704, 9710, 9716, 972, 9730, 9736, 974, 9748, 9754, 976,
+    9766, 9772, 978, 9784, 9790, 9796, 98, 9808, 9814, 982, 9826, 9832, 984, 9844, 9852, 986,
+    9864, 9870, 9876, 988, 9888, 9894, 990, 9906, 9912, 992, 9924, 9930, 9936, 994, 9948, 9954,
+    996, 9968, 9974, 998, 9986, 9992, 10, 10004, 10010, 10016, 1002, 10028, 10034, 1004, 10046, 10052,
+    1006, 10064, 10070, 10076, 1008, 10090, 10096, 1010, 10108, 10114, 1012, 10126, 10132, 1014, 10144, 10150,
+    10156, 1016, 10168, 10174, 1018, 10186, 10192, 102, 10206, 10212, 1022, 10224, 10230, 10236, 1024, 10248,
+    10254, 1026, 10266, 10272, 1028, 10284, 10290, 10296, 1030, 10308, 10314, 1032, 10328, 10334, 1034, 10346,
+    10352, 1036, 10364, 10370, 10376, 1038, 10388, 10394, 104, 10406, 10412, 1042, 10424, 10430, 1044, 10444,
+    10450, 10456, 1046, 10468, 10474, 1048, 10486, 10492, 1050, 10504, 10510, 10516, 1052, 10528, 10534, 1054,
+    10546, 10552, 1056, 10566, 10572, 1058, 10584, 10590, 10596, 106, 10608, 10614, 1062, 10626, 10632, 1064,
+    10644, 10650, 10656, 1066, 10668, 10676, 1068, 10688, 10694, 1070, 10706, 10712, 1072, 10724, 10730, 10736,
+    1074, 10748, 10754, 1076, 10766, 10772, 1078, 10784, 10792, 108, 10804, 10810, 10816, 1082, 10828, 10834,
+    1084, 10846, 10852, 1086, 10864, 10870, 10876, 1088, 10888, 10894, 1090, 10906, 10914, 1092, 10926, 10932,
+    1094, 10944, 10950, 10956, 1096, 10968, 10974, 1098, 10986, 10992, 110, 11004, 11010, 11016, 1102, 11030,
+    11036, 1104, 11048, 11054, 1106, 11066, 11072, 1108, 11084, 11090, 11096, 1110, 11108, 11114, 1112, 11126,
+    11132, 1114, 11146, 11152, 1116, 11164, 11170, 11176, 1118, 11188, 11194, 112, 11206, 11212, 1122, 11224,
+    11230, 11236, 1124, 11248, 11254, 1126, 11268, 11274, 1128, 11286, 11292, 1130, 11304, 11310, 11316, 1132,
+    11328, 11334, 1134, 11346, 11352, 1136, 11364, 11370, 1138, 11384, 11390, 11396, 114, 11408, 11414, 1142,
+    11426, 11432, 1144, 11444, 11450, 11456, 1146, 11468, 11474, 1148, 11486, 11492, 1150, 11506, 11512, 1152,
+    11524, 11530, 11536, 1154, 11548, 11554, 1156, 11566, 11572, 1158, 11584, 11590, 11596, 116, 11608, 11614,
+    1162, 11628, 11634, 1164, 11646, 11652, 1166, 11664, 11670, 11676, 1168, 11688, 11694, 1170, 11706, 11712,
+    1172, 11724, 11730, 1174, 11744, 11750, 11756, 1176, 11768, 11774, 1178, 11786, 11792, 118, 11804, 11810,
+    11816, 1182, 11828, 11834, 1184, 11846, 11854, 1186, 11866, 11872, 1188, 11884, 11890, 11896, 1190, 11908,
+    11914, 1192, 11926, 11932, 1194, 11944, 11950, 11956, 1196, 11968, 11976, 1198, 11988, 11994, 12, 12006,
+    12012, 1202, 12024, 12030, 12036, 1204, 12048, 12054, 1206, 12066, 12072, 1208, 12084, 12092, 1210, 12104,
+    12110, 12116, 1212, 12128, 12134, 1214, 12146, 12152, 1216, 12164, 12170, 12176, 1218, 12188, 12194, 122,
+    12208, 12214, 1222, 12226, 12232, 1224, 12244, 12250, 12256, 1226, 12268, 12274, 1228, 12286, 12292, 1230,
+    12304, 12310, 12316, 1232, 12330, 12336, 1234, 12348, 12354, 1236, 12366, 12372, 1238, 12384, 12390, 12396,
+    124, 12408, 12414, 1242, 12426, 12432, 1244, 12446, 12452, 1246, 12464, 12470, 12476, 1248, 12488, 12494,
+    1250, 12512, 1252, 1254, 12548, 1256, 12574, 1258, 126, 12610, 1262, 1264, 12646, 1266, 12670, 1268,
+    1270, 12708, 1272, 12732, 1274, 1276, 12768, 1278, 12792, 128, 1282, 12830, 1284, 1286, 12866, 1288,
+    12890, 1290, 1292, 12928, 1294, 12952, 1296, 1298, 12988, 130, 13012, 1302, 1304, 13050, 1306, 13074,
+    1308, 1310, 13110, 1312, 1314, 13146, 1316, 13172, 1318, 132, 13208, 1322, 13232, 1324, 1326, 13270,
+    1328, 13294, 1330, 1332, 13330, 1334, 1336, 13366, 1338, 13392, 134, 1342, 13428, 1344, 13452, 1346,
+    1348, 13488, 1350, 13514, 1352, 1354, 13550, 1356, 1358, 13586, 136, 13610, 1362, 1364, 13648, 1366,
+    13672, 1368, 1370, 13708, 1372, 13732, 1374, 1376, 13770, 1378, 138, 13806, 1382, 13830, 1384, 1386,
+    13868, 1388, 13892, 1390, 1392, 13928, 1394, 13952, 1396, 1398, 13990, 14, 14014, 1402, 1404, 14050,
+    1406, 1408, 14086, 1410, 14112, 1412, 1414, 14148, 1416, 14172, 1418, 142, 14208, 1422, 14234, 1424,
+    1426, 14270, 1428, 1430, 14306, 1432, 14332, 1434, 1436, 14368, 1438, 14392, 144, 1442, 14428, 1444,
+    14454, 1446, 1448, 14490, 1450, 1452, 14526, 1454, 14550, 1456, 1458, 14588, 146, 14612, 1462, 1464,
+    14648, 1466, 14672, 1468, 1470, 14710, 1472, 14734, 1474, 1476, 14770, 1478, 148, 14808, 1482, 14832,
+    1484, 1486, 14868, 1488, 14892, 1490, 1492, 14930, 1494, 14954, 1496, 1498, 14990, 150, 1502, 15026,
+    1504, 15052, 1506, 1508, 15088, 1510, 15112, 1512, 1514, 15148, 1516, 15174, 1518, 152, 15210, 1522,
+    1524, 15246, 1526, 15270, 1528, 1530, 15308, 1532, 15332, 1534, 1536, 15368, 1538, 15394, 154, 1542,
+    15430, 1544, 1546, 15466, 1548, 15490, 1550, 1552, 15528, 1554, 15552, 1556, 1558, 15588, 156, 15612,
+    1562, 1564, 15650, 1566, 15674, 1568, 1570, 15710, 1572, 1574, 15748, 1576, 15772, 1578, 158, 15808,
+    1582, 15832, 1584, 1586, 15870, 1588, 15894, 1590, 1592, 15930, 1594, 1596, 15966, 1598, 15992, 16,
+    1602, 16028, 1604, 16052, 1606, 1608, 16088, 1610, 16114, 1612, 1614, 16150, 1616, 1618, 16186, 162,
+    16210, 1622, 1624, 16248, 1626, 16272, 1628, 1630, 16308, 1632, 16334, 1634, 1636, 16370, 1638, 164,
+    16406, 1642, 16430, 1644, 1646, 16468, 1648, 16492, 1650, 1652, 16528, 1654, 16552, 1656, 1658, 16590,
+    166, 16614, 1662, 1664, 16650, 1666, 1668, 16688, 1670, 16712, 1672, 1674, 16748, 1676, 16772, 1678,
+    168, 16810, 1682, 16834, 1684, 1686, 16870, 1688, 1690, 16906, 1692, 16932, 1694, 1696, 16968, 1698,
+    16992, 170, 1702, 17028, 1704, 17054, 1706, 1708, 17090, 1710, 1712, 17126, 1714, 17150, 1716, 1718,
+    17188, 172, 17212, 1722, 1724, 17248, 1726, 17272, 1728, 1730, 17310, 1732, 1734, 17346, 1736, 17370,
+    1738, 174, 17408, 1742, 17432, 1744, 1746, 17468, 1748, 17492, 1750, 1752, 17530, 1754, 17554, 1756,
+    1758, 17590, 176, 1762, 17626, 1764, 17652, 1766, 1768, 17688, 1770, 17712, 1772, 1774, 17750, 1776,
+    17774, 1778, 178, 17810, 1782, 1784, 17846, 1786, 17872, 1788, 1790, 17908, 1792, 17932, 1794, 1796,
+    17968, 1798, 17994, 18, 1802, 18030, 1804, 1806, 18066, 1808, 18090, 1810, 1812, 18128, 1814, 18152,
+    1816, 1818, 18188, 182, 18212, 1822, 1824, 18250, 1826, 1828, 18286, 1830, 18310, 1832, 1834, 18348,
+    1836, 18372, 1838, 184, 18408, 1842, 18432, 1844, 1846, 18470, 1848, 18494, 1850, 1852, 18530, 1854,
+    1856, 18566, 1858, 18592, 186, 1862, 18628, 1864, 18652, 1866, 1868, 18688, 1870, 18714, 1872, 1874,
+    18750, 1876, 1878, 18786, 188, 18812, 1882, 1884, 18848, 1886, 18872, 1888, 1890, 18908, 1892, 18934,
+    1894, 1896, 18970, 1898, 190, 19006, 1902, 19030, 1904, 1906, 19068, 1908, 19092, 1910, 1912, 19128,
+    1914, 19152, 1916, 1918, 19190, 192, 19214, 1922, 1924, 19250, 1926, 1928, 19288, 1930, 19312, 1932,
+    1934, 19348, 1936, 19372, 1938, 194, 19410, 1942, 19434, 1944, 1946, 19470, 1948, 1950, 19506, 1952,
+    19532, 1954, 1956, 19568, 1958, 19592, 196, 1962, 19628, 1964, 19654, 1966, 1968, 19690, 1970, 1972,
+    19726, 1974, 19750, 1976, 1978, 19788, 198, 19812, 1982, 1984, 19848, 1986, 19874, 1988, 1990, 19910,
+    1992, 1994, 19946, 1996, 19970, 1998, 3, 20009, 2003, 20033, 2005, 2007, 20069, 2009, 20093, 2011,
+    2013, 20131, 2015, 20155, 2017, 2019, 20191, 203, 2023, 20229, 2025, 20253, 2027, 2029, 20289, 2031,
+    20313, 2033, 2035, 20351, 2037, 20375, 2039, 205, 20411, 2043, 2045, 20447, 2047, 20473, 2049, 2051,
+    20509, 2053, 20533, 2055, 2057, 20569, 2059, 20595, 207, 2063, 20631, 2065, 2067, 20667, 2069, 20691,
+    2071, 2073, 20729, 2075, 20753, 2077, 2079, 20789, 209, 20813, 2083, 2085, 20851, 2087, 2089, 20887,
+    2091, 20911, 2093, 2095, 20949, 2097, 20973, 2099, 211, 21009, 2103, 21033, 2105, 2107, 21071, 2109,
+    21095, 2111, 2113, 21131, 2115, 2117, 21167, 2119, 21193, 213, 2123, 21229, 2125, 21253, 2127, 2129,
+    21291, 2131, 21315, 2133, 2135, 21351, 2137, 2139, 21387, 215, 21413, 2143, 2145, 21449, 2147, 21473,
+    2149, 2151, 21509, 2153, 21535, 2155, 2157, 21571, 2159, 217, 21607, 2163, 21631, 2165, 2167, 21669,
+    2169, 21693, 2171, 2173, 21729, 2175, 21753, 2177, 2179, 21791, 219, 2183, 21827, 2185, 21851, 2187,
+    2189, 21889, 2191, 21913, 2193, 2195, 21949, 2197, 21973, 2199, 23, 22011, 2203, 22035, 2205, 2207,
+    22071, 2209, 2211, 22107, 2213, 22133, 2215, 2217, 22169, 2219, 22193, 223, 2223, 22231, 2225, 22255,
+    2227, 2229, 22291, 2231, 2233, 22327, 2235, 22353, 2237, 2239, 22389, 225, 22413, 2243, 2245, 22449,
+    2247, 22475, 2249, 2251, 22511, 2253, 2255, 22547, 2257, 22571, 2259, 227, 22609, 2263, 22633, 2265,
+    2267, 22669, 2269, 22693, 2271, 2273, 22731, 2275, 2277, 22767, 2279, 22791, 229, 2283, 22829, 2285,
+    22853, 2287, 2289, 22889, 2291, 22913, 2293, 2295, 22951, 2297, 22975, 2299, 231, 23011, 2303, 2305,
+    23047, 2307, 23073, 2309, 2311, 23109, 2313, 23133, 2315, 2317, 23169, 2319, 23195, 233, 2323, 23231,
+    2325, 2327, 23267, 2329, 23293, 2331, 2333, 23329, 2335, 23353, 2337, 2339, 23389, 235, 23415, 2343,
+    2345, 23451, 2347, 2349, 23487, 2351, 23511, 2353, 2355, 23549, 2357, 23573, 2359, 237, 23609, 2363,
+    23633, 2365, 2367, 23671, 2369, 23695, 2371, 2373, 23731, 2375, 2377, 23769, 2379, 23793, 239, 2383,
+    23829, 2385, 23853, 2387, 2389, 23891, 2391, 23915, 2393, 2395, 23951, 2397, 2399, 23987, 25, 24013,
+    2403, 2405, 24049, 2407, 24073, 2409, 2411, 24109, 2413, 24135, 2415, 2417, 24171, 2419, 243, 24207,
+    2423, 24231, 2425, 2427, 24269, 2429, 24293, 2431, 2433, 24329, 2435, 24355, 2437, 2439, 24391, 245,
+    2443, 24427, 2445, 24451, 2447, 2449, 24489, 2451, 24513, 2453, 2455, 24549, 2457, 24573, 2459, 247,
+    24611, 2463, 24635, 2465, 2467, 24671, 2469, 2471, 24709, 2473, 24733, 2475, 2477, 24769, 2479, 24793,
+    249, 2483, 24831, 2485, 24855, 2487, 2489, 24891, 2491, 2493, 24927, 2495, 24953, 2497, 2499, 24989,
+    250, 2502, 2504, 2508, 2510, 2512, 2514, 2518, 252, 2522, 2524, 2526, 2530, 2532, 2534, 2536,
+    254, 2542, 2544, 2546, 2548, 2552, 2554, 2556, 2558, 256, 2564, 2566, 2568, 2570, 2574, 2576,
+    2578, 258, 2584, 2586, 2588, 2590, 2592, 2596, 2598, 26, 2602, 2604, 2608, 2610, 2612, 2614,
+    2618, 262, 2622, 2624, 2626, 2630, 2632, 2634, 2636, 264, 2642, 2644, 2646, 2648, 2652, 2654,
+    2656, 2658, 266, 2664, 2666, 2668, 2670, 2674, 2676, 2678, 268, 2684, 2686, 2688, 2690, 2692,
+    2696, 2698, 270, 2702, 2706, 2708, 2710, 2712, 2714, 2718, 272, 2722, 2724, 2728, 2730, 2732,
+    2734, 2736, 274, 2742, 2744, 2746, 2750, 2752, 2754, 2756, 276, 2762, 2764, 2766, 2768, 2770,
+    2774, 2776, 2778, 278, 2784, 2786, 2788, 2790, 2792, 2796, 2798, 28, 2802, 2806, 2808, 2810,
+    2812, 2814, 2818, 282, 2822, 2824, 2828, 2830, 2832, 2834, 2836, 284, 2842, 2844, 2846, 2850,
+    2852, 2854, 2856, 286, 2862, 2864, 2866, 2868, 2872, 2874, 2876, 2878, 288, 2884, 2886, 2888,
+    2890, 2894, 2896, 2898, 290, 2902, 2906, 2908, 2910, 2912, 2916, 2918, 292, 2922, 2924, 2928,
+    2930, 2932, 2934, 2938, 294, 2942, 2944, 2946, 2950, 2952, 2954, 2956, 296, 2962, 2964, 2966,
+    2968, 2972, 2974, 2976, 2978, 298, 2984, 2986, 2988, 2990, 2994, 2996, 2998, 30, 3002, 3006,
+    3008, 3010, 3012, 3016, 3018, 302, 3022, 3024, 3028, 3030, 3032, 3034, 3038, 304, 3042, 3044,
+    3046, 3050, 3052, 3054, 3056, 306, 3062, 3064, 3066, 3068, 3072, 3074, 3076, 3078, 308, 3084,
+    3086, 3088, 3090, 3094, 3096, 3098, 310, 3104, 3106, 3108, 3110, 3112, 3116, 3118, 312, 3122,
+    3124, 3128, 3130, 3132, 3134, 3138, 314, 3142, 3144, 3146, 3150, 3152, 3154, 3156, 316, 3162,
+    3164, 3166, 3168, 3172, 3174, 3176, 3178, 318, 3184, 3186, 3188, 3190, 3194, 3196, 3198, 32,
+    3204, 3206, 3208, 3210, 3212, 3216, 3218, 322, 3222, 3226, 3228, 3230, 3232, 3234, 3238, 324,
+    3242, 3244, 3248, 3250, 3252, 3254, 3256, 326, 3262, 3264, 3266, 3270, 3272, 3274, 3276, 328,
+    3282, 3284, 3286, 3288, 3292, 3294, 3296, 3298, 330, 3304, 3306, 3308, 3310, 3312, 3316, 3318,
+    332, 3322, 3326, 3328, 3330, 3332, 3334, 3338, 334, 3342, 3344, 3348, 3350, 3352, 3354, 3356,
+    336, 3362, 3364, 3366, 3370, 3372, 3374, 3376, 338, 3382, 3384, 3386, 3388, 3392, 3394, 3396,
+    3398, 34, 3404, 3406, 3408, 3410, 3414, 3416, 3418, 342, 3422, 3426, 3428, 3430, 3432, 3436,
+    3438, 344, 3442, 3444, 3448, 3450, 3452, 3454, 3458, 346, 3462, 3464, 3466, 3470, 3472, 3474,
+    3476, 348, 3482, 3484, 3486, 3488, 3492, 3494, 3496, 3498, 350, 3504, 3506, 3508, 3510, 3514,
+    3516, 3518, 352, 3522, 3526, 3528, 3530, 3532, 3536, 3538, 354, 3542, 3544, 3548, 3550, 3552,
+    3554, 3558, 356, 3562, 3564, 3566, 3570, 3572, 3574, 3576, 358, 3582, 3584, 3586, 3588, 3592,
+    3594, 3596, 3598, 36, 3604, 3606, 3608, 3610, 3614, 3616, 3618, 362, 3624, 3626, 3628, 3630,
+    3632, 3636, 3638, 364, 3642, 3646, 3648, 3650, 3652, 3654, 3658, 366, 3662, 3664, 3666, 3670,
+    3672, 3674, 3676, 368, 3682, 3684, 3686, 3688, 3692, 3694, 3696, 3698, 370, 3704, 3706, 3708,
+    3710, 3714, 3716, 3718, 372, 3724, 3726, 3728, 3730, 3732, 3736, 3738, 374, 3742, 3746, 3748,
+    3750, 3752, 3754, 3758, 376, 3762, 3764, 3768, 3770, 3772, 3774, 3776, 378, 3782, 3784, 3786,
+    3790, 3792, 3794, 3796, 38, 3802, 3804, 3806, 3808, 3812, 3814, 3816, 3818, 382, 3824, 3826,
+    3828, 3830, 3834, 3836, 3838, 384, 3842, 3846, 3848, 3850, 3852, 3854, 3858, 386, 3862, 3864,
+    3868, 3870, 3872, 3874, 3876, 388, 3882, 3884, 3886, 3890, 3892, 3894, 3896, 390, 3902, 3904,
+    3906, 3908, 3912, 3914, 3916, 3918, 392, 3924, 3926, 3928, 3930, 3934, 3936, 3938, 394, 3942,
+    3946, 3948, 3950, 3952, 3956, 3958, 396, 3962, 3964, 3968, 3970, 3972, 3974, 3978, 398, 3982,
+    3984, 3986, 3990, 3992, 3994, 3996, 4, 4002, 4004, 4006, 4008, 4012, 4014, 4016, 4018, 402,
+    4024, 4026, 4028, 4030, 4034, 4036, 4038, 404, 4042, 4046, 4048, 4050, 4052, 4056, 4058, 406,
+    4062, 4064, 4068, 4070, 4072, 4074, 4078, 408, 4082, 4084, 4086, 4090, 4092, 4094, 4096, 410,
+    4102, 4104, 4106, 4108, 4112, 4114, 4116, 4118, 412, 4124, 4126, 4128, 4130, 4134, 4136, 4138,
+    414, 4144, 4146, 4148, 4150, 4152, 4156, 4158, 416, 4162, 4166, 4168, 4170, 4172, 4174, 4178,
+    418, 4182, 4184, 4188, 4190, 4192, 4194, 4196, 42, 4202, 4204, 4206, 4208, 4212, 4214, 4216,
+    4218, 422, 4224, 4226, 4228, 4230, 4234, 4236, 4238, 424, 4244, 4246, 4248, 4250, 4252, 4256,
+    4258, 426, 4262, 4266, 4268, 4270, 4272, 4274, 4278, 428, 4282, 4284, 4288, 4290, 4292, 4294,
+    4296, 430, 4302, 4304, 4306, 4310, 4312, 4314, 4316, 432, 4322, 4324, 4326, 4328, 4332, 4334,
+    4336, 4338, 434, 4344, 4346, 4348, 4350, 4354, 4356, 4358, 436, 4362, 4366, 4368, 4370, 4372,
+    4376, 4378, 438, 4382, 4384, 4388, 4390, 4392, 4394, 4396, 44, 4402, 4404, 4406, 4410, 4412,
+    4414, 4416, 442, 4422, 4424, 4426, 4428, 4432, 4434, 4436, 4438, 444, 4444, 4446, 4448, 4450,
+    4454, 4456, 4458, 446, 4462, 4466, 4468, 4470, 4472, 4476, 4478, 448, 4482, 4484, 4488, 4490,
+    4492, 4494, 4498, 450, 4502, 4504, 4506, 4510, 4512, 4514, 4516, 452, 4522, 4524, 4526, 4528,
+    4532, 4534, 4536, 4538, 454, 4544, 4546, 4548, 4550, 4554, 4556, 4558, 456, 4562, 4566, 4568,
+    4570, 4572, 4576, 4578, 458, 4582, 4584, 4588, 4590, 4592, 4594, 4598, 46, 4602, 4604, 4606,
+    4610, 4612, 4614, 4616, 462, 4622, 4624, 4626, 4628, 4632, 4634, 4636, 4638, 464, 4644, 4646,
+    4648, 4650, 4654, 4656, 4658, 466, 4664, 4666, 4668, 4670, 4672, 4676, 4678, 468, 4682, 4686,
+    4688, 4690, 4692, 4694, 4698, 470, 4702, 4704, 4708, 4710, 4712, 4714, 4716, 472, 4722, 4724,
+    4726, 4730, 4732, 4734, 4736, 4738, 474, 4744, 4746, 4748, 4750, 4754, 4756, 4758, 476, 4764,
+    4766, 4768, 4770, 4772, 4776, 4778, 478, 4782, 4786, 4788, 4790, 4792, 4794, 4798, 48, 4802,
+    4804, 4808, 4810, 4812, 4814, 4816, 482, 4822, 4824, 4826, 4830, 4832, 4834, 4836, 484, 4842,
+    4844, 4846, 4848, 4852, 4854, 4856, 4858, 486, 4864, 4866, 4868, 4870, 4874, 4876, 4878, 488,
+    4882, 4886, 4888, 4890, 4892, 4896, 4898, 490, 4902, 4904, 4908, 4910, 4912, 4914, 4916, 492,
+    4922, 4924, 4926, 4930, 4932, 4934, 4936, 494, 4942, 4944, 4946, 4948, 4952, 4954, 4956, 4958,
+    496, 4964, 4966, 4968, 4970, 4974, 4976, 4978, 498, 4982, 4986, 4988, 4990, 4992, 4996, 4998,
+    50, 5004, 5010, 5014, 502, 5024, 5030, 5034, 504, 5044, 5048, 5054, 506, 5064, 5068, 5074,
+    508, 5084, 5088, 5092, 510, 5102, 5108, 5112, 5118, 512, 5126, 5132, 5136, 514, 5146, 5152,
+    5156, 516, 5166, 5170, 5176, 518, 5186, 5190, 5196, 52, 5206, 5210, 5214, 522, 5224, 5230,
+    5234, 524, 5244, 5250, 5254, 526, 5264, 5268, 5274, 528, 5284, 5288, 5292, 530, 5302, 5308,
+    5312, 5318, 532, 5328, 5332, 5336, 534, 5346, 5352, 5356, 536, 5366, 5372, 5376, 538, 5386,
+    5390, 5396, 54, 5406, 5410, 5416, 542, 5424, 5430, 5434, 544, 5444, 5450, 5454, 546, 5464,
+    5468, 5474, 548, 5484, 5488, 5494, 550, 5502, 5508, 5512, 552, 5522, 5528, 5532, 5538, 554,
+    5546, 5552, 5556, 556, 5566, 5572, 5576, 558, 5586, 5590, 5596, 56, 5606, 5610, 5616, 562,
+    5624, 5630, 5634, 564, 5644, 5650, 5654, 566, 5664, 5668, 5674, 568, 5684, 5688, 5694, 570,
+    5704, 5708, 5712, 572, 5722, 5728, 5732, 5738, 574, 5748, 5752, 5756, 576, 5766, 5772, 5776,
+    578, 5786, 5792, 5796, 58, 5806, 5810, 5816, 582, 5826, 5830, 5834, 584, 5844, 5850, 5854,
+    586, 5864, 5870, 5874, 588, 5884, 5888, 5894, 590, 5904, 5908, 5914, 592, 5922, 5928, 5932,
+    5938, 594, 5948, 5952, 5958, 596, 5966, 5972, 5976, 598, 5986, 5992, 5996, 6, 6006, 6010,
+    6016, 602, 6026, 6030, 6036, 604, 6044, 6050, 6054, 606, 6064, 6070, 6074, 608, 6084, 6088,
+    6094, 610, 6104, 6108, 6114, 612, 6124, 6128, 6132, 614, 6142, 6148, 6152, 6158, 616, 6166,
+    6172, 6176, 618, 6186, 6192, 6196, 62, 6206, 6210, 6216, 622, 6226, 6230, 6236, 624, 6246,
+    6250, 6254, 626, 6264, 6270, 6274, 628, 6284, 6290, 6294, 630, 6304, 6308, 6314, 632, 6324,
+    6328, 6334, 634, 6342, 6348, 6352, 6358, 636, 6368, 6372, 6376, 638, 6386, 6392, 6396, 64,
+    6406, 6412, 6416, 642, 6426, 6430, 6436, 644, 6446, 6450, 6456, 646, 6464, 6470, 6474, 648,
+    6484, 6490, 6494, 650, 6504, 6508, 6514, 652, 6524, 6528, 6534, 654, 6542, 6548, 6552, 656,
+    6562, 6568, 6572, 6578, 658, 6586, 6592, 6596, 66, 6606, 6612, 6616, 662, 6626, 6630, 6636,
+    664, 6646, 6650, 6656, 666, 6666, 6670, 6674, 668, 6684, 6690, 6694, 670, 6704, 6708, 6714,
+    672, 6724, 6728, 6734, 674, 6744, 6748, 6752, 676, 6762, 6768, 6772, 6778, 678, 6788, 6792,
+    6796, 68, 6806, 6812, 6816, 682, 6826, 6832, 6836, 684, 6846, 6850, 6856, 686, 6866, 6870,
+    6876, 688, 6884, 6890, 6894, 690, 6904, 6910, 6914, 692, 6924, 6928, 6934, 694, 6944, 6948,
+    6954, 696, 6962, 6968, 6972, 6978, 698, 6988, 6992, 6998, 70, 7006, 7012, 7016, 702, 7026,
+    7032, 7036, 704, 7046, 7050, 7056, 706, 7066, 7070, 7076, 708, 7084, 7090, 7094, 710, 7104,
+    7110, 7114, 712, 7124, 7128, 7134, 714, 7144, 7148, 7154, 716, 7164, 7168, 7172, 718, 7182,
+    7188, 7192, 7198, 72, 7208, 7212, 7216, 722, 7226, 7232, 7236, 724, 7246, 7250, 7256, 726,
+    7266, 7270, 7276, 728, 7286, 7290, 7294, 730, 7304, 7310, 7314, 732, 7324, 7330, 7334, 734,
+    7344, 7348, 7354, 736, 7364, 7368, 7374, 738, 7382, 7388, 7392, 7398, 74, 7408, 7412, 7416,
+    742, 7426, 7432, 7436, 744, 7446, 7452, 7456, 746, 7466, 7470, 7476, 748, 7486, 7490, 7496,
+    750, 7504, 7510, 7514, 752, 7524, 7530, 7534, 754, 7544, 7548, 7554, 756, 7564, 7568, 7574,
+    758, 7584, 7588, 7592, 76, 7602, 7608, 7612, 7618, 762, 7626, 7632, 7636, 764, 7646, 7652,
+    7656, 766, 7666, 7670, 7676, 768, 7686, 7690, 7696, 770, 7706, 7710, 7714, 772, 7724, 7730,
+    7734, 774, 7744, 7750, 7754, 776, 7764, 7768, 7774, 778, 7784, 7788, 7792, 78, 7802, 7808,
+    7812, 7818, 782, 7828, 7832, 7836, 784, 7846, 7852, 7856, 786, 7866, 7872, 7876, 788, 7886,
+    7890, 7896, 790, 7906, 7910, 7916, 792, 7924, 7930, 7934, 794, 7944, 7950, 7954, 796, 7964,
+    7968, 7974, 798, 7984, 7988, 7994, 8, 8002, 8008, 8012, 802, 8022, 8028, 8032, 8038, 804,
+    8046, 8052, 8056, 806, 8066, 8072, 8076, 808, 8086, 8090, 8096, 810, 8106, 8110, 8116, 812,
+    8124, 8130, 8134, 814, 8144, 8150, 8154, 816, 8164, 8168, 8174, 818, 8184, 8188, 8194, 82,
+    8204, 8208, 8212, 822, 8222, 8228, 8232, 8238, 824, 8248, 8252, 8256, 826, 8266, 8272, 8276,
+    828, 8286, 8292, 8296, 830, 8306, 8310, 8316, 832, 8326, 8330, 8334, 834, 8344, 8350, 8354,
+    836, 8364, 8370, 8374, 838, 8384, 8388, 8394, 84, 8404, 8408, 8414, 842, 8422, 8428, 8432,
+    8438, 844, 8448, 8452, 8458, 846, 8466, 8472, 8476, 848, 8486, 8492, 8496, 850, 8506, 8510,
+    8516, 852, 8526, 8530, 8536, 854, 8544, 8550, 8554, 856, 8564, 8570, 8574, 858, 8584, 8588,
+    8594, 86, 8604, 8608, 8614, 862, 8624, 8628, 8632, 864, 8642, 8648, 8652, 8658, 866, 8666,
+    8672, 8676, 868, 8686, 8692, 8696, 870, 8706, 8710, 8716, 872, 8726, 8730, 8736, 874, 8746,
+    8750, 8754, 876, 8764, 8770, 8774, 878, 8784, 8790, 8794, 88, 8804, 8808, 8814, 882, 8824,
+    8828, 8834, 884, 8842, 8848, 8852, 8858, 886, 8868, 8872, 8876, 888, 8886, 8892, 8896, 890,
+    8906, 8912, 8916, 892, 8926, 8930, 8936, 894, 8946, 8950, 8956, 896, 8964, 8970, 8974, 898,
+    8984, 8990, 8994, 90, 9004, 9008, 9014, 902, 9024, 9028, 9034, 904, 9042, 9048, 9052, 906,
+    9062, 9068, 9072, 9078, 908, 9086, 9092, 9096, 910, 9106, 9112, 9116, 912, 9126, 9130, 9136,
+    914, 9146, 9150, 9156, 916, 9166, 9170, 9174, 918, 9184, 9190, 9194, 92, 9204, 9208, 9214,
+    922, 9224, 9228, 9234, 924, 9244, 9248, 9252, 926, 9262, 9268, 9272, 9278, 928, 9288, 9292,
+    9296, 930, 9306, 9312, 9316, 932, 9326, 9332, 9336, 934, 9346, 9350, 9356, 936, 9366, 9370,
+    9376, 938, 9384, 9390, 9394, 94, 9404, 9410, 9414, 942, 9424, 9428, 9434, 944, 9444, 9448,
+    9454, 946, 9462, 9468, 9472, 9478, 948, 9488, 9492, 9498, 950, 9506, 9512, 9516, 952, 9526,
+    9532, 9536, 954, 9546, 9550, 9556, 956, 9566, 9570, 9576, 958, 9584, 9590, 9594, 96, 9604,
+    9610, 9614, 962, 9624, 9628, 9634, 964, 9644, 9648, 9654, 966, 9664, 9668, 9672, 968, 9682,
+    9688, 9692, 9698, 970, 9708, 9712, 9716, 972, 9726, 9732, 9736, 974, 9746, 9750, 9756, 976,
+    9766, 9770, 9776, 978, 9786, 9790, 9794, 98, 9804, 9810, 9814, 982, 9824, 9830, 9834, 984,
+    9844, 9848, 9854, 986, 9864, 9868, 9874, 988, 9882, 9888, 9892, 9898, 990, 9908, 9912, 9916,
+    992, 9926, 9932, 9936, 994, 9946, 9952, 9956, 996, 9966, 9970, 9976, 998, 9986, 9990, 9996,
+    10, 10010, 1002, 10030, 1004, 10048, 1006, 10068, 1008, 10088, 1010, 10108, 1012, 10126, 1014, 10146,
+    1016, 10166, 1018, 10186, 102, 10206, 10214, 1022, 10234, 1024, 10254, 1026, 10274, 1028, 10292, 1030,
+    10312, 1032, 10332, 1034, 10352, 1036, 10372, 1038, 10390, 104, 10410, 1042, 10430, 1044, 10450, 1046,
+    10468, 1048, 10488, 1050, 10508, 1052, 10528, 1054, 10546, 1056, 10566, 1058, 10586, 106, 10606, 1062,
+    10624, 10634, 1064, 10654, 1066, 10674, 1068, 10694, 1070, 10712, 1072, 10732, 1074, 10752, 1076, 10772,
+    1078, 10792, 108, 10810, 1082, 10830, 1084, 10850, 1086, 10870, 1088, 10888, 1090, 10908, 1092, 10928,
+    1094, 10948, 1096, 10966, 1098, 10986, 110, 11006, 1102, 11026, 1104, 11044, 11054, 1106, 11074, 1108,
+    11094, 1110, 11114, 1112, 11132, 1114, 11152, 1116, 11172, 1118, 11192, 112, 11210, 1122, 11230, 1124,
+    11250, 1126, 11270, 1128, 11290, 1130, 11308, 1132, 11328, 1134, 11348, 1136, 11368, 1138, 11386, 114,
+    11406, 1142, 11426, 1144, 11446, 11456, 1146, 11474, 1148, 11494, 1150, 11514, 1152, 11534, 1154, 11552,
+    1156, 11572, 1158, 11592, 116, 11612, 1162, 11630, 1164, 11650, 1166, 11670, 1168, 11690, 1170, 11708,
+    1172, 11728, 1174, 11748, 1176, 11768, 1178, 11788, 118, 11806, 1182, 11826, 1184, 11846, 1186, 11866,
+    11876, 1188, 11894, 1190, 11914, 1192, 11934, 1194, 11954, 1196, 11972, 1198, 11992, 12, 12012, 1202,
+    12032, 1204, 12050, 1206, 12070, 1208, 12090, 1210, 12110, 1212, 12128, 1214, 12148, 1216, 12168, 1218,
+    12188, 122, 12208, 1222, 12226, 1224, 12246, 1226, 12266, 1228, 12286, 12294, 1230, 12314, 1232, 12334,
+    1234, 12354, 1236, 12374, 1238, 12392, 124, 12412, 1242, 12432, 1244, 12452, 1246, 12470, 1248, 12490,
+    1250, 12510, 1252, 12530, 1254, 12548, 1256, 12568, 1258, 12588, 126, 12608, 1262, 12626, 1264, 12646,
+    1266, 12666, 1268, 12686, 1270, 12706, 12714, 1272, 12734, 1274, 12754, 1276, 12774, 1278, 12792, 128,
+    12812, 1282, 12832, 1284, 12852, 1286, 12872, 1288, 12890, 1290, 12910, 1292, 12930, 1294, 12950, 1296,
+    12968, 1298, 12988, 130, 13008, 1302, 13028, 1304, 13046, 1306, 13066, 1308, 13086, 1310, 13106, 1312,
+    13124, 13134, 1314, 13154, 1316, 13174, 1318, 13194, 132, 13212, 1322, 13232, 1324, 13252, 1326, 13272,
+    1328, 13292, 1330, 13310, 1332, 13330, 1334, 13350, 1336, 13370, 1338, 13388, 134, 13408, 1342, 13428,
+    1344, 13448, 1346, 13466, 1348, 13486, 1350, 13506, 1352, 13526, 1354, 13544, 13554, 1356, 13574, 1358,
+    13594, 136, 13614, 1362, 13632, 1364, 13652, 1366, 13672, 1368, 13692, 1370, 13710, 1372, 13730, 1374,
+    13750, 1376, 13770, 1378, 13790, 138, 13808, 1382, 13828, 1384, 13848, 1386, 13868, 1388, 13886, 1390,
+    13906, 1392, 13926, 1394, 13946, 13956, 1396, 13974, 1398, 13994, 14, 14014, 1402, 14034, 1404, 14052,
+    1406, 14072, 1408, 14092, 1410, 14112, 1412, 14130, 1414, 14150, 1416, 14170, 1418, 14190, 142, 14208,
+    1422, 14228, 1424, 14248, 1426, 14268, 1428, 14288, 1430, 14306, 1432, 14326, 1434, 14346, 1436, 14366,
+    14376, 1438, 14394, 144, 14414, 1442, 14434, 1444, 14454, 1446, 14472, 1448, 14492, 1450, 14512, 1452,
+    14532, 1454, 14550, 1456, 14570, 1458, 14590, 146, 14610, 1462, 14628, 1464, 14648, 1466, 14668, 1468,
+    14688, 1470, 14708, 1472, 14726, 1474, 14746, 1476, 14766, 1478, 14786, 14794, 148, 14814, 1482, 14834,
+    1484, 14854, 1486, 14874, 1488, 14892, 1490, 14912, 1492, 14932, 1494, 14952, 1496, 14970, 1498, 14990,
+    150, 15010, 1502, 15030, 1504, 15048, 1506, 15068, 1508, 15088, 1510, 15108, 1512, 15126, 1514, 15146,
+    1516, 15166, 1518, 15186, 152, 15206, 15214, 1522, 15234, 1524, 15254, 1526, 15274, 1528, 15292, 1530,
+    15312, 1532, 15332, 1534, 15352, 1536, 15372, 1538, 15390, 154, 15410, 1542, 15430, 1544, 15450, 1546,
+    15468, 1548, 15488, 1550, 15508, 1552, 15528, 1554, 15546, 1556, 15566, 1558, 15586, 156, 15606, 1562,
+    15624, 15634, 1564, 15654, 1566, 15674, 1568, 15694, 1570, 15712, 1572, 15732, 1574, 15752, 1576, 15772,
+    1578, 15792, 158, 15810, 1582, 15830, 1584, 15850, 1586, 15870, 1588, 15888, 1590, 15908, 1592, 15928,
+    1594, 15948, 1596, 15966, 1598, 15986, 16, 16006, 1602, 16026, 1604, 16044, 16054, 1606, 16074, 1608,
+    16094, 1610, 16114, 1612, 16132, 1614, 16152, 1616, 16172, 1618, 16192, 162, 16210, 1622, 16230, 1624,
+    16250, 1626, 16270, 1628, 16290, 1630, 16308, 1632, 16328, 1634, 16348, 1636, 16368, 1638, 16386, 164,
+    16406, 1642, 16426, 1644, 16446, 16456, 1646, 16474, 1648, 16494, 1650, 16514, 1652, 16534, 1654, 16552,
+    1656, 16572, 1658, 16592, 166, 16612, 1662, 16630, 1664, 16650, 1666, 16670, 1668, 16690, 1670, 16708,
+    1672, 16728, 1674, 16748, 1676, 16768, 1678, 16788, 168, 16806, 1682, 16826, 1684, 16846, 1686, 16866,
+    16876, 1688, 16894, 1690, 16914, 1692, 16934, 1694, 16954, 1696, 16972, 1698, 16992, 170, 17012, 1702,
+    17032, 1704, 17050, 1706, 17070, 1708, 17090, 1710, 17110, 1712, 17128, 1714, 17148, 1716, 17168, 1718,
+    17188, 172, 17208, 1722, 17226, 1724, 17246, 1726, 17266, 1728, 17286, 17294, 1730, 17314, 1732, 17334,
+    1734, 17354, 1736, 17374, 1738, 17392, 174, 17412, 1742, 17432, 1744, 17452, 1746, 17470, 1748, 17490,
+    1750, 17510, 1752, 17530, 1754, 17548, 1756, 17568, 1758, 17588, 176, 17608, 1762, 17626, 1764, 17646,
+    1766, 17666, 1768, 17686, 1770, 17706, 17714, 1772, 17734, 1774, 17754, 1776, 17774, 1778, 17792, 178,
+    17812, 1782, 17832, 1784, 17852, 1786, 17872, 1788, 17890, 1790, 17910, 1792, 17930, 1794, 17950, 1796,
+    17968, 1798, 17988, 18, 18008, 1802, 18028, 1804, 18046, 1806, 18066, 1808, 18086, 1810, 18106, 1812,
+    18124, 18134, 1814, 18154, 1816, 18174, 1818, 18194, 182, 18212, 1822, 18232, 1824, 18252, 1826, 18272,
+    1828, 18292, 1830, 18310, 1832, 18330, 1834, 18350, 1836, 18370, 1838, 18388, 184, 18408, 1842, 18428,
+    1844, 18448, 1846, 18466, 1848, 18486, 1850, 18506, 1852, 18526, 1854, 18544, 18554, 1856, 18574, 1858,
+    18594, 186, 18614, 1862, 18632, 1864, 18652, 1866, 18672, 1868, 18692, 1870, 18710, 1872, 18730, 1874,
+    18750, 1876, 18770, 1878, 18790, 188, 18808, 1882, 18828, 1884, 18848, 1886, 18868, 1888, 18886, 1890,
+    18906, 1892, 18926, 1894, 18946, 18956, 1896, 18974, 1898, 18994, 190, 19014, 1902, 19034, 1904, 19052,
+    1906, 19072, 1908, 19092, 1910, 19112, 1912, 19130, 1914, 19150, 1916, 19170, 1918, 19190, 192, 19208,
+    1922, 19228, 1924, 19248, 1926, 19268, 1928, 19288, 1930, 19306, 1932, 19326, 1934, 19346, 1936, 19366,
+    19376, 1938, 19394, 194, 19414, 1942, 19434, 1944, 19454, 1946, 19472, 1948, 19492, 1950, 19512, 1952,
+    19532, 1954, 19550, 1956, 19570, 1958, 19590, 196, 19610, 1962, 19628, 1964, 19648, 1966, 19668, 1968,
+    19688, 1970, 19708, 1972, 19726, 1974, 19746, 1976, 19766, 1978, 19786, 19794, 198, 19814, 1982, 19834,
+    1984, 19854, 1986, 19874, 1988, 19892, 1990, 19912, 1992, 19932, 1994, 19952, 1996, 19970, 1998, 19990,
+    2, 2002, 2004, 2006, 2008, 2010, 2012, 2014, 2016, 2018, 202, 2022, 2024, 2026, 2028, 2030,
+    2032, 2034, 2036, 2038, 204, 20410, 2042, 2044, 2046, 2048, 2050, 2052, 2054, 2056, 2058, 206,
+    2062, 2064, 2066, 2068, 2070, 2072, 2074, 2076, 2078, 208, 2082, 2084, 2086, 2088, 2090, 2092,
+    2094, 2096, 2098, 210, 2102, 2104, 2106, 2108, 2110, 2112, 2114, 2116, 2118, 212, 2122, 2124,
+    21250, 2126, 2128, 2130, 2132, 2134, 2136, 2138, 214, 2142, 2144, 2146, 2148, 2150, 2152, 2154,
+    2156, 2158, 216, 2162, 2164, 2166, 2168, 2170, 2172, 2174, 2176, 2178, 218, 2182, 2184, 2186,
+    2188, 2190, 2192, 2194, 2196, 2198, 22, 2202, 2204, 2206, 2208, 22090, 2210, 2212, 2214, 2216,
+    2218, 222, 2222, 2224, 2226, 2228, 2230, 2232, 2234, 2236, 2238, 224, 2242, 2244, 2246, 2248,
+    2250, 2252, 2254, 2256, 2258, 226, 2262, 2264, 2266, 2268, 2270, 2272, 2274, 2276, 2278, 228,
+    2282, 2284, 2286, 2288, 2290, 22910, 2292, 2294, 2296, 2298, 230, 2302, 2304, 2306, 2308, 2310,
+    2312, 2314, 2316, 2318, 232, 2322, 2324, 2326, 2328, 2330, 2332, 2334, 2336, 2338, 234, 2342,
+    2344, 2346, 2348, 2350, 2352, 2354, 2356, 2358, 236, 2362, 2364, 2366, 2368, 2370, 2372, 2374,
+    23750, 2376, 2378, 238, 2382, 2384, 2386, 2388, 2390, 2392, 2394, 2396, 2398, 24, 2402, 2404,
+    2406, 2408, 2410, 2412, 2414, 2416, 2418, 242, 2422, 2424, 2426, 2428, 2430, 2432, 2434, 2436,
+    2438, 244, 2442, 2444, 2446, 2448, 2450, 2452, 2454, 2456, 2458, 24590, 246, 2462, 2464, 2466,
+    2468, 2470, 2472, 2474, 2476, 2478, 248, 2482, 2484, 2486, 2488, 2490, 2492, 2494, 2496, 2498,
+    250, 2502, 2504, 2506, 2508, 2510, 2512, 2514, 2516, 2518, 252, 2522, 2524, 2526, 2528, 2530,
+    2532, 2534, 2536, 2538, 254, 25410, 2542, 2544, 2546, 2548, 2550, 2552, 2554, 2556, 2558, 256,
+    2562, 2564, 2566, 2568, 2570, 2572, 2574, 2576, 2578, 258, 2582, 2584, 2586, 2588, 2590, 2592,
+    2594, 2596, 2598, 26, 2602, 2604, 2606, 2608, 2610, 2612, 2614, 2616, 2618, 262, 2622, 2624,
+    26250, 2626, 2628, 2630, 2632, 2634, 2636, 2638, 264, 2642, 2644, 2646, 2648, 2650, 2652, 2654,
+    2656, 2658, 266, 2662, 2664, 2666, 2668, 2670, 2672, 2674, 2676, 2678, 268, 2682, 2684, 2686,
+    2688, 2690, 2692, 2694, 2696, 2698, 270, 2702, 2704, 2706, 2708, 27090, 2710, 2712, 2714, 2716,
+    2718, 272, 2722, 2724, 2726, 2728, 2730, 2732, 2734, 2736, 2738, 274, 2742, 2744, 2746, 2748,
+    2750, 2752, 2754, 2756, 2758, 276, 2762, 2764, 2766, 2768, 2770, 2772, 2774, 2776, 2778, 278,
+    2782, 2784, 2786, 2788, 2790, 27910, 2792, 2794, 2796, 2798, 28, 2802, 2804, 2806, 2808, 2810,
+    2812, 2814, 2816, 2818, 282, 2822, 2824, 2826, 2828, 2830, 2832, 2834, 2836, 2838, 284, 2842,
+    2844, 2846, 2848, 2850, 2852, 2854, 2856, 2858, 286, 2862, 2864, 2866, 2868, 2870, 2872, 2874,
+    28750, 2876, 2878, 288, 2882, 2884, 2886, 2888, 2890, 2892, 2894, 2896, 2898, 290, 2902, 2904,
+    2906, 2908, 2910, 2912, 2914, 2916, 2918, 292, 2922, 2924, 2926, 2928, 2930, 2932, 2934, 2936,
+    2938, 294, 2942, 2944, 2946, 2948, 2950, 2952, 2954, 2956, 2958, 29590, 296, 2962, 2964, 2966,
+    2968, 2970, 2972, 2974, 2976, 2978, 298, 2982, 2984, 2986, 2988, 2990, 2992, 2994, 2996, 2998,
+    30, 3002, 3004, 3006, 3008, 3010, 3012, 3014, 3016, 3018, 302, 3022, 3024, 3026, 3028, 3030,
+    3032, 3034, 3036, 3038, 304, 30410, 3042, 3044, 3046, 3048, 3050, 3052, 3054, 3056, 3058, 306,
+    3062, 3064, 3066, 3068, 3070, 3072, 3074, 3076, 3078, 308, 3082, 3084, 3086, 3088, 3090, 3092,
+    3094, 3096, 3098, 310, 3102, 3104, 3106, 3108, 3110, 3112, 3114, 3116, 3118, 312, 3122, 3124,
+    31250, 3126, 3128, 3130, 3132, 3134, 3136, 3138, 314, 3142, 3144, 3146, 3148, 3150, 3152, 3154,
+    3156, 3158, 316, 3162, 3164, 3166, 3168, 3170, 3172, 3174, 3176, 3178, 318, 3182, 3184, 3186,
+    3188, 3190, 3192, 3194, 3196, 3198, 32, 3202, 3204, 3206, 3208, 32090, 3210, 3212, 3214, 3216,
+    3218, 322, 3222, 3224, 3226, 3228, 3230, 3232, 3234, 3236, 3238, 324, 3242, 3244, 3246, 3248,
+    3250, 3252, 3254, 3256, 3258, 326, 3262, 3264, 3266, 3268, 3270, 3272, 3274, 3276, 3278, 328,
+    3282, 3284, 3286, 3288, 3290, 32910, 3292, 3294, 3296, 3298, 330, 3302, 3304, 3306, 3308, 3310,
+    3312, 3314, 3316, 3318, 332, 3322, 3324, 3326, 3328, 3330, 3332, 3334, 3336, 3338, 334, 3342,
+    3344, 3346, 3348, 3350, 3352, 3354, 3356, 3358, 336, 3362, 3364, 3366, 3368, 3370, 3372, 3374,
+    33750, 3376, 3378, 338, 3382, 3384, 3386, 3388, 3390, 3392, 3394, 3396, 3398, 34, 3402, 3404,
+    3406, 3408, 3410, 3412, 3414, 3416, 3418, 342, 3422, 3424, 3426, 3428, 3430, 3432, 3434, 3436,
+    3438, 344, 3442, 3444, 3446, 3448, 3450, 3452, 3454, 3456, 3458, 34590, 346, 3462, 3464, 3466,
+    3468, 3470, 3472, 3474, 3476, 3478, 348, 3482, 3484, 3486, 3488, 3490, 3492, 3494, 3496, 3498,
+    350, 3502, 3504, 3506, 3508, 3510, 3512, 3514, 3516, 3518, 352, 3522, 3524, 3526, 3528, 3530,
+    3532, 3534, 3536, 3538, 354, 35410, 3542, 3544, 3546, 3548, 3550, 3552, 3554, 3556, 3558, 356,
+    3562, 3564, 3566, 3568, 3570, 3572, 3574, 3576, 3578, 358, 3582, 3584, 3586, 3588, 3590, 3592,
+    3594, 3596, 3598, 36, 3602, 3604, 3606, 3608, 3610, 3612, 3614, 3616, 3618, 362, 3622, 3624,
+    36250, 3626, 3628, 3630, 3632, 3634, 3636, 3638, 364, 3642, 3644, 3646, 3648, 3650, 3652, 3654,
+    3656, 3658, 366, 3662, 3664, 3666, 3668, 3670, 3672, 3674, 3676, 3678, 368, 3682, 3684, 3686,
+    3688, 3690, 3692, 3694, 3696, 3698, 370, 3702, 3704, 3706, 3708, 37090, 3710, 3712, 3714, 3716,
+    3718, 372, 3722, 3724, 3726, 3728, 3730, 3732, 3734, 3736, 3738, 374, 3742, 3744, 3746, 3748,
+    3750, 3752, 3754, 3756, 3758, 376, 3762, 3764, 3766, 3768, 3770, 3772, 3774, 3776, 3778, 378,
+    3782, 3784, 3786, 3788, 3790, 37910, 3792, 3794, 3796, 3798, 38, 3802, 3804, 3806, 3808, 3810,
+    3812, 3814, 3816, 3818, 382, 3822, 3824, 3826, 3828, 3830, 3832, 3834, 3836, 3838, 384, 3842,
+    3844, 3846, 3848, 3850, 3852, 3854, 3856, 3858, 386, 3862, 3864, 3866, 3868, 3870, 3872, 3874,
+    38750, 3876, 3878, 388, 3882, 3884, 3886, 3888, 3890, 3892, 3894, 3896, 3898, 390, 3902, 3904,
+    3906, 3908, 3910, 3912, 3914, 3916, 3918, 392, 3922, 3924, 3926, 3928, 3930, 3932, 3934, 3936,
+    3938, 394, 3942, 3944, 3946, 3948, 3950, 3952, 3954, 3956, 3958, 39590, 396, 3962, 3964, 3966,
+    3968, 3970, 3972, 3974, 3976, 3978, 398, 3982, 3984, 3986, 3988, 3990, 3992, 3994, 3996, 3998,
+    4, 4004, 4008, 4012, 4016, 402, 4024, 4028, 4032, 4036, 404, 4042, 4046, 4050, 4054, 406,
+    4062, 4066, 4070, 4074, 408, 4082, 4086, 4090, 4094, 4098, 410, 4106, 4110, 4114, 4118, 412,
+    4124, 4128, 4132, 4136, 414, 4144, 4148, 4152, 4156, 416, 4164, 4168, 4172, 4176, 418, 4184,
+    4188, 4192, 4196, 42, 4204, 4208, 4210, 4214, 422, 4222, 4226, 4230, 4234, 424, 4242, 4246,
+    4250, 4254, 4258, 426, 4266, 4270, 4274, 4278, 428, 4286, 4290, 4292, 4296, 430, 4304, 4308,
+    4312, 4316, 432, 4324, 4328, 4332, 4336, 434, 4344, 4348, 4352, 4356, 436, 4364, 4368, 4372,
+    4376, 438, 4382, 4386, 4390, 4394, 44, 4402, 4406, 4410, 4414, 4418, 442, 4426, 4430, 4434,
+    4438, 444, 4446, 4450, 4454, 4458, 446, 4464, 4468, 4472, 4476, 448, 4484, 4488, 4492, 4496,
+    450, 4504, 4508, 4512, 4516, 452, 4524, 4528, 4532, 4536, 454, 4542, 4546, 4550, 4554, 456,
+    4562, 4566, 4570, 4574, 458, 4582, 4586, 4590, 4594, 4598, 46, 4606, 4610, 4614, 4618, 462,
+    4624, 4628, 4632, 4636, 464, 4644, 4648, 4652, 4656, 466, 4664, 4668, 4672, 4676, 468, 4684,
+    4688, 4692, 4696, 470, 4704, 4708, 4710, 4714, 472, 4722, 4726, 4730, 4734, 474, 4742, 4746,
+    4750, 4754, 4758, 476, 4766, 4770, 4774, 4778, 478, 4786, 4790, 4792, 4796, 48, 4804, 4808,
+    4812, 4816, 482, 4824, 4828, 4832, 4836, 484, 4844, 4848, 4852, 4856, 486, 4864, 4868, 4872,
+    4876, 488, 4882, 4886, 4890, 4894, 490, 4902, 4906, 4910, 4914, 4918, 492, 4926, 4930, 4934,
+    4938, 494, 4946, 4950, 4954, 4958, 496, 4964, 4968, 4972, 4976, 498, 4984, 4988, 4992, 4996,
+    50, 5004, 5008, 5012, 5016, 502, 5024, 5028, 5032, 5036, 504, 5042, 5046, 5050, 5054, 506,
+    5062, 5066, 5070, 5074, 508, 5082, 5086, 5090, 5094, 5098, 510, 5106, 5110, 5114, 5118, 512,
+    5124, 5128, 5132, 5136, 514, 5144, 5148, 5152, 5156, 516, 5164, 5168, 5172, 5176, 518, 5184,
+    5188, 5192, 5196, 52, 5204, 5208, 5210, 5214, 522, 5222, 5226, 5230, 5234, 524, 5242, 5246,
+    5250, 5254, 5258, 526, 5266, 5270, 5274, 5278, 528, 5286, 5290, 5292, 5296, 530, 5304, 5308,
+    5312, 5316, 532, 5324, 5328, 5332, 5336, 534, 5344, 5348, 5352, 5356, 536, 5364, 5368, 5372,
+    5376, 538, 5382, 5386, 5390, 5394, 54, 5402, 5406, 5410, 5414, 5418, 542, 5426, 5430, 5434,
+    5438, 544, 5446, 5450, 5454, 5458, 546, 5464, 5468, 5472, 5476, 548, 5484, 5488, 5492, 5496,
+    550, 5504, 5508, 5512, 5516, 552, 5524, 5528, 5532, 5536, 554, 5542, 5546, 5550, 5554, 556,
+    5562, 5566, 5570, 5574, 558, 5582, 5586, 5590, 5594, 5598, 56, 5606, 5610, 5614, 5618, 562,
+    5624, 5628, 5632, 5636, 564, 5644, 5648, 5652, 5656, 566, 5664, 5668, 5672, 5676, 568, 5684,
+    5688, 5692, 5696, 570, 5704, 5708, 5710, 5714, 572, 5722, 5726, 5730, 5734, 574, 5742, 5746,
+    5750, 5754, 5758, 576, 5766, 5770, 5774, 5778, 578, 5786, 5790, 5792, 5796, 58, 5804, 5808,
+    5812, 5816, 582, 5824, 5828, 5832, 5836, 584, 5844, 5848, 5852, 5856, 586, 5864, 5868, 5872,
+    5876, 588, 5882, 5886, 5890, 5894, 590, 5902, 5906, 5910, 5914, 5918, 592, 5926, 5930, 5934,
+    5938, 594, 5946, 5950, 5954, 5958, 596, 5964, 5968, 5972, 5976, 598, 5984, 5988, 5992, 5996,
+    6, 6004, 6008, 6012, 6016, 602, 6024, 6028, 6032, 6036, 604, 6042, 6046, 6050, 6054, 606,
+    6062, 6066, 6070, 6074, 608, 6082, 6086, 6090, 6094, 6098, 610, 6106, 6110, 6114, 6118, 612,
+    6124, 6128, 6132, 6136, 614, 6144, 6148, 6152, 6156, 616, 6164, 6168, 6172, 6176, 618, 6184,
+    6188, 6192, 6196, 62, 6204, 6208, 6210, 6214, 622, 6222, 6226, 6230, 6234, 624, 6242, 6246,
+    6250, 6254, 6258, 626, 6266, 6270, 6274, 6278, 628, 6286, 6290, 6292, 6296, 630, 6304, 6308,
+    6312, 6316, 632, 6324, 6328, 6332, 6336, 634, 6344, 6348, 6352, 6356, 636, 6364, 6368, 6372,
+    6376, 638, 6382, 6386, 6390, 6394, 64, 6402, 6406, 6410, 6414, 6418, 642, 6426, 6430, 6434,
+    6438, 644, 6446, 6450, 6454, 6458, 646, 6464, 6468, 6472, 6476, 648, 6484, 6488, 6492, 6496,
+    650, 6504, 6508, 6512, 6516, 652, 6524, 6528, 6532, 6536, 654, 6542, 6546, 6550, 6554, 656,
+    6562, 6566, 6570, 6574, 658, 6582, 6586, 6590, 6594, 6598, 66, 6606, 6610, 6614, 6618, 662,
+    6624, 6628, 6632, 6636, 664, 6644, 6648, 6652, 6656, 666, 6664, 6668, 6672, 6676, 668, 6684,
+    6688, 6692, 6696, 670, 6704, 6708, 6710, 6714, 672, 6722, 6726, 6730, 6734, 674, 6742, 6746,
+    6750, 6754, 6758, 676, 6766, 6770, 6774, 6778, 678, 6786, 6790, 6792, 6796, 68, 6804, 6808,
+    6812, 6816, 682, 6824, 6828, 6832, 6836, 684, 6844, 6848, 6852, 6856, 686, 6864, 6868, 6872,
+    6876, 688, 6882, 6886, 6890, 6894, 690, 6902, 6906, 6910, 6914, 6918, 692, 6926, 6930, 6934,
+    6938, 694, 6946, 6950, 6954, 6958, 696, 6964, 6968, 6972, 6976, 698, 6984, 6988, 6992, 6996,
+    70, 7004, 7008, 7012, 7016, 702, 7024, 7028, 7032, 7036, 704, 7042, 7046, 7050, 7054, 706,
+    7062, 7066, 7070, 7074, 708, 7082, 7086, 7090, 7094, 7098, 710, 7106, 7110, 7114, 7118, 712,
+    7124, 7128, 7132, 7136, 714, 7144, 7148, 7152, 7156, 716, 7164, 7168, 7172, 7176, 718, 7184,
+    7188, 7192, 7196, 72, 7204, 7208, 7210, 7214, 722, 7222, 7226, 7230, 7234, 724, 7242, 7246,
+    7250, 7254, 7258, 726, 7266, 7270, 7274, 7278, 728, 7286, 7290, 7292, 7296, 730, 7304, 7308,
+    7312, 7316, 732, 7324, 7328, 7332, 7336, 734, 7344, 7348, 7352, 7356, 736, 7364, 7368, 7372,
+    7376, 738, 7382, 7386, 7390, 7394, 74, 7402, 7406, 7410, 7414, 7418, 742, 7426, 7430, 7434,
+    7438, 744, 7446, 7450, 7454, 7458, 746, 7464, 7468, 7472, 7476, 748, 7484, 7488, 7492, 7496,
+    750, 7504, 7508, 7512, 7516, 752, 7524, 7528, 7532, 7536, 754, 7542, 7546, 7550, 7554, 756,
+    7562, 7566, 7570, 7574, 758, 7582, 7586, 7590, 7594, 7598, 76, 7606, 7610, 7614, 7618, 762,
+    7624, 7628, 7632, 7636, 764, 7644, 7648, 7652, 7656, 766, 7664, 7668, 7672, 7676, 768, 7684,
+    7688, 7692, 7696, 770, 7704, 7708, 7710, 7714, 772, 7722, 7726, 7730, 7734, 774, 7742, 7746,
+    7750, 7754, 7758, 776, 7766, 7770, 7774, 7778, 778, 7786, 7790, 7792, 7796, 78, 7804, 7808,
+    7812, 7816, 782, 7824, 7828, 7832, 7836, 784, 7844, 7848, 7852, 7856, 786, 7864, 7868, 7872,
+    7876, 788, 7882, 7886, 7890, 7894, 790, 7902, 7906, 7910, 7914, 7918, 792, 7926, 7930, 7934,
+    7938, 794, 7946, 7950, 7954, 7958, 796, 7964, 7968, 7972, 7976, 798, 7984, 7988, 7992, 7996,
+    8, 8008, 8016, 802, 8032, 804, 8046, 8054, 806, 8070, 808, 8086, 8094, 810, 8110, 812,
+    8124, 8132, 814, 8148, 816, 8164, 8172, 818, 8188, 8196, 82, 8210, 822, 8226, 8234, 824,
+    8250, 826, 8266, 8274, 828, 8290, 830, 8304, 8312, 832, 8328, 8336, 834, 8352, 836, 8368,
+    8376, 838, 8390, 84, 8406, 8414, 842, 8430, 844, 8446, 8454, 846, 8468, 848, 8484, 8492,
+    850, 8508, 8516, 852, 8532, 854, 8546, 8554, 856, 8570, 858, 8586, 8594, 86, 8610, 862,
+    8624, 8632, 864, 8648, 866, 8664, 8672, 868, 8688, 8696, 870, 8710, 872, 8726, 8734, 874,
+    8750, 876, 8766, 8774, 878, 8790, 88, 8804, 8812, 882, 8828, 8836, 884, 8852, 886, 8868,
+    8876, 888, 8890, 890, 8906, 8914, 892, 8930, 894, 8946, 8954, 896, 8968, 898, 8984, 8992,
+    90, 9008, 9016, 902, 9032, 904, 9046, 9054, 906, 9070, 908, 9086, 9094, 910, 9110, 912,
+    9124, 9132, 914, 9148, 916, 9164, 9172, 918, 9188, 9196, 92, 9210, 922, 9226, 9234, 924,
+    9250, 926, 9266, 9274, 928, 9290, 930, 9304, 9312, 932, 9328, 9336, 934, 9352, 936, 9368,
+    9376, 938, 9390, 94, 9406, 9414, 942, 9430, 944, 9446, 9454, 946, 9468, 948, 9484, 9492,
+    950, 9508, 9516, 952, 9532, 954, 9546, 9554, 956, 9570, 958, 9586, 9594, 96, 9610, 962,
+    9624, 9632, 964, 9648, 966, 9664, 9672, 968, 9688, 9696, 970, 9710, 972, 9726, 9734, 974,
+    9750, 976, 9766, 9774, 978, 9790, 98, 9804, 9812, 982, 9828, 9836, 984, 9852, 986, 9868,
+    9876, 988, 9890, 990, 9906, 9914, 992, 9930, 994, 9946, 9954, 996, 9968, 998, 9984, 9992,
+    10, 10008, 10016, 1002, 10032, 1004, 10046, 10054, 1006, 10070, 1008, 10086, 10094, 1010, 10110, 1012,
+    10124, 10132, 1014, 10148, 1016, 10164, 10172, 1018, 10188, 10196, 102, 10210, 1022, 10226, 10234, 1024,
+    10250, 1026, 10266, 10274, 1028, 10290, 1030, 10304, 10312, 1032, 10328, 10336, 1034, 10352, 1036, 10368,
+    10376, 1038, 10390, 104, 10406, 10414, 1042, 10430, 1044, 10446, 10454, 1046, 10468, 1048, 10484, 10492,
+    1050, 10508, 10516, 1052, 10532, 1054, 10546, 10554, 1056, 10570, 1058, 10586, 10594, 106, 10610, 1062,
+    10624, 10632, 1064, 10648, 1066, 10664, 10672, 1068, 10688, 10696, 1070, 10710, 1072, 10726, 10734, 1074,
+    10750, 1076, 10766, 10774, 1078, 10790, 108, 10804, 10812, 1082, 10828, 10836, 1084, 10852, 1086, 10868,
+    10876, 1088, 10890, 1090, 10906, 10914, 1092, 10930, 1094, 10946, 10954, 1096, 10968, 1098, 10984, 10992,
+    110, 11008, 11016, 1102, 11032, 1104, 11046, 11054, 1106, 11070, 1108, 11086, 11094, 1110, 11110, 1112,
+    11124, 11132, 1114, 11148, 1116, 11164, 11172, 1118, 11188, 11196, 112, 11210, 1122, 11226, 11234, 1124,
+    11250, 1126, 11266, 11274, 1128, 11290, 1130, 11304, 11312, 1132, 11328, 11336, 1134, 11352, 1136, 11368,
+    11376, 1138, 11390, 114, 11406, 11414, 1142, 11430, 1144, 11446, 11454, 1146, 11468, 1148, 11484, 11492,
+    1150, 11508, 11516, 1152, 11532, 1154, 11546, 11554, 1156, 11570, 1158, 11586, 11594, 116, 11610, 1162,
+    11624, 11632, 1164, 11648, 1166, 11664, 11672, 1168, 11688, 11696, 1170, 11710, 1172, 11726, 11734, 1174,
+    11750, 1176, 11766, 11774, 1178, 11790, 118, 11804, 11812, 1182, 11828, 11836, 1184, 11852, 1186, 11868,
+    11876, 1188, 11890, 1190, 11906, 11914, 1192, 11930, 1194, 11946, 11954, 1196, 11968, 1198, 11984, 11992,
+    12, 12008, 12016, 1202, 12032, 1204, 12046, 12054, 1206, 12070, 1208, 12086, 12094, 1210, 12110, 1212,
+    12124, 12132, 1214, 12148, 1216, 12164, 12172, 1218, 12188, 12196, 122, 12210, 1222, 12226, 12234, 1224,
+    12250, 1226, 12266, 12274, 1228, 12290, 1230, 12304, 12312, 1232, 12328, 12336, 1234, 12352, 1236, 12368,
+    12376, 1238, 12390, 124, 12406, 12414, 1242, 12430, 1244, 12446, 12454, 1246, 12468, 1248, 12484, 12492,
+    1250, 12508, 12516, 1252, 12532, 1254, 12546, 12554, 1256, 12570, 1258, 12586, 12594, 126, 12610, 1262,
+    12624, 12632, 1264, 12648, 1266, 12664, 12672, 1268, 12688, 12696, 1270, 12710, 1272, 12726, 12734, 1274,
+    12750, 1276, 12766, 12774, 1278, 12790, 128, 12804, 12812, 1282, 12828, 12836, 1284, 12852, 1286, 12868,
+    12876, 1288, 12890, 1290, 12906, 12914, 1292, 12930, 1294, 12946, 12954, 1296, 12968, 1298, 12984, 12992,
+    130, 13008, 13016, 1302, 13032, 1304, 13046, 13054, 1306, 13070, 1308, 13086, 13094, 1310, 13110, 1312,
+    13124, 13132, 1314, 13148, 1316, 13164, 13172, 1318, 13188, 13196, 132, 13210, 1322, 13226, 13234, 1324,
+    13250, 1326, 13266, 13274, 1328, 13290, 1330, 13304, 13312, 1332, 13328, 13336, 1334, 13352, 1336, 13368,
+    13376, 1338, 13390, 134, 13406, 13414, 1342, 13430, 1344, 13446, 13454, 1346, 13468, 1348, 13484, 13492,
+    1350, 13508, 13516, 1352, 13532, 1354, 13546, 13554, 1356, 13570, 1358, 13586, 13594, 136, 13610, 1362,
+    13624, 13632, 1364, 13648, 1366, 13664, 13672, 1368, 13688, 13696, 1370, 13710, 1372, 13726, 13734, 1374,
+    13750, 1376, 13766, 13774, 1378, 13790, 138, 13804, 13812, 1382, 13828, 13836, 1384, 13852, 1386, 13868,
+    13876, 1388, 13890, 1390, 13906, 13914, 1392, 13930, 1394, 13946, 13954, 1396, 13968, 1398, 13984, 13992,
+    14, 14008, 14016, 1402, 14032, 1404, 14046, 14054, 1406, 14070, 1408, 14086, 14094, 1410, 14110, 1412,
+    14124, 14132, 1414, 14148, 1416, 14164, 14172, 1418, 14188, 14196, 142, 14210, 1422, 14226, 14234, 1424,
+    14250, 1426, 14266, 14274, 1428, 14290, 1430, 14304, 14312, 1432, 14328, 14336, 1434, 14352, 1436, 14368,
+    14376, 1438, 14390, 144, 14406, 14414, 1442, 14430, 1444, 14446, 14454, 1446, 14468, 1448, 14484, 14492,
+    1450, 14508, 14516, 1452, 14532, 1454, 14546, 14554, 1456, 14570, 1458, 14586, 14594, 146, 14610, 1462,
+    14624, 14632, 1464, 14648, 1466, 14664, 14672, 1468, 14688, 14696, 1470, 14710, 1472, 14726, 14734, 1474,
+    14750, 1476, 14766, 14774, 1478, 14790, 148, 14804, 14812, 1482, 14828, 14836, 1484, 14852, 1486, 14868,
+    14876, 1488, 14890, 1490, 14906, 14914, 1492, 14930, 1494, 14946, 14954, 1496, 14968, 1498, 14984, 14992,
+    150, 15008, 15016, 1502, 15032, 1504, 15046, 15054, 1506, 15070, 1508, 15086, 15094, 1510, 15110, 1512,
+    15124, 15132, 1514, 15148, 1516, 15164, 15172, 1518, 15188, 15196, 152, 15210, 1522, 15226, 15234, 1524,
+    15250, 1526, 15266, 15274, 1528, 15290, 1530, 15304, 15312, 1532, 15328, 15336, 1534, 15352, 1536, 15368,
+    15376, 1538, 15390, 154, 15406, 15414, 1542, 15430, 1544, 15446, 15454, 1546, 15468, 1548, 15484, 15492,
+    1550, 15508, 15516, 1552, 15532, 1554, 15546, 15554, 1556, 15570, 1558, 15586, 15594, 156, 15610, 1562,
+    15624, 15632, 1564, 15648, 1566, 15664, 15672, 1568, 15688, 15696, 1570, 15710, 1572, 15726, 15734, 1574,
+    15750, 1576, 15766, 15774, 1578, 15790, 158, 15804, 15812, 1582, 15828, 15836, 1584, 15852, 1586, 15868,
+    15876, 1588, 15890, 1590, 15906, 15914, 1592, 15930, 1594, 15946, 15954, 1596, 15968, 1598, 15984, 15992,
+    16, 1602, 16032, 1604, 1606, 1608, 1610, 16110, 1612, 1614, 1616, 16172, 1618, 162, 1622, 1624,
+    16250, 1626, 1628, 1630, 1632, 16328, 1634, 1636, 1638, 16390, 164, 1642, 1644, 1646, 16468, 1648,
+    1650, 1652, 16532, 1654, 1656, 1658, 166, 16610, 1662, 1664, 1666, 16672, 1668, 1670, 1672, 1674,
+    16750, 1676, 1678, 168, 1682, 16828, 1684, 1686, 1688, 16890, 1690, 1692, 1694, 1696, 16968, 1698,
+    170, 1702, 17032, 1704, 1706, 1708, 1710, 17110, 1712, 1714, 1716, 17172, 1718, 172, 1722, 1724,
+    17250, 1726, 1728, 1730, 1732, 17328, 1734, 1736, 1738, 17390, 174, 1742, 1744, 1746, 17468, 1748,
+    1750, 1752, 17532, 1754, 1756, 1758, 176, 17610, 1762, 1764, 1766, 17672, 1768, 1770, 1772, 1774,
+    17750, 1776, 1778, 178, 1782, 17828, 1784, 1786, 1788, 17890, 1790, 1792, 1794, 1796, 17968, 1798,
+    18, 1802, 18032, 1804, 1806, 1808, 1810, 18110, 1812, 1814, 1816, 18172, 1818, 182, 1822, 1824,
+    18250, 1826, 1828, 1830, 1832, 18328, 1834, 1836, 1838, 18390, 184, 1842, 1844, 1846, 18468, 1848,
+    1850, 1852, 18532, 1854, 1856, 1858, 186, 18610, 1862, 1864, 1866, 18672, 1868, 1870, 1872, 1874,
+    18750, 1876, 1878, 188, 1882, 18828, 1884, 1886, 1888, 18890, 1890, 1892, 1894, 1896, 18968, 1898,
+    190, 1902, 19032, 1904, 1906, 1908, 1910, 19110, 1912, 1914, 1916, 19172, 1918, 192, 1922, 1924,
+    19250, 1926, 1928, 1930, 1932, 19328, 1934, 1936, 1938, 19390, 194, 1942, 1944, 1946, 19468, 1948,
+    1950, 1952, 19532, 1954, 1956, 1958, 196, 19610, 1962, 1964, 1966, 19672, 1968, 1970, 1972, 1974,
+    19750, 1976, 1978, 198, 1982, 19828, 1984, 1986, 1988, 19890, 1990, 1992, 1994, 1996, 19968, 1998,
+    3, 2003, 20033, 2005, 2007, 2009, 2011, 20111, 2013, 2015, 2017, 20173, 2019, 203, 2023, 2025,
+    20251, 2027, 2029, 2031, 2033, 20329, 2035, 2037, 2039, 20391, 205, 2043, 2045, 2047, 20469, 2049,
+    2051, 2053, 20533, 2055, 2057, 2059, 207, 20611, 2063, 2065, 2067, 20673, 2069, 2071, 2073, 2075,
+    20751, 2077, 2079, 209, 2083, 20829, 2085, 2087, 2089, 20891, 2091, 2093, 2095, 2097, 20969, 2099,
+    211, 2103, 21033, 2105, 2107, 2109, 2111, 21111, 2113, 2115, 2117, 21173, 2119, 213, 2123, 2125,
+    21251, 2127, 2129, 2131, 2133, 21329, 2135, 2137, 2139, 21391, 215, 2143, 2145, 2147, 21469, 2149,
+    2151, 2153, 21533, 2155, 2157, 2159, 217, 21611, 2163, 2165, 2167, 21673, 2169, 2171, 2173, 2175,
+    21751, 2177, 2179, 219, 2183, 21829, 2185, 2187, 2189, 21891, 2191, 2193, 2195, 2197, 21969, 2199,
+    23, 2203, 22033, 2205, 2207, 2209, 2211, 22111, 2213, 2215, 2217, 22173, 2219, 223, 2223, 2225,
+    22251, 2227, 2229, 2231, 2233, 22329, 2235, 2237, 2239, 22391, 225, 2243, 2245, 2247, 22469, 2249,
+    2251, 2253, 22533, 2255, 2257, 2259, 227, 22611, 2263, 2265, 2267, 22673, 2269, 2271, 2273, 2275,
+    22751, 2277, 2279, 229, 2283, 22829, 2285, 2287, 2289, 22891, 2291, 2293, 2295, 2297, 22969, 2299,
+    231, 2303, 23033, 2305, 2307, 2309, 2311, 23111, 2313, 2315, 2317, 23173, 2319, 233, 2323, 2325,
+    23251, 2327, 2329, 2331, 2333, 23329, 2335, 2337, 2339, 23391, 235, 2343, 2345, 2347, 23469, 2349,
+    2351, 2353, 23533, 2355, 2357, 2359, 237, 23611, 2363, 2365, 2367, 23673, 2369, 2371, 2373, 2375,
+    23751, 2377, 2379, 239, 2383, 23829, 2385, 2387, 2389, 23891, 2391, 2393, 2395, 2397, 23969, 2399,
+    25, 2403, 24033, 2405, 2407, 2409, 2411, 24111, 2413, 2415, 2417, 24173, 2419, 243, 2423, 2425,
+    24251, 2427, 2429, 2431, 2433, 24329, 2435, 2437, 2439, 24391, 245, 2443, 2445, 2447, 24469, 2449,
+    2451, 2453, 24533, 2455, 2457, 2459, 247, 24611, 2463, 2465, 2467, 24673, 2469, 2471, 2473, 2475,
+    24751, 2477, 2479, 249, 2483, 24829, 2485, 2487, 2489, 24891, 2491, 2493, 2495, 2497, 24969, 2499,
+    251, 2503, 25033, 2505, 2507, 2509, 2511, 25111, 2513, 2515, 2517, 25173, 2519, 253, 2523, 2525,
+    25251, 2527, 2529, 2531, 2533, 25329, 2535, 2537, 2539, 25391, 255, 2543, 2545, 2547, 25469, 2549,
+    2551, 2553, 25533, 2555, 2557, 2559, 257, 25611, 2563, 2565, 2567, 25673, 2569, 2571, 2573, 2575,
+    25751, 2577, 2579, 259, 2583, 25829, 2585, 2587, 2589, 25891, 2591, 2593, 2595, 2597, 25969, 2599,
+    27, 2603, 26033, 2605, 2607, 2609, 2611, 26111, 2613, 2615, 2617, 26173, 2619, 263, 2623, 2625,
+    26251, 2627, 2629, 2631, 2633, 26329, 2635, 2637, 2639, 26391, 265, 2643, 2645, 2647, 26469, 2649,
+    2651, 2653, 26533, 2655, 2657, 2659, 267, 26611, 2663, 2665, 2667, 26673, 2669, 2671, 2673, 2675,
+    26751, 2677, 2679, 269, 2683, 26829, 2685, 2687, 2689, 26891, 2691, 2693, 2695, 2697, 26969, 2699,
+    271, 2703, 27033, 2705, 2707, 2709, 2711, 27111, 2713, 2715, 2717, 27173, 2719, 273, 2723, 2725,
+    27251, 2727, 2729, 2731, 2733, 27329, 2735, 2737, 2739, 27391, 275, 2743, 2745, 2747, 27469, 2749,
+    2751, 2753, 27533, 2755, 2757, 2759, 277, 27611, 2763, 2765, 2767, 27673, 2769, 2771, 2773, 2775,
+    27751, 2777, 2779, 279, 2783, 27829, 2785, 2787, 2789, 27891, 2791, 2793, 2795, 2797, 27969, 2799,
+    29, 2803, 28033, 2805, 2807, 2809, 2811, 28111, 2813, 2815, 2817, 28173, 2819, 283, 2823, 2825,
+    28251, 2827, 2829, 2831, 2833, 28329, 2835, 2837, 2839, 28391, 285, 2843, 2845, 2847, 28469, 2849,
+    2851, 2853, 28533, 2855, 2857, 2859, 287, 28611, 2863, 2865, 2867, 28673, 2869, 2871, 2873, 2875,
+    28751, 2877, 2879, 289, 2883, 28829, 2885, 2887, 2889, 28891, 2891, 2893, 2895, 2897, 28969, 2899,
+    291, 2903, 29033, 2905, 2907, 2909, 2911, 29111, 2913, 2915, 2917, 29173, 2919, 293, 2923, 2925,
+    29251, 2927, 2929, 2931, 2933, 29329, 2935, 2937, 2939, 29391, 295, 2943, 2945, 2947, 29469, 2949,
+    2951, 2953, 29533, 2955, 2957, 2959, 297, 29611, 2963, 2965, 2967, 29673, 2969, 2971, 2973, 2975,
+    29751, 2977, 2979, 299, 2983, 29829, 2985, 2987, 2989, 29891, 2991, 2993, 2995, 2997, 29969, 2999,
+    31, 3003, 30033, 3005, 3007, 3009, 3011, 30111, 3013, 3015, 3017, 30173, 3019, 303, 3023, 3025,
+    30251, 3027, 3029, 3031, 3033, 30329, 3035, 3037, 3039, 30391, 305, 3043, 3045, 3047, 30469, 3049,
+    3051, 3053, 30533, 3055, 3057, 3059, 307, 30611, 3063, 3065, 3067, 30673, 3069, 3071, 3073, 3075,
+    30751, 3077, 3079, 309, 3083, 30829, 3085, 3087, 3089, 30891, 3091, 3093, 3095, 3097, 30969, 3099,
+    311, 3103, 31033, 3105, 3107, 3109, 3111, 31111, 3113, 3115, 3117, 31173, 3119, 313, 3123, 3125,
+    31251, 3127, 3129, 3131, 3133, 31329, 3135, 3137, 3139, 31391, 315, 3143, 3145, 3147, 31469, 3149,
+    3151, 3153, 31533, 3155, 3157, 3159, 317, 31611, 3163, 3165, 3167, 31673, 3169, 3171, 3173, 3175,
+    31751, 3177, 3179, 319, 3183, 31829, 3185, 3187, 3189, 31891, 3191, 3193, 3195, 3197, 31969, 3199,
+    32, 3204, 3206, 3210, 3212, 3216, 322, 3222, 3224, 3228, 3232, 3234, 3238, 324, 3244, 3246,
+    3250, 3254, 3256, 326, 3262, 3266, 3268, 3272, 3276, 3278, 328, 3284, 3288, 3290, 3294, 3296,
+    330, 3304, 3306, 3310, 3312, 3316, 332, 3322, 3324, 3328, 3332, 3334, 3338, 334, 3344, 3346,
+    3350, 3354, 3356, 336, 3362, 3366, 3368, 3372, 3376, 3378, 338, 3384, 3388, 3390, 3394, 3396,
+    34, 3404, 3406, 3410, 3412, 3416, 342, 3422, 3424, 3428, 3432, 3434, 3438, 344, 3444, 3446,
+    3450, 3454, 3456, 346, 3462, 3466, 3468, 3472, 3476, 3478, 348, 3484, 3488, 3490, 3494, 3496,
+    350, 3504, 3506, 3510, 3512, 3516, 352, 3522, 3524, 3528, 3532, 3534, 3538, 354, 3544, 3546,
+    3550, 3554, 3556, 356, 3562, 3566, 3568, 3572, 3576, 3578, 358, 3584, 3588, 3590, 3594, 3596,
+    36, 3604, 3606, 3610, 3612, 3616, 362, 3622, 3624, 3628, 3632, 3634, 3638, 364, 3644, 3646,
+    3650, 3654, 3656, 366, 3662, 3666, 3668, 3672, 3676, 3678, 368, 3684, 3688, 3690, 3694, 3696,
+    370, 3704, 3706, 3710, 3712, 3716, 372, 3722, 3724, 3728, 3732, 3734, 3738, 374, 3744, 3746,
+    3750, 3754, 3756, 376, 3762, 3766, 3768, 3772, 3776, 3778, 378, 3784, 3788, 3790, 3794, 3796,
+    38, 3804, 3806, 3810, 3812, 3816, 382, 3822, 3824, 3828, 3832, 3834, 3838, 384, 3844, 3846,
+    3850, 3854, 3856, 386, 3862, 3866, 3868, 3872, 3876, 3878, 388, 3884, 3888, 3890, 3894, 3896,
+    390, 3904, 3906, 3910, 3912, 3916, 392, 3922, 3924, 3928, 3932, 3934, 3938, 394, 3944, 3946,
+    3950, 3954, 3956, 396, 3962, 3966, 3968, 3972, 3976, 3978, 398, 3984, 3988, 3990, 3994, 3996,
+    4, 4004, 4006, 4010, 4012, 4016, 402, 4022, 4024, 4028, 4032, 4034, 4038, 404, 4044, 4046,
+    4050, 4054, 4056, 406, 4062, 4066, 4068, 4072, 4076, 4078, 408, 4084, 4088, 4090, 4094, 4096,
+    410, 4104, 4106, 4110, 4112, 4116, 412, 4122, 4124, 4128, 4132, 4134, 4138, 414, 4144, 4146,
+    4150, 4154, 4156, 416, 4162, 4166, 4168, 4172, 4176, 4178, 418, 4184, 4188, 4190, 4194, 4196,
+    42, 4204, 4206, 4210, 4212, 4216, 422, 4222, 4224, 4228, 4232, 4234, 4238, 424, 4244, 4246,
+    4250, 4254, 4256, 426, 4262, 4266, 4268, 4272, 4276, 4278, 428, 4284, 4288, 4290, 4294, 4296,
+    430, 4304, 4306, 4310, 4312, 4316, 432, 4322, 4324, 4328, 4332, 4334, 4338, 434, 4344, 4346,
+    4350, 4354, 4356, 436, 4362, 4366, 4368, 4372, 4376, 4378, 438, 4384, 4388, 4390, 4394, 4396,
+    44, 4404, 4406, 4410, 4412, 4416, 442, 4422, 4424, 4428, 4432, 4434, 4438, 444, 4444, 4446,
+    4450, 4454, 4456, 446, 4462, 4466, 4468, 4472, 4476, 4478, 448, 4484, 4488, 4490, 4494, 4496,
+    450, 4504, 4506, 4510, 4512, 4516, 452, 4522, 4524, 4528, 4532, 4534, 4538, 454, 4544, 4546,
+    4550, 4554, 4556, 456, 4562, 4566, 4568, 4572, 4576, 4578, 458, 4584, 4588, 4590, 4594, 4596,
+    46, 4604, 4606, 4610, 4612, 4616, 462, 4622, 4624, 4628, 4632, 4634, 4638, 464, 4644, 4646,
+    4650, 4654, 4656, 466, 4662, 4666, 4668, 4672, 4676, 4678, 468, 4684, 4688, 4690, 4694, 4696,
+    470, 4704, 4706, 4710, 4712, 4716, 472, 4722, 4724, 4728, 4732, 4734, 4738, 474, 4744, 4746,
+    4750, 4754, 4756, 476, 4762, 4766, 4768, 4772, 4776, 4778, 478, 4784, 4788, 4790, 4794, 4796,
+    48, 4804, 4806, 4810, 4812, 4816, 482, 4822, 4824, 4828, 4832, 4834, 4838, 484, 4844, 4846,
+    4850, 4854, 4856, 486, 4862, 4866, 4868, 4872, 4876, 4878, 488, 4884, 4888, 4890, 4894, 4896,
+    490, 4904, 4906, 4910, 4912, 4916, 492, 4922, 4924, 4928, 4932, 4934, 4938, 494, 4944, 4946,
+    4950, 4954, 4956, 496, 4962, 4966, 4968, 4972, 4976, 4978, 498, 4984, 4988, 4990, 4994, 4996,
+    50, 5004, 5006, 5010, 5012, 5016, 502, 5022, 5024, 5028, 5032, 5034, 5038, 504, 5044, 5046,
+    5050, 5054, 5056, 506, 5062, 5066, 5068, 5072, 5076, 5078, 508, 5084, 5088, 5090, 5094, 5096,
+    510, 5104, 5106, 5110, 5112, 5116, 512, 5122, 5124, 5128, 5132, 5134, 5138, 514, 5144, 5146,
+    5150, 5154, 5156, 516, 5162, 5166, 5168, 5172, 5176, 5178, 518, 5184, 5188, 5190, 5194, 5196,
+    52, 5204, 5206, 5210, 5212, 5216, 522, 5222, 5224, 5228, 5232, 5234, 5238, 524, 5244, 5246,
+    5250, 5254, 5256, 526, 5262, 5266, 5268, 5272, 5276, 5278, 528, 5284, 5288, 5290, 5294, 5296,
+    530, 5304, 5306, 5310, 5312, 5316, 532, 5322, 5324, 5328, 5332, 5334, 5338, 534, 5344, 5346,
+    5350, 5354, 5356, 536, 5362, 5366, 5368, 5372, 5376, 5378, 538, 5384, 5388, 5390, 5394, 5396,
+    54, 5404, 5406, 5410, 5412, 5416, 542, 5422, 5424, 5428, 5432, 5434, 5438, 544, 5444, 5446,
+    5450, 5454, 5456, 546, 5462, 5466, 5468, 5472, 5476, 5478, 548, 5484, 5488, 5490, 5494, 5496,
+    550, 5504, 5506, 5510, 5512, 5516, 552, 5522, 5524, 5528, 5532, 5534, 5538, 554, 5544, 5546,
+    5550, 5554, 5556, 556, 5562, 5566, 5568, 5572, 5576, 5578, 558, 5584, 5588, 5590, 5594, 5596,
+    56, 5604, 5606, 5610, 5612, 5616, 562, 5622, 5624, 5628, 5632, 5634, 5638, 564, 5644, 5646,
+    5650, 5654, 5656, 566, 5662, 5666, 5668, 5672, 5676, 5678, 568, 5684, 5688, 5690, 5694, 5696,
+    570, 5704, 5706, 5710, 5712, 5716, 572, 5722, 5724, 5728, 5732, 5734, 5738, 574, 5744, 5746,
+    5750, 5754, 5756, 576, 5762, 5766, 5768, 5772, 5776, 5778, 578, 5784, 5788, 5790, 5794, 5796,
+    58, 5804, 5806, 5810, 5812, 5816, 582, 5822, 5824, 5828, 5832, 5834, 5838, 584, 5844, 5846,
+    5850, 5854, 5856, 586, 5862, 5866, 5868, 5872, 5876, 5878, 588, 5884, 5888, 5890, 5894, 5896,
+    590, 5904, 5906, 5910, 5912, 5916, 592, 5922, 5924, 5928, 5932, 5934, 5938, 594, 5944, 5946,
+    5950, 5954, 5956, 596, 5962, 5966, 5968, 5972, 5976, 5978, 598, 5984, 5988, 5990, 5994, 5996,
+    6, 6004, 6006, 6010, 6012, 6016, 602, 6022, 6024, 6028, 6032, 6034, 6038, 604, 6044, 6046,
+    6050, 6054, 6056, 606, 6062, 6066, 6068, 6072, 6076, 6078, 608, 6084, 6088, 6090, 6094, 6096,
+    610, 6104, 6106, 6110, 6112, 6116, 612, 6122, 6124, 6128, 6132, 6134, 6138, 614, 6144, 6146,
+    6150, 6154, 6156, 616, 6162, 6166, 6168, 6172, 6176, 6178, 618, 6184, 6188, 6190, 6194, 6196,
+    62, 6204, 6206, 6210, 6212, 6216, 622, 6222, 6224, 6228, 6232, 6234, 6238, 624, 6244, 6246,
+    6250, 6254, 6256, 626, 6262, 6266, 6268, 6272, 6276, 6278, 628, 6284, 6288, 6290, 6294, 6296,
+    630, 6304, 6306, 6310, 6312, 6316, 632, 6322, 6324, 6328, 6332, 6334, 6338, 634, 6344, 6346,
+    6350, 6354, 6356, 636, 6362, 6366, 6368, 6372, 6376, 6378, 638, 6384, 6388, 6390, 6394, 6396,
+    64, 6406, 6412, 642, 6424, 6432, 644, 6444, 6450, 6456, 646, 6468, 6476, 648, 6488, 6494,
+    650, 6506, 6512, 652, 6524, 6532, 654, 6544, 6550, 6556, 656, 6568, 6576, 658, 6588, 6594,
+    66, 6606, 6612, 662, 6624, 6632, 664, 6644, 6650, 6656, 666, 6668, 6676, 668, 6688, 6694,
+    670, 6706, 6712, 672, 6724, 6732, 674, 6744, 6750, 6756, 676, 6768, 6776, 678, 6788, 6794,
+    68, 6806, 6812, 682, 6824, 6832, 684, 6844, 6850, 6856, 686, 6868, 6876, 688, 6888, 6894,
+    690, 6906, 6912, 692, 6924, 6932, 694, 6944, 6950, 6956, 696, 6968, 6976, 698, 6988, 6994,
+    70, 7006, 7012, 702, 7024, 7032, 704, 7044, 7050, 7056, 706, 7068, 7076, 708, 7088, 7094,
+    710, 7106, 7112, 712, 7124, 7132, 714, 7144, 7150, 7156, 716, 7168, 7176, 718, 7188, 7194,
+    72, 7206, 7212, 722, 7224, 7232, 724, 7244, 7250, 7256, 726, 7268, 7276, 728, 7288, 7294,
+    730, 7306, 7312, 732, 7324, 7332, 734, 7344, 7350, 7356, 736, 7368, 7376, 738, 7388, 7394,
+    74, 7406, 7412, 742, 7424, 7432, 744, 7444, 7450, 7456, 746, 7468, 7476, 748, 7488, 7494,
+    750, 7506, 7512, 752, 7524, 7532, 754, 7544, 7550, 7556, 756, 7568, 7576, 758, 7588, 7594,
+    76, 7606, 7612, 762, 7624, 7632, 764, 7644, 7650, 7656, 766, 7668, 7676, 768, 7688, 7694,
+    770, 7706, 7712, 772, 7724, 7732, 774, 7744, 7750, 7756, 776, 7768, 7776, 778, 7788, 7794,
+    78, 7806, 7812, 782, 7824, 7832, 784, 7844, 7850, 7856, 786, 7868, 7876, 788, 7888, 7894,
+    790, 7906, 7912, 792, 7924, 7932, 794, 7944, 7950, 7956, 796, 7968, 7976, 798, 7988, 7994,
+    8, 8006, 8012, 802, 8024, 8032, 804, 8044, 8050, 8056, 806, 8068, 8076, 808, 8088, 8094,
+    810, 8106, 8112, 812, 8124, 8132, 814, 8144, 8150, 8156, 816, 8168, 8176, 818, 8188, 8194,
+    82, 8206, 8212, 822, 8224, 8232, 824, 8244, 8250, 8256, 826, 8268, 8276, 828, 8288, 8294,
+    830, 8306, 8312, 832, 8324, 8332, 834, 8344, 8350, 8356, 836, 8368, 8376, 838, 8388, 8394,
+    84, 8406, 8412, 842, 8424, 8432, 844, 8444, 8450, 8456, 846, 8468, 8476, 848, 8488, 8494,
+    850, 8506, 8512, 852, 8524, 8532, 854, 8544, 8550, 8556, 856, 8568, 8576, 858, 8588, 8594,
+    86, 8606, 8612, 862, 8624, 8632, 864, 8644, 8650, 8656, 866, 8668, 8676, 868, 8688, 8694,
+    870, 8706, 8712, 872, 8724, 8732, 874, 8744, 8750, 8756, 876, 8768, 8776, 878, 8788, 8794,
+    88, 8806, 8812, 882, 8824, 8832, 884, 8844, 8850, 8856, 886, 8868, 8876, 888, 8888, 8894,
+    890, 8906, 8912, 892, 8924, 8932, 894, 8944, 8950, 8956, 896, 8968, 8976, 898, 8988, 8994,
+    90, 9006, 9012, 902, 9024, 9032, 904, 9044, 9050, 9056, 906, 9068, 9076, 908, 9088, 9094,
+    910, 9106, 9112, 912, 9124, 9132, 914, 9144, 9150, 9156, 916, 9168, 9176, 918, 9188, 9194,
+    92, 9206, 9212, 922, 9224, 9232, 924, 9244, 9250, 9256, 926, 9268, 9276, 928, 9288, 9294,
+    930, 9306, 9312, 932, 9324, 9332, 934, 9344, 9350, 9356, 936, 9368, 9376, 938, 9388, 9394,
+    94, 9406, 9412, 942, 9424, 9432, 944, 9444, 9450, 9456, 946, 9468, 9476, 948, 9488, 9494,
+    950, 9506, 9512, 952, 9524, 9532, 954, 9544, 9550, 9556, 956, 9568, 9576, 958, 9588, 9594,
+    96, 9606, 9612, 962, 9624, 9632, 964, 9644, 9650, 9656, 966, 9668, 9676, 968, 9688, 9694,
+    970, 9706, 9712, 972, 9724, 9732, 974, 9744, 9750, 9756, 976, 9768, 9776, 978, 9788, 9794,
+    98, 9806, 9812, 982, 9824, 9832, 984, 9844, 9850, 9856, 986, 9868, 9876, 988, 9888, 9894,
+    990, 9906, 9912, 992, 9924, 9932, 994, 9944, 9950, 9956, 996, 9968, 9976, 998, 9988, 9994,
+    10, 10006, 10012, 1002, 10024, 10032, 1004, 10044, 10050, 10056, 1006, 10068, 10076, 1008, 10088, 10094,
+    1010, 10106, 10112, 1012, 10124, 10132, 1014, 10144, 10150, 10156, 1016, 10168, 10176, 1018, 10188, 10194,
+    102, 10206, 10212, 1022, 10224, 10232, 1024, 10244, 10250, 10256, 1026, 10268, 10276, 1028, 10288, 10294,
+    1030, 10306, 10312, 1032, 10324, 10332, 1034, 10344, 10350, 10356, 1036, 10368, 10376, 1038, 10388, 10394,
+    104, 10406, 10412, 1042, 10424, 10432, 1044, 10444, 10450, 10456, 1046, 10468, 10476, 1048, 10488, 10494,
+    1050, 10506, 10512, 1052, 10524, 10532, 1054, 10544, 10550, 10556, 1056, 10568, 10576, 1058, 10588, 10594,
+    106, 10606, 10612, 1062, 10624, 10632, 1064, 10644, 10650, 10656, 1066, 10668, 10676, 1068, 10688, 10694,
+    1070, 10706, 10712, 1072, 10724, 10732, 1074, 10744, 10750, 10756, 1076, 10768, 10776, 1078, 10788, 10794,
+    108, 10806, 10812, 1082, 10824, 10832, 1084, 10844, 10850, 10856, 1086, 10868, 10876, 1088, 10888, 10894,
+    1090, 10906, 10912, 1092, 10924, 10932, 1094, 10944, 10950, 10956, 1096, 10968, 10976, 1098, 10988, 10994,
+    110, 11006, 11012, 1102, 11024, 11032, 1104, 11044, 11050, 11056, 1106, 11068, 11076, 1108, 11088, 11094,
+    1110, 11106, 11112, 1112, 11124, 11132, 1114, 11144, 11150, 11156, 1116, 11168, 11176, 1118, 11188, 11194,
+    112, 11206, 11212, 1122, 11224, 11232, 1124, 11244, 11250, 11256, 1126, 11268, 11276, 1128, 11288, 11294,
+    1130, 11306, 11312, 1132, 11324, 11332, 1134, 11344, 11350, 11356, 1136, 11368, 11376, 1138, 11388, 11394,
+    114, 11406, 11412, 1142, 11424, 11432, 1144, 11444, 11450, 11456, 1146, 11468, 11476, 1148, 11488, 11494,
+    1150, 11506, 11512, 1152, 11524, 11532, 1154, 11544, 11550, 11556, 1156, 11568, 11576, 1158, 11588, 11594,
+    116, 11606, 11612, 1162, 11624, 11632, 1164, 11644, 11650, 11656, 1166, 11668, 11676, 1168, 11688, 11694,
+    1170, 11706, 11712, 1172, 11724, 11732, 1174, 11744, 11750, 11756, 1176, 11768, 11776, 1178, 11788, 11794,
+    118, 11806, 11812, 1182, 11824, 11832, 1184, 11844, 11850, 11856, 1186, 11868, 11876, 1188, 11888, 11894,
+    1190, 11906, 11912, 1192, 11924, 11932, 1194, 11944, 11950, 11956, 1196, 11968, 11976, 1198, 11988, 11994,
+    12, 12006, 12012, 1202, 12024, 12032, 1204, 12044, 12050, 12056, 1206, 12068, 12076, 1208, 12088, 12094,
+    1210, 12106, 12112, 1212, 12124, 12132, 1214, 12144, 12150, 12156, 1216, 12168, 12176, 1218, 12188, 12194,
+    122, 12206, 12212, 1222, 12224, 12232, 1224, 12244, 12250, 12256, 1226, 12268, 12276, 1228, 12288, 12294,
+    1230, 12306, 12312, 1232, 12324, 12332, 1234, 12344, 12350, 12356, 1236, 12368, 12376, 1238, 12388, 12394,
+    124, 12406, 12412, 1242, 12424, 12432, 1244, 12444, 12450, 12456, 1246, 12468, 12476, 1248, 12488, 12494,
+    1250, 12506, 12512, 1252, 12524, 12532, 1254, 12544, 12550, 12556, 1256, 12568, 12576, 1258, 12588, 12594,
+    126, 12606, 12612, 1262, 12624, 12632, 1264, 12644, 12650, 12656, 1266, 12668, 12676, 1268, 12688, 12694,
+    1270, 12706, 12712, 1272, 12724, 12732, 1274, 12744, 12750, 12756, 1276, 12768, 12776, 1278, 12788, 12794,
+    128, 12812, 1282, 1284, 12850, 1286, 1288, 12888, 1290, 12912, 1292, 1294, 12950, 1296, 1298, 12988,
+    130, 13012, 1302, 1304, 13050, 1306, 1308, 13088, 1310, 13112, 1312, 1314, 13150, 1316, 1318, 13188,
+    132, 13212, 1322, 1324, 13250, 1326, 1328, 13288, 1330, 13312, 1332, 1334, 13350, 1336, 1338, 13388,
+    134, 13412, 1342, 1344, 13450, 1346, 1348, 13488, 1350, 13512, 1352, 1354, 13550, 1356, 1358, 13588,
+    136, 13612, 1362, 1364, 13650, 1366, 1368, 13688, 1370, 13712, 1372, 1374, 13750, 1376, 1378, 13788,
+    138, 13812, 1382, 1384, 13850, 1386, 1388, 13888, 1390, 13912, 1392, 1394, 13950, 1396, 1398, 13988,
+    14, 14012, 1402, 1404, 14050, 1406, 1408, 14088, 1410, 14112, 1412, 1414, 14150, 1416, 1418, 14188,
+    142, 14212, 1422, 1424, 14250, 1426, 1428, 14288, 1430, 14312, 1432, 1434, 14350, 1436, 1438, 14388,
+    144, 14412, 1442, 1444, 14450, 1446, 1448, 14488, 1450, 14512, 1452, 1454, 14550, 1456, 1458, 14588,
+    146, 14612, 1462, 1464, 14650, 1466, 1468, 14688, 1470, 14712, 1472, 1474, 14750, 1476, 1478, 14788,
+    148, 14812, 1482, 1484, 14850, 1486, 1488, 14888, 1490, 14912, 1492, 1494, 14950, 1496, 1498, 14988,
+    150, 15012, 1502, 1504, 15050, 1506, 1508, 15088, 1510, 15112, 1512, 1514, 15150, 1516, 1518, 15188,
+    152, 15212, 1522, 1524, 15250, 1526, 1528, 15288, 1530, 15312, 1532, 1534, 15350, 1536, 1538, 15388,
+    154, 15412, 1542, 1544, 15450, 1546, 1548, 15488, 1550, 15512, 1552, 1554, 15550, 1556, 1558, 15588,
+    156, 15612, 1562, 1564, 15650, 1566, 1568, 15688, 1570, 15712, 1572, 1574, 15750, 1576, 1578, 15788,
+    158, 15812, 1582, 1584, 15850, 1586, 1588, 15888, 1590, 15912, 1592, 1594, 15950, 1596, 1598, 15988,
+    16, 16012, 1602, 1604, 16050, 1606, 1608, 16088, 1610, 16112, 1612, 1614, 16150, 1616, 1618, 16188,
+    162, 16212, 1622, 1624, 16250, 1626, 1628, 16288, 1630, 16312, 1632, 1634, 16350, 1636, 1638, 16388,
+    164, 16412, 1642, 1644, 16450, 1646, 1648, 16488, 1650, 16512, 1652, 1654, 16550, 1656, 1658, 16588,
+    166, 16612, 1662, 1664, 16650, 1666, 1668, 16688, 1670, 16712, 1672, 1674, 16750, 1676, 1678, 16788,
+    168, 16812, 1682, 1684, 16850, 1686, 1688, 16888, 1690, 16912, 1692, 1694, 16950, 1696, 1698, 16988,
+    170, 17012, 1702, 1704, 17050, 1706, 1708, 17088, 1710, 17112, 1712, 1714, 17150, 1716, 1718, 17188,
+    172, 17212, 1722, 1724, 17250, 1726, 1728, 17288, 1730, 17312, 1732, 1734, 17350, 1736, 1738, 17388,
+    174, 17412, 1742, 1744, 17450, 1746, 1748, 17488, 1750, 17512, 1752, 1754, 17550, 1756, 1758, 17588,
+    176, 17612, 1762, 1764, 17650, 1766, 1768, 17688, 1770, 17712, 1772, 1774, 17750, 1776, 1778, 17788,
+    178, 17812, 1782, 1784, 17850, 1786, 1788, 17888, 1790, 17912, 1792, 1794, 17950, 1796, 1798, 17988,
+    18, 18012, 1802, 1804, 18050, 1806, 1808, 18088, 1810, 18112, 1812, 1814, 18150, 1816, 1818, 18188,
+    182, 18212, 1822, 1824, 18250, 1826, 1828, 18288, 1830, 18312, 1832, 1834, 18350, 1836, 1838, 18388,
+    184, 18412, 1842, 1844, 18450, 1846, 1848, 18488, 1850, 18512, 1852, 1854, 18550, 1856, 1858, 18588,
+    186, 18612, 1862, 1864, 18650, 1866, 1868, 18688, 1870, 18712, 1872, 1874, 18750, 1876, 1878, 18788,
+    188, 18812, 1882, 1884, 18850, 1886, 1888, 18888, 1890, 18912, 1892, 1894, 18950, 1896, 1898, 18988,
+    190, 19012, 1902, 1904, 19050, 1906, 1908, 19088, 1910, 19112, 1912, 1914, 19150, 1916, 1918, 19188,
+    192, 19212, 1922, 1924, 19250, 1926, 1928, 19288, 1930, 19312, 1932, 1934, 19350, 1936, 1938, 19388,
+    194, 19412, 1942, 1944, 19450, 1946, 1948, 19488, 1950, 19512, 1952, 1954, 19550, 1956, 1958, 19588,
+    196, 19612, 1962, 1964, 19650, 1966, 1968, 19688, 1970, 19712, 1972, 1974, 19750, 1976, 1978, 19788,
+    198, 19812, 1982, 1984, 19850, 1986, 1988, 19888, 1990, 19912, 1992, 1994, 19950, 1996, 1998, 19988,
+    3, 20013, 2003, 2005, 20051, 2007, 2009, 20089, 2011, 20113, 2013, 2015, 20151, 2017, 2019, 20189,
+    203, 20213, 2023, 2025, 20251, 2027, 2029, 20289, 2031, 20313, 2033, 2035, 20351, 2037, 2039, 20389,
+    205, 20413, 2043, 2045, 20451, 2047, 2049, 20489, 2051, 20513, 2053, 2055, 20551, 2057, 2059, 20589,
+    207, 20613, 2063, 2065, 20651, 2067, 2069, 20689, 2071, 20713, 2073, 2075, 20751, 2077, 2079, 20789,
+    209, 20813, 2083, 2085, 20851, 2087, 2089, 20889, 2091, 20913, 2093, 2095, 20951, 2097, 2099, 20989,
+    211, 21013, 2103, 2105, 21051, 2107, 2109, 21089, 2111, 21113, 2113, 2115, 21151, 2117, 2119, 21189,
+    213, 21213, 2123, 2125, 21251, 2127, 2129, 21289, 2131, 21313, 2133, 2135, 21351, 2137, 2139, 21389,
+    215, 21413, 2143, 2145, 21451, 2147, 2149, 21489, 2151, 21513, 2153, 2155, 21551, 2157, 2159, 21589,
+    217, 21613, 2163, 2165, 21651, 2167, 2169, 21689, 2171, 21713, 2173, 2175, 21751, 2177, 2179, 21789,
+    219, 21813, 2183, 2185, 21851, 2187, 2189, 21889, 2191, 21913, 2193, 2195, 21951, 2197, 2199, 21989,
+    23, 22013, 2203, 2205, 22051, 2207, 2209, 22089, 2211, 22113, 2213, 2215, 22151, 2217, 2219, 22189,
+    223, 22213, 2223, 2225, 22251, 2227, 2229, 22289, 2231, 22313, 2233, 2235, 22351, 2237, 2239, 22389,
+    225, 22413, 2243, 2245, 22451, 2247, 2249, 22489, 2251, 22513, 2253, 2255, 22551, 2257, 2259, 22589,
+    227, 22613, 2263, 2265, 22651, 2267, 2269, 22689, 2271, 22713, 2273, 2275, 22751, 2277, 2279, 22789,
+    229, 22813, 2283, 2285, 22851, 2287, 2289, 22889, 2291, 22913, 2293, 2295, 22951, 2297, 2299, 22989,
+    231, 23013, 2303, 2305, 23051, 2307, 2309, 23089, 2311, 23113, 2313, 2315, 23151, 2317, 2319, 23189,
+    233, 23213, 2323, 2325, 23251, 2327, 2329, 23289, 2331, 23313, 2333, 2335, 23351, 2337, 2339, 23389,
+    235, 23413, 2343, 2345, 23451, 2347, 2349, 23489, 2351, 23513, 2353, 2355, 23551, 2357, 2359, 23589,
+    237, 23613, 2363, 2365, 23651, 2367, 2369, 23689, 2371, 23713, 2373, 2375, 23751, 2377, 2379, 23789,
+    239, 23813, 2383, 2385, 23851, 2387, 2389, 23889, 2391, 23913, 2393, 2395, 23951, 2397, 2399, 23989,
+    25, 24013, 2403, 2405, 24051, 2407, 2409, 24089, 2411, 24113, 2413, 2415, 24151, 2417, 2419, 24189,
+    243, 24213, 2423, 2425, 24251, 2427, 2429, 24289, 2431, 24313, 2433, 2435, 24351, 2437, 2439, 24389,
+    245, 24413, 2443, 2445, 24451, 2447, 2449, 24489, 2451, 24513, 2453, 2455, 24551, 2457, 2459, 24589,
+    247, 24613, 2463, 2465, 24651, 2467, 2469, 24689, 2471, 24713, 2473, 2475, 24751, 2477, 2479, 24789,
+    249, 24813, 2483, 2485, 24851, 2487, 2489, 24889, 2491, 24913, 2493, 2495, 24951, 2497, 2499, 24989,
+    251, 25013, 2503, 2505, 25051, 2507, 2509, 25089, 2511, 25113, 2513, 2515, 25151, 2517, 2519, 25189,
+    253, 25213, 2523, 2525, 25251, 2527, 2529, 25289, 2531, 25313, 2533, 2535, 25351, 2537, 2539, 25389,
+    255, 25413, 2543, 2545, 25451, 2547, 2549, 25489, 2551, 25513, 2553, 2555, 25551, 2557, 2559, 25589,
+    256, 2562, 2564, 2568, 2570, 2572, 2576, 2578, 258, 2582, 2584, 2588, 2590, 2592, 2596, 2598,
+    26, 2602, 2604, 2608, 2610, 2612, 2616, 2618, 262, 2622, 2624, 2628, 2630, 2632, 2636, 2638,
+    264, 2642, 2644, 2648, 2650, 2652, 2656, 2658, 266, 2662, 2664, 2668, 2670, 2672, 2676, 2678,
+    268, 2682, 2684, 2688, 2690, 2692, 2696, 2698, 270, 2702, 2704, 2708, 2710, 2712, 2716, 2718,
+    272, 2722, 2724, 2728, 2730, 2732, 2736, 2738, 274, 2742, 2744, 2748, 2750, 2752, 2756, 2758,
+    276, 2762, 2764, 2768, 2770, 2772, 2776, 2778, 278, 2782, 2784, 2788, 2790, 2792, 2796, 2798,
+    28, 2802, 2804, 2808, 2810, 2812, 2816, 2818, 282, 2822, 2824, 2828, 2830, 2832, 2836, 2838,
+    284, 2842, 2844, 2848, 2850, 2852, 2856, 2858, 286, 2862, 2864, 2868, 2870, 2872, 2876, 2878,
+    288, 2882, 2884, 2888, 2890, 2892, 2896, 2898, 290, 2902, 2904, 2908, 2910, 2912, 2916, 2918,
+    292, 2922, 2924, 2928, 2930, 2932, 2936, 2938, 294, 2942, 2944, 2948, 2950, 2952, 2956, 2958,
+    296, 2962, 2964, 2968, 2970, 2972, 2976, 2978, 298, 2982, 2984, 2988, 2990, 2992, 2996, 2998,
+    30, 3002, 3004, 3008, 3010, 3012, 3016, 3018, 302, 3022, 3024, 3028, 3030, 3032, 3036, 3038,
+    304, 3042, 3044, 3048, 3050, 3052, 3056, 3058, 306, 3062, 3064, 3068, 3070, 3072, 3076, 3078,
+    308, 3082, 3084, 3088, 3090, 3092, 3096, 3098, 310, 3102, 3104, 3108, 3110, 3112, 3116, 3118,
+    312, 3122, 3124, 3128, 3130, 3132, 3136, 3138, 314, 3142, 3144, 3148, 3150, 3152, 3156, 3158,
+    316, 3162, 3164, 3168, 3170, 3172, 3176, 3178, 318, 3182, 3184, 3188, 3190, 3192, 3196, 3198,
+    32, 3202, 3204, 3208, 3210, 3212, 3216, 3218, 322, 3222, 3224, 3228, 3230, 3232, 3236, 3238,
+    324, 3242, 3244, 3248, 3250, 3252, 3256, 3258, 326, 3262, 3264, 3268, 3270, 3272, 3276, 3278,
+    328, 3282, 3284, 3288, 3290, 3292, 3296, 3298, 330, 3302, 3304, 3308, 3310, 3312, 3316, 3318,
+    332, 3322, 3324, 3328, 3330, 3332, 3336, 3338, 334, 3342, 3344, 3348, 3350, 3352, 3356, 3358,
+    336, 3362, 3364, 3368, 3370, 3372, 3376, 3378, 338, 3382, 3384, 3388, 3390, 3392, 3396, 3398,
+    34, 3402, 3404, 3408, 3410, 3412, 3416, 3418, 342, 3422, 3424, 3428, 3430, 3432, 3436, 3438,
+    344, 3442, 3444, 3448, 3450, 3452, 3456, 3458, 346, 3462, 3464, 3468, 3470, 3472, 3476, 3478,
+    348, 3482, 3484, 3488, 3490, 3492, 3496, 3498, 350, 3502, 3504, 3508, 3510, 3512, 3516, 3518,
+    352, 3522, 3524, 3528, 3530, 3532, 3536, 3538, 354, 3542, 3544, 3548, 3550, 3552, 3556, 3558,
+    356, 3562, 3564, 3568, 3570, 3572, 3576, 3578, 358, 3582, 3584, 3588, 3590, 3592, 3596, 3598,
+    36, 3602, 3604, 3608, 3610, 3612, 3616, 3618, 362, 3622, 3624, 3628, 3630, 3632, 3636, 3638,
+    364, 3642, 3644, 3648, 3650, 3652, 3656, 3658, 366, 3662, 3664, 3668, 3670, 3672, 3676, 3678,
+    368, 3682, 3684, 3688, 3690, 3692, 3696, 3698, 370, 3702, 3704, 3708, 3710, 3712, 3716, 3718,
+    372, 3722, 3724, 3728, 3730, 3732, 3736, 3738, 374, 3742, 3744, 3748, 3750, 3752, 3756, 3758,
+    376, 3762, 3764, 3768, 3770, 3772, 3776, 3778, 378, 3782, 3784, 3788, 3790, 3792, 3796, 3798,
+    38, 3802, 3804, 3808, 3810, 3812, 3816, 3818, 382, 3822, 3824, 3828, 3830, 3832, 3836, 3838,
+    384, 3842, 3844, 3848, 3850, 3852, 3856, 3858, 386, 3862, 3864, 3868, 3870, 3872, 3876, 3878,
+    388, 3882, 3884, 3888, 3890, 3892, 3896, 3898, 390, 3902, 3904, 3908, 3910, 3912, 3916, 3918,
+    392, 3922, 3924, 3928, 3930, 3932, 3936, 3938, 394, 3942, 3944, 3948, 3950, 3952, 3956, 3958,
+    396, 3962, 3964, 3968, 3970, 3972, 3976, 3978, 398, 3982, 3984, 3988, 3990, 3992, 3996, 3998,
+    4, 4002, 4004, 4008, 4010, 4012, 4016, 4018, 402, 4022, 4024, 4028, 4030, 4032, 4036, 4038,
+    404, 4042, 4044, 4048, 4050, 4052, 4056, 4058, 406, 4062, 4064, 4068, 4070, 4072, 4076, 4078,
+    408, 4082, 4084, 4088, 4090, 4092, 4096, 4098, 410, 4102, 4104, 4108, 4110, 4112, 4116, 4118,
+    412, 4122, 4124, 4128, 4130, 4132, 4136, 4138, 414, 4142, 4144, 4148, 4150, 4152, 4156, 4158,
+    416, 4162, 4164, 4168, 4170, 4172, 4176, 4178, 418, 4182, 4184, 4188, 4190, 4192, 4196, 4198,
+    42, 4202, 4204, 4208, 4210, 4212, 4216, 4218, 422, 4222, 4224, 4228, 4230, 4232, 4236, 4238,
+    424, 4242, 4244, 4248, 4250, 4252, 4256, 4258, 426, 4262, 4264, 4268, 4270, 4272, 4276, 4278,
+    428, 4282, 4284, 4288, 4290, 4292, 4296, 4298, 430, 4302, 4304, 4308, 4310, 4312, 4316, 4318,
+    432, 4322, 4324, 4328, 4330, 4332, 4336, 4338, 434, 4342, 4344, 4348, 4350, 4352, 4356, 4358,
+    436, 4362, 4364, 4368, 4370, 4372, 4376, 4378, 438, 4382, 4384, 4388, 4390, 4392, 4396, 4398,
+    44, 4402, 4404, 4408, 4410, 4412, 4416, 4418, 442, 4422, 4424, 4428, 4430, 4432, 4436, 4438,
+    444, 4442, 4444, 4448, 4450, 4452, 4456, 4458, 446, 4462, 4464, 4468, 4470, 4472, 4476, 4478,
+    448, 4482, 4484, 4488, 4490, 4492, 4496, 4498, 450, 4502, 4504, 4508, 4510, 4512, 4516, 4518,
+    452, 4522, 4524, 4528, 4530, 4532, 4536, 4538, 454, 4542, 4544, 4548, 4550, 4552, 4556, 4558,
+    456, 4562, 4564, 4568, 4570, 4572, 4576, 4578, 458, 4582, 4584, 4588, 4590, 4592, 4596, 4598,
+    46, 4602, 4604, 4608, 4610, 4612, 4616, 4618, 462, 4622, 4624, 4628, 4630, 4632, 4636, 4638,
+    464, 4642, 4644, 4648, 4650, 4652, 4656, 4658, 466, 4662, 4664, 4668, 4670, 4672, 4676, 4678,
+    468, 4682, 4684, 4688, 4690, 4692, 4696, 4698, 470, 4702, 4704, 4708, 4710, 4712, 4716, 4718,
+    472, 4722, 4724, 4728, 4730, 4732, 4736, 4738, 474, 4742, 4744, 4748, 4750, 4752, 4756, 4758,
+    476, 4762, 4764, 4768, 4770, 4772, 4776, 4778, 478, 4782, 4784, 4788, 4790, 4792, 4796, 4798,
+    48, 4802, 4804, 4808, 4810, 4812, 4816, 4818, 482, 4822, 4824, 4828, 4830, 4832, 4836, 4838,
+    484, 4842, 4844, 4848, 4850, 4852, 4856, 4858, 486, 4862, 4864, 4868, 4870, 4872, 4876, 4878,
+    488, 4882, 4884, 4888, 4890, 4892, 4896, 4898, 490, 4902, 4904, 4908, 4910, 4912, 4916, 4918,
+    492, 4922, 4924, 4928, 4930, 4932, 4936, 4938, 494, 4942, 4944, 4948, 4950, 4952, 4956, 4958,
+    496, 4962, 4964, 4968, 4970, 4972, 4976, 4978, 498, 4982, 4984, 4988, 4990, 4992, 4996, 4998,
+    50, 5002, 5004, 5008, 5010, 5012, 5016, 5018, 502, 5022, 5024, 5028, 5030, 5032, 5036, 5038,
+    504, 5042, 5044, 5048, 5050, 5052, 5056, 5058, 506, 5062, 5064, 5068, 5070, 5072, 5076, 5078,
+    508, 5082, 5084, 5088, 5090, 5092, 5096, 5098, 510, 5102, 5104, 5108, 5110, 5112, 5116, 5118,
+    512, 5124, 5130, 5136, 514, 5144, 5150, 5156, 516, 5164, 5170, 5176, 518, 5184, 5190, 5196,
+    52, 5204, 5210, 5216, 522, 5224, 5230, 5236, 524, 5244, 5250, 5256, 526, 5264, 5270, 5276,
+    528, 5284, 5290, 5296, 530, 5304, 5310, 5316, 532, 5324, 5330, 5336, 534, 5344, 5350, 5356,
+    536, 5364, 5370, 5376, 538, 5384, 5390, 5396, 54, 5404, 5410, 5416, 542, 5424, 5430, 5436,
+    544, 5444, 5450, 5456, 546, 5464, 5470, 5476, 548, 5484, 5490, 5496, 550, 5504, 5510, 5516,
+    552, 5524, 5530, 5536, 554, 5544, 5550, 5556, 556, 5564, 5570, 5576, 558, 5584, 5590, 5596,
+    56, 5604, 5610, 5616, 562, 5624, 5630, 5636, 564, 5644, 5650, 5656, 566, 5664, 5670, 5676,
+    568, 5684, 5690, 5696, 570, 5704, 5710, 5716, 572, 5724, 5730, 5736, 574, 5744, 5750, 5756,
+    576, 5764, 5770, 5776, 578, 5784, 5790, 5796, 58, 5804, 5810, 5816, 582, 5824, 5830, 5836,
+    584, 5844, 5850, 5856, 586, 5864, 5870, 5876, 588, 5884, 5890, 5896, 590, 5904, 5910, 5916,
+    592, 5924, 5930, 5936, 594, 5944, 5950, 5956, 596, 5964, 5970, 5976, 598, 5984, 5990, 5996,
+    6, 6004, 6010, 6016, 602, 6024, 6030, 6036, 604, 6044, 6050, 6056, 606, 6064, 6070, 6076,
+    608, 6084, 6090, 6096, 610, 6104, 6110, 6116, 612, 6124, 6130, 6136, 614, 6144, 6150, 6156,
+    616, 6164, 6170, 6176, 618, 6184, 6190, 6196, 62, 6204, 6210, 6216, 622, 6224, 6230, 6236,
+    624, 6244, 6250, 6256, 626, 6264, 6270, 6276, 628, 6284, 6290, 6296, 630, 6304, 6310, 6316,
+    632, 6324, 6330, 6336, 634, 6344, 6350, 6356, 636, 6364, 6370, 6376, 638, 6384, 6390, 6396,
+    64, 6404, 6410, 6416, 642, 6424, 6430, 6436, 644, 6444, 6450, 6456, 646, 6464, 6470, 6476,
+    648, 6484, 6490, 6496, 650, 6504, 6510, 6516, 652, 6524, 6530, 6536, 654, 6544, 6550, 6556,
+    656, 6564, 6570, 6576, 658, 6584, 6590, 6596, 66, 6604, 6610, 6616, 662, 6624, 6630, 6636,
+    664, 6644, 6650, 6656, 666, 6664, 6670, 6676, 668, 6684, 6690, 6696, 670, 6704, 6710, 6716,
+    672, 6724, 6730, 6736, 674, 6744, 6750, 6756, 676, 6764, 6770, 6776, 678, 6784, 6790, 6796,
+    68, 6804, 6810, 6816, 682, 6824, 6830, 6836, 684, 6844, 6850, 6856, 686, 6864, 6870, 6876,
+    688, 6884, 6890, 6896, 690, 6904, 6910, 6916, 692, 6924, 6930, 6936, 694, 6944, 6950, 6956,
+    696, 6964, 6970, 6976, 698, 6984, 6990, 6996, 70, 7004, 7010, 7016, 702, 7024, 7030, 7036,
+    704, 7044, 7050, 7056, 706, 7064, 7070, 7076, 708, 7084, 7090, 7096, 710, 7104, 7110, 7116,
+    712, 7124, 7130, 7136, 714, 7144, 7150, 7156, 716, 7164, 7170, 7176, 718, 7184, 7190, 7196,
+    72, 7204, 7210, 7216, 722, 7224, 7230, 7236, 724, 7244, 7250, 7256, 726, 7264, 7270, 7276,
+    728, 7284, 7290, 7296, 730, 7304, 7310, 7316, 732, 7324, 7330, 7336, 734, 7344, 7350, 7356,
+    736, 7364, 7370, 7376, 738, 7384, 7390, 7396, 74, 7404, 7410, 7416, 742, 7424, 7430, 7436,
+    744, 7444, 7450, 7456, 746, 7464, 7470, 7476, 748, 7484, 7490, 7496, 750, 7504, 7510, 7516,
+    752, 7524, 7530, 7536, 754, 7544, 7550, 7556, 756, 7564, 7570, 7576, 758, 7584, 7590, 7596,
+    76, 7604, 7610, 7616, 762, 7624, 7630, 7636, 764, 7644, 7650, 7656, 766, 7664, 7670, 7676,
+    768, 7684, 7690, 7696, 770, 7704, 7710, 7716, 772, 7724, 7730, 7736, 774, 7744, 7750, 7756,
+    776, 7764, 7770, 7776, 778, 7784, 7790, 7796, 78, 7804, 7810, 7816, 782, 7824, 7830, 7836,
+    784, 7844, 7850, 7856, 786, 7864, 7870, 7876, 788, 7884, 7890, 7896, 790, 7904, 7910, 7916,
+    792, 7924, 7930, 7936, 794, 7944, 7950, 7956, 796, 7964, 7970, 7976, 798, 7984, 7990, 7996,
+    8, 8004, 8010, 8016, 802, 8024, 8030, 8036, 804, 8044, 8050, 8056, 806, 8064, 8070, 8076,
+    808, 8084, 8090, 8096, 810, 8104, 8110, 8116, 812, 8124, 8130, 8136, 814, 8144, 8150, 8156,
+    816, 8164, 8170, 8176, 818, 8184, 8190, 8196, 82, 8204, 8210, 8216, 822, 8224, 8230, 8236,
+    824, 8244, 8250, 8256, 826, 8264, 8270, 8276, 828, 8284, 8290, 8296, 830, 8304, 8310, 8316,
+    832, 8324, 8330, 8336, 834, 8344, 8350, 8356, 836, 8364, 8370, 8376, 838, 8384, 8390, 8396,
+    84, 8404, 8410, 8416, 842, 8424, 8430, 8436, 844, 8444, 8450, 8456, 846, 8464, 8470, 8476,
+    848, 8484, 8490, 8496, 850, 8504, 8510, 8516, 852, 8524, 8530, 8536, 854, 8544, 8550, 8556,
+    856, 8564, 8570, 8576, 858, 8584, 8590, 8596, 86, 8604, 8610, 8616, 862, 8624, 8630, 8636,
+    864, 8644, 8650, 8656, 866, 8664, 8670, 8676, 868, 8684, 8690, 8696, 870, 8704, 8710, 8716,
+    872, 8724, 8730, 8736, 874, 8744, 8750, 8756, 876, 8764, 8770, 8776, 878, 8784, 8790, 8796,
+    88, 8804, 8810, 8816, 882, 8824, 8830, 8836, 884, 8844, 8850, 8856, 886, 8864, 8870, 8876,
+    888, 8884, 8890, 8896, 890, 8904, 8910, 8916, 892, 8924, 8930, 8936, 894, 8944, 8950, 8956,
+    896, 8964, 8970, 8976, 898, 8984, 8990, 8996, 90, 9004, 9010, 9016, 902, 9024, 9030, 9036,
+    904, 9044, 9050, 9056, 906, 9064, 9070, 9076, 908, 9084, 9090, 9096, 910, 9104, 9110, 9116,
+    912, 9124, 9130, 9136, 914, 9144, 9150, 9156, 916, 9164, 9170, 9176, 918, 9184, 9190, 9196,
+    92, 9204, 9210, 9216, 922, 9224, 9230, 9236, 924, 9244, 9250, 9256, 926, 9264, 9270, 9276,
+    928, 9284, 9290, 9296, 930, 9304, 9310, 9316, 932, 9324, 9330, 9336, 934, 9344, 9350, 9356,
+    936, 9364, 9370, 9376, 938, 9384, 9390, 9396, 94, 9404, 9410, 9416, 942, 9424, 9430, 9436,
+    944, 9444, 9450, 9456, 946, 9464, 9470, 9476, 948, 9484, 9490, 9496, 950, 9504, 9510, 9516,
+    952, 9524, 9530, 9536, 954, 9544, 9550, 9556, 956, 9564, 9570, 9576, 958, 9584, 9590, 9596,
+    96, 9604, 9610, 9616, 962, 9624, 9630, 9636, 964, 9644, 9650, 9656, 966, 9664, 9670, 9676,
+    968, 9684, 9690, 9696, 970, 9704, 9710, 9716, 972, 9724, 9730, 9736, 974, 9744, 9750, 9756,
+    976, 9764, 9770, 9776, 978, 9784, 9790, 9796, 98, 9804, 9810, 9816, 982, 9824, 9830, 9836,
+    984, 9844, 9850, 9856, 986, 9864, 9870, 9876, 988, 9884, 9890, 9896, 990, 9904, 9910, 9916,
+    992, 9924, 9930, 9936, 994, 9944, 9950, 9956, 996, 9964, 9970, 9976, 998, 9984, 9990, 9996,
+    10, 10004, 10010, 10016, 1002, 10024, 10030, 10036, 1004, 10044, 10050, 10056, 1006, 10064, 10070, 10076,
+    1008, 10084, 10090, 10096, 1010, 10104, 10110, 10116, 1012, 10124, 10130, 10136, 1014, 10144, 10150, 10156,
+    1016, 10164, 10170, 10176, 1018, 10184, 10190, 10196, 102, 10204, 10210, 10216, 1022, 10224, 10230, 10236,
+    1024, 10250, 1026, 10270, 1028, 10290, 1030, 10310, 1032, 10330, 1034, 10350, 1036, 10370, 1038, 10390,
+    104, 10410, 1042, 10430, 1044, 10450, 1046, 10470, 1048, 10490, 1050, 10510, 1052, 10530, 1054, 10550,
+    1056, 10570, 1058, 10590, 106, 10610, 1062, 10630, 1064, 10650, 1066, 10670, 1068, 10690, 1070, 10710,
+    1072, 10730, 1074, 10750, 1076, 10770, 1078, 10790, 108, 10810, 1082, 10830, 1084, 10850, 1086, 10870,
+    1088, 10890, 1090, 10910, 1092, 10930, 1094, 10950, 1096, 10970, 1098, 10990, 110, 11010, 1102, 11030,
+    1104, 11050, 1106, 11070, 1108, 11090, 1110, 11110, 1112, 11130, 1114, 11150, 1116, 11170, 1118, 11190,
+    112, 11210, 1122, 11230, 1124, 11250, 1126, 11270, 1128, 11290, 1130, 11310, 1132, 11330, 1134, 11350,
+    1136, 11370, 1138, 11390, 114, 11410, 1142, 11430, 1144, 11450, 1146, 11470, 1148, 11490, 1150, 11510,
+    1152, 11530, 1154, 11550, 1156, 11570, 1158, 11590, 116, 11610, 1162, 11630, 1164, 11650, 1166, 11670,
+    1168, 11690, 1170, 11710, 1172, 11730, 1174, 11750, 1176, 11770, 1178, 11790, 118, 11810, 1182, 11830,
+    1184, 11850, 1186, 11870, 1188, 11890, 1190, 11910, 1192, 11930, 1194, 11950, 1196, 11970, 1198, 11990,
+    12, 12010, 1202, 12030, 1204, 12050, 1206, 12070, 1208, 12090, 1210, 12110, 1212, 12130, 1214, 12150,
+    1216, 12170, 1218, 12190, 122, 12210, 1222, 12230, 1224, 12250, 1226, 12270, 1228, 12290, 1230, 12310,
+    1232, 12330, 1234, 12350, 1236, 12370, 1238, 12390, 124, 12410, 1242, 12430, 1244, 12450, 1246, 12470,
+    1248, 12490, 1250, 12510, 1252, 12530, 1254, 12550, 1256, 12570, 1258, 12590, 126, 12610, 1262, 12630,
+    1264, 12650, 1266, 12670, 1268, 12690, 1270, 12710, 1272, 12730, 1274, 12750, 1276, 12770, 1278, 12790,
+    128, 12810, 1282, 12830, 1284, 12850, 1286, 12870, 1288, 12890, 1290, 12910, 1292, 12930, 1294, 12950,
+    1296, 12970, 1298, 12990, 130, 13010, 1302, 13030, 1304, 13050, 1306, 13070, 1308, 13090, 1310, 13110,
+    1312, 13130, 1314, 13150, 1316, 13170, 1318, 13190, 132, 13210, 1322, 13230, 1324, 13250, 1326, 13270,
+    1328, 13290, 1330, 13310, 1332, 13330, 1334, 13350, 1336, 13370, 1338, 13390, 134, 13410, 1342, 13430,
+    1344, 13450, 1346, 13470, 1348, 13490, 1350, 13510, 1352, 13530, 1354, 13550, 1356, 13570, 1358, 13590,
+    136, 13610, 1362, 13630, 1364, 13650, 1366, 13670, 1368, 13690, 1370, 13710, 1372, 13730, 1374, 13750,
+    1376, 13770, 1378, 13790, 138, 13810, 1382, 13830, 1384, 13850, 1386, 13870, 1388, 13890, 1390, 13910,
+    1392, 13930, 1394, 13950, 1396, 13970, 1398, 13990, 14, 14010, 1402, 14030, 1404, 14050, 1406, 14070,
+    1408, 14090, 1410, 14110, 1412, 14130, 1414, 14150, 1416, 14170, 1418, 14190, 142, 14210, 1422, 14230,
+    1424, 14250, 1426, 14270, 1428, 14290, 1430, 14310, 1432, 14330, 1434, 14350, 1436, 14370, 1438, 14390,
+    144, 14410, 1442, 14430, 1444, 14450, 1446, 14470, 1448, 14490, 1450, 14510, 1452, 14530, 1454, 14550,
+    1456, 14570, 1458, 14590, 146, 14610, 1462, 14630, 1464, 14650, 1466, 14670, 1468, 14690, 1470, 14710,
+    1472, 14730, 1474, 14750, 1476, 14770, 1478, 14790, 148, 14810, 1482, 14830, 1484, 14850, 1486, 14870,
+    1488, 14890, 1490, 14910, 1492, 14930, 1494, 14950, 1496, 14970, 1498, 14990, 150, 15010, 1502, 15030,
+    1504, 15050, 1506, 15070, 1508, 15090, 1510, 15110, 1512, 15130, 1514, 15150, 1516, 15170, 1518, 15190,
+    152, 15210, 1522, 15230, 1524, 15250, 1526, 15270, 1528, 15290, 1530, 15310, 1532, 15330, 1534, 15350,
+    1536, 15370, 1538, 15390, 154, 15410, 1542, 15430, 1544, 15450, 1546, 15470, 1548, 15490, 1550, 15510,
+    1552, 15530, 1554, 15550, 1556, 15570, 1558, 15590, 156, 15610, 1562, 15630, 1564, 15650, 1566, 15670,
+    1568, 15690, 1570, 15710, 1572, 15730, 1574, 15750, 1576, 15770, 1578, 15790, 158, 15810, 1582, 15830,
+    1584, 15850, 1586, 15870, 1588, 15890, 1590, 15910, 1592, 15930, 1594, 15950, 1596, 15970, 1598, 15990,
+    16, 16010, 1602, 16030, 1604, 16050, 1606, 16070, 1608, 16090, 1610, 16110, 1612, 16130, 1614, 16150,
+    1616, 16170, 1618, 16190, 162, 16210, 1622, 16230, 1624, 16250, 1626, 16270, 1628, 16290, 1630, 16310,
+    1632, 16330, 1634, 16350, 1636, 16370, 1638, 16390, 164, 16410, 1642, 16430, 1644, 16450, 1646, 16470,
+    1648, 16490, 1650, 16510, 1652, 16530, 1654, 16550, 1656, 16570, 1658, 16590, 166, 16610, 1662, 16630,
+    1664, 16650, 1666, 16670, 1668, 16690, 1670, 16710, 1672, 16730, 1674, 16750, 1676, 16770, 1678, 16790,
+    168, 16810, 1682, 16830, 1684, 16850, 1686, 16870, 1688, 16890, 1690, 16910, 1692, 16930, 1694, 16950,
+    1696, 16970, 1698, 16990, 170, 17010, 1702, 17030, 1704, 17050, 1706, 17070, 1708, 17090, 1710, 17110,
+    1712, 17130, 1714, 17150, 1716, 17170, 1718, 17190, 172, 17210, 1722, 17230, 1724, 17250, 1726, 17270,
+    1728, 17290, 1730, 17310, 1732, 17330, 1734, 17350, 1736, 17370, 1738, 17390, 174, 17410, 1742, 17430,
+    1744, 17450, 1746, 17470, 1748, 17490, 1750, 17510, 1752, 17530, 1754, 17550, 1756, 17570, 1758, 17590,
+    176, 17610, 1762, 17630, 1764, 17650, 1766, 17670, 1768, 17690, 1770, 17710, 1772, 17730, 1774, 17750,
+    1776, 17770, 1778, 17790, 178, 17810, 1782, 17830, 1784, 17850, 1786, 17870, 1788, 17890, 1790, 17910,
+    1792, 17930, 1794, 17950, 1796, 17970, 1798, 17990, 18, 18010, 1802, 18030, 1804, 18050, 1806, 18070,
+    1808, 18090, 1810, 18110, 1812, 18130, 1814, 18150, 1816, 18170, 1818, 18190, 182, 18210, 1822, 18230,
+    1824, 18250, 1826, 18270, 1828, 18290, 1830, 18310, 1832, 18330, 1834, 18350, 1836, 18370, 1838, 18390,
+    184, 18410, 1842, 18430, 1844, 18450, 1846, 18470, 1848, 18490, 1850, 18510, 1852, 18530, 1854, 18550,
+    1856, 18570, 1858, 18590, 186, 18610, 1862, 18630, 1864, 18650, 1866, 18670, 1868, 18690, 1870, 18710,
+    1872, 18730, 1874, 18750, 1876, 18770, 1878, 18790, 188, 18810, 1882, 18830, 1884, 18850, 1886, 18870,
+    1888, 18890, 1890, 18910, 1892, 18930, 1894, 18950, 1896, 18970, 1898, 18990, 190, 19010, 1902, 19030,
+    1904, 19050, 1906, 19070, 1908, 19090, 1910, 19110, 1912, 19130, 1914, 19150, 1916, 19170, 1918, 19190,
+    192, 19210, 1922, 19230, 1924, 19250, 1926, 19270, 1928, 19290, 1930, 19310, 1932, 19330, 1934, 19350,
+    1936, 19370, 1938, 19390, 194, 19410, 1942, 19430, 1944, 19450, 1946, 19470, 1948, 19490, 1950, 19510,
+    1952, 19530, 1954, 19550, 1956, 19570, 1958, 19590, 196, 19610, 1962, 19630, 1964, 19650, 1966, 19670,
+    1968, 19690, 1970, 19710, 1972, 19730, 1974, 19750, 1976, 19770, 1978, 19790, 198, 19810, 1982, 19830,
+    1984, 19850, 1986, 19870, 1988, 19890, 1990, 19910, 1992, 19930, 1994, 19950, 1996, 19970, 1998, 19990,
+    3, 20011, 2003, 20031, 2005, 20051, 2007, 20071, 2009, 20091, 2011, 20111, 2013, 20131, 2015, 20151,
+    2017, 20171, 2019, 20191, 203, 20211, 2023, 20231, 2025, 20251, 2027, 20271, 2029, 20291, 2031, 20311,
+    2033, 20331, 2035, 20351, 2037, 20371, 2039, 20391, 205, 20411, 2043, 20431, 2045, 20451, 2047, 20471,
+    2048, 2050, 2052, 2054, 2056, 2058, 206, 2062, 2064, 2066, 2068, 2070, 2072, 2074, 2076, 2078,
+    208, 2082, 2084, 2086, 2088, 2090, 2092, 2094, 2096, 2098, 210, 2102, 2104, 2106, 2108, 2110,
+    2112, 2114, 2116, 2118, 212, 2122, 2124, 2126, 2128, 2130, 2132, 2134, 2136, 2138, 214, 2142,
+    2144, 2146, 2148, 2150, 2152, 2154, 2156, 2158, 216, 2162, 2164, 2166, 2168, 2170, 2172, 2174,
+    2176, 2178, 218, 2182, 2184, 2186, 2188, 2190, 2192, 2194, 2196, 2198, 22, 2202, 2204, 2206,
+    2208, 2210, 2212, 2214, 2216, 2218, 222, 2222, 2224, 2226, 2228, 2230, 2232, 2234, 2236, 2238,
+    224, 2242, 2244, 2246, 2248, 2250, 2252, 2254, 2256, 2258, 226, 2262, 2264, 2266, 2268, 2270,
+    2272, 2274, 2276, 2278, 228, 2282, 2284, 2286, 2288, 2290, 2292, 2294, 2296, 2298, 230, 2302,
+    2304, 2306, 2308, 2310, 2312, 2314, 2316, 2318, 232, 2322, 2324, 2326, 2328, 2330, 2332, 2334,
+    2336, 2338, 234, 2342, 2344, 2346, 2348, 2350, 2352, 2354, 2356, 2358, 236, 2362, 2364, 2366,
+    2368, 2370, 2372, 2374, 2376, 2378, 238, 2382, 2384, 2386, 2388, 2390, 2392, 2394, 2396, 2398,
+    24, 2402, 2404, 2406, 2408, 2410, 2412, 2414, 2416, 2418, 242, 2422, 2424, 2426, 2428, 2430,
+    2432, 2434, 2436, 2438, 244, 2442, 2444, 2446, 2448, 2450, 2452, 2454, 2456, 2458, 246, 2462,
+    2464, 2466, 2468, 2470, 2472, 2474, 2476, 2478, 248, 2482, 2484, 2486, 2488, 2490, 2492, 2494,
+    2496, 2498, 250, 2502, 2504, 2506, 2508, 2510, 2512, 2514, 2516, 2518, 252, 2522, 2524, 2526,
+    2528, 2530, 2532, 2534, 2536, 2538, 254, 2542, 2544, 2546, 2548, 2550, 2552, 2554, 2556, 2558,
+    256, 2562, 2564, 2566, 2568, 2570, 2572, 2574, 2576, 2578, 258, 2582, 2584, 2586, 2588, 2590,
+    2592, 2594, 2596, 2598, 26, 2602, 2604, 2606, 2608, 2610, 2612, 2614, 2616, 2618, 262, 2622,
+    2624, 2626, 2628, 2630, 2632, 2634, 2636, 2638, 264, 2642, 2644, 2646, 2648, 2650, 2652, 2654,
+    2656, 2658, 266, 2662, 2664, 2666, 2668, 2670, 2672, 2674, 2676, 2678, 268, 2682, 2684, 2686,
+    2688, 2690, 2692, 2694, 2696, 2698, 270, 2702, 2704, 2706, 2708, 2710, 2712, 2714, 2716, 2718,
+    272, 2722, 2724, 2726, 2728, 2730, 2732, 2734, 2736, 2738, 274, 2742, 2744, 2746, 2748, 2750,
+    2752, 2754, 2756, 2758, 276, 2762, 2764, 2766, 2768, 2770, 2772, 2774, 2776, 2778, 278, 2782,
+    2784, 2786, 2788, 2790, 2792, 2794, 2796, 2798, 28, 2802, 2804, 2806, 2808, 2810, 2812, 2814,
+    2816, 2818, 282, 2822, 2824, 2826, 2828, 2830, 2832, 2834, 2836, 2838, 284, 2842, 2844, 2846,
+    2848, 2850, 2852, 2854, 2856, 2858, 286, 2862, 2864, 2866, 2868, 2870, 2872, 2874, 2876, 2878,
+    288, 2882, 2884, 2886, 2888, 2890, 2892, 2894, 2896, 2898, 290, 2902, 2904, 2906, 2908, 2910,
+    2912, 2914, 2916, 2918, 292, 2922, 2924, 2926, 2928, 2930, 2932, 2934, 2936, 2938, 294, 2942,
+    2944, 2946, 2948, 2950, 2952, 2954, 2956, 2958, 296, 2962, 2964, 2966, 2968, 2970, 2972, 2974,
+    2976, 2978, 298, 2982, 2984, 2986, 2988, 2990, 2992, 2994, 2996, 2998, 30, 3002, 3004, 3006,
+    3008, 3010, 3012, 3014, 3016, 3018, 302, 3022, 3024, 3026, 3028, 3030, 3032, 3034, 3036, 3038,
+    304, 3042, 3044, 3046, 3048, 3050, 3052, 3054, 3056, 3058, 306, 3062, 3064, 3066, 3068, 3070,
+    3072, 3074, 3076, 3078, 308, 3082, 3084, 3086, 3088, 3090, 3092, 3094, 3096, 3098, 310, 3102,
+    3104, 3106, 3108, 3110, 3112, 3114, 3116, 3118, 312, 3122, 3124, 3126, 3128, 3130, 3132, 3134,
+    3136, 3138, 314, 3142, 3144, 3146, 3148, 3150, 3152, 3154, 3156, 3158, 316, 3162, 3164, 3166,
+    3168, 3170, 3172, 3174, 3176, 3178, 318, 3182, 3184, 3186, 3188, 3190, 3192, 3194, 3196, 3198,
+    32, 3202, 3204, 3206, 3208, 3210, 3212, 3214, 3216, 3218, 322, 3222, 3224, 3226, 3228, 3230,
+    3232, 3234, 3236, 3238, 324, 3242, 3244, 3246, 3248, 3250, 3252, 3254, 3256, 3258, 326, 3262,
+    3264, 3266, 3268, 3270, 3272, 3274, 3276, 3278, 328, 3282, 3284, 3286, 3288, 3290, 3292, 3294,
+    3296, 3298, 330, 3302, 3304, 3306, 3308, 3310, 3312, 3314, 3316, 3318, 332, 3322, 3324, 3326,
+    3328, 3330, 3332, 3334, 3336, 3338, 334, 3342, 3344, 3346, 3348, 3350, 3352, 3354, 3356, 3358,
+    336, 3362, 3364, 3366, 3368, 3370, 3372, 3374, 3376, 3378, 338, 3382, 3384, 3386, 3388, 3390,
+    3392, 3394, 3396, 3398, 34, 3402, 3404, 3406, 3408, 3410, 3412, 3414, 3416, 3418, 342, 3422,
+    3424, 3426, 3428, 3430, 3432, 3434, 3436, 3438, 344, 3442, 3444, 3446, 3448, 3450, 3452, 3454,
+    3456, 3458, 346, 3462, 3464, 3466, 3468, 3470, 3472, 3474, 3476, 3478, 348, 3482, 3484, 3486,
+    3488, 3490, 3492, 3494, 3496, 3498, 350, 3502, 3504, 3506, 3508, 3510, 3512, 3514, 3516, 3518,
+    352, 3522, 3524, 3526, 3528, 3530, 3532, 3534, 3536, 3538, 354, 3542, 3544, 3546, 3548, 3550,
+    3552, 3554, 3556, 3558, 356, 3562, 3564, 3566, 3568, 3570, 3572, 3574, 3576, 3578, 358, 3582,
+    3584, 3586, 3588, 3590, 3592, 3594, 3596, 3598, 36, 3602, 3604, 3606, 3608, 3610, 3612, 3614,
+    3616, 3618, 362, 3622, 3624, 3626, 3628, 3630, 3632, 3634, 3636, 3638, 364, 3642, 3644, 3646,
+    3648, 3650, 3652, 3654, 3656, 3658, 366, 3662, 3664, 3666, 3668, 3670, 3672, 3674, 3676, 3678,
+    368, 3682, 3684, 3686, 3688, 3690, 3692, 3694, 3696, 3698, 370, 3702, 3704, 3706, 3708, 3710,
+    3712, 3714, 3716, 3718, 372, 3722, 3724, 3726, 3728, 3730, 3732, 3734, 3736, 3738, 374, 3742,
+    3744, 3746, 3748, 3750, 3752, 3754, 3756, 3758, 376, 3762, 3764, 3766, 3768, 3770, 3772, 3774,
+    3776, 3778, 378, 3782, 3784, 3786, 3788, 3790, 3792, 3794, 3796, 3798, 38, 3802, 3804, 3806,
+    3808, 3810, 3812, 3814, 3816, 3818, 382, 3822, 3824, 3826, 3828, 3830, 3832, 3834, 3836, 3838,
+    384, 3842, 3844, 3846, 3848, 3850, 3852, 3854, 3856, 3858, 386, 3862, 3864, 3866, 3868, 3870,
+    3872, 3874, 3876, 3878, 388, 3882, 3884, 3886, 3888, 3890, 3892, 3894, 3896, 3898, 390, 3902,
+    3904, 3906, 3908, 3910, 3912, 3914, 3916, 3918, 392, 3922, 3924, 3926, 3928, 3930, 3932, 3934,
+    3936, 3938, 394, 3942, 3944, 3946, 3948, 3950, 3952, 3954, 3956, 3958, 396, 3962, 3964, 3966,
+    3968, 3970, 3972, 3974, 3976, 3978, 398, 3982, 3984, 3986, 3988, 3990, 3992, 3994, 3996, 3998,
+    4, 4002, 4004, 4006, 4008, 4010, 4012, 4014, 4016, 4018, 402, 4022, 4024, 4026, 4028, 4030,
+    4032, 4034, 4036, 4038, 404, 4042, 4044, 4046, 4048, 4050, 4052, 4054, 4056, 4058, 406, 4062,
+    4064, 4066, 4068, 4070, 4072, 4074, 4076, 4078, 408, 4082, 4084, 4086, 4088, 4090, 4092, 4094,
+    4096, 410, 4104, 4108, 4112, 4116, 412, 4124, 4128, 4132, 4136, 414, 4144, 4148, 4152, 4156,
+    416, 4164, 4168, 4172, 4176, 418, 4184, 4188, 4192, 4196, 42, 4204, 4208, 4212, 4216, 422,
+    4224, 4228, 4232, 4236, 424, 4244, 4248, 4252, 4256, 426, 4264, 4268, 4272, 4276, 428, 4284,
+    4288, 4292, 4296, 430, 4304, 4308, 4312, 4316, 432, 4324, 4328, 4332, 4336, 434, 4344, 4348,
+    4352, 4356, 436, 4364, 4368, 4372, 4376, 438, 4384, 4388, 4392, 4396, 44, 4404, 4408, 4412,
+    4416, 442, 4424, 4428, 4432, 4436, 444, 4444, 4448, 4452, 4456, 446, 4464, 4468, 4472, 4476,
+    448, 4484, 4488, 4492, 4496, 450, 4504, 4508, 4512, 4516, 452, 4524, 4528, 4532, 4536, 454,
+    4544, 4548, 4552, 4556, 456, 4564, 4568, 4572, 4576, 458, 4584, 4588, 4592, 4596, 46, 4604,
+    4608, 4612, 4616, 462, 4624, 4628, 4632, 4636, 464, 4644, 4648, 4652, 4656, 466, 4664, 4668,
+    4672, 4676, 468, 4684, 4688, 4692, 4696, 470, 4704, 4708, 4712, 4716, 472, 4724, 4728, 4732,
+    4736, 474, 4744, 4748, 4752, 4756, 476, 4764, 4768, 4772, 4776, 478, 4784, 4788, 4792, 4796,
+    48, 4804, 4808, 4812, 4816, 482, 4824, 4828, 4832, 4836, 484, 4844, 4848, 4852, 4856, 486,
+    4864, 4868, 4872, 4876, 488, 4884, 4888, 4892, 4896, 490, 4904, 4908, 4912, 4916, 492, 4924,
+    4928, 4932, 4936, 494, 4944, 4948, 4952, 4956, 496, 4964, 4968, 4972, 4976, 498, 4984, 4988,
+    4992, 4996, 50, 5004, 5008, 5012, 5016, 502, 5024, 5028, 5032, 5036, 504, 5044, 5048, 5052,
+    5056, 506, 5064, 5068, 5072, 5076, 508, 5084, 5088, 5092, 5096, 510, 5104, 5108, 5112, 5116,
+    512, 5124, 5128, 5132, 5136, 514, 5144, 5148, 5152, 5156, 516, 5164, 5168, 5172, 5176, 518,
+    5184, 5188, 5192, 5196, 52, 5204, 5208, 5212, 5216, 522, 5224, 5228, 5232, 5236, 524, 5244,
+    5248, 5252, 5256, 526, 5264, 5268, 5272, 5276, 528, 5284, 5288, 5292, 5296, 530, 5304, 5308,
+    5312, 5316, 532, 5324, 5328, 5332, 5336, 534, 5344, 5348, 5352, 5356, 536, 5364, 5368, 5372,
+    5376, 538, 5384, 5388, 5392, 5396, 54, 5404, 5408, 5412, 5416, 542, 5424, 5428, 5432, 5436,
+    544, 5444, 5448, 5452, 5456, 546, 5464, 5468, 5472, 5476, 548, 5484, 5488, 5492, 5496, 550,
+    5504, 5508, 5512, 5516, 552, 5524, 5528, 5532, 5536, 554, 5544, 5548, 5552, 5556, 556, 5564,
+    5568, 5572, 5576, 558, 5584, 5588, 5592, 5596, 56, 5604, 5608, 5612, 5616, 562, 5624, 5628,
+    5632, 5636, 564, 5644, 5648, 5652, 5656, 566, 5664, 5668, 5672, 5676, 568, 5684, 5688, 5692,
+    5696, 570, 5704, 5708, 5712, 5716, 572, 5724, 5728, 5732, 5736, 574, 5744, 5748, 5752, 5756,
+    576, 5764, 5768, 5772, 5776, 578, 5784, 5788, 5792, 5796, 58, 5804, 5808, 5812, 5816, 582,
+    5824, 5828, 5832, 5836, 584, 5844, 5848, 5852, 5856, 586, 5864, 5868, 5872, 5876, 588, 5884,
+    5888, 5892, 5896, 590, 5904, 5908, 5912, 5916, 592, 5924, 5928, 5932, 5936, 594, 5944, 5948,
+    5952, 5956, 596, 5964, 5968, 5972, 5976, 598, 5984, 5988, 5992, 5996, 6, 6004, 6008, 6012,
+    6016, 602, 6024, 6028, 6032, 6036, 604, 6044, 6048, 6052, 6056, 606, 6064, 6068, 6072, 6076,
+    608, 6084, 6088, 6092, 6096, 610, 6104, 6108, 6112, 6116, 612, 6124, 6128, 6132, 6136, 614,
+    6144, 6148, 6152, 6156, 616, 6164, 6168, 6172, 6176, 618, 6184, 6188, 6192, 6196, 62, 6204,
+    6208, 6212, 6216, 622, 6224, 6228, 6232, 6236, 624, 6244, 6248, 6252, 6256, 626, 6264, 6268,
+    6272, 6276, 628, 6284, 6288, 6292, 6296, 630, 6304, 6308, 6312, 6316, 632, 6324, 6328, 6332,
+    6336, 634, 6344, 6348, 6352, 6356, 636, 6364, 6368, 6372, 6376, 638, 6384, 6388, 6392, 6396,
+    64, 6404, 6408, 6412, 6416, 642, 6424, 6428, 6432, 6436, 644, 6444, 6448, 6452, 6456, 646,
+    6464, 6468, 6472, 6476, 648, 6484, 6488, 6492, 6496, 650, 6504, 6508, 6512, 6516, 652, 6524,
+    6528, 6532, 6536, 654, 6544, 6548, 6552, 6556, 656, 6564, 6568, 6572, 6576, 658, 6584, 6588,
+    6592, 6596, 66, 6604, 6608, 6612, 6616, 662, 6624, 6628, 6632, 6636, 664, 6644, 6648, 6652,
+    6656, 666, 6664, 6668, 6672, 6676, 668, 6684, 6688, 6692, 6696, 670, 6704, 6708, 6712, 6716,
+    672, 6724, 6728, 6732, 6736, 674, 6744, 6748, 6752, 6756, 676, 6764, 6768, 6772, 6776, 678,
+    6784, 6788, 6792, 6796, 68, 6804, 6808, 6812, 6816, 682, 6824, 6828, 6832, 6836, 684, 6844,
+    6848, 6852, 6856, 686, 6864, 6868, 6872, 6876, 688, 6884, 6888, 6892, 6896, 690, 6904, 6908,
+    6912, 6916, 692, 6924, 6928, 6932, 6936, 694, 6944, 6948, 6952, 6956, 696, 6964, 6968, 6972,
+    6976, 698, 6984, 6988, 6992, 6996, 70, 7004, 7008, 7012, 7016, 702, 7024, 7028, 7032, 7036,
+    704, 7044, 7048, 7052, 7056, 706, 7064, 7068, 7072, 7076, 708, 7084, 7088, 7092, 7096, 710,
+    7104, 7108, 7112, 7116, 712, 7124, 7128, 7132, 7136, 714, 7144, 7148, 7152, 7156, 716, 7164,
+    7168, 7172, 7176, 718, 7184, 7188, 7192, 7196, 72, 7204, 7208, 7212, 7216, 722, 7224, 7228,
+    7232, 7236, 724, 7244, 7248, 7252, 7256, 726, 7264, 7268, 7272, 7276, 728, 7284, 7288, 7292,
+    7296, 730, 7304, 7308, 7312, 7316, 732, 7324, 7328, 7332, 7336, 734, 7344, 7348, 7352, 7356,
+    736, 7364, 7368, 7372, 7376, 738, 7384, 7388, 7392, 7396, 74, 7404, 7408, 7412, 7416, 742,
+    7424, 7428, 7432, 7436, 744, 7444, 7448, 7452, 7456, 746, 7464, 7468, 7472, 7476, 748, 7484,
+    7488, 7492, 7496, 750, 7504, 7508, 7512, 7516, 752, 7524, 7528, 7532, 7536, 754, 7544, 7548,
+    7552, 7556, 756, 7564, 7568, 7572, 7576, 758, 7584, 7588, 7592, 7596, 76, 7604, 7608, 7612,
+    7616, 762, 7624, 7628, 7632, 7636, 764, 7644, 7648, 7652, 7656, 766, 7664, 7668, 7672, 7676,
+    768, 7684, 7688, 7692, 7696, 770, 7704, 7708, 7712, 7716, 772, 7724, 7728, 7732, 7736, 774,
+    7744, 7748, 7752, 7756, 776, 7764, 7768, 7772, 7776, 778, 7784, 7788, 7792, 7796, 78, 7804,
+    7808, 7812, 7816, 782, 7824, 7828, 7832, 7836, 784, 7844, 7848, 7852, 7856, 786, 7864, 7868,
+    7872, 7876, 788, 7884, 7888, 7892, 7896, 790, 7904, 7908, 7912, 7916, 792, 7924, 7928, 7932,
+    7936, 794, 7944, 7948, 7952, 7956, 796, 7964, 7968, 7972, 7976, 798, 7984, 7988, 7992, 7996,
+    8, 8004, 8008, 8012, 8016, 802, 8024, 8028, 8032, 8036, 804, 8044, 8048, 8052, 8056, 806,
+    8064, 8068, 8072, 8076, 808, 8084, 8088, 8092, 8096, 810, 8104, 8108, 8112, 8116, 812, 8124,
+    8128, 8132, 8136, 814, 8144, 8148, 8152, 8156, 816, 8164, 8168, 8172, 8176, 818, 8184, 8188,
+    8192, 82, 8208, 8216, 822, 8232, 824, 8248, 826, 8264, 8272, 828, 8288, 8296, 830, 8312,
+    832, 8328, 834, 8344, 8352, 836, 8368, 8376, 838, 8392, 84, 8408, 842, 8424, 8432, 844,
+    8448, 8456, 846, 8472, 848, 8488, 850, 8504, 8512, 852, 8528, 8536, 854, 8552, 856, 8568,
+    858, 8584, 8592, 86, 8608, 8616, 862, 8632, 864, 8648, 866, 8664, 8672, 868, 8688, 8696,
+    870, 8712, 872, 8728, 874, 8744, 8752, 876, 8768, 8776, 878, 8792, 88, 8808, 882, 8824,
+    8832, 884, 8848, 8856, 886, 8872, 888, 8888, 890, 8904, 8912, 892, 8928, 8936, 894, 8952,
+    896, 8968, 898, 8984, 8992, 90, 9008, 9016, 902, 9032, 904, 9048, 906, 9064, 9072, 908,
+    9088, 9096, 910, 9112, 912, 9128, 914, 9144, 9152, 916, 9168, 9176, 918, 9192, 92, 9208,
+    922, 9224, 9232, 924, 9248, 9256, 926, 9272, 928, 9288, 930, 9304, 9312, 932, 9328, 9336,
+    934, 9352, 936, 9368, 938, 9384, 9392, 94, 9408, 9416, 942, 9432, 944, 9448, 946, 9464,
+    9472, 948, 9488, 9496, 950, 9512, 952, 9528, 954, 9544, 9552, 956, 9568, 9576, 958, 9592,
+    96, 9608, 962, 9624, 9632, 964, 9648, 9656, 966, 9672, 968, 9688, 970, 9704, 9712, 972,
+    9728, 9736, 974, 9752, 976, 9768, 978, 9784, 9792, 98, 9808, 9816, 982, 9832, 984, 9848,
+    986, 9864, 9872, 988, 9888, 9896, 990, 9912, 992, 9928, 994, 9944, 9952, 996, 9968, 9976,
+    998, 9992, 10, 10008, 1002, 10024, 10032, 1004, 10048, 10056, 1006, 10072, 1008, 10088, 1010, 10104,
+    10112, 1012, 10128, 10136, 1014, 10152, 1016, 10168, 1018, 10184, 10192, 102, 10208, 10216, 1022, 10232,
+    1024, 10248, 1026, 10264, 10272, 1028, 10288, 10296, 1030, 10312, 1032, 10328, 1034, 10344, 10352, 1036,
+    10368, 10376, 1038, 10392, 104, 10408, 1042, 10424, 10432, 1044, 10448, 10456, 1046, 10472, 1048, 10488,
+    1050, 10504, 10512, 1052, 10528, 10536, 1054, 10552, 1056, 10568, 1058, 10584, 10592, 106, 10608, 10616,
+    1062, 10632, 1064, 10648, 1066, 10664, 10672, 1068, 10688, 10696, 1070, 10712, 1072, 10728, 1074, 10744,
+    10752, 1076, 10768, 10776, 1078, 10792, 108, 10808, 1082, 10824, 10832, 1084, 10848, 10856, 1086, 10872,
+    1088, 10888, 1090, 10904, 10912, 1092, 10928, 10936, 1094, 10952, 1096, 10968, 1098, 10984, 10992, 110,
+    11008, 11016, 1102, 11032, 1104, 11048, 1106, 11064, 11072, 1108, 11088, 11096, 1110, 11112, 1112, 11128,
+    1114, 11144, 11152, 1116, 11168, 11176, 1118, 11192, 112, 11208, 1122, 11224, 11232, 1124, 11248, 11256,
+    1126, 11272, 1128, 11288, 1130, 11304, 11312, 1132, 11328, 11336, 1134, 11352, 1136, 11368, 1138, 11384,
+    11392, 114, 11408, 11416, 1142, 11432, 1144, 11448, 1146, 11464, 11472, 1148, 11488, 11496, 1150, 11512,
+    1152, 11528, 1154, 11544, 11552, 1156, 11568, 11576, 1158, 11592, 116, 11608, 1162, 11624, 11632, 1164,
+    11648, 11656, 1166, 11672, 1168, 11688, 1170, 11704, 11712, 1172, 11728, 11736, 1174, 11752, 1176, 11768,
+    1178, 11784, 11792, 118, 11808, 11816, 1182, 11832, 1184, 11848, 1186, 11864, 11872, 1188, 11888, 11896,
+    1190, 11912, 1192, 11928, 1194, 11944, 11952, 1196, 11968, 11976, 1198, 11992, 12, 12008, 1202, 12024,
+    12032, 1204, 12048, 12056, 1206, 12072, 1208, 12088, 1210, 12104, 12112, 1212, 12128, 12136, 1214, 12152,
+    1216, 12168, 1218, 12184, 12192, 122, 12208, 12216, 1222, 12232, 1224, 12248, 1226, 12264, 12272, 1228,
+    12288, 12296, 1230, 12312, 1232, 12328, 1234, 12344, 12352, 1236, 12368, 12376, 1238, 12392, 124, 12408,
+    1242, 12424, 12432, 1244, 12448, 12456, 1246, 12472, 1248, 12488, 1250, 12504, 12512, 1252, 12528, 12536,
+    1254, 12552, 1256, 12568, 1258, 12584, 12592, 126, 12608, 12616, 1262, 12632, 1264, 12648, 1266, 12664,
+    12672, 1268, 12688, 12696, 1270, 12712, 1272, 12728, 1274, 12744, 12752, 1276, 12768, 12776, 1278, 12792,
+    128, 12808, 1282, 12824, 12832, 1284, 12848, 12856, 1286, 12872, 1288, 12888, 1290, 12904, 12912, 1292,
+    12928, 12936, 1294, 12952, 1296, 12968, 1298, 12984, 12992, 130, 13008, 13016, 1302, 13032, 1304, 13048,
+    1306, 13064, 13072, 1308, 13088, 13096, 1310, 13112, 1312, 13128, 1314, 13144, 13152, 1316, 13168, 13176,
+    1318, 13192, 132, 13208, 1322, 13224, 13232, 1324, 13248, 13256, 1326, 13272, 1328, 13288, 1330, 13304,
+    13312, 1332, 13328, 13336, 1334, 13352, 1336, 13368, 1338, 13384, 13392, 134, 13408, 13416, 1342, 13432,
+    1344, 13448, 1346, 13464, 13472, 1348, 13488, 13496, 1350, 13512, 1352, 13528, 1354, 13544, 13552, 1356,
+    13568, 13576, 1358, 13592, 136, 13608, 1362, 13624, 13632, 1364, 13648, 13656, 1366, 13672, 1368, 13688,
+    1370, 13704, 13712, 1372, 13728, 13736, 1374, 13752, 1376, 13768, 1378, 13784, 13792, 138, 13808, 13816,
+    1382, 13832, 1384, 13848, 1386, 13864, 13872, 1388, 13888, 13896, 1390, 13912, 1392, 13928, 1394, 13944,
+    13952, 1396, 13968, 13976, 1398, 13992, 14, 14008, 1402, 14024, 14032, 1404, 14048, 14056, 1406, 14072,
+    1408, 14088, 1410, 14104, 14112, 1412, 14128, 14136, 1414, 14152, 1416, 14168, 1418, 14184, 14192, 142,
+    14208, 14216, 1422, 14232, 1424, 14248, 1426, 14264, 14272, 1428, 14288, 14296, 1430, 14312, 1432, 14328,
+    1434, 14344, 14352, 1436, 14368, 14376, 1438, 14392, 144, 14408, 1442, 14424, 14432, 1444, 14448, 14456,
+    1446, 14472, 1448, 14488, 1450, 14504, 14512, 1452, 14528, 14536, 1454, 14552, 1456, 14568, 1458, 14584,
+    14592, 146, 14608, 14616, 1462, 14632, 1464, 14648, 1466, 14664, 14672, 1468, 14688, 14696, 1470, 14712,
+    1472, 14728, 1474, 14744, 14752, 1476, 14768, 14776, 1478, 14792, 148, 14808, 1482, 14824, 14832, 1484,
+    14848, 14856, 1486, 14872, 1488, 14888, 1490, 14904, 14912, 1492, 14928, 14936, 1494, 14952, 1496, 14968,
+    1498, 14984, 14992, 150, 15008, 15016, 1502, 15032, 1504, 15048, 1506, 15064, 15072, 1508, 15088, 15096,
+    1510, 15112, 1512, 15128, 1514, 15144, 15152, 1516, 15168, 15176, 1518, 15192, 152, 15208, 1522, 15224,
+    15232, 1524, 15248, 15256, 1526, 15272, 1528, 15288, 1530, 15304, 15312, 1532, 15328, 15336, 1534, 15352,
+    1536, 15368, 1538, 15384, 15392, 154, 15408, 15416, 1542, 15432, 1544, 15448, 1546, 15464, 15472, 1548,
+    15488, 15496, 1550, 15512, 1552, 15528, 1554, 15544, 15552, 1556, 15568, 15576, 1558, 15592, 156, 15608,
+    1562, 15624, 15632, 1564, 15648, 15656, 1566, 15672, 1568, 15688, 1570, 15704, 15712, 1572, 15728, 15736,
+    1574, 15752, 1576, 15768, 1578, 15784, 15792, 158, 15808, 15816, 1582, 15832, 1584, 15848, 1586, 15864,
+    15872, 1588, 15888, 15896, 1590, 15912, 1592, 15928, 1594, 15944, 15952, 1596, 15968, 15976, 1598, 15992,
+    16, 16008, 1602, 16024, 16032, 1604, 16048, 16056, 1606, 16072, 1608, 16088, 1610, 16104, 16112, 1612,
+    16128, 16136, 1614, 16152, 1616, 16168, 1618, 16184, 16192, 162, 16208, 16216, 1622, 16232, 1624, 16248,
+    1626, 16264, 16272, 1628, 16288, 16296, 1630, 16312, 1632, 16328, 1634, 16344, 16352, 1636, 16368, 16376,
+    1638, 164, 1642, 16432, 1644, 1646, 1648, 1650, 1652, 16528, 1654, 1656, 1658, 16592, 166, 1662,
+    1664, 1666, 1668, 16688, 1670, 1672, 1674, 16752, 1676, 1678, 168, 1682, 1684, 16848, 1686, 1688,
+    1690, 16912, 1692, 1694, 1696, 1698, 170, 17008, 1702, 1704, 1706, 17072, 1708, 1710, 1712, 1714,
+    1716, 17168, 1718, 172, 1722, 17232, 1724, 1726, 1728, 1730, 1732, 17328, 1734, 1736, 1738, 17392,
+    174, 1742, 1744, 1746, 1748, 17488, 1750, 1752, 1754, 17552, 1756, 1758, 176, 1762, 1764, 17648,
+    1766, 1768, 1770, 17712, 1772, 1774, 1776, 1778, 178, 17808, 1782, 1784, 1786, 17872, 1788, 1790,
+    1792, 1794, 1796, 17968, 1798, 18, 1802, 18032, 1804, 1806, 1808, 1810, 1812, 18128, 1814, 1816,
+    1818, 18192, 182, 1822, 1824, 1826, 1828, 18288, 1830, 1832, 1834, 18352, 1836, 1838, 184, 1842,
+    1844, 18448, 1846, 1848, 1850, 18512, 1852, 1854, 1856, 1858, 186, 18608, 1862, 1864, 1866, 18672,
+    1868, 1870, 1872, 1874, 1876, 18768, 1878, 188, 1882, 18832, 1884, 1886, 1888, 1890, 1892, 18928,
+    1894, 1896, 1898, 18992, 190, 1902, 1904, 1906, 1908, 19088, 1910, 1912, 1914, 19152, 1916, 1918,
+    192, 1922, 1924, 19248, 1926, 1928, 1930, 19312, 1932, 1934, 1936, 1938, 194, 19408, 1942, 1944,
+    1946, 19472, 1948, 1950, 1952, 1954, 1956, 19568, 1958, 196, 1962, 19632, 1964, 1966, 1968, 1970,
+    1972, 19728, 1974, 1976, 1978, 19792, 198, 1982, 1984, 1986, 1988, 19888, 1990, 1992, 1994, 19952,
+    1996, 1998, 3, 2003, 2005, 20049, 2007, 2009, 2011, 20113, 2013, 2015, 2017, 2019, 203, 20209,
+    2023, 2025, 2027, 20273, 2029, 2031, 2033, 2035, 2037, 20369, 2039, 205, 2043, 20433, 2045, 2047,
+    2049, 2051, 2053, 20529, 2055, 2057, 2059, 20593, 207, 2063, 2065, 2067, 2069, 20689, 2071, 2073,
+    2075, 20753, 2077, 2079, 209, 2083, 2085, 20849, 2087, 2089, 2091, 20913, 2093, 2095, 2097, 2099,
+    211, 21009, 2103, 2105, 2107, 21073, 2109, 2111, 2113, 2115, 2117, 21169, 2119, 213, 2123, 21233,
+    2125, 2127, 2129, 2131, 2133, 21329, 2135, 2137, 2139, 21393, 215, 2143, 2145, 2147, 2149, 21489,
+    2151, 2153, 2155, 21553, 2157, 2159, 217, 2163, 2165, 21649, 2167, 2169, 2171, 21713, 2173, 2175,
+    2177, 2179, 219, 21809, 2183, 2185, 2187, 21873, 2189, 2191, 2193, 2195, 2197, 21969, 2199, 23,
+    2203, 22033, 2205, 2207, 2209, 2211, 2213, 22129, 2215, 2217, 2219, 22193, 223, 2223, 2225, 2227,
+    2229, 22289, 2231, 2233, 2235, 22353, 2237, 2239, 225, 2243, 2245, 22449, 2247, 2249, 2251, 22513,
+    2253, 2255, 2257, 2259, 227, 22609, 2263, 2265, 2267, 22673, 2269, 2271, 2273, 2275, 2277, 22769,
+    2279, 229, 2283, 22833, 2285, 2287, 2289, 2291, 2293, 22929, 2295, 2297, 2299, 22993, 231, 2303,
+    2305, 2307, 2309, 23089, 2311, 2313, 2315, 23153, 2317, 2319, 233, 2323, 2325, 23249, 2327, 2329,
+    2331, 23313, 2333, 2335, 2337, 2339, 235, 23409, 2343, 2345, 2347, 23473, 2349, 2351, 2353, 2355,
+    2357, 23569, 2359, 237, 2363, 23633, 2365, 2367, 2369, 2371, 2373, 23729, 2375, 2377, 2379, 23793,
+    239, 2383, 2385, 2387, 2389, 23889, 2391, 2393, 2395, 23953, 2397, 2399, 25, 2403, 2405, 24049,
+    2407, 2409, 2411, 24113, 2413, 2415, 2417, 2419, 243, 24209, 2423, 2425, 2427, 24273, 2429, 2431,
+    2433, 2435, 2437, 24369, 2439, 245, 2443, 24433, 2445, 2447, 2449, 2451, 2453, 24529, 2455, 2457,
+    2459, 24593, 247, 2463, 2465, 2467, 2469, 24689, 2471, 2473, 2475, 24753, 2477, 2479, 249, 2483,
+    2485, 24849, 2487, 2489, 2491, 24913, 2493, 2495, 2497, 2499, 251, 25009, 2503, 2505, 2507, 25073,
+    2509, 2511, 2513, 2515, 2517, 25169, 2519, 253, 2523, 25233, 2525, 2527, 2529, 2531, 2533, 25329,
+    2535, 2537, 2539, 25393, 255, 2543, 2545, 2547, 2549, 25489, 2551, 2553, 2555, 25553, 2557, 2559,
+    257, 2563, 2565, 25649, 2567, 2569, 2571, 25713, 2573, 2575, 2577, 2579, 259, 25809, 2583, 2585,
+    2587, 25873, 2589, 2591, 2593, 2595, 2597, 25969, 2599, 27, 2603, 26033, 2605, 2607, 2609, 2611,
+    2613, 26129, 2615, 2617, 2619, 26193, 263, 2623, 2625, 2627, 2629, 26289, 2631, 2633, 2635, 26353,
+    2637, 2639, 265, 2643, 2645, 26449, 2647, 2649, 2651, 26513, 2653, 2655, 2657, 2659, 267, 26609,
+    2663, 2665, 2667, 26673, 2669, 2671, 2673, 2675, 2677, 26769, 2679, 269, 2683, 26833, 2685, 2687,
+    2689, 2691, 2693, 26929, 2695, 2697, 2699, 26993, 271, 2703, 2705, 2707, 2709, 27089, 2711, 2713,
+    2715, 27153, 2717, 2719, 273, 2723, 2725, 27249, 2727, 2729, 2731, 27313, 2733, 2735, 2737, 2739,
+    275, 27409, 2743, 2745, 2747, 27473, 2749, 2751, 2753, 2755, 2757, 27569, 2759, 277, 2763, 27633,
+    2765, 2767, 2769, 2771, 2773, 27729, 2775, 2777, 2779, 27793, 279, 2783, 2785, 2787, 2789, 27889,
+    2791, 2793, 2795, 27953, 2797, 2799, 29, 2803, 2805, 28049, 2807, 2809, 2811, 28113, 2813, 2815,
+    2817, 2819, 283, 28209, 2823, 2825, 2827, 28273, 2829, 2831, 2833, 2835, 2837, 28369, 2839, 285,
+    2843, 28433, 2845, 2847, 2849, 2851, 2853, 28529, 2855, 2857, 2859, 28593, 287, 2863, 2865, 2867,
+    2869, 28689, 2871, 2873, 2875, 28753, 2877, 2879, 289, 2883, 2885, 28849, 2887, 2889, 2891, 28913,
+    2893, 2895, 2897, 2899, 291, 29009, 2903, 2905, 2907, 29073, 2909, 2911, 2913, 2915, 2917, 29169,
+    2919, 293, 2923, 29233, 2925, 2927, 2929, 2931, 2933, 29329, 2935, 2937, 2939, 29393, 295, 2943,
+    2945, 2947, 2949, 29489, 2951, 2953, 2955, 29553, 2957, 2959, 297, 2963, 2965, 29649, 2967, 2969,
+    2971, 29713, 2973, 2975, 2977, 2979, 299, 29809, 2983, 2985, 2987, 29873, 2989, 2991, 2993, 2995,
+    2997, 29969, 2999, 31, 3003, 30033, 3005, 3007, 3009, 3011, 3013, 30129, 3015, 3017, 3019, 30193,
+    303, 3023, 3025, 3027, 3029, 30289, 3031, 3033, 3035, 30353, 3037, 3039, 305, 3043, 3045, 30449,
+    3047, 3049, 3051, 30513, 3053, 3055, 3057, 3059, 307, 30609, 3063, 3065, 3067, 30673, 3069, 3071,
+    3073, 3075, 3077, 30769, 3079, 309, 3083, 30833, 3085, 3087, 3089, 3091, 3093, 30929, 3095, 3097,
+    3099, 30993, 311, 3103, 3105, 3107, 3109, 31089, 3111, 3113, 3115, 31153, 3117, 3119, 313, 3123,
+    3125, 31249, 3127, 3129, 3131, 31313, 3133, 3135, 3137, 3139, 315, 31409, 3143, 3145, 3147, 31473,
+    3149, 3151, 3153, 3155, 3157, 31569, 3159, 317, 3163, 31633, 3165, 3167, 3169, 3171, 3173, 31729,
+    3175, 3177, 3179, 31793, 319, 3183, 3185, 3187, 3189, 31889, 3191, 3193, 3195, 31953, 3197, 3199,
+    33, 3203, 3205, 32049, 3207, 3209, 3211, 32113, 3213, 3215, 3217, 3219, 323, 32209, 3223, 3225,
+    3227, 32273, 3229, 3231, 3233, 3235, 3237, 32369, 3239, 325, 3243, 32433, 3245, 3247, 3249, 3251,
+    3253, 32529, 3255, 3257, 3259, 32593, 327, 3263, 3265, 3267, 3269, 32689, 3271, 3273, 3275, 32753,
+    3276, 328, 3284, 3286, 3290, 3292, 3296, 330, 3302, 3306, 3308, 3312, 3316, 3318, 332, 3324,
+    3328, 3332, 3334, 3338, 334, 3344, 3348, 3350, 3354, 3356, 336, 3364, 3366, 3370, 3372, 3376,
+    338, 3382, 3386, 3388, 3392, 3396, 34, 3402, 3404, 3408, 3412, 3414, 3418, 342, 3424, 3428,
+    3430, 3434, 3436, 344, 3444, 3446, 3450, 3452, 3456, 346, 3462, 3466, 3468, 3472, 3476, 3478,
+    348, 3484, 3488, 3492, 3494, 3498, 350, 3504, 3508, 3510, 3514, 3516, 352, 3524, 3526, 3530,
+    3532, 3536, 354, 3542, 3546, 3548, 3552, 3556, 356, 3562, 3564, 3568, 3572, 3574, 3578, 358,
+    3584, 3588, 3590, 3594, 3596, 36, 3604, 3606, 3610, 3612, 3616, 362, 3622, 3626, 3628, 3632,
+    3636, 3638, 364, 3644, 3648, 3652, 3654, 3658, 366, 3664, 3668, 3670, 3674, 3676, 368, 3684,
+    3686, 3690, 3692, 3696, 370, 3702, 3706, 3708, 3712, 3716, 372, 3722, 3724, 3728, 3732, 3734,
+    3738, 374, 3744, 3748, 3750, 3754, 3756, 376, 3764, 3766, 3770, 3772, 3776, 378, 3782, 3786,
+    3788, 3792, 3796, 3798, 38, 3804, 3808, 3812, 3814, 3818, 382, 3824, 3828, 3830, 3834, 3836,
+    384, 3844, 3846, 3850, 3852, 3856, 386, 3862, 3866, 3868, 3872, 3876, 388, 3882, 3884, 3888,
+    3892, 3894, 3898, 390, 3904, 3908, 3910, 3914, 3916, 392, 3924, 3926, 3930, 3932, 3936, 394,
+    3942, 3946, 3948, 3952, 3956, 3958, 396, 3964, 3968, 3972, 3974, 3978, 398, 3984, 3988, 3990,
+    3994, 3996, 4, 4004, 4006, 4010, 4012, 4016, 402, 4022, 4026, 4028, 4032, 4036, 404, 4042,
+    4044, 4048, 4052, 4054, 4058, 406, 4064, 4068, 4070, 4074, 4076, 408, 4084, 4086, 4090, 4092,
+    4096, 410, 4102, 4106, 4108, 4112, 4116, 4118, 412, 4124, 4128, 4132, 4134, 4138, 414, 4144,
+    4148, 4150, 4154, 4156, 416, 4164, 4166, 4170, 4172, 4176, 418, 4182, 4186, 4188, 4192, 4196,
+    42, 4202, 4204, 4208, 4212, 4214, 4218, 422, 4224, 4228, 4230, 4234, 4236, 424, 4244, 4246,
+    4250, 4252, 4256, 426, 4262, 4266, 4268, 4272, 4276, 4278, 428, 4284, 4288, 4292, 4294, 4298,
+    430, 4304, 4308, 4310, 4314, 4316, 432, 4324, 4326, 4330, 4332, 4336, 434, 4342, 4346, 4348,
+    4352, 4356, 436, 4362, 4364, 4368, 4372, 4374, 4378, 438, 4384, 4388, 4390, 4394, 4396, 44,
+    4404, 4406, 4410, 4412, 4416, 442, 4422, 4426, 4428, 4432, 4436, 4438, 444, 4444, 4448, 4452,
+    4454, 4458, 446, 4464, 4468, 4470, 4474, 4476, 448, 4484, 4486, 4490, 4492, 4496, 450, 4502,
+    4506, 4508, 4512, 4516, 452, 4522, 4524, 4528, 4532, 4534, 4538, 454, 4544, 4548, 4550, 4554,
+    4556, 456, 4564, 4566, 4570, 4572, 4576, 458, 4582, 4586, 4588, 4592, 4596, 4598, 46, 4604,
+    4608, 4612, 4614, 4618, 462, 4624, 4628, 4630, 4634, 4636, 464, 4644, 4646, 4650, 4652, 4656,
+    466, 4662, 4666, 4668, 4672, 4676, 468, 4682, 4684, 4688, 4692, 4694, 4698, 470, 4704, 4708,
+    4710, 4714, 4716, 472, 4724, 4726, 4730, 4732, 4736, 474, 4742, 4746, 4748, 4752, 4756, 4758,
+    476, 4764, 4768, 4772, 4774, 4778, 478, 4784, 4788, 4790, 4794, 4796, 48, 4804, 4806, 4810,
+    4812, 4816, 482, 4822, 4826, 4828, 4832, 4836, 484, 4842, 4844, 4848, 4852, 4854, 4858, 486,
+    4864, 4868, 4870, 4874, 4876, 488, 4884, 4886, 4890, 4892, 4896, 490, 4902, 4906, 4908, 4912,
+    4916, 4918, 492, 4924, 4928, 4932, 4934, 4938, 494, 4944, 4948, 4950, 4954, 4956, 496, 4964,
+    4966, 4970, 4972, 4976, 498, 4982, 4986, 4988, 4992, 4996, 50, 5002, 5004, 5008, 5012, 5014,
+    5018, 502, 5024, 5028, 5030, 5034, 5036, 504, 5044, 5046, 5050, 5052, 5056, 506, 5062, 5066,
+    5068, 5072, 5076, 5078, 508, 5084, 5088, 5092, 5094, 5098, 510, 5104, 5108, 5110, 5114, 5116,
+    512, 5124, 5126, 5130, 5132, 5136, 514, 5142, 5146, 5148, 5152, 5156, 516, 5162, 5164, 5168,
+    5172, 5174, 5178, 518, 5184, 5188, 5190, 5194, 5196, 52, 5204, 5206, 5210, 5212, 5216, 522,
+    5222, 5226, 5228, 5232, 5236, 5238, 524, 5244, 5248, 5252, 5254, 5258, 526, 5264, 5268, 5270,
+    5274, 5276, 528, 5284, 5286, 5290, 5292, 5296, 530, 5302, 5306, 5308, 5312, 5316, 532, 5322,
+    5324, 5328, 5332, 5334, 5338, 534, 5344, 5348, 5350, 5354, 5356, 536, 5364, 5366, 5370, 5372,
+    5376, 538, 5382, 5386, 5388, 5392, 5396, 5398, 54, 5404, 5408, 5412, 5414, 5418, 542, 5424,
+    5428, 5430, 5434, 5436, 544, 5444, 5446, 5450, 5452, 5456, 546, 5462, 5466, 5468, 5472, 5476,
+    548, 5482, 5484, 5488, 5492, 5494, 5498, 550, 5504, 5508, 5510, 5514, 5516, 552, 5524, 5526,
+    5530, 5532, 5536, 554, 5542, 5546, 5548, 5552, 5556, 5558, 556, 5564, 5568, 5572, 5574, 5578,
+    558, 5584, 5588, 5590, 5594, 5596, 56, 5604, 5606, 5610, 5612, 5616, 562, 5622, 5626, 5628,
+    5632, 5636, 564, 5642, 5644, 5648, 5652, 5654, 5658, 566, 5664, 5668, 5670, 5674, 5676, 568,
+    5684, 5686, 5690, 5692, 5696, 570, 5702, 5706, 5708, 5712, 5716, 5718, 572, 5724, 5728, 5732,
+    5734, 5738, 574, 5744, 5748, 5750, 5754, 5756, 576, 5764, 5766, 5770, 5772, 5776, 578, 5782,
+    5786, 5788, 5792, 5796, 58, 5802, 5804, 5808, 5812, 5814, 5818, 582, 5824, 5828, 5830, 5834,
+    5836, 584, 5844, 5846, 5850, 5852, 5856, 586, 5862, 5866, 5868, 5872, 5876, 5878, 588, 5884,
+    5888, 5892, 5894, 5898, 590, 5904, 5908, 5910, 5914, 5916, 592, 5924, 5926, 5930, 5932, 5936,
+    594, 5942, 5946, 5948, 5952, 5956, 596, 5962, 5964, 5968, 5972, 5974, 5978, 598, 5984, 5988,
+    5990, 5994, 5996, 6, 6004, 6006, 6010, 6012, 6016, 602, 6022, 6026, 6028, 6032, 6036, 6038,
+    604, 6044, 6048, 6052, 6054, 6058, 606, 6064, 6068, 6070, 6074, 6076, 608, 6084, 6086, 6090,
+    6092, 6096, 610, 6102, 6106, 6108, 6112, 6116, 612, 6122, 6124, 6128, 6132, 6134, 6138, 614,
+    6144, 6148, 6150, 6154, 6156, 616, 6164, 6166, 6170, 6172, 6176, 618, 6182, 6186, 6188, 6192,
+    6196, 6198, 62, 6204, 6208, 6212, 6214, 6218, 622, 6224, 6228, 6230, 6234, 6236, 624, 6244,
+    6246, 6250, 6252, 6256, 626, 6262, 6266, 6268, 6272, 6276, 628, 6282, 6284, 6288, 6292, 6294,
+    6298, 630, 6304, 6308, 6310, 6314, 6316, 632, 6324, 6326, 6330, 6332, 6336, 634, 6342, 6346,
+    6348, 6352, 6356, 6358, 636, 6364, 6368, 6372, 6374, 6378, 638, 6384, 6388, 6390, 6394, 6396,
+    64, 6404, 6406, 6410, 6412, 6416, 642, 6422, 6426, 6428, 6432, 6436, 644, 6442, 6444, 6448,
+    6452, 6454, 6458, 646, 6464, 6468, 6470, 6474, 6476, 648, 6484, 6486, 6490, 6492, 6496, 650,
+    6502, 6506, 6508, 6512, 6516, 6518, 652, 6524, 6528, 6532, 6534, 6538, 654, 6544, 6548, 6550,
+    6554, 656, 6566, 6572, 658, 6586, 6592, 66, 6604, 6612, 662, 6624, 6630, 6636, 664, 6650,
+    6656, 666, 6668, 6676, 668, 6688, 6694, 670, 6708, 6714, 672, 6726, 6732, 674, 6746, 6752,
+    676, 6764, 6772, 678, 6784, 6790, 68, 6804, 6810, 6816, 682, 6828, 6836, 684, 6848, 6854,
+    686, 6868, 6874, 688, 6886, 6892, 690, 6906, 6912, 692, 6924, 6932, 694, 6944, 6950, 6956,
+    696, 6970, 6976, 698, 6988, 6996, 70, 7008, 7014, 702, 7028, 7034, 704, 7046, 7052, 706,
+    7066, 7072, 708, 7084, 7092, 710, 7104, 7110, 712, 7124, 7130, 7136, 714, 7148, 7156, 716,
+    7168, 7174, 718, 7188, 7194, 72, 7206, 7212, 722, 7226, 7232, 724, 7244, 7252, 726, 7264,
+    7270, 7276, 728, 7290, 7296, 730, 7308, 7316, 732, 7328, 7334, 734, 7348, 7354, 736, 7366,
+    7372, 738, 7386, 7392, 74, 7404, 7412, 742, 7424, 7430, 744, 7444, 7450, 7456, 746, 7468,
+    7476, 748, 7488, 7494, 750, 7508, 7514, 752, 7526, 7532, 754, 7546, 7552, 756, 7564, 7572,
+    758, 7584, 7590, 7596, 76, 7610, 7616, 762, 7628, 7636, 764, 7648, 7654, 766, 7668, 7674,
+    768, 7686, 7692, 770, 7706, 7712, 772, 7724, 7732, 774, 7744, 7750, 776, 7764, 7770, 7776,
+    778, 7788, 7796, 78, 7808, 7814, 782, 7828, 7834, 784, 7846, 7852, 786, 7866, 7872, 788,
+    7884, 7892, 790, 7904, 7910, 7916, 792, 7930, 7936, 794, 7948, 7956, 796, 7968, 7974, 798,
+    7988, 7994, 8, 8006, 8012, 802, 8026, 8032, 804, 8044, 8052, 806, 8064, 8070, 808, 8084,
+    8090, 8096, 810, 8108, 8116, 812, 8128, 8134, 814, 8148, 8154, 816, 8166, 8172, 818, 8186,
+    8192, 82, 8204, 8212, 822, 8224, 8230, 8236, 824, 8250, 8256, 826, 8268, 8276, 828, 8288,
+    8294, 830, 8308, 8314, 832, 8326, 8332, 834, 8346, 8352, 836, 8364, 8372, 838, 8384, 8390,
+    84, 8404, 8410, 8416, 842, 8428, 8436, 844, 8448, 8454, 846, 8468, 8474, 848, 8486, 8492,
+    850, 8506, 8512, 852, 8524, 8532, 854, 8544, 8550, 8556, 856, 8570, 8576, 858, 8588, 8596,
+    86, 8608, 8614, 862, 8628, 8634, 864, 8646, 8652, 866, 8666, 8672, 868, 8684, 8692, 870,
+    8704, 8710, 872, 8724, 8730, 8736, 874, 8748, 8756, 876, 8768, 8774, 878, 8788, 8794, 88,
+    8806, 8812, 882, 8826, 8832, 884, 8844, 8852, 886, 8864, 8870, 8876, 888, 8890, 8896, 890,
+    8908, 8916, 892, 8928, 8934, 894, 8948, 8954, 896, 8966, 8972, 898, 8986, 8992, 90, 9004,
+    9012, 902, 9024, 9030, 904, 9044, 9050, 9056, 906, 9068, 9076, 908, 9088, 9094, 910, 9108,
+    9114, 912, 9126, 9132, 914, 9146, 9152, 916, 9164, 9172, 918, 9184, 9190, 9196, 92, 9210,
+    9216, 922, 9228, 9236, 924, 9248, 9254, 926, 9268, 9274, 928, 9286, 9292, 930, 9306, 9312,
+    932, 9324, 9332, 934, 9344, 9350, 936, 9364, 9370, 9376, 938, 9388, 9396, 94, 9408, 9414,
+    942, 9428, 9434, 944, 9446, 9452, 946, 9466, 9472, 948, 9484, 9492, 950, 9504, 9510, 9516,
+    952, 9530, 9536, 954, 9548, 9556, 956, 9568, 9574, 958, 9588, 9594, 96, 9606, 9612, 962,
+    9626, 9632, 964, 9644, 9652, 966, 9664, 9670, 968, 9684, 9690, 9696, 970, 9708, 9716, 972,
+    9728, 9734, 974, 9748, 9754, 976, 9766, 9772, 978, 9786, 9792, 98, 9804, 9812, 982, 9824,
+    9830, 9836, 984, 9850, 9856, 986, 9868, 9876, 988, 9888, 9894, 990, 9908, 9914, 992, 9926,
+    9932, 994, 9946, 9952, 996, 9964, 9972, 998, 9984, 9990, 10, 10004, 10010, 10016, 1002, 10028,
+    10036, 1004, 10048, 10054, 1006, 10068, 10074, 1008, 10086, 10092, 1010, 10106, 10112, 1012, 10124, 10132,
+    1014, 10144, 10150, 10156, 1016, 10170, 10176, 1018, 10188, 10196, 102, 10208, 10214, 1022, 10228, 10234,
+    1024, 10246, 10252, 1026, 10266, 10272, 1028, 10284, 10292, 1030, 10304, 10310, 1032, 10324, 10330, 10336,
+    1034, 10348, 10356, 1036, 10368, 10374, 1038, 10388, 10394, 104, 10406, 10412, 1042, 10426, 10432, 1044,
+    10444, 10452, 1046, 10464, 10470, 10476, 1048, 10490, 10496, 1050, 10508, 10516, 1052, 10528, 10534, 1054,
+    10548, 10554, 1056, 10566, 10572, 1058, 10586, 10592, 106, 10604, 10612, 1062, 10624, 10630, 1064, 10644,
+    10650, 10656, 1066, 10668, 10676, 1068, 10688, 10694, 1070, 10708, 10714, 1072, 10726, 10732, 1074, 10746,
+    10752, 1076, 10764, 10772, 1078, 10784, 10790, 10796, 108, 10810, 10816, 1082, 10828, 10836, 1084, 10848,
+    10854, 1086, 10868, 10874, 1088, 10886, 10892, 1090, 10906, 10912, 1092, 10924, 10932, 1094, 10944, 10950,
+    1096, 10964, 10970, 10976, 1098, 10988, 10996, 110, 11008, 11014, 1102, 11028, 11034, 1104, 11046, 11052,
+    1106, 11066, 11072, 1108, 11084, 11092, 1110, 11104, 11110, 11116, 1112, 11130, 11136, 1114, 11148, 11156,
+    1116, 11168, 11174, 1118, 11188, 11194, 112, 11206, 11212, 1122, 11226, 11232, 1124, 11244, 11252, 1126,
+    11264, 11270, 1128, 11284, 11290, 11296, 1130, 11308, 11316, 1132, 11328, 11334, 1134, 11348, 11354, 1136,
+    11366, 11372, 1138, 11386, 11392, 114, 11404, 11412, 1142, 11424, 11430, 11436, 1144, 11450, 11456, 1146,
+    11468, 11476, 1148, 11488, 11494, 1150, 11508, 11514, 1152, 11526, 11532, 1154, 11546, 11552, 1156, 11564,
+    11572, 1158, 11584, 11590, 116, 11604, 11610, 11616, 1162, 11628, 11636, 1164, 11648, 11654, 1166, 11668,
+    11674, 1168, 11686, 11692, 1170, 11706, 11712, 1172, 11724, 11732, 1174, 11744, 11750, 11756, 1176, 11770,
+    11776, 1178, 11788, 11796, 118, 11808, 11814, 1182, 11828, 11834, 1184, 11846, 11852, 1186, 11866, 11872,
+    1188, 11884, 11892, 1190, 11904, 11910, 1192, 11924, 11930, 11936, 1194, 11948, 11956, 1196, 11968, 11974,
+    1198, 11988, 11994, 12, 12006, 12012, 1202, 12026, 12032, 1204, 12044, 12052, 1206, 12064, 12070, 12076,
+    1208, 12090, 12096, 1210, 12108, 12116, 1212, 12128, 12134, 1214, 12148, 12154, 1216, 12166, 12172, 1218,
+    12186, 12192, 122, 12204, 12212, 1222, 12224, 12230, 1224, 12244, 12250, 12256, 1226, 12268, 12276, 1228,
+    12288, 12294, 1230, 12308, 12314, 1232, 12326, 12332, 1234, 12346, 12352, 1236, 12364, 12372, 1238, 12384,
+    12390, 12396, 124, 12410, 12416, 1242, 12428, 12436, 1244, 12448, 12454, 1246, 12468, 12474, 1248, 12486,
+    12492, 1250, 12506, 12512, 1252, 12524, 12532, 1254, 12544, 12550, 1256, 12564, 12570, 12576, 1258, 12588,
+    12596, 126, 12608, 12614, 1262, 12628, 12634, 1264, 12646, 12652, 1266, 12666, 12672, 1268, 12684, 12692,
+    1270, 12704, 12710, 12716, 1272, 12730, 12736, 1274, 12748, 12756, 1276, 12768, 12774, 1278, 12788, 12794,
+    128, 12806, 12812, 1282, 12826, 12832, 1284, 12844, 12852, 1286, 12864, 12870, 1288, 12884, 12890, 12896,
+    1290, 12908, 12916, 1292, 12928, 12934, 1294, 12948, 12954, 1296, 12966, 12972, 1298, 12986, 12992, 130,
+    13004, 13012, 1302, 13024, 13030, 13036, 1304, 13050, 13056, 1306, 13068, 13076, 1308, 13088, 13094, 1310,
+};
+
+static constexpr std::uint16_t bfloat16_decimal_table[32640] = {
+    0, 3, 4, 6, 8, 10, 110, 12, 14, 16, 18, 3, 23, 25, 27, 29,
+    30, 32, 330, 34, 36, 38, 4, 42, 44, 46, 48, 50, 52, 54, 56, 570,
+    58, 6, 62, 64, 66, 68, 70, 72, 74, 76, 78, 790, 8, 82, 84, 86,
+    88, 90, 92, 94, 96, 98, 10, 1010, 102, 104, 106, 108, 110, 112, 114, 116,
+    118, 12, 122, 1230, 124, 126, 128, 130, 132, 134, 136, 138, 14, 142, 144, 146,
+    1470, 148, 150, 152, 154, 156, 158, 16, 162, 164, 166, 168, 1690, 170, 172, 174,
+    176, 178, 18, 182, 184, 186, 188, 190, 1910, 192, 194, 196, 198, 3, 203, 205,
+    207, 209, 211, 213, 2131, 215, 217, 219, 23, 223, 225, 227, 229, 231, 233, 235,
+    236, 2370, 238, 24, 242, 244, 246, 248, 250, 252, 254, 256, 258, 2590, 26, 262,
+    264, 266, 268, 270, 272, 274, 276, 278, 28, 2810, 282, 284, 286, 288, 290, 292,
+    294, 296, 298, 30, 302, 3030, 304, 306, 308, 310, 312, 314, 316, 318, 32, 322,
+    324, 326, 3270, 328, 330, 332, 334, 336, 338, 34, 342, 344, 346, 348, 3490, 350,
+    352, 354, 356, 358, 36, 362, 364, 366, 368, 370, 3710, 372, 374, 376, 378, 38,
+    382, 384, 386, 388, 390, 392, 3930, 394, 396, 398, 4, 402, 404, 406, 408, 410,
+    412, 414, 416, 4170, 418, 42, 422, 424, 426, 428, 430, 432, 434, 436, 438, 4390,
+    44, 442, 444, 446, 448, 450, 452, 454, 456, 458, 46, 4610, 462, 464, 466, 468,
+    470, 474, 478, 48, 484, 488, 492, 496, 50, 504, 506, 510, 514, 518, 52, 526,
+    528, 532, 536, 54, 544, 548, 552, 554, 56, 562, 566, 570, 574, 576, 58, 584,
+    588, 592, 596, 6, 602, 606, 610, 614, 618, 62, 624, 628, 632, 636, 64, 642,
+    646, 650, 654, 658, 66, 664, 668, 672, 676, 68, 684, 686, 690, 694, 698, 70,
+    706, 708, 712, 716, 72, 724, 728, 732, 734, 74, 742, 746, 750, 754, 756, 76,
+    764, 768, 772, 776, 78, 782, 786, 790, 794, 798, 8, 804, 808, 812, 816, 82,
+    822, 826, 830, 834, 838, 84, 844, 848, 852, 856, 86, 864, 866, 870, 874, 878,
+    88, 886, 888, 892, 896, 90, 904, 908, 912, 914, 92, 922, 926, 930, 934, 936,
+    94, 948, 956, 96, 970, 98, 984, 992, 10, 1006, 1014, 102, 1028, 1036, 104, 1050,
+    106, 1066, 1072, 108, 1088, 1094, 110, 1110, 112, 1124, 1132, 114, 1146, 1154, 116, 1168,
+    1176, 118, 1190, 12, 1204, 1212, 122, 1226, 1234, 124, 1248, 1256, 126, 1272, 128, 1286,
+    1294, 130, 1308, 1316, 132, 1330, 134, 1344, 1352, 136, 1366, 1374, 138, 1388, 1396, 14,
+    1410, 142, 1426, 1432, 144, 1448, 1454, 146, 1470, 148, 1484, 1492, 150, 1506, 1514, 152,
+    1528, 1536, 154, 1550, 156, 1564, 1572, 158, 1586, 1594, 16, 1608, 1616, 162, 1630, 164,
+    1646, 1654, 166, 1668, 1676, 168, 1690, 170, 1704, 1712, 172, 1726, 1734, 174, 1748, 1756,
+    176, 1770, 178, 1786, 1792, 18, 1808, 1814, 182, 1830, 184, 1844, 1852, 186, 1866, 1874,
+    188, 190, 1910, 192, 194, 196, 1968, 198, 3, 203, 2029, 205, 207, 2073, 209, 211,
+    213, 2131, 215, 217, 219, 2191, 23, 223, 225, 2249, 227, 229, 2293, 231, 233, 235,
+    2351, 237, 239, 25, 2411, 243, 245, 247, 2469, 249, 251, 2513, 253, 255, 257, 2573,
+    259, 27, 263, 2631, 265, 267, 269, 2689, 271, 273, 275, 2749, 277, 279, 2793, 29,
+    283, 285, 2851, 287, 289, 291, 2911, 293, 295, 297, 2969, 299, 31, 3013, 303, 305,
+    307, 3071, 309, 311, 313, 3131, 315, 317, 319, 3189, 33, 323, 3233, 325, 327, 329,
+    3293, 331, 333, 335, 3351, 337, 339, 35, 3409, 343, 345, 347, 3469, 349, 351, 3513,
+    353, 355, 357, 3571, 359, 37, 363, 3631, 365, 367, 369, 3689, 371, 373, 3733, 375,
+    376, 38, 382, 384, 388, 390, 394, 396, 4, 402, 406, 408, 412, 414, 418, 42,
+    424, 426, 430, 432, 434, 438, 44, 444, 446, 450, 452, 456, 458, 46, 464, 468,
+    470, 474, 476, 48, 482, 484, 488, 490, 494, 496, 50, 502, 506, 508, 512, 514,
+    518, 52, 524, 526, 528, 532, 534, 538, 54, 544, 546, 550, 552, 556, 558, 56,
+    564, 568, 570, 574, 576, 58, 582, 584, 588, 590, 594, 596, 6, 602, 606, 608,
+    612, 614, 618, 62, 624, 626, 628, 632, 634, 638, 64, 644, 646, 650, 652, 656,
+    658, 66, 664, 668, 670, 672, 676, 68, 682, 684, 688, 690, 694, 696, 70, 702,
+    706, 708, 712, 714, 718, 72, 722, 726, 728, 732, 734, 738, 74, 744, 746, 750,
+    752, 76, 764, 770, 776, 78, 788, 794, 8, 806, 812, 816, 82, 828, 834, 84,
+    846, 852, 86, 864, 870, 876, 88, 888, 894, 90, 906, 912, 916, 92, 928, 934,
+    94, 946, 952, 96, 964, 970, 976, 98, 988, 994, 10, 1006, 1010, 1016, 102, 1028,
+    1034, 104, 1046, 1052, 106, 1064, 1070, 1076, 108, 1088, 1094, 110, 1104, 1110, 1116, 112,
+    1128, 1134, 114, 1146, 1152, 116, 1164, 1170, 1176, 118, 1188, 1194, 12, 1204, 1210, 1216,
+    122, 1228, 1234, 124, 1246, 1252, 126, 1264, 1270, 1276, 128, 1288, 1294, 130, 1304, 1310,
+    1316, 132, 1328, 1334, 134, 1346, 1352, 136, 1364, 1370, 1376, 138, 1388, 1392, 14, 1404,
+    1410, 1416, 142, 1428, 1434, 144, 1446, 1452, 146, 1464, 1470, 1476, 148, 1488, 1492, 150,
+    1504, 152, 1528, 154, 1552, 156, 158, 1586, 16, 1610, 162, 1634, 164, 166, 1670, 168,
+    1692, 170, 172, 1728, 174, 1752, 176, 178, 1786, 18, 1810, 182, 1834, 184, 186, 1870,
+    188, 1892, 190, 192, 1928, 194, 1952, 196, 198, 1986, 3, 2011, 203, 2035, 205, 207,
+    2069, 209, 2093, 211, 213, 2129, 215, 2153, 217, 219, 2187, 23, 2211, 223, 2235, 225,
+    227, 2269, 229, 2293, 231, 233, 2329, 235, 2351, 237, 239, 2387, 25, 2411, 243, 2435,
+    245, 247, 2469, 249, 2493, 251, 253, 2529, 255, 2551, 257, 259, 2587, 27, 2611, 263,
+    2635, 265, 267, 2669, 269, 2693, 271, 273, 2729, 275, 2751, 277, 279, 2787, 29, 2811,
+    283, 2833, 285, 287, 2869, 289, 2893, 291, 293, 2927, 295, 2951, 297, 2975, 299, 31,
+    302, 304, 306, 308, 310, 312, 316, 318, 32, 322, 324, 326, 330, 332, 334, 336,
+    338, 34, 344, 346, 348, 350, 352, 354, 358, 36, 362, 364, 366, 370, 372, 374,
+    376, 378, 38, 384, 386, 388, 390, 392, 394, 398, 4, 402, 404, 406, 410, 412,
+    414, 416, 418, 42, 424, 426, 428, 430, 432, 434, 438, 44, 442, 444, 446, 450,
+    452, 454, 456, 458, 46, 464, 466, 468, 470, 472, 474, 478, 48, 482, 484, 486,
+    490, 492, 494, 496, 498, 50, 504, 506, 508, 510, 512, 514, 518, 52, 522, 524,
+    526, 528, 532, 534, 536, 538, 54, 544, 546, 548, 550, 552, 554, 558, 56, 562,
+    564, 566, 568, 572, 574, 576, 578, 58, 584, 586, 588, 590, 592, 594, 598, 6,
+    602, 606, 612, 616, 62, 626, 630, 634, 64, 644, 648, 654, 66, 662, 668, 672,
+    678, 68, 686, 692, 696, 70, 706, 710, 714, 72, 724, 728, 734, 74, 742, 748,
+    752, 758, 76, 766, 772, 776, 78, 786, 790, 794, 8, 804, 808, 814, 82, 822,
+    828, 832, 836, 84, 846, 852, 856, 86, 866, 870, 874, 88, 884, 888, 894, 90,
+    902, 908, 912, 916, 92, 926, 930, 936, 94, 946, 950, 954, 96, 964, 968, 974,
+    98, 982, 988, 992, 996, 10, 1006, 1010, 1016, 102, 1026, 1030, 1034, 104, 1044, 1048,
+    1054, 106, 1062, 1068, 1072, 1076, 108, 1086, 1090, 1096, 110, 1104, 1110, 1114, 112, 1124,
+    1128, 1134, 114, 1142, 1148, 1152, 1156, 116, 1166, 1170, 1176, 118, 1184, 1190, 1194, 12,
+    1204, 1214, 122, 1232, 124, 1250, 126, 1270, 128, 1288, 130, 1308, 132, 1326, 134, 1344,
+    1354, 136, 1372, 138, 1392, 14, 1410, 142, 1430, 144, 1448, 146, 1468, 148, 1486, 1496,
+    150, 1514, 152, 1532, 154, 1552, 156, 1570, 158, 1590, 16, 1608, 162, 1626, 164, 1646,
+    1656, 166, 1674, 168, 1692, 170, 1712, 172, 1730, 174, 1750, 176, 1768, 178, 1786, 18,
+    1806, 1814, 182, 1834, 184, 1852, 186, 1872, 188, 1890, 190, 1910, 192, 1928, 194, 1946,
+    196, 1966, 1974, 198, 1994, 3, 2013, 203, 2033, 205, 2051, 207, 2069, 209, 2089, 211,
+    2107, 213, 2127, 2135, 215, 2155, 217, 2173, 219, 2193, 23, 2211, 223, 2229, 225, 2249,
+    227, 2267, 229, 2287, 2295, 231, 2315, 233, 2333, 235, 2351, 237, 2371, 239, 2389, 25,
+    2408, 242, 244, 246, 248, 250, 252, 254, 256, 258, 26, 262, 264, 266, 268, 2690,
+    270, 272, 274, 276, 278, 28, 282, 284, 286, 288, 290, 292, 294, 296, 298, 2990,
+    30, 302, 304, 306, 308, 310, 312, 314, 316, 318, 32, 322, 324, 326, 328, 330,
+    3310, 332, 334, 336, 338, 34, 342, 344, 346, 348, 350, 352, 354, 356, 358, 36,
+    362, 3630, 364, 366, 368, 370, 372, 374, 376, 378, 38, 382, 384, 386, 388, 390,
+    392, 394, 3950, 396, 398, 4, 402, 404, 406, 408, 410, 412, 414, 416, 418, 42,
+    422, 424, 4250, 426, 428, 430, 432, 434, 436, 438, 44, 442, 444, 446, 448, 450,
+    452, 454, 456, 4570, 458, 46, 462, 464, 466, 468, 470, 472, 474, 476, 478, 48,
+    482, 486, 490, 492, 496, 50, 504, 508, 512, 516, 52, 522, 526, 530, 534, 538,
+    54, 546, 550, 552, 556, 56, 564, 568, 572, 576, 58, 584, 586, 590, 594, 598,
+    6, 606, 610, 614, 616, 62, 624, 628, 632, 636, 64, 644, 646, 650, 654, 66,
+    662, 666, 670, 674, 678, 68, 684, 688, 692, 696, 70, 704, 708, 710, 714, 72,
+    722, 726, 730, 734, 738, 74, 744, 748, 752, 756, 76, 764, 768, 772, 774, 78,
+    782, 786, 790, 794, 798, 8, 804, 808, 812, 816, 82, 824, 828, 832, 836, 84,
+    842, 846, 850, 854, 858, 86, 866, 868, 872, 876, 88, 884, 888, 892, 896, 90,
+    902, 906, 910, 914, 918, 92, 926, 930, 932, 936, 94, 944, 948, 952, 956, 96,
+    962, 970, 98, 986, 994, 10, 1008, 1016, 102, 1030, 104, 1046, 1054, 106, 1068, 1076,
+    108, 1090, 110, 1106, 1114, 112, 1128, 1136, 114, 1152, 116, 1166, 1174, 118, 1188, 1196,
+    12, 1212, 122, 1226, 1234, 124, 1248, 126, 1264, 1272, 128, 1286, 1294, 130, 1310, 132,
+    1324, 1332, 134, 1346, 1354, 136, 1370, 138, 1384, 1392, 14, 1406, 1414, 142, 1430, 144,
+    1444, 1452, 146, 1468, 1474, 148, 1490, 150, 1504, 1512, 152, 1528, 1534, 154, 1550, 156,
+    1564, 1572, 158, 1588, 1594, 16, 1610, 162, 1626, 1632, 164, 1648, 1656, 166, 1670, 168,
+    1686, 1692, 170, 1708, 1716, 172, 1730, 174, 1746, 1752, 176, 1768, 1776, 178, 1790, 18,
+    1806, 1814, 182, 1828, 1836, 184, 1850, 186, 1866, 1874, 188, 1888, 1896, 190, 1910, 192,
+    1926, 194, 196, 1972, 198, 3, 203, 2033, 205, 207, 209, 2093, 211, 213, 215, 2153,
+    217, 219, 23, 2213, 223, 225, 227, 2273, 229, 231, 233, 2333, 235, 237, 239, 2393,
+    25, 243, 245, 247, 2469, 249, 251, 253, 2529, 255, 257, 259, 2589, 27, 263, 265,
+    2649, 267, 269, 271, 2709, 273, 275, 277, 2769, 279, 29, 283, 2829, 285, 287, 289,
+    2889, 291, 293, 295, 2951, 297, 299, 31, 3011, 303, 305, 307, 3071, 309, 311, 313,
+    3131, 315, 317, 319, 3191, 33, 323, 325, 3251, 327, 329, 331, 3311, 333, 335, 337,
+    3371, 339, 35, 343, 3431, 345, 347, 349, 3491, 351, 353, 355, 3551, 357, 359, 37,
+    3613, 363, 365, 367, 3673, 369, 371, 373, 3733, 375, 377, 379, 3793, 39, 383, 385,
+    386, 388, 392, 394, 398, 4, 404, 406, 410, 412, 416, 418, 42, 424, 428, 430,
+    434, 436, 44, 442, 446, 448, 452, 454, 458, 46, 464, 466, 470, 472, 476, 478,
+    48, 484, 488, 490, 494, 496, 50, 502, 506, 508, 512, 514, 518, 52, 524, 526,
+    530, 532, 536, 54, 542, 544, 548, 550, 554, 556, 56, 562, 566, 568, 572, 574,
+    578, 58, 584, 586, 590, 592, 596, 6, 602, 604, 608, 610, 614, 616, 62, 622,
+    626, 628, 632, 634, 638, 64, 644, 646, 650, 654, 656, 66, 662, 666, 668, 672,
+    674, 678, 68, 684, 686, 690, 692, 696, 698, 70, 704, 708, 710, 714, 716, 72,
+    722, 726, 728, 732, 734, 738, 74, 744, 746, 750, 752, 756, 758, 76, 764, 768,
+    770, 776, 78, 788, 794, 8, 806, 812, 82, 824, 830, 836, 84, 848, 854, 86,
+    866, 872, 88, 884, 890, 896, 90, 908, 914, 92, 926, 932, 94, 944, 950, 956,
+    96, 968, 976, 98, 988, 994, 10, 1006, 1012, 102, 1024, 1030, 1036, 104, 1048, 1054,
+    106, 1066, 1072, 108, 1084, 1090, 1096, 110, 1108, 1114, 112, 1126, 1132, 114, 1144, 1150,
+    1156, 116, 1168, 1174, 118, 1186, 1192, 12, 1204, 1210, 1216, 122, 1228, 1234, 124, 1246,
+    1252, 126, 1264, 1270, 1276, 128, 1288, 1294, 130, 1306, 1312, 132, 1324, 1330, 1336, 134,
+    1348, 1354, 136, 1366, 1372, 138, 1384, 1390, 1396, 14, 1408, 1414, 142, 1426, 1432, 144,
+    1444, 1450, 1456, 146, 1468, 1474, 148, 1486, 1492, 150, 1504, 1510, 1516, 152, 1528, 1534,
+    154, 1552, 156, 158, 1588, 16, 1612, 162, 164, 1650, 166, 1674, 168, 170, 1710, 172,
+    1734, 174, 176, 1770, 178, 1794, 18, 182, 1830, 184, 1854, 186, 188, 1890, 190, 1914,
+    192, 194, 1950, 196, 198, 1986, 3, 2011, 203, 205, 2047, 207, 2071, 209, 211, 2107,
+    213, 2131, 215, 217, 2167, 219, 2191, 23, 223, 2227, 225, 2251, 227, 229, 2289, 231,
+    2313, 233, 235, 2349, 237, 2373, 239, 25, 2409, 243, 2433, 245, 247, 2469, 249, 2493,
+    251, 253, 2529, 255, 2553, 257, 259, 2589, 27, 2613, 263, 265, 2649, 267, 2673, 269,
+    271, 2709, 273, 2733, 275, 277, 2769, 279, 2793, 29, 283, 2829, 285, 2853, 287, 289,
+    2889, 291, 2913, 293, 295, 2951, 297, 2975, 299, 31, 3011, 303, 3035, 305, 307, 3071,
+    308, 310, 312, 316, 318, 32, 322, 326, 328, 330, 332, 334, 338, 34, 342, 344,
+    346, 350, 352, 354, 356, 358, 36, 364, 366, 368, 370, 374, 376, 378, 38, 382,
+    386, 388, 390, 392, 394, 398, 4, 402, 404, 406, 410, 412, 414, 416, 42, 422,
+    424, 426, 428, 430, 434, 436, 438, 44, 442, 446, 448, 450, 452, 456, 458, 46,
+    462, 464, 468, 470, 472, 474, 476, 48, 482, 484, 486, 488, 492, 494, 496, 498,
+    50, 504, 506, 508, 510, 512, 516, 518, 52, 522, 524, 528, 530, 532, 534, 536,
+    54, 542, 544, 546, 548, 552, 554, 556, 558, 56, 564, 566, 568, 570, 572, 576,
+    578, 58, 582, 586, 588, 590, 592, 594, 598, 6, 602, 604, 606, 610, 612, 614,
+    616, 62, 626, 630, 636, 64, 646, 650, 654, 66, 664, 670, 674, 68, 684, 688,
+    694, 70, 702, 708, 712, 718, 72, 728, 732, 736, 74, 746, 752, 756, 76, 766,
+    770, 776, 78, 784, 790, 794, 8, 804, 808, 814, 82, 824, 828, 832, 84, 842,
+    848, 852, 858, 86, 866, 872, 876, 88, 886, 890, 896, 90, 906, 910, 914, 92,
+    924, 930, 934, 94, 944, 948, 954, 96, 962, 968, 972, 978, 98, 988, 992, 996,
+    10, 1006, 1012, 1016, 102, 1026, 1030, 1036, 104, 1044, 1050, 1054, 106, 1064, 1068, 1074,
+    108, 1084, 1088, 1092, 110, 1102, 1108, 1112, 1118, 112, 1126, 1132, 1136, 114, 1146, 1150,
+    1156, 116, 1166, 1170, 1174, 118, 1184, 1190, 1194, 12, 1204, 1208, 1214, 122, 1222, 1228,
+    1232, 124, 1252, 126, 1272, 128, 1290, 130, 1310, 132, 1328, 134, 1348, 136, 1368, 138,
+    1386, 14, 1406, 142, 1426, 1434, 144, 1454, 146, 1474, 148, 1492, 150, 1512, 152, 1532,
+    154, 1550, 156, 1570, 158, 1588, 16, 1608, 162, 1628, 164, 1646, 166, 1666, 168, 1686,
+    1694, 170, 1714, 172, 1734, 174, 1752, 176, 1772, 178, 1792, 18, 1810, 182, 1830, 184,
+    1848, 186, 1868, 188, 1888, 190, 1906, 192, 1926, 194, 1946, 1954, 196, 1974, 198, 1994,
+    3, 2013, 203, 2033, 205, 2053, 207, 2071, 209, 2091, 211, 2109, 213, 2129, 215, 2149,
+    217, 2167, 219, 2187, 23, 2207, 2215, 223, 2235, 225, 2255, 227, 2273, 229, 2293, 231,
+    2313, 233, 2331, 235, 2351, 237, 2369, 239, 2389, 25, 2409, 243, 2427, 245, 2447, 247,
+    2466, 248, 250, 252, 254, 256, 258, 26, 262, 264, 266, 268, 270, 272, 274, 276,
+    278, 28, 282, 284, 286, 2870, 288, 290, 292, 294, 296, 298, 30, 302, 304, 306,
+    308, 310, 312, 314, 316, 318, 32, 322, 324, 326, 328, 330, 332, 334, 336, 338,
+    3390, 34, 342, 344, 346, 348, 350, 352, 354, 356, 358, 36, 362, 364, 366, 368,
+    370, 372, 374, 376, 378, 38, 382, 384, 386, 388, 390, 3910, 392, 394, 396, 398,
+    4, 402, 404, 406, 408, 410, 412, 414, 416, 418, 42, 422, 424, 426, 428, 430,
+    432, 434, 436, 438, 44, 442, 4430, 444, 446, 448, 450, 452, 454, 456, 458, 46,
+    462, 464, 466, 468, 470, 472, 474, 476, 478, 48, 482, 484, 486, 488, 490, 492,
+    494, 496, 50, 504, 508, 512, 516, 52, 524, 528, 532, 536, 54, 544, 546, 550,
+    554, 56, 562, 566, 570, 574, 578, 58, 586, 590, 594, 598, 6, 604, 608, 612,
+    616, 62, 624, 628, 632, 636, 64, 644, 648, 650, 654, 66, 662, 666, 670, 674,
+    678, 68, 686, 690, 694, 698, 70, 704, 708, 712, 716, 72, 724, 728, 732, 736,
+    74, 744, 748, 752, 754, 76, 762, 766, 770, 774, 78, 782, 786, 790, 794, 798,
+    8, 806, 808, 812, 816, 82, 824, 828, 832, 836, 84, 844, 848, 852, 856, 86,
+    862, 866, 870, 874, 88, 882, 886, 890, 894, 898, 90, 906, 910, 912, 916, 92,
+    924, 928, 932, 936, 94, 944, 948, 952, 956, 96, 962, 966, 970, 974, 98, 982,
+    986, 994, 10, 1010, 102, 1024, 1032, 104, 1048, 1056, 106, 1070, 108, 1086, 1094, 110,
+    1110, 112, 1124, 1132, 114, 1148, 1156, 116, 1170, 118, 1186, 1194, 12, 1210, 122, 1224,
+    1232, 124, 1248, 1256, 126, 1272, 128, 1286, 1294, 130, 1310, 132, 1326, 1332, 134, 1348,
+    1356, 136, 1372, 138, 1386, 1394, 14, 1410, 142, 1426, 1432, 144, 1448, 1456, 146, 1472,
+    148, 1486, 1494, 150, 1510, 152, 1526, 1534, 154, 1548, 156, 1564, 1572, 158, 1586, 1594,
+    16, 1610, 162, 1626, 1634, 164, 1648, 166, 1664, 1672, 168, 1688, 1694, 170, 1710, 172,
+    1726, 1734, 174, 1748, 176, 1764, 1772, 178, 1788, 1794, 18, 1810, 182, 1826, 1834, 184,
+    1848, 186, 1864, 1872, 188, 1888, 1896, 190, 1910, 192, 1926, 1934, 194, 1950, 196, 1964,
+    1972, 198, 3, 203, 205, 2051, 207, 209, 211, 2111, 213, 215, 217, 219, 2189, 23,
+    223, 225, 2251, 227, 229, 231, 2313, 233, 235, 237, 239, 2389, 25, 243, 245, 2451,
+    247, 249, 251, 2513, 253, 255, 257, 259, 2589, 27, 263, 265, 2651, 267, 269, 271,
+    2713, 273, 275, 277, 279, 2789, 29, 283, 285, 2851, 287, 289, 291, 2913, 293, 295,
+    297, 299, 2991, 31, 303, 305, 3051, 307, 309, 311, 313, 3129, 315, 317, 319, 3191,
+    33, 323, 325, 3251, 327, 329, 331, 333, 3329, 335, 337, 339, 3391, 35, 343, 345,
+    3453, 347, 349, 351, 353, 3529, 355, 357, 359, 3591, 37, 363, 365, 3653, 367, 369,
+    371, 373, 3729, 375, 377, 379, 3791, 39, 383, 385, 3853, 387, 389, 391, 393, 3929,
+    394, 398, 4, 404, 406, 410, 412, 416, 42, 422, 426, 428, 432, 434, 438, 44,
+    444, 446, 450, 452, 456, 46, 462, 466, 468, 472, 474, 478, 48, 484, 486, 490,
+    494, 496, 50, 502, 506, 508, 512, 514, 518, 52, 524, 526, 530, 534, 536, 54,
+    542, 546, 548, 552, 554, 558, 56, 564, 566, 570, 574, 576, 58, 582, 586, 588,
+    592, 594, 598, 6, 604, 608, 610, 614, 616, 62, 622, 626, 628, 632, 634, 638,
+    64, 644, 648, 650, 654, 656, 66, 662, 666, 668, 672, 674, 678, 68, 684, 688,
+    690, 694, 696, 70, 702, 706, 708, 712, 714, 718, 72, 724, 728, 730, 734, 736,
+    74, 742, 746, 748, 752, 754, 758, 76, 764, 768, 770, 774, 776, 78, 782, 786,
+    788, 796, 8, 808, 814, 82, 826, 832, 84, 844, 850, 856, 86, 868, 876, 88,
+    888, 894, 90, 906, 912, 92, 924, 930, 936, 94, 950, 956, 96, 968, 974, 98,
+    986, 992, 10, 1004, 1010, 1016, 102, 1030, 1036, 104, 1048, 1054, 106, 1066, 1072, 108,
+    1084, 1090, 110, 1104, 1110, 1116, 112, 1128, 1134, 114, 1146, 1152, 116, 1164, 1170, 118,
+    1184, 1190, 1196, 12, 1208, 1214, 122, 1226, 1232, 124, 1244, 1252, 126, 1264, 1270, 1276,
+    128, 1288, 1294, 130, 1306, 1312, 132, 1326, 1332, 134, 1344, 1350, 1356, 136, 1368, 1374,
+    138, 1386, 1392, 14, 1406, 1412, 142, 1424, 1430, 1436, 144, 1448, 1454, 146, 1466, 1472,
+    148, 1486, 1492, 150, 1504, 1510, 1516, 152, 1528, 1534, 154, 1546, 1554, 156, 1566, 1572,
+    158, 1590, 16, 162, 1628, 164, 1652, 166, 168, 1688, 170, 1714, 172, 174, 1750, 176,
+    178, 1788, 18, 1812, 182, 184, 1848, 186, 1874, 188, 190, 1910, 192, 194, 1948, 196,
+    1972, 198, 3, 2011, 203, 2035, 205, 207, 2071, 209, 211, 2109, 213, 2133, 215, 217,
+    2171, 219, 23, 2207, 223, 2231, 225, 227, 2269, 229, 2293, 231, 233, 2331, 235, 237,
+    2367, 239, 2393, 25, 243, 2429, 245, 2453, 247, 249, 2491, 251, 253, 2527, 255, 2553,
+    257, 259, 2589, 27, 2615, 263, 265, 2651, 267, 269, 2689, 271, 2713, 273, 275, 2749,
+    277, 2775, 279, 29, 2811, 283, 285, 2849, 287, 2873, 289, 291, 2909, 293, 2935, 295,
+    297, 2971, 299, 31, 3009, 303, 3033, 305, 307, 3071, 309, 3095, 311, 313, 3131, 315,
+    316, 318, 32, 322, 326, 328, 330, 332, 336, 338, 34, 342, 346, 348, 350, 352,
+    354, 358, 36, 362, 364, 368, 370, 372, 374, 378, 38, 382, 384, 388, 390, 392,
+    394, 396, 4, 402, 404, 406, 410, 412, 414, 416, 42, 422, 424, 426, 428, 432,
+    434, 436, 44, 442, 444, 446, 448, 452, 454, 456, 458, 46, 464, 466, 468, 470,
+    474, 476, 478, 48, 484, 486, 488, 490, 494, 496, 498, 50, 502, 506, 508, 510,
+    512, 516, 518, 52, 522, 526, 528, 530, 532, 534, 538, 54, 542, 544, 548, 550,
+    552, 554, 558, 56, 562, 564, 566, 570, 572, 574, 576, 58, 582, 584, 586, 590,
+    592, 594, 596, 6, 602, 604, 606, 608, 612, 614, 616, 618, 62, 624, 626, 628,
+    632, 636, 64, 646, 650, 656, 66, 666, 670, 676, 68, 686, 690, 696, 70, 706,
+    710, 714, 72, 724, 730, 734, 74, 744, 750, 754, 76, 764, 770, 774, 78, 784,
+    788, 794, 8, 804, 808, 814, 82, 824, 828, 834, 84, 844, 848, 852, 86, 862,
+    868, 872, 88, 882, 888, 892, 898, 90, 908, 912, 918, 92, 926, 932, 936, 94,
+    946, 952, 956, 96, 966, 972, 976, 98, 986, 992, 996, 10, 1006, 1010, 1016, 102,
+    1026, 1030, 1036, 104, 1046, 1050, 1056, 106, 1064, 1070, 1074, 108, 1084, 1090, 1094, 110,
+    1104, 1110, 1114, 112, 1124, 1130, 1134, 114, 1144, 1148, 1154, 116, 1164, 1168, 1174, 118,
+    1184, 1188, 1194, 12, 1204, 1208, 1212, 122, 1222, 1228, 1232, 1238, 124, 1248, 1252, 1258,
+    126, 1272, 128, 1292, 130, 1312, 132, 1332, 134, 1350, 136, 1370, 138, 1390, 14, 1410,
+    142, 1430, 144, 1450, 146, 1470, 148, 1488, 150, 1508, 152, 1528, 154, 1548, 156, 1568,
+    158, 1588, 16, 1608, 162, 1628, 164, 1646, 166, 1666, 168, 1686, 170, 1706, 172, 1726,
+    174, 1746, 176, 1766, 1774, 178, 1794, 18, 1814, 182, 1834, 184, 1854, 186, 1874, 188,
+    1894, 190, 1912, 192, 1932, 194, 1952, 196, 1972, 198, 1992, 3, 2013, 203, 2033, 205,
+    2053, 207, 2071, 209, 2091, 211, 2111, 213, 2131, 215, 2151, 217, 2171, 219, 2191, 23,
+    2209, 223, 2229, 225, 2249, 227, 2269, 229, 2289, 231, 2309, 233, 2329, 235, 2347, 237,
+    2367, 239, 2387, 25, 2407, 243, 2427, 245, 2447, 247, 2467, 2477, 249, 2495, 251, 2515,
+    252, 254, 256, 258, 26, 262, 264, 266, 268, 270, 272, 274, 276, 278, 28, 282,
+    284, 286, 288, 290, 292, 294, 296, 298, 30, 302, 304, 306, 308, 310, 312, 314,
+    316, 318, 32, 322, 324, 326, 328, 330, 332, 334, 336, 338, 34, 342, 344, 346,
+    348, 350, 352, 354, 3550, 356, 358, 36, 362, 364, 366, 368, 370, 372, 374, 376,
+    378, 38, 382, 384, 386, 388, 390, 392, 394, 396, 398, 4, 402, 404, 406, 408,
+    410, 412, 414, 416, 418, 42, 422, 424, 426, 428, 430, 432, 434, 436, 438, 44,
+    442, 444, 446, 448, 450, 452, 454, 456, 458, 46, 462, 464, 466, 468, 470, 472,
+    474, 476, 478, 48, 482, 484, 486, 488, 490, 492, 494, 4950, 496, 498, 50, 502,
+    504, 508, 512, 516, 52, 524, 528, 532, 536, 54, 544, 548, 552, 556, 56, 564,
+    568, 572, 576, 58, 584, 588, 592, 596, 6, 604, 608, 612, 616, 62, 624, 628,
+    632, 636, 64, 642, 646, 650, 654, 66, 662, 666, 670, 674, 68, 682, 686, 690,
+    694, 70, 702, 706, 710, 714, 718, 72, 726, 730, 734, 738, 74, 746, 750, 754,
+    758, 76, 766, 770, 774, 778, 78, 784, 788, 792, 796, 8, 804, 808, 812, 816,
+    82, 824, 828, 832, 836, 84, 844, 848, 852, 856, 86, 864, 868, 872, 876, 88,
+    884, 888, 892, 896, 90, 904, 908, 912, 916, 92, 922, 926, 930, 934, 94, 942,
+    946, 950, 954, 96, 962, 966, 970, 974, 98, 982, 986, 990, 994, 998, 10, 1006,
+    1010, 102, 1026, 1034, 104, 1050, 106, 1064, 1072, 108, 1088, 110, 1104, 1112, 112, 1128,
+    1136, 114, 1152, 116, 1168, 1176, 118, 1192, 12, 1206, 1214, 122, 1230, 124, 1246, 1254,
+    126, 1270, 128, 1286, 1294, 130, 1310, 132, 1326, 1334, 134, 1348, 136, 1364, 1372, 138,
+    1388, 14, 1404, 1412, 142, 1428, 1436, 144, 1452, 146, 1468, 1476, 148, 1490, 150, 1506,
+    1514, 152, 1530, 154, 1546, 1554, 156, 1570, 158, 1586, 1594, 16, 1610, 162, 1626, 1632,
+    164, 1648, 166, 1664, 1672, 168, 1688, 1696, 170, 1712, 172, 1728, 1736, 174, 1752, 176,
+    1768, 1774, 178, 1790, 18, 1806, 1814, 182, 1830, 184, 1846, 1854, 186, 1870, 188, 1886,
+    1894, 190, 1910, 192, 1924, 1932, 194, 1948, 196, 1964, 1972, 198, 1988, 1996, 3, 2013,
+    202, 204, 2052, 206, 208, 210, 212, 2130, 214, 216, 218, 22, 2208, 222, 224, 226,
+    2272, 228, 230, 232, 234, 2350, 236, 238, 24, 242, 2430, 244, 246, 248, 250, 2508,
+    252, 254, 256, 2572, 258, 26, 262, 264, 2650, 266, 268, 270, 272, 2730, 274, 276,
+    278, 28, 2808, 282, 284, 286, 2872, 288, 290, 292, 294, 2950, 296, 298, 30, 302,
+    3030, 304, 306, 308, 310, 3108, 312, 314, 316, 3172, 318, 32, 322, 324, 3250, 326,
+    328, 330, 332, 3328, 334, 336, 338, 3392, 34, 342, 344, 346, 3470, 348, 350, 352,
+    354, 3550, 356, 358, 36, 362, 3628, 364, 366, 368, 3692, 370, 372, 374, 376, 3770,
+    378, 38, 382, 384, 3850, 386, 388, 390, 392, 3928, 394, 396, 398, 3992, 4, 402,
+    404, 408, 410, 414, 416, 42, 422, 426, 430, 432, 436, 44, 442, 444, 448, 452,
+    454, 458, 46, 464, 468, 470, 474, 476, 48, 482, 486, 490, 492, 496, 50, 502,
+    504, 508, 512, 514, 518, 52, 524, 526, 530, 534, 536, 54, 542, 546, 550, 552,
+    556, 56, 562, 564, 568, 572, 574, 578, 58, 584, 586, 590, 594, 596, 6, 602,
+    606, 610, 612, 616, 62, 622, 624, 628, 632, 634, 638, 64, 644, 646, 650, 654,
+    656, 66, 662, 666, 668, 672, 676, 678, 68, 684, 688, 692, 694, 698, 70, 704,
+    706, 710, 714, 716, 72, 722, 726, 728, 732, 736, 738, 74, 744, 748, 750, 754,
+    758, 76, 764, 766, 770, 774, 776, 78, 782, 786, 788, 792, 796, 798, 8, 804,
+    808, 814, 82, 826, 834, 84, 846, 852, 86, 864, 870, 88, 884, 890, 896, 90,
+    908, 916, 92, 928, 934, 94, 946, 952, 96, 966, 972, 98, 984, 990, 10, 1004,
+    1010, 1016, 102, 1028, 1034, 104, 1048, 1054, 106, 1066, 1072, 108, 1086, 1092, 110, 1104,
+    1110, 112, 1124, 1130, 1136, 114, 1148, 1154, 116, 1168, 1174, 118, 1186, 1192, 12, 1206,
+    1212, 122, 1224, 1230, 124, 1244, 1250, 1256, 126, 1268, 1274, 128, 1288, 1294, 130, 1306,
+    1312, 132, 1326, 1332, 134, 1344, 1350, 1356, 136, 1370, 1376, 138, 1388, 1394, 14, 1408,
+    1414, 142, 1426, 1432, 144, 1446, 1452, 146, 1464, 1470, 1476, 148, 1490, 1496, 150, 1508,
+    1514, 152, 1528, 1534, 154, 1546, 1552, 156, 1566, 1572, 158, 1584, 1590, 1596, 16, 1610,
+    162, 1628, 164, 1654, 166, 168, 1692, 170, 172, 1730, 174, 176, 1768, 178, 1792, 18,
+    182, 1830, 184, 186, 1868, 188, 1894, 190, 192, 1932, 194, 196, 1968, 198, 3, 2007,
+    203, 2033, 205, 207, 2071, 209, 211, 2109, 213, 2135, 215, 217, 2171, 219, 23, 2209,
+    223, 225, 2247, 227, 2273, 229, 231, 2311, 233, 235, 2349, 237, 2373, 239, 25, 2411,
+    243, 245, 2449, 247, 249, 2487, 251, 2513, 253, 255, 2551, 257, 259, 2589, 27, 2613,
+    263, 265, 2651, 267, 269, 2689, 271, 2715, 273, 275, 2753, 277, 279, 2791, 29, 283,
+    2829, 285, 2853, 287, 289, 2891, 291, 293, 2929, 295, 2955, 297, 299, 2993, 31, 303,
+    3031, 305, 307, 3069, 309, 3093, 311, 313, 3131, 315, 317, 3169, 319, 3195, 33, 323,
+    324, 326, 328, 330, 334, 336, 338, 34, 344, 346, 348, 350, 354, 356, 358, 36,
+    364, 366, 368, 372, 374, 376, 378, 38, 384, 386, 388, 392, 394, 396, 4, 402,
+    404, 406, 408, 412, 414, 416, 42, 422, 424, 426, 430, 432, 434, 436, 44, 442,
+    444, 446, 450, 452, 454, 456, 46, 462, 464, 468, 470, 472, 474, 478, 48, 482,
+    484, 488, 490, 492, 494, 498, 50, 502, 504, 508, 510, 512, 514, 518, 52, 522,
+    526, 528, 530, 532, 536, 538, 54, 542, 546, 548, 550, 552, 556, 558, 56, 562,
+    566, 568, 570, 574, 576, 578, 58, 584, 586, 588, 590, 594, 596, 598, 6, 604,
+    606, 608, 610, 614, 616, 618, 62, 624, 626, 628, 632, 634, 636, 638, 64, 644,
+    646, 652, 656, 66, 666, 672, 676, 68, 686, 692, 696, 70, 706, 712, 716, 72,
+    728, 732, 738, 74, 748, 752, 758, 76, 768, 772, 78, 782, 788, 792, 8, 802,
+    808, 812, 82, 822, 828, 834, 84, 844, 848, 854, 86, 864, 868, 874, 88, 884,
+    888, 894, 90, 904, 908, 914, 92, 924, 928, 934, 94, 944, 950, 954, 96, 964,
+    970, 974, 98, 984, 990, 994, 10, 1004, 1010, 1014, 102, 1024, 1030, 1034, 104, 1046,
+    1050, 1056, 106, 1066, 1070, 1076, 108, 1086, 1090, 1096, 110, 1106, 1110, 1116, 112, 1126,
+    1130, 1136, 114, 1146, 1152, 1156, 116, 1166, 1172, 1176, 118, 1186, 1192, 1196, 12, 1206,
+    1212, 1216, 122, 1226, 1232, 1236, 124, 1248, 1252, 1258, 126, 1268, 1272, 1278, 128, 1288,
+    1292, 130, 1312, 132, 1332, 134, 1354, 136, 1374, 138, 1394, 14, 1414, 142, 1434, 144,
+    1454, 146, 1474, 148, 1494, 150, 1514, 152, 1534, 154, 156, 1566, 158, 1586, 16, 1606,
+    162, 1626, 164, 1646, 166, 1666, 168, 1686, 170, 1706, 172, 1726, 174, 1746, 176, 1768,
+    178, 1788, 18, 1808, 182, 1828, 184, 1848, 186, 1868, 188, 1888, 190, 1908, 192, 1928,
+    194, 1948, 196, 1968, 198, 1990, 3, 2011, 203, 2031, 205, 2051, 207, 2071, 209, 2091,
+    211, 2111, 213, 2131, 215, 2151, 217, 2171, 219, 2193, 23, 2213, 223, 2233, 225, 2253,
+    227, 2273, 229, 2293, 231, 2313, 233, 2333, 235, 2353, 237, 2373, 239, 2395, 25, 2415,
+    243, 2435, 245, 2455, 247, 2475, 249, 2495, 251, 2515, 253, 2535, 255, 2555, 257, 2575,
+    258, 26, 262, 264, 266, 268, 270, 272, 274, 276, 278, 28, 282, 284, 286, 288,
+    290, 292, 294, 296, 298, 30, 302, 304, 306, 308, 312, 314, 316, 318, 32, 322,
+    324, 326, 328, 330, 332, 334, 336, 338, 34, 342, 344, 346, 348, 350, 352, 354,
+    356, 358, 36, 362, 364, 366, 368, 370, 372, 374, 376, 378, 38, 382, 384, 386,
+    388, 390, 392, 394, 396, 398, 4, 402, 404, 406, 408, 410, 412, 414, 416, 418,
+    42, 422, 424, 426, 428, 430, 432, 434, 436, 438, 44, 442, 444, 446, 448, 450,
+    452, 454, 456, 458, 46, 462, 464, 466, 468, 470, 472, 474, 476, 478, 48, 482,
+    484, 486, 488, 490, 492, 494, 496, 498, 50, 502, 504, 506, 508, 510, 512, 514,
+    516, 52, 526, 530, 534, 538, 54, 546, 550, 554, 558, 56, 566, 570, 574, 578,
+    58, 586, 590, 594, 598, 6, 606, 610, 614, 618, 62, 626, 630, 634, 64, 642,
+    646, 650, 654, 66, 662, 666, 670, 674, 68, 682, 686, 690, 694, 70, 702, 706,
+    710, 714, 72, 722, 728, 732, 736, 74, 744, 748, 752, 756, 76, 764, 768, 772,
+    776, 78, 784, 788, 792, 796, 8, 804, 808, 812, 816, 82, 824, 828, 832, 836,
+    84, 844, 848, 852, 856, 86, 864, 868, 872, 876, 88, 884, 888, 892, 896, 90,
+    904, 908, 912, 916, 92, 924, 928, 934, 938, 94, 946, 950, 954, 958, 96, 966,
+    970, 974, 978, 98, 986, 990, 994, 998, 10, 1006, 1010, 1014, 1018, 102, 1026, 1030,
+    1034, 104, 1050, 106, 1066, 1074, 108, 1090, 110, 1106, 1114, 112, 1130, 114, 1148, 1156,
+    116, 1172, 118, 1188, 1196, 12, 1212, 122, 1228, 1236, 124, 1252, 126, 1268, 128, 1284,
+    1292, 130, 1308, 132, 1324, 1332, 134, 1350, 136, 1366, 1374, 138, 1390, 14, 1406, 1414,
+    142, 1430, 144, 1446, 1454, 146, 1470, 148, 1486, 1494, 150, 1510, 152, 1526, 1534, 154,
+    1550, 156, 1568, 1576, 158, 1592, 16, 1608, 1616, 162, 1632, 164, 1648, 166, 1664, 1672,
+    168, 1688, 170, 1704, 1712, 172, 1728, 174, 1744, 1752, 176, 1770, 178, 1786, 1794, 18,
+    1810, 182, 1826, 1834, 184, 1850, 186, 1866, 1874, 188, 1890, 190, 1906, 1914, 192, 1930,
+    194, 1946, 1954, 196, 1972, 198, 1988, 1996, 3, 2013, 203, 2029, 2037, 205, 2053, 207,
+    2068, 208, 210, 212, 214, 2148, 216, 218, 22, 222, 2230, 224, 226, 228, 230, 2310,
+    232, 234, 236, 238, 2392, 24, 242, 244, 246, 2472, 248, 250, 252, 254, 256, 2568,
+    258, 26, 262, 264, 2650, 266, 268, 270, 272, 2730, 274, 276, 278, 28, 2812, 282,
+    284, 286, 288, 2892, 290, 292, 294, 296, 298, 2988, 30, 302, 304, 306, 3070, 308,
+    310, 312, 314, 3150, 316, 318, 32, 322, 3232, 324, 326, 328, 330, 332, 3328, 334,
+    336, 338, 34, 3408, 342, 344, 346, 348, 3490, 350, 352, 354, 356, 3570, 358, 36,
+    362, 364, 3652, 366, 368, 370, 372, 374, 3748, 376, 378, 38, 382, 3828, 384, 386,
+    388, 390, 3910, 392, 394, 396, 398, 3990, 4, 402, 404, 406, 4072, 408, 410, 412,
+    414, 416, 42, 424, 426, 430, 432, 436, 44, 442, 446, 450, 452, 456, 46, 462,
+    466, 468, 472, 474, 478, 48, 484, 488, 492, 494, 498, 50, 504, 508, 510, 514,
+    516, 52, 524, 526, 530, 534, 536, 54, 542, 546, 550, 552, 556, 56, 562, 566,
+    568, 572, 576, 578, 58, 584, 588, 592, 594, 598, 6, 604, 608, 610, 614, 618,
+    62, 624, 626, 630, 634, 636, 64, 644, 646, 650, 652, 656, 66, 662, 666, 668,
+    672, 676, 68, 682, 686, 688, 692, 694, 698, 70, 704, 708, 710, 714, 718, 72,
+    724, 728, 730, 734, 736, 74, 744, 746, 750, 752, 756, 76, 762, 766, 770, 772,
+    776, 78, 782, 786, 788, 792, 794, 798, 8, 804, 808, 812, 814, 818, 82, 824,
+    828, 834, 84, 846, 854, 86, 866, 872, 88, 886, 892, 90, 904, 912, 92, 924,
+    930, 94, 944, 950, 956, 96, 970, 976, 98, 988, 996, 10, 1008, 1014, 102, 1028,
+    1034, 104, 1046, 1054, 106, 1066, 1072, 108, 1086, 1092, 110, 1106, 1112, 112, 1124, 1130,
+    114, 1144, 1150, 1156, 116, 1170, 1176, 118, 1190, 1196, 12, 1208, 1214, 122, 1228, 1234,
+    124, 1248, 1254, 126, 1266, 1274, 128, 1286, 1292, 130, 1306, 1312, 132, 1324, 1332, 134,
+    1344, 1350, 136, 1364, 1370, 1376, 138, 1390, 1396, 14, 1408, 1416, 142, 1428, 1434, 144,
+    1448, 1454, 146, 1466, 1474, 148, 1486, 1492, 150, 1506, 1512, 152, 1526, 1532, 154, 1544,
+    1550, 156, 1564, 1570, 158, 1584, 1590, 1596, 16, 1610, 1616, 162, 1628, 1634, 164, 1648,
+    166, 1668, 168, 1694, 170, 172, 1732, 174, 176, 1770, 178, 18, 1810, 182, 184, 1848,
+    186, 188, 1888, 190, 1912, 192, 194, 1952, 196, 198, 1990, 3, 203, 2031, 205, 207,
+    2069, 209, 211, 2107, 213, 2133, 215, 217, 2173, 219, 23, 2211, 223, 225, 2249, 227,
+    229, 2289, 231, 2315, 233, 235, 2353, 237, 239, 2393, 25, 243, 2431, 245, 247, 2469,
+    249, 251, 2509, 253, 2535, 255, 257, 2573, 259, 27, 2611, 263, 265, 2651, 267, 269,
+    2689, 271, 273, 2729, 275, 2753, 277, 279, 2793, 29, 283, 2831, 285, 287, 2871, 289,
+    291, 2909, 293, 295, 2947, 297, 2973, 299, 31, 3013, 303, 305, 3051, 307, 309, 3091,
+    311, 313, 3129, 315, 317, 3167, 319, 3193, 33, 323, 3233, 325, 327, 3271, 329, 331,
+    332, 334, 336, 338, 34, 344, 346, 348, 352, 354, 356, 36, 362, 364, 368, 370,
+    372, 374, 378, 38, 382, 386, 388, 390, 392, 396, 398, 4, 404, 406, 408, 412,
+    414, 416, 42, 422, 424, 426, 430, 432, 434, 436, 44, 442, 444, 448, 450, 452,
+    454, 458, 46, 462, 466, 468, 470, 474, 476, 478, 48, 484, 486, 488, 492, 494,
+    496, 50, 502, 504, 506, 510, 512, 514, 516, 52, 522, 524, 528, 530, 532, 536,
+    538, 54, 542, 546, 548, 550, 554, 556, 558, 56, 564, 566, 568, 572, 574, 576,
+    58, 582, 584, 586, 590, 592, 594, 598, 6, 602, 604, 608, 610, 612, 616, 618,
+    62, 622, 626, 628, 630, 634, 636, 638, 64, 644, 646, 648, 652, 654, 656, 66,
+    662, 666, 672, 678, 68, 688, 692, 70, 704, 708, 714, 72, 724, 728, 734, 74,
+    744, 750, 754, 76, 766, 770, 776, 78, 786, 790, 796, 8, 806, 812, 816, 82,
+    828, 832, 84, 842, 848, 854, 86, 864, 868, 874, 88, 884, 890, 894, 90, 904,
+    910, 916, 92, 926, 930, 936, 94, 946, 952, 956, 96, 966, 972, 978, 98, 988,
+    992, 10, 1002, 1008, 1014, 102, 1024, 1028, 1034, 104, 1044, 1050, 1054, 106, 1064, 1070,
+    1076, 108, 1086, 1090, 1096, 110, 1106, 1112, 1116, 112, 1128, 1132, 1138, 114, 1148, 1152,
+    116, 1164, 1168, 1174, 118, 1184, 1190, 1194, 12, 1204, 1210, 1214, 122, 1226, 1230, 1236,
+    124, 1246, 1252, 1256, 126, 1266, 1272, 1276, 128, 1288, 1292, 130, 1302, 1308, 1314, 132,
+    1324, 1334, 134, 1354, 136, 138, 1386, 14, 1406, 142, 1426, 144, 1448, 146, 1468, 148,
+    1488, 150, 1510, 152, 1530, 154, 1550, 156, 1572, 158, 1592, 16, 1614, 162, 1634, 164,
+    1654, 166, 168, 1686, 170, 1706, 172, 1726, 174, 1748, 176, 1768, 178, 1788, 18, 1810,
+    182, 1830, 184, 1850, 186, 1872, 188, 1892, 190, 1912, 192, 1934, 194, 1954, 196, 198,
+    1986, 3, 2007, 203, 2027, 205, 2049, 207, 2069, 209, 2089, 211, 2111, 213, 2131, 215,
+    2151, 217, 2173, 219, 2193, 23, 2213, 223, 2235, 225, 2255, 227, 2275, 229, 231, 2307,
+    233, 2327, 235, 2349, 237, 2369, 239, 2389, 25, 2411, 243, 2431, 245, 2451, 247, 2473,
+    249, 2493, 251, 2513, 253, 2535, 255, 2555, 257, 2575, 259, 27, 2607, 263, 2627, 265,
+    2646, 266, 268, 270, 272, 276, 278, 28, 282, 284, 286, 288, 290, 292, 294, 296,
+    298, 30, 302, 304, 306, 308, 310, 312, 314, 316, 318, 32, 322, 324, 326, 328,
+    330, 332, 336, 338, 34, 342, 344, 346, 348, 350, 352, 354, 356, 358, 36, 362,
+    364, 366, 368, 370, 372, 374, 376, 378, 38, 382, 384, 386, 388, 390, 392, 394,
+    398, 4, 402, 404, 406, 408, 410, 412, 414, 416, 418, 42, 422, 424, 426, 428,
+    430, 432, 434, 436, 438, 44, 442, 444, 446, 448, 450, 452, 454, 458, 46, 462,
+    464, 466, 468, 470, 472, 474, 476, 478, 48, 482, 484, 486, 488, 490, 492, 494,
+    496, 498, 50, 502, 504, 506, 508, 510, 512, 514, 516, 52, 522, 524, 526, 528,
+    530, 534, 538, 54, 546, 550, 554, 56, 562, 566, 570, 574, 58, 584, 588, 592,
+    596, 6, 604, 608, 612, 616, 62, 624, 628, 632, 636, 64, 646, 650, 654, 658,
+    66, 666, 670, 674, 68, 682, 686, 690, 694, 70, 704, 708, 712, 716, 72, 724,
+    728, 732, 736, 74, 744, 748, 752, 756, 76, 766, 770, 774, 778, 78, 786, 790,
+    794, 8, 802, 806, 810, 814, 82, 824, 828, 832, 836, 84, 844, 848, 852, 856,
+    86, 864, 868, 872, 876, 88, 886, 890, 894, 898, 90, 906, 910, 914, 92, 922,
+    926, 930, 934, 94, 942, 948, 952, 956, 96, 964, 968, 972, 976, 98, 984, 988,
+    992, 996, 10, 1006, 1010, 1014, 1018, 102, 1026, 1030, 1034, 104, 1042, 1046, 1050, 1054,
+    106, 1068, 1076, 108, 1092, 110, 1108, 112, 1124, 1134, 114, 1150, 116, 1166, 1174, 118,
+    1192, 12, 1208, 122, 1224, 1232, 124, 1250, 126, 1266, 1274, 128, 1290, 130, 1306, 1316,
+    132, 1332, 134, 1348, 136, 1364, 1374, 138, 1390, 14, 1406, 1414, 142, 1432, 144, 1448,
+    1456, 146, 1472, 148, 1488, 150, 1506, 1514, 152, 1530, 154, 1546, 1556, 156, 1572, 158,
+    1588, 16, 1604, 1614, 162, 1630, 164, 1646, 1654, 166, 1670, 168, 1688, 1696, 170, 1712,
+    172, 1728, 174, 1746, 1754, 176, 1770, 178, 1786, 1794, 18, 1812, 182, 1828, 184, 1844,
+    1852, 186, 1870, 188, 1886, 1894, 190, 1910, 192, 1928, 1936, 194, 1952, 196, 1968, 198,
+    1986, 1994, 3, 2011, 203, 2027, 2035, 205, 2053, 207, 2069, 209, 2085, 2093, 211, 2111,
+    212, 214, 2150, 216, 218, 22, 222, 224, 2250, 226, 228, 230, 232, 234, 2350, 236,
+    238, 24, 242, 244, 2448, 246, 248, 250, 252, 2532, 254, 256, 258, 26, 262, 2630,
+    264, 266, 268, 270, 272, 2730, 274, 276, 278, 28, 282, 2828, 284, 286, 288, 290,
+    2912, 292, 294, 296, 298, 30, 3010, 302, 304, 306, 308, 310, 3110, 312, 314, 316,
+    318, 32, 3210, 322, 324, 326, 328, 330, 3308, 332, 334, 336, 338, 3392, 34, 342,
+    344, 346, 348, 3490, 350, 352, 354, 356, 358, 3590, 36, 362, 364, 366, 368, 3690,
+    370, 372, 374, 376, 378, 3788, 38, 382, 384, 386, 3872, 388, 390, 392, 394, 396,
+    3970, 398, 4, 402, 404, 406, 4070, 408, 410, 412, 414, 416, 4168, 418, 42, 422,
+    424, 426, 430, 434, 436, 44, 444, 446, 450, 454, 456, 46, 464, 466, 470, 474,
+    476, 48, 484, 486, 490, 492, 496, 50, 502, 506, 510, 512, 516, 52, 522, 526,
+    530, 532, 536, 54, 542, 546, 550, 552, 556, 56, 562, 566, 570, 572, 576, 58,
+    582, 586, 588, 592, 596, 6, 602, 606, 608, 612, 616, 62, 622, 626, 628, 632,
+    636, 64, 642, 646, 648, 652, 656, 66, 662, 666, 668, 672, 674, 678, 68, 684,
+    688, 692, 694, 698, 70, 704, 708, 712, 714, 718, 72, 724, 728, 732, 734, 738,
+    74, 744, 748, 752, 754, 758, 76, 764, 768, 770, 774, 778, 78, 784, 788, 790,
+    794, 798, 8, 804, 808, 810, 814, 818, 82, 824, 828, 830, 834, 838, 84, 844,
+    848, 854, 86, 866, 874, 88, 886, 894, 90, 906, 914, 92, 926, 934, 94, 946,
+    952, 96, 966, 972, 98, 986, 992, 10, 1006, 1012, 102, 1026, 1032, 104, 1046, 1052,
+    106, 1066, 1072, 108, 1086, 1092, 110, 1106, 1112, 112, 1124, 1132, 114, 1144, 1152, 116,
+    1164, 1172, 118, 1184, 1192, 12, 1204, 1210, 122, 1224, 1230, 124, 1244, 1250, 126, 1264,
+    1270, 128, 1284, 1290, 130, 1304, 1310, 132, 1324, 1330, 134, 1344, 1350, 1356, 136, 1370,
+    1376, 138, 1390, 1396, 14, 1410, 1416, 142, 1430, 1436, 144, 1450, 1456, 146, 1470, 1476,
+    148, 1488, 1496, 150, 1508, 1516, 152, 1528, 1536, 154, 1548, 1556, 156, 1568, 1574, 158,
+    1588, 1594, 16, 1608, 1614, 162, 1628, 1634, 164, 1648, 1654, 166, 1668, 1674, 168, 1688,
+    170, 1708, 172, 174, 1748, 176, 178, 1786, 18, 1814, 182, 184, 1852, 186, 188, 1892,
+    190, 192, 1932, 194, 196, 1972, 198, 3, 2013, 203, 205, 2053, 207, 209, 2093, 211,
+    213, 2131, 215, 217, 2171, 219, 23, 2211, 223, 225, 2251, 227, 229, 2291, 231, 233,
+    2331, 235, 237, 2371, 239, 25, 2409, 243, 245, 2449, 247, 249, 2489, 251, 253, 2529,
+    255, 257, 2569, 259, 27, 2609, 263, 265, 2647, 267, 269, 2687, 271, 2715, 273, 275,
+    2753, 277, 279, 2793, 29, 283, 2833, 285, 287, 2873, 289, 291, 2913, 293, 295, 2953,
+    297, 299, 2993, 31, 303, 3031, 305, 307, 3071, 309, 311, 3111, 313, 315, 3151, 317,
+    319, 3191, 33, 323, 3231, 325, 327, 3271, 329, 331, 3309, 333, 335, 3349, 337, 339,
+    34, 342, 344, 346, 350, 352, 354, 358, 36, 362, 366, 368, 370, 374, 376, 378,
+    38, 384, 386, 390, 392, 394, 398, 4, 402, 404, 408, 410, 412, 416, 418, 42,
+    424, 426, 428, 432, 434, 436, 44, 442, 444, 448, 450, 452, 456, 458, 46, 464,
+    466, 468, 472, 474, 476, 48, 482, 484, 488, 490, 492, 494, 498, 50, 502, 506,
+    508, 510, 514, 516, 52, 522, 524, 526, 530, 532, 534, 538, 54, 542, 546, 548,
+    550, 554, 556, 558, 56, 564, 566, 570, 572, 574, 578, 58, 582, 584, 588, 590,
+    592, 596, 598, 6, 604, 606, 608, 612, 614, 616, 62, 622, 624, 628, 630, 632,
+    636, 638, 64, 644, 646, 648, 652, 654, 656, 66, 662, 664, 668, 670, 672, 674,
+    68, 682, 688, 694, 70, 704, 710, 714, 72, 726, 730, 736, 74, 746, 752, 758,
+    76, 768, 772, 78, 784, 788, 794, 8, 804, 810, 816, 82, 826, 832, 836, 84,
+    848, 852, 86, 862, 868, 874, 88, 884, 890, 894, 90, 906, 910, 916, 92, 926,
+    932, 938, 94, 948, 952, 96, 964, 968, 974, 98, 984, 990, 996, 10, 1006, 1012,
+    1016, 102, 1028, 1032, 104, 1042, 1048, 1054, 106, 1064, 1070, 1074, 108, 1086, 1090, 1096,
+    110, 1106, 1112, 1118, 112, 1128, 1132, 114, 1144, 1148, 1154, 116, 1164, 1170, 1176, 118,
+    1186, 1192, 1196, 12, 1208, 1212, 122, 1222, 1228, 1234, 124, 1244, 1250, 1254, 126, 1266,
+    1270, 1276, 128, 1286, 1292, 1298, 130, 1308, 1312, 132, 1324, 1328, 1334, 134, 1344, 1350,
+    136, 1366, 138, 1388, 14, 1408, 142, 1430, 144, 1450, 146, 1472, 148, 1492, 150, 1514,
+    152, 154, 1546, 156, 1568, 158, 1588, 16, 1610, 162, 1630, 164, 1652, 166, 1672, 168,
+    1694, 170, 172, 1726, 174, 1748, 176, 1768, 178, 1790, 18, 1810, 182, 1832, 184, 1852,
+    186, 1874, 188, 190, 1906, 192, 1926, 194, 1948, 196, 1970, 198, 1990, 3, 2013, 203,
+    2033, 205, 2055, 207, 209, 2087, 211, 2107, 213, 2129, 215, 2151, 217, 2171, 219, 2193,
+    23, 2213, 223, 2235, 225, 227, 2267, 229, 2287, 231, 2309, 233, 2331, 235, 2351, 237,
+    2373, 239, 2393, 25, 2415, 243, 245, 2447, 247, 2467, 249, 2489, 251, 2511, 253, 2531,
+    255, 2553, 257, 2573, 259, 2595, 27, 263, 2627, 265, 2647, 267, 2669, 269, 2691, 271,
+    272, 274, 276, 278, 28, 282, 284, 286, 288, 290, 292, 294, 296, 298, 30, 302,
+    304, 308, 310, 312, 314, 316, 318, 32, 322, 324, 326, 328, 330, 332, 334, 336,
+    338, 34, 344, 346, 348, 350, 352, 354, 356, 358, 36, 362, 364, 366, 368, 370,
+    372, 374, 376, 38, 382, 384, 386, 388, 390, 392, 394, 396, 398, 4, 402, 404,
+    406, 408, 410, 412, 416, 418, 42, 422, 424, 426, 428, 430, 432, 434, 436, 438,
+    44, 442, 444, 446, 448, 452, 454, 456, 458, 46, 462, 464, 466, 468, 470, 472,
+    474, 476, 478, 48, 482, 484, 488, 490, 492, 494, 496, 498, 50, 502, 504, 506,
+    508, 510, 512, 514, 516, 518, 52, 524, 526, 528, 530, 532, 534, 536, 538, 54,
+    542, 546, 550, 554, 56, 564, 568, 572, 576, 58, 584, 588, 592, 598, 6, 606,
+    610, 614, 62, 622, 626, 632, 636, 64, 644, 648, 652, 656, 66, 664, 670, 674,
+    678, 68, 686, 690, 694, 70, 704, 708, 712, 716, 72, 724, 728, 732, 736, 74,
+    746, 750, 754, 76, 762, 766, 770, 776, 78, 784, 788, 792, 796, 8, 804, 808,
+    814, 818, 82, 826, 830, 834, 84, 842, 848, 852, 856, 86, 864, 868, 872, 876,
+    88, 886, 890, 894, 898, 90, 906, 910, 914, 92, 924, 928, 932, 936, 94, 944,
+    948, 952, 958, 96, 966, 970, 974, 98, 982, 986, 992, 996, 10, 1004, 1008, 1012,
+    1016, 102, 1024, 1030, 1034, 1038, 104, 1046, 1050, 1054, 106, 1064, 1068, 1072, 1076, 108,
+    1084, 1092, 110, 1110, 112, 1126, 1136, 114, 1152, 116, 1168, 118, 1186, 1194, 12, 1212,
+    122, 1228, 124, 1246, 1254, 126, 1270, 128, 1288, 130, 1304, 1312, 132, 1330, 134, 1346,
+    1356, 136, 1372, 138, 1390, 14, 1406, 1414, 142, 1432, 144, 1448, 146, 1466, 1474, 148,
+    1490, 150, 1508, 152, 1524, 1534, 154, 1550, 156, 1568, 1576, 158, 1592, 16, 1610, 162,
+    1626, 1634, 164, 1652, 166, 1668, 168, 1686, 1694, 170, 1712, 172, 1728, 174, 1744, 1754,
+    176, 1770, 178, 1788, 1796, 18, 1812, 182, 1830, 184, 1846, 1856, 186, 1872, 188, 1888,
+    190, 1906, 1914, 192, 1932, 194, 1948, 196, 1966, 1974, 198, 1990, 3, 2009, 203, 2025,
+    2033, 205, 2051, 207, 2067, 2077, 209, 2093, 211, 2111, 213, 2127, 2135, 215, 2153, 217,
+    2168, 218, 22, 222, 224, 226, 2270, 228, 230, 232, 234, 236, 238, 2388, 24, 242,
+    244, 246, 248, 2490, 250, 252, 254, 256, 258, 26, 2608, 262, 264, 266, 268, 270,
+    2710, 272, 274, 276, 278, 28, 282, 2830, 284, 286, 288, 290, 292, 2930, 294, 296,
+    298, 30, 302, 304, 3050, 306, 308, 310, 312, 314, 3150, 316, 318, 32, 322, 324,
+    326, 3270, 328, 330, 332, 334, 336, 3372, 338, 34, 342, 344, 346, 348, 3490, 350,
+    352, 354, 356, 358, 3592, 36, 362, 364, 366, 368, 370, 3710, 372, 374, 376, 378,
+    38, 382, 3828, 384, 386, 388, 390, 392, 3930, 394, 396, 398, 4, 402, 404, 4048,
+    406, 408, 410, 412, 414, 4150, 416, 418, 42, 422, 424, 426, 4270, 428, 430, 432,
+    434, 438, 44, 444, 448, 450, 454, 458, 46, 464, 468, 470, 474, 478, 48, 484,
+    488, 492, 494, 498, 50, 504, 508, 512, 514, 52, 522, 526, 528, 532, 536, 54,
+    542, 546, 548, 552, 556, 56, 562, 566, 570, 572, 576, 58, 582, 586, 590, 592,
+    596, 6, 604, 606, 610, 614, 616, 62, 624, 626, 630, 634, 636, 64, 644, 648,
+    650, 654, 658, 66, 664, 668, 670, 674, 678, 68, 684, 688, 692, 694, 698, 70,
+    704, 708, 712, 714, 718, 72, 726, 728, 732, 736, 74, 742, 746, 748, 752, 756,
+    76, 762, 766, 770, 772, 776, 78, 782, 786, 790, 792, 796, 8, 802, 806, 810,
+    814, 816, 82, 824, 826, 830, 834, 836, 84, 844, 848, 850, 854, 858, 86, 864,
+    868, 874, 88, 888, 894, 90, 908, 914, 92, 928, 936, 94, 948, 956, 96, 970,
+    976, 98, 990, 996, 10, 1010, 1016, 102, 1030, 104, 1044, 1050, 106, 1064, 1070, 108,
+    1084, 1090, 110, 1104, 1112, 112, 1124, 1132, 114, 1146, 1152, 116, 1166, 1172, 118, 1186,
+    1192, 12, 1206, 1212, 122, 1226, 1234, 124, 1246, 1254, 126, 1268, 1274, 128, 1288, 1294,
+    130, 1308, 1314, 132, 1328, 1334, 134, 1348, 1356, 136, 1368, 1376, 138, 1390, 1396, 14,
+    1410, 1416, 142, 1430, 1436, 144, 1450, 146, 1464, 1470, 148, 1484, 1490, 150, 1504, 1512,
+    152, 1524, 1532, 154, 1544, 1552, 156, 1566, 1572, 158, 1586, 1592, 16, 1606, 1612, 162,
+    1626, 1634, 164, 1646, 1654, 166, 1666, 1674, 168, 1688, 1694, 170, 1708, 1714, 172, 1728,
+    174, 1748, 176, 178, 1788, 18, 182, 1830, 184, 186, 1870, 188, 190, 1910, 192, 194,
+    1952, 196, 198, 1992, 3, 203, 2033, 205, 207, 209, 2089, 211, 213, 2129, 215, 217,
+    2169, 219, 23, 2211, 223, 225, 2251, 227, 229, 2291, 231, 233, 2333, 235, 237, 2373,
+    239, 25, 2413, 243, 245, 2455, 247, 249, 251, 2509, 253, 255, 2549, 257, 259, 2589,
+    27, 263, 2631, 265, 267, 2671, 269, 271, 2711, 273, 275, 2753, 277, 279, 2793, 29,
+    283, 2833, 285, 287, 2875, 289, 291, 293, 2929, 295, 297, 2969, 299, 31, 3009, 303,
+    305, 3051, 307, 309, 3091, 311, 313, 3131, 315, 317, 3173, 319, 33, 3213, 323, 325,
+    3253, 327, 329, 331, 3307, 333, 335, 3349, 337, 339, 3389, 35, 343, 3429, 345, 347,
+    348, 350, 352, 356, 358, 36, 364, 366, 368, 372, 374, 376, 38, 382, 384, 388,
+    390, 394, 396, 398, 4, 404, 406, 410, 412, 414, 418, 42, 422, 426, 428, 430,
+    434, 436, 44, 442, 444, 448, 450, 452, 456, 458, 46, 464, 466, 468, 472, 474,
+    478, 48, 482, 486, 488, 490, 494, 496, 50, 502, 504, 506, 510, 512, 514, 518,
+    52, 524, 526, 528, 532, 534, 536, 54, 542, 544, 548, 550, 552, 556, 558, 56,
+    564, 566, 570, 572, 574, 578, 58, 582, 586, 588, 590, 594, 596, 6, 602, 604,
+    608, 610, 612, 616, 618, 62, 624, 626, 628, 632, 634, 636, 64, 642, 646, 648,
+    650, 654, 656, 66, 662, 664, 666, 670, 672, 674, 678, 68, 684, 686, 688, 692,
+    694, 70, 704, 710, 716, 72, 726, 732, 738, 74, 748, 754, 76, 764, 770, 776,
+    78, 786, 792, 796, 8, 808, 814, 82, 824, 830, 834, 84, 846, 852, 856, 86,
+    868, 872, 88, 884, 890, 894, 90, 906, 910, 916, 92, 926, 932, 94, 944, 948,
+    954, 96, 964, 970, 976, 98, 986, 992, 10, 1002, 1008, 1014, 102, 1024, 1030, 1036,
+    104, 1046, 1052, 1058, 106, 1068, 1074, 108, 1084, 1090, 1096, 110, 1106, 1112, 1116, 112,
+    1128, 1132, 114, 1144, 1150, 1154, 116, 1166, 1170, 1176, 118, 1188, 1192, 12, 1204, 1208,
+    1214, 122, 1226, 1230, 1236, 124, 1246, 1252, 126, 1264, 1268, 1274, 128, 1284, 1290, 1296,
+    130, 1306, 1312, 132, 1322, 1328, 1334, 134, 1344, 1350, 1356, 136, 1366, 1372, 1376, 138,
+    1388, 14, 1410, 142, 1432, 144, 1452, 146, 1474, 148, 150, 1508, 152, 1528, 154, 1550,
+    156, 1572, 158, 1594, 16, 162, 1626, 164, 1648, 166, 1670, 168, 1692, 170, 1714, 172,
+    174, 1746, 176, 1768, 178, 1788, 18, 1810, 182, 1832, 184, 1854, 186, 188, 1886, 190,
+    1908, 192, 1930, 194, 1952, 196, 1974, 198, 3, 2007, 203, 2029, 205, 2051, 207, 2071,
+    209, 2093, 211, 2115, 213, 215, 2147, 217, 2169, 219, 2191, 23, 2213, 223, 2235, 225,
+    227, 2267, 229, 2289, 231, 2311, 233, 2333, 235, 2353, 237, 2375, 239, 25, 2407, 243,
+    2429, 245, 2451, 247, 2473, 249, 2495, 251, 253, 2527, 255, 2549, 257, 2571, 259, 2593,
+    27, 2613, 263, 265, 2647, 267, 2669, 269, 2689, 271, 2711, 273, 2733, 275, 2755, 277,
+    278, 28, 282, 284, 286, 288, 290, 292, 294, 298, 30, 302, 304, 306, 308, 310,
+    312, 314, 316, 318, 32, 324, 326, 328, 330, 332, 334, 336, 338, 34, 342, 344,
+    346, 350, 352, 354, 356, 358, 36, 362, 364, 366, 368, 370, 372, 376, 378, 38,
+    382, 384, 386, 388, 390, 392, 394, 396, 4, 402, 404, 406, 408, 410, 412, 414,
+    416, 418, 42, 422, 426, 428, 430, 432, 434, 436, 438, 44, 442, 444, 446, 448,
+    452, 454, 456, 458, 46, 462, 464, 466, 468, 470, 472, 474, 478, 48, 482, 484,
+    486, 488, 490, 492, 494, 496, 498, 50, 504, 506, 508, 510, 512, 514, 516, 518,
+    52, 522, 524, 526, 530, 532, 534, 536, 538, 54, 542, 544, 546, 548, 550, 552,
+    556, 56, 564, 568, 572, 576, 58, 586, 590, 594, 6, 602, 608, 612, 616, 62,
+    624, 628, 634, 638, 64, 646, 650, 654, 66, 664, 668, 672, 676, 68, 686, 690,
+    694, 70, 702, 706, 712, 716, 72, 724, 728, 732, 738, 74, 746, 750, 754, 76,
+    764, 768, 772, 776, 78, 784, 790, 794, 8, 802, 806, 810, 816, 82, 824, 828,
+    832, 838, 84, 846, 850, 854, 86, 864, 868, 872, 876, 88, 884, 890, 894, 898,
+    90, 906, 910, 916, 92, 924, 928, 932, 936, 94, 946, 950, 954, 96, 962, 968,
+    972, 976, 98, 984, 988, 994, 998, 10, 1006, 1010, 1014, 102, 1024, 1028, 1032, 1036,
+    104, 1046, 1050, 1054, 106, 1062, 1066, 1072, 1076, 108, 1084, 1088, 1092, 1098, 110, 1106,
+    1110, 112, 1128, 114, 1144, 1154, 116, 1170, 118, 1188, 12, 1206, 1214, 122, 1232, 124,
+    1250, 126, 1266, 1276, 128, 1292, 130, 1310, 132, 1328, 134, 1344, 1354, 136, 1370, 138,
+    1388, 14, 1406, 1414, 142, 1432, 144, 1448, 146, 1466, 1474, 148, 1492, 150, 1510, 152,
+    1526, 1536, 154, 1552, 156, 1570, 158, 1588, 16, 1604, 1614, 162, 1630, 164, 1648, 166,
+    1666, 1674, 168, 1692, 170, 1708, 172, 1726, 1734, 174, 1752, 176, 1770, 178, 1786, 1796,
+    18, 1812, 182, 1830, 184, 1848, 186, 1864, 1874, 188, 1890, 190, 1908, 192, 1926, 1934,
+    194, 1952, 196, 1968, 198, 1986, 1994, 3, 2013, 203, 2031, 205, 2047, 2057, 207, 2073,
+    209, 2091, 211, 2109, 213, 2127, 2135, 215, 2153, 217, 2169, 219, 2187, 2195, 23, 2213,
+    222, 224, 226, 228, 2290, 230, 232, 234, 236, 238, 24, 2412, 242, 244, 246, 248,
+    250, 252, 254, 2550, 256, 258, 26, 262, 264, 266, 268, 2688, 270, 272, 274, 276,
+    278, 28, 2810, 282, 284, 286, 288, 290, 292, 294, 2950, 296, 298, 30, 302, 304,
+    306, 3070, 308, 310, 312, 314, 316, 318, 32, 3210, 322, 324, 326, 328, 330, 332,
+    3330, 334, 336, 338, 34, 342, 344, 346, 3470, 348, 350, 352, 354, 356, 358, 3590,
+    36, 362, 364, 366, 368, 370, 372, 3730, 374, 376, 378, 38, 382, 384, 3852, 386,
+    388, 390, 392, 394, 396, 398, 3990, 4, 402, 404, 406, 408, 410, 4112, 412, 414,
+    416, 418, 42, 422, 424, 4250, 426, 428, 430, 432, 434, 436, 438, 4388, 44, 442,
+    444, 448, 452, 454, 458, 46, 464, 468, 472, 476, 48, 482, 486, 490, 492, 496,
+    50, 504, 506, 510, 514, 516, 52, 524, 528, 530, 534, 538, 54, 544, 548, 552,
+    556, 56, 562, 566, 568, 572, 576, 58, 582, 586, 590, 594, 596, 6, 604, 608,
+    610, 614, 618, 62, 624, 628, 632, 634, 64, 642, 646, 648, 652, 656, 66, 662,
+    666, 670, 674, 676, 68, 684, 686, 690, 694, 698, 70, 704, 708, 712, 714, 718,
+    72, 726, 728, 732, 736, 74, 742, 746, 750, 752, 756, 76, 764, 766, 770, 774,
+    778, 78, 784, 788, 792, 794, 798, 8, 804, 808, 812, 816, 82, 822, 826, 830,
+    832, 836, 84, 844, 846, 850, 854, 856, 86, 864, 868, 870, 874, 878, 88, 884,
+    888, 896, 90, 908, 916, 92, 930, 94, 944, 950, 96, 964, 972, 98, 986, 992,
+    10, 1006, 1014, 102, 1026, 1034, 104, 1048, 1054, 106, 1068, 1076, 108, 1090, 1096, 110,
+    1110, 112, 1124, 1132, 114, 1144, 1152, 116, 1166, 1172, 118, 1186, 1194, 12, 1208, 1214,
+    122, 1228, 1236, 124, 1250, 1256, 126, 1270, 128, 1284, 1290, 130, 1304, 1312, 132, 1326,
+    1332, 134, 1346, 1354, 136, 1366, 1374, 138, 1388, 1394, 14, 1408, 1416, 142, 1430, 1436,
+    144, 1450, 146, 1464, 1472, 148, 1484, 1492, 150, 1506, 1512, 152, 1526, 1534, 154, 1548,
+    1554, 156, 1568, 1576, 158, 1590, 1596, 16, 1610, 162, 1624, 1630, 164, 1644, 1652, 166,
+    1666, 1672, 168, 1686, 1694, 170, 1706, 1714, 172, 1728, 1734, 174, 1748, 1756, 176, 1770,
+    178, 1790, 18, 182, 1832, 184, 186, 188, 1888, 190, 192, 1930, 194, 196, 1970, 198,
+    3, 2013, 203, 205, 207, 2069, 209, 211, 2111, 213, 215, 2153, 217, 219, 2193, 23,
+    223, 225, 2249, 227, 229, 2291, 231, 233, 2333, 235, 237, 239, 2387, 25, 243, 2429,
+    245, 247, 2471, 249, 251, 2513, 253, 255, 257, 2569, 259, 27, 2611, 263, 265, 2651,
+    267, 269, 2693, 271, 273, 275, 2749, 277, 279, 2791, 29, 283, 2833, 285, 287, 2873,
+    289, 291, 293, 2929, 295, 297, 2971, 299, 31, 3013, 303, 305, 307, 3067, 309, 311,
+    3109, 313, 315, 3151, 317, 319, 3193, 33, 323, 325, 3249, 327, 329, 3291, 331, 333,
+    3331, 335, 337, 3373, 339, 35, 343, 3429, 345, 347, 3471, 349, 351, 3513, 353, 355,
+    356, 358, 36, 364, 366, 370, 372, 374, 378, 38, 384, 386, 388, 392, 394, 396,
+    4, 402, 406, 408, 410, 414, 416, 42, 422, 424, 428, 430, 432, 436, 438, 44,
+    444, 446, 450, 452, 456, 458, 46, 464, 466, 470, 472, 474, 478, 48, 482, 486,
+    488, 492, 494, 496, 50, 502, 506, 508, 510, 514, 516, 52, 522, 524, 528, 530,
+    532, 536, 538, 54, 544, 546, 550, 552, 556, 558, 56, 564, 566, 568, 572, 574,
+    578, 58, 582, 586, 588, 592, 594, 596, 6, 602, 606, 608, 610, 614, 616, 62,
+    622, 624, 628, 630, 632, 636, 638, 64, 644, 646, 650, 652, 656, 658, 66, 664,
+    666, 668, 672, 674, 678, 68, 682, 686, 688, 692, 694, 696, 70, 702, 704, 708,
+    710, 716, 72, 728, 732, 74, 744, 750, 754, 76, 766, 772, 778, 78, 788, 794,
+    8, 804, 810, 816, 82, 828, 832, 84, 844, 850, 854, 86, 866, 872, 878, 88,
+    888, 894, 90, 904, 910, 916, 92, 928, 932, 94, 944, 950, 954, 96, 966, 972,
+    976, 98, 988, 994, 10, 1004, 1010, 1016, 102, 1026, 1032, 104, 1044, 1050, 1054, 106,
+    1066, 1072, 1076, 108, 1088, 1094, 110, 1104, 1110, 1116, 112, 1126, 1132, 114, 1144, 1150,
+    1154, 116, 1166, 1172, 1176, 118, 1188, 1194, 12, 1204, 1210, 1216, 122, 1226, 1232, 124,
+    1244, 1250, 1254, 126, 1266, 1272, 1276, 128, 1288, 1294, 130, 1304, 1310, 1316, 132, 1326,
+    1332, 134, 1344, 1348, 1354, 136, 1366, 1372, 1376, 138, 1388, 1394, 14, 1404, 1410, 1416,
+    142, 1432, 144, 1454, 146, 148, 1488, 150, 1510, 152, 1532, 154, 1554, 156, 158, 1588,
+    16, 1610, 162, 1632, 164, 1654, 166, 168, 1688, 170, 1710, 172, 1732, 174, 1754, 176,
+    178, 1788, 18, 1810, 182, 1832, 184, 1854, 186, 188, 1888, 190, 1910, 192, 1932, 194,
+    1954, 196, 198, 1988, 3, 2011, 203, 2033, 205, 2055, 207, 209, 2089, 211, 2111, 213,
+    2133, 215, 2155, 217, 219, 2189, 23, 2211, 223, 2233, 225, 2255, 227, 229, 2289, 231,
+    2311, 233, 2333, 235, 2355, 237, 239, 2387, 25, 2411, 243, 2433, 245, 2455, 247, 249,
+    2487, 251, 2511, 253, 2533, 255, 2555, 257, 259, 2587, 27, 2611, 263, 2633, 265, 2655,
+    267, 269, 2687, 271, 2709, 273, 2733, 275, 2755, 277, 279, 2787, 29, 2809, 283, 2833,
+    284, 286, 288, 290, 294, 296, 298, 30, 302, 304, 306, 308, 310, 314, 316, 318,
+    32, 322, 324, 326, 328, 330, 334, 336, 338, 34, 342, 344, 346, 348, 350, 354,
+    356, 358, 36, 362, 364, 366, 368, 370, 374, 376, 378, 38, 382, 384, 386, 388,
+    390, 394, 396, 398, 4, 402, 404, 406, 408, 410, 414, 416, 418, 42, 422, 424,
+    426, 428, 430, 432, 436, 438, 44, 442, 444, 446, 448, 450, 452, 456, 458, 46,
+    462, 464, 466, 468, 470, 472, 476, 478, 48, 482, 484, 486, 488, 490, 492, 496,
+    498, 50, 502, 504, 506, 508, 510, 512, 516, 518, 52, 522, 524, 526, 528, 530,
+    532, 536, 538, 54, 542, 544, 546, 548, 550, 552, 556, 558, 56, 562, 564, 566,
+    568, 572, 578, 58, 586, 590, 596, 6, 604, 608, 612, 618, 62, 626, 630, 636,
+    64, 644, 648, 652, 658, 66, 666, 670, 676, 68, 684, 688, 692, 698, 70, 706,
+    710, 714, 72, 724, 728, 732, 738, 74, 746, 750, 754, 76, 764, 768, 772, 778,
+    78, 786, 790, 794, 8, 804, 808, 812, 818, 82, 826, 830, 834, 84, 844, 848,
+    852, 858, 86, 866, 870, 874, 88, 884, 888, 892, 898, 90, 906, 910, 914, 92,
+    924, 928, 932, 938, 94, 946, 950, 954, 96, 964, 968, 972, 976, 98, 986, 990,
+    994, 10, 1004, 1008, 1012, 1016, 102, 1026, 1030, 1034, 104, 1044, 1048, 1052, 1056, 106,
+    1066, 1070, 1074, 108, 1084, 1088, 1092, 1096, 110, 1106, 1110, 1114, 112, 1124, 1128, 1132,
+    114, 1146, 1154, 116, 1172, 118, 1190, 12, 1208, 122, 1226, 1234, 124, 1252, 126, 1270,
+    128, 1288, 130, 1306, 1314, 132, 1332, 134, 1350, 136, 1368, 138, 1386, 1394, 14, 1412,
+    142, 1430, 144, 1448, 146, 1466, 1474, 148, 1492, 150, 1510, 152, 1528, 154, 1546, 1554,
+    156, 1572, 158, 1590, 16, 1608, 162, 1626, 1634, 164, 1652, 166, 1670, 168, 1688, 170,
+    1706, 1714, 172, 1732, 174, 1750, 176, 1768, 178, 1786, 1794, 18, 1812, 182, 1830, 184,
+    1848, 186, 1866, 1874, 188, 1892, 190, 1910, 192, 1928, 194, 1946, 1954, 196, 1972, 198,
+    1990, 3, 2009, 203, 2027, 2035, 205, 2053, 207, 2071, 209, 2089, 211, 2105, 2115, 213,
+    2133, 215, 2151, 217, 2169, 219, 2185, 2195, 23, 2213, 223, 2231, 225, 2249, 227, 2265,
+    228, 230, 2310, 232, 234, 236, 238, 24, 242, 244, 246, 2470, 248, 250, 252, 254,
+    256, 258, 26, 262, 2630, 264, 266, 268, 270, 272, 274, 276, 2772, 278, 28, 282,
+    284, 286, 288, 290, 292, 2930, 294, 296, 298, 30, 302, 304, 306, 308, 3090, 310,
+    312, 314, 316, 318, 32, 322, 324, 3250, 326, 328, 330, 332, 334, 336, 338, 34,
+    3410, 342, 344, 346, 348, 350, 352, 354, 356, 3570, 358, 36, 362, 364, 366, 368,
+    370, 372, 3730, 374, 376, 378, 38, 382, 384, 386, 388, 3890, 390, 392, 394, 396,
+    398, 4, 402, 404, 4050, 406, 408, 410, 412, 414, 416, 418, 42, 4210, 422, 424,
+    426, 428, 430, 432, 434, 436, 4370, 438, 44, 442, 444, 446, 448, 450, 452, 4530,
+    454, 46, 462, 466, 468, 472, 476, 48, 484, 486, 490, 494, 498, 50, 504, 508,
+    512, 516, 52, 522, 526, 530, 532, 536, 54, 544, 548, 550, 554, 558, 56, 564,
+    568, 572, 576, 58, 582, 586, 590, 594, 596, 6, 604, 608, 612, 614, 618, 62,
+    626, 628, 632, 636, 64, 644, 646, 650, 654, 658, 66, 664, 668, 672, 676, 68,
+    682, 686, 690, 692, 696, 70, 704, 706, 710, 714, 718, 72, 724, 728, 732, 736,
+    74, 742, 746, 750, 754, 756, 76, 764, 768, 770, 774, 778, 78, 786, 788, 792,
+    796, 8, 802, 806, 810, 814, 818, 82, 824, 828, 832, 834, 84, 842, 846, 850,
+    852, 856, 86, 864, 866, 870, 874, 878, 88, 884, 888, 892, 896, 90, 902, 906,
+    910, 92, 924, 930, 94, 946, 952, 96, 966, 974, 98, 988, 994, 10, 1008, 1016,
+    102, 1030, 104, 1044, 1052, 106, 1066, 1072, 108, 1088, 1094, 110, 1108, 1116, 112, 1130,
+    114, 1144, 1152, 116, 1166, 1172, 118, 1186, 1194, 12, 1208, 1216, 122, 1230, 1236, 124,
+    1250, 126, 1264, 1272, 128, 1286, 1294, 130, 1308, 1314, 132, 1328, 1336, 134, 1350, 136,
+    1364, 1372, 138, 1386, 1392, 14, 1406, 1414, 142, 1428, 1436, 144, 1450, 146, 1464, 1470,
+    148, 1486, 1492, 150, 1506, 1514, 152, 1528, 1534, 154, 1548, 1556, 156, 1570, 158, 1584,
+    1592, 16, 1606, 1612, 162, 1628, 1634, 164, 1648, 1656, 166, 1670, 168, 1684, 1692, 170,
+    1706, 1712, 172, 1726, 1734, 174, 1748, 1756, 176, 1770, 1776, 178, 1790, 18, 1804, 1812,
+    182, 184, 1848, 186, 188, 1890, 190, 192, 1932, 194, 196, 198, 1990, 3, 203, 2033,
+    205, 207, 209, 2089, 211, 213, 2133, 215, 217, 219, 2189, 23, 223, 2233, 225, 227,
+    229, 2289, 231, 233, 2331, 235, 237, 239, 2389, 25, 243, 2431, 245, 247, 2473, 249,
+    251, 253, 2531, 255, 257, 2573, 259, 27, 263, 2631, 265, 267, 2673, 269, 271, 273,
+    2729, 275, 277, 2773, 279, 29, 283, 2829, 285, 287, 2871, 289, 291, 293, 2929, 295,
+    297, 2971, 299, 31, 3013, 303, 305, 307, 3071, 309, 311, 3113, 313, 315, 317, 3171,
+    319, 33, 3213, 323, 325, 327, 3269, 329, 331, 3313, 333, 335, 337, 3369, 339, 35,
+    3411, 343, 345, 347, 3469, 349, 351, 3511, 353, 355, 3553, 357, 359, 37, 3611, 363,
+    364, 366, 370, 372, 376, 378, 38, 384, 386, 390, 392, 396, 398, 4, 404, 406,
+    410, 412, 414, 418, 42, 424, 426, 430, 432, 434, 438, 44, 444, 446, 450, 452,
+    454, 458, 46, 464, 466, 468, 472, 474, 478, 48, 484, 486, 488, 492, 494, 498,
+    50, 504, 506, 508, 512, 514, 518, 52, 522, 526, 528, 532, 534, 538, 54, 542,
+    546, 548, 552, 554, 558, 56, 562, 566, 568, 572, 574, 576, 58, 582, 586, 588,
+    592, 594, 596, 6, 602, 606, 608, 612, 614, 616, 62, 622, 626, 628, 630, 634,
+    636, 64, 642, 646, 648, 650, 654, 656, 66, 662, 666, 668, 670, 674, 676, 68,
+    682, 684, 688, 690, 694, 696, 70, 702, 704, 708, 710, 714, 716, 72, 722, 724,
+    728, 734, 74, 744, 750, 756, 76, 768, 774, 78, 784, 790, 796, 8, 808, 812,
+    82, 824, 830, 836, 84, 846, 852, 86, 864, 870, 876, 88, 886, 892, 90, 904,
+    910, 916, 92, 926, 932, 94, 944, 950, 954, 96, 966, 972, 98, 984, 990, 994,
+    10, 1006, 1012, 102, 1024, 1028, 1034, 104, 1046, 1052, 106, 1062, 1068, 1074, 108, 1086,
+    1092, 1098, 110, 1108, 1114, 112, 1126, 1132, 1136, 114, 1148, 1154, 116, 1166, 1170, 1176,
+    118, 1188, 1194, 12, 1206, 1210, 1216, 122, 1228, 1234, 124, 1244, 1250, 1256, 126, 1268,
+    1274, 128, 1284, 1290, 1296, 130, 1308, 1314, 132, 1324, 1330, 1336, 134, 1348, 1352, 136,
+    1364, 1370, 1376, 138, 1386, 1392, 14, 1404, 1410, 1416, 142, 1426, 1432, 144, 1444, 1450,
+    146, 1466, 148, 1490, 150, 1512, 152, 154, 1546, 156, 1568, 158, 1592, 16, 162, 1626,
+    164, 1648, 166, 1672, 168, 1694, 170, 172, 1728, 174, 1750, 176, 1774, 178, 18, 1808,
+    182, 1830, 184, 1854, 186, 188, 1888, 190, 1910, 192, 1932, 194, 196, 1966, 198, 1990,
+    3, 2013, 203, 205, 2047, 207, 2071, 209, 2093, 211, 213, 2127, 215, 2149, 217, 2173,
+    219, 2195, 23, 223, 2229, 225, 2251, 227, 2275, 229, 231, 2309, 233, 2331, 235, 2355,
+    237, 239, 2389, 25, 2411, 243, 2433, 245, 247, 2469, 249, 2491, 251, 2513, 253, 255,
+    2547, 257, 2571, 259, 2593, 27, 263, 2627, 265, 2649, 267, 2673, 269, 271, 2707, 273,
+    2729, 275, 2753, 277, 2775, 279, 29, 2809, 283, 2831, 285, 2855, 287, 289, 2889, 291,
+    292, 294, 296, 298, 30, 302, 304, 306, 310, 312, 314, 316, 318, 32, 322, 326,
+    328, 330, 332, 334, 336, 338, 34, 344, 346, 348, 350, 352, 354, 356, 36, 362,
+    364, 366, 368, 370, 372, 376, 378, 38, 382, 384, 386, 388, 392, 394, 396, 398,
+    4, 402, 404, 406, 410, 412, 414, 416, 418, 42, 422, 426, 428, 430, 432, 434,
+    436, 438, 44, 444, 446, 448, 450, 452, 454, 458, 46, 462, 464, 466, 468, 470,
+    472, 476, 478, 48, 482, 484, 486, 488, 492, 494, 496, 498, 50, 502, 504, 508,
+    510, 512, 514, 516, 518, 52, 522, 526, 528, 530, 532, 534, 536, 54, 542, 544,
+    546, 548, 550, 552, 554, 558, 56, 562, 564, 566, 568, 570, 572, 576, 578, 58,
+    582, 586, 592, 596, 6, 604, 610, 614, 62, 624, 628, 632, 636, 64, 646, 650,
+    654, 66, 664, 668, 674, 678, 68, 686, 692, 696, 70, 704, 710, 714, 72, 724,
+    728, 732, 736, 74, 746, 750, 754, 76, 764, 768, 774, 778, 78, 786, 792, 796,
+    8, 804, 810, 814, 82, 824, 828, 832, 836, 84, 846, 850, 854, 86, 864, 868,
+    874, 878, 88, 886, 892, 896, 90, 904, 910, 914, 92, 924, 928, 932, 936, 94,
+    946, 950, 954, 96, 964, 968, 974, 978, 98, 986, 992, 996, 10, 1004, 1010, 1014,
+    102, 1024, 1028, 1032, 1036, 104, 1046, 1050, 1056, 106, 1064, 1068, 1074, 108, 1082, 1086,
+    1092, 1096, 110, 1106, 1110, 1114, 112, 1124, 1128, 1132, 1136, 114, 1146, 1150, 1156, 116,
+    1164, 1174, 118, 1192, 12, 1210, 122, 1228, 124, 1246, 1256, 126, 1274, 128, 1292, 130,
+    1310, 132, 1328, 134, 1346, 1356, 136, 1374, 138, 1392, 14, 1410, 142, 1428, 144, 1446,
+    1456, 146, 1474, 148, 1492, 150, 1510, 152, 1528, 154, 1546, 1556, 156, 1574, 158, 1592,
+    16, 1610, 162, 1628, 164, 1646, 1656, 166, 1674, 168, 1692, 170, 1710, 172, 1728, 174,
+    1746, 1756, 176, 1774, 178, 1792, 18, 1810, 182, 1828, 184, 1846, 1856, 186, 1874, 188,
+    1892, 190, 1910, 192, 1928, 194, 1946, 1956, 196, 1974, 198, 1992, 3, 2011, 203, 2029,
+    205, 2047, 207, 2065, 2075, 209, 2093, 211, 2111, 213, 2129, 215, 2147, 217, 2165, 2175,
+    219, 2193, 23, 2211, 223, 2229, 225, 2247, 227, 2265, 2275, 229, 2293, 231, 2311, 233,
+    2328, 234, 236, 238, 24, 242, 244, 246, 248, 250, 2510, 252, 254, 256, 258, 26,
+    262, 264, 266, 268, 270, 2710, 272, 274, 276, 278, 28, 282, 284, 286, 288, 290,
+    2910, 292, 294, 296, 298, 30, 302, 304, 306, 308, 310, 3110, 312, 314, 316, 318,
+    32, 322, 324, 326, 328, 330, 3310, 332, 334, 336, 338, 34, 342, 344, 346, 348,
+    350, 3510, 352, 354, 356, 358, 36, 362, 364, 366, 368, 370, 3710, 372, 374, 376,
+    378, 38, 382, 384, 386, 388, 390, 3910, 392, 394, 396, 398, 4, 402, 404, 406,
+    408, 410, 412, 4130, 414, 416, 418, 42, 422, 424, 426, 428, 430, 432, 4330, 434,
+    436, 438, 44, 442, 444, 446, 448, 450, 452, 4530, 454, 456, 458, 46, 462, 464,
+    466, 470, 472, 476, 48, 484, 488, 492, 494, 50, 502, 506, 510, 512, 516, 52,
+    524, 528, 532, 534, 54, 542, 546, 550, 552, 556, 56, 564, 568, 572, 574, 58,
+    582, 586, 590, 592, 596, 6, 604, 608, 612, 614, 62, 622, 626, 630, 634, 636,
+    64, 644, 648, 652, 654, 66, 662, 666, 670, 674, 676, 68, 684, 688, 692, 694,
+    70, 702, 706, 710, 714, 716, 72, 724, 728, 732, 734, 74, 742, 746, 750, 754,
+    756, 76, 764, 768, 772, 774, 78, 782, 786, 790, 794, 796, 8, 804, 808, 812,
+    814, 82, 822, 826, 830, 834, 836, 84, 844, 848, 852, 854, 86, 862, 866, 870,
+    874, 876, 88, 884, 888, 892, 894, 90, 902, 906, 910, 914, 916, 92, 924, 928,
+    932, 94, 946, 954, 96, 968, 974, 98, 990, 10, 1004, 1012, 102, 1026, 1034, 104,
+    1048, 1056, 106, 1070, 108, 1084, 1092, 110, 1106, 1114, 112, 1128, 1136, 114, 1150, 116,
+    1164, 1172, 118, 1186, 1194, 12, 1208, 1216, 122, 1230, 124, 1244, 1252, 126, 1266, 1274,
+    128, 1288, 1296, 130, 1310, 132, 1324, 1332, 134, 1346, 1354, 136, 1368, 1376, 138, 1390,
+    14, 1404, 1412, 142, 1426, 1434, 144, 1448, 1456, 146, 1470, 148, 1484, 1492, 150, 1506,
+    1514, 152, 1528, 1536, 154, 1550, 156, 1564, 1572, 158, 1586, 1594, 16, 1608, 1616, 162,
+    1630, 164, 1644, 1652, 166, 1666, 1674, 168, 1688, 1696, 170, 1710, 172, 1724, 1732, 174,
+    1746, 1754, 176, 1768, 1776, 178, 1790, 18, 1804, 1812, 182, 1826, 1834, 184, 1848, 1856,
+    186, 188, 1892, 190, 192, 194, 1950, 196, 198, 3, 2009, 203, 205, 2053, 207, 209,
+    211, 2111, 213, 215, 217, 2169, 219, 23, 2213, 223, 225, 227, 2271, 229, 231, 233,
+    2329, 235, 237, 2373, 239, 25, 243, 2431, 245, 247, 249, 2489, 251, 253, 2533, 255,
+    257, 259, 2591, 27, 263, 265, 2649, 267, 269, 2693, 271, 273, 275, 2751, 277, 279,
+    29, 2809, 283, 285, 2853, 287, 289, 291, 2911, 293, 295, 297, 2969, 299, 31, 3013,
+    303, 305, 307, 3071, 309, 311, 313, 3129, 315, 317, 3173, 319, 33, 323, 3231, 325,
+    327, 329, 3289, 331, 333, 3333, 335, 337, 339, 3391, 35, 343, 345, 3449, 347, 349,
+    3493, 351, 353, 355, 3551, 357, 359, 37, 3609, 363, 365, 3653, 367, 369, 371, 3711,
+    372, 376, 378, 38, 384, 388, 390, 392, 396, 4, 402, 404, 408, 410, 414, 416,
+    42, 422, 424, 428, 430, 434, 436, 44, 442, 446, 448, 452, 454, 456, 46, 462,
+    466, 468, 472, 474, 478, 48, 484, 486, 488, 492, 494, 498, 50, 504, 506, 510,
+    512, 516, 518, 52, 524, 526, 530, 532, 536, 538, 54, 544, 548, 550, 552, 556,
+    56, 562, 564, 568, 570, 574, 576, 58, 582, 584, 588, 590, 594, 596, 6, 602,
+    606, 608, 612, 614, 618, 62, 622, 626, 628, 632, 634, 638, 64, 644, 646, 650,
+    652, 654, 658, 66, 664, 666, 670, 672, 676, 678, 68, 684, 686, 690, 692, 696,
+    698, 70, 704, 708, 710, 714, 716, 72, 722, 724, 728, 730, 734, 736, 74, 742,
+    746, 750, 756, 76, 768, 774, 78, 786, 792, 8, 804, 810, 814, 82, 826, 832,
+    84, 844, 850, 856, 86, 868, 874, 88, 884, 890, 896, 90, 908, 914, 92, 926,
+    932, 94, 942, 948, 954, 96, 966, 972, 98, 984, 990, 996, 10, 1006, 1012, 102,
+    1024, 1030, 1036, 104, 1048, 1054, 106, 1066, 1072, 1076, 108, 1088, 1094, 110, 1106, 1112,
+    112, 1124, 1130, 1136, 114, 1146, 1152, 116, 1164, 1170, 1176, 118, 1188, 1194, 12, 1204,
+    1210, 1216, 122, 1228, 1234, 124, 1246, 1252, 126, 1264, 1268, 1274, 128, 1286, 1292, 130,
+    1304, 1310, 1316, 132, 1328, 1332, 134, 1344, 1350, 1356, 136, 1368, 1374, 138, 1386, 1392,
+    1396, 14, 1408, 1414, 142, 1426, 1432, 144, 1444, 1450, 1456, 146, 1466, 1472, 148, 1484,
+    1490, 150, 1514, 152, 154, 1548, 156, 1572, 158, 16, 1606, 162, 1630, 164, 1654, 166,
+    168, 1688, 170, 1712, 172, 174, 1746, 176, 1770, 178, 1792, 18, 182, 1828, 184, 1852,
+    186, 188, 1886, 190, 1910, 192, 1932, 194, 196, 1968, 198, 1990, 3, 2015, 203, 205,
+    2049, 207, 2073, 209, 211, 2109, 213, 2131, 215, 2155, 217, 219, 2189, 23, 2213, 223,
+    225, 2247, 227, 2271, 229, 2295, 231, 233, 2329, 235, 2353, 237, 239, 2387, 25, 2411,
+    243, 2435, 245, 247, 2469, 249, 2493, 251, 253, 2527, 255, 2551, 257, 2573, 259, 27,
+    2609, 263, 2631, 265, 267, 2667, 269, 2691, 271, 2713, 273, 275, 2749, 277, 2771, 279,
+    2795, 29, 283, 2829, 285, 2853, 287, 289, 2889, 291, 2911, 293, 2935, 295, 297, 2969,
+    298, 30, 302, 306, 308, 310, 312, 314, 316, 32, 322, 324, 326, 328, 330, 332,
+    336, 338, 34, 342, 344, 346, 350, 352, 354, 356, 358, 36, 364, 366, 368, 370,
+    372, 374, 378, 38, 382, 384, 386, 388, 392, 394, 396, 398, 4, 402, 406, 408,
+    410, 412, 414, 416, 42, 422, 424, 426, 428, 430, 434, 436, 438, 44, 442, 444,
+    448, 450, 452, 454, 456, 458, 46, 464, 466, 468, 470, 472, 474, 478, 48, 482,
+    484, 486, 488, 492, 494, 496, 498, 50, 502, 506, 508, 510, 512, 514, 516, 52,
+    522, 524, 526, 528, 530, 534, 536, 538, 54, 542, 544, 548, 550, 552, 554, 556,
+    558, 56, 564, 566, 568, 570, 572, 576, 578, 58, 582, 584, 586, 590, 592, 594,
+    596, 6, 606, 610, 614, 62, 624, 628, 634, 64, 642, 648, 652, 656, 66, 666,
+    670, 676, 68, 684, 690, 694, 70, 704, 708, 712, 718, 72, 726, 732, 736, 74,
+    746, 750, 754, 76, 764, 768, 772, 778, 78, 786, 792, 796, 8, 806, 810, 814,
+    82, 824, 828, 834, 84, 842, 848, 852, 856, 86, 866, 870, 876, 88, 884, 890,
+    894, 90, 904, 908, 912, 918, 92, 926, 932, 936, 94, 946, 950, 954, 96, 964,
+    968, 974, 98, 982, 988, 992, 996, 10, 1006, 1010, 1016, 102, 1024, 1030, 1034, 104,
+    1044, 1048, 1052, 1058, 106, 1066, 1072, 1076, 108, 1084, 1090, 1094, 110, 1104, 1108, 1112,
+    1118, 112, 1126, 1132, 1136, 114, 1146, 1150, 1154, 116, 1164, 1168, 1174, 118, 1182, 1188,
+    1192, 12, 1210, 122, 1230, 124, 1248, 126, 1266, 128, 1286, 1294, 130, 1314, 132, 1332,
+    134, 1350, 136, 1370, 138, 1388, 14, 1406, 142, 1424, 1434, 144, 1452, 146, 1472, 148,
+    1490, 150, 1508, 152, 1528, 154, 1546, 1556, 156, 1574, 158, 1592, 16, 1612, 162, 1630,
+    164, 1648, 166, 1668, 168, 1686, 1696, 170, 1714, 172, 1732, 174, 1750, 176, 1770, 178,
+    1788, 18, 1806, 182, 1826, 1834, 184, 1854, 186, 1872, 188, 1890, 190, 1910, 192, 1928,
+    194, 1946, 196, 1966, 1974, 198, 1994, 3, 2013, 203, 2031, 205, 2049, 207, 2069, 209,
+    2087, 211, 2105, 2115, 213, 2133, 215, 2153, 217, 2171, 219, 2189, 23, 2209, 223, 2227,
+    2237, 225, 2255, 227, 2273, 229, 2293, 231, 2311, 233, 2329, 235, 2347, 237, 2367, 2375,
+    238, 24, 242, 244, 246, 248, 250, 252, 254, 256, 2570, 258, 26, 262, 264, 266,
+    268, 270, 272, 274, 276, 278, 28, 282, 284, 2850, 286, 288, 290, 292, 294, 296,
+    298, 30, 302, 304, 306, 308, 310, 3110, 312, 314, 316, 318, 32, 322, 324, 326,
+    328, 330, 332, 334, 336, 338, 3390, 34, 342, 344, 346, 348, 350, 352, 354, 356,
+    358, 36, 362, 364, 366, 3670, 368, 370, 372, 374, 376, 378, 38, 382, 384, 386,
+    388, 390, 392, 3930, 394, 396, 398, 4, 402, 404, 406, 408, 410, 412, 414, 416,
+    418, 42, 4210, 422, 424, 426, 428, 430, 432, 434, 436, 438, 44, 442, 444, 446,
+    4470, 448, 450, 452, 454, 456, 458, 46, 462, 464, 466, 468, 470, 472, 474, 4750,
+    476, 48, 484, 488, 492, 496, 50, 502, 506, 510, 514, 518, 52, 526, 528, 532,
+    536, 54, 544, 548, 552, 556, 56, 562, 566, 570, 574, 578, 58, 584, 588, 592,
+    596, 6, 604, 608, 610, 614, 62, 622, 626, 630, 634, 638, 64, 644, 648, 652,
+    656, 66, 664, 666, 670, 674, 678, 68, 686, 690, 692, 696, 70, 704, 708, 712,
+    716, 72, 722, 726, 730, 734, 738, 74, 746, 748, 752, 756, 76, 764, 768, 772,
+    774, 78, 782, 786, 790, 794, 798, 8, 804, 808, 812, 816, 82, 824, 828, 830,
+    834, 84, 842, 846, 850, 854, 856, 86, 864, 868, 872, 876, 88, 882, 886, 890,
+    894, 898, 90, 906, 908, 912, 916, 92, 924, 928, 932, 936, 94, 942, 946, 950,
+    954, 96, 968, 976, 98, 990, 10, 1006, 1014, 102, 1028, 1036, 104, 1050, 106, 1066,
+    1072, 108, 1088, 1096, 110, 1110, 112, 1126, 1132, 114, 1148, 1154, 116, 1170, 118, 1184,
+    1192, 12, 1206, 1214, 122, 1230, 124, 1244, 1252, 126, 1266, 1274, 128, 1288, 130, 1304,
+    1312, 132, 1326, 1334, 134, 1348, 1356, 136, 1370, 138, 1386, 1394, 14, 1408, 1416, 142,
+    1430, 144, 1446, 1452, 146, 1468, 1476, 148, 1490, 150, 1506, 1512, 152, 1528, 1534, 154,
+    1550, 156, 1564, 1572, 158, 1586, 1594, 16, 1610, 162, 1624, 1632, 164, 1646, 1654, 166,
+    1668, 168, 1684, 1692, 170, 1706, 1714, 172, 1728, 1736, 174, 1750, 176, 1766, 1774, 178,
+    1788, 1796, 18, 1810, 182, 1826, 1832, 184, 1848, 1856, 186, 1870, 188, 1884, 1892, 190,
+    1908, 192, 194, 1952, 196, 198, 3, 2013, 203, 205, 207, 2073, 209, 211, 213, 2131,
+    215, 217, 219, 2191, 23, 223, 225, 2251, 227, 229, 231, 2311, 233, 235, 237, 2371,
+    239, 25, 243, 2429, 245, 247, 249, 2489, 251, 253, 255, 2549, 257, 259, 27, 2609,
+    263, 265, 2653, 267, 269, 271, 2713, 273, 275, 277, 2773, 279, 29, 283, 2833, 285,
+    287, 289, 2891, 291, 293, 295, 2951, 297, 299, 31, 3011, 303, 305, 307, 3071, 309,
+    311, 313, 3131, 315, 317, 319, 3189, 33, 323, 325, 3249, 327, 329, 331, 3309, 333,
+    335, 337, 3369, 339, 35, 3413, 343, 345, 347, 3473, 349, 351, 353, 3533, 355, 357,
+    359, 3593, 37, 363, 365, 3651, 367, 369, 371, 3711, 373, 375, 377, 3771, 379, 39,
+    382, 384, 388, 390, 394, 396, 4, 402, 406, 408, 412, 414, 418, 42, 424, 426,
+    430, 432, 436, 438, 44, 444, 448, 450, 452, 456, 46, 462, 464, 468, 470, 474,
+    476, 48, 482, 486, 488, 492, 494, 498, 50, 504, 506, 510, 512, 516, 52, 522,
+    524, 528, 530, 534, 536, 54, 542, 546, 548, 552, 554, 558, 56, 564, 566, 570,
+    572, 576, 578, 58, 584, 588, 590, 594, 596, 6, 602, 604, 608, 610, 614, 616,
+    62, 622, 626, 628, 632, 634, 638, 64, 644, 646, 650, 652, 656, 66, 662, 664,
+    668, 670, 674, 676, 68, 682, 686, 688, 692, 694, 698, 70, 704, 706, 710, 712,
+    716, 718, 72, 724, 728, 730, 734, 736, 74, 742, 746, 748, 752, 754, 756, 76,
+    762, 768, 774, 78, 786, 792, 8, 804, 810, 816, 82, 828, 834, 84, 846, 852,
+    86, 864, 870, 876, 88, 888, 894, 90, 906, 912, 92, 924, 930, 936, 94, 948,
+    954, 96, 966, 972, 98, 984, 990, 996, 10, 1008, 1014, 102, 1026, 1032, 104, 1044,
+    1050, 1056, 106, 1066, 1072, 108, 1084, 1090, 1096, 110, 1108, 1114, 112, 1126, 1132, 114,
+    1144, 1150, 1156, 116, 1168, 1174, 118, 1186, 1192, 12, 1204, 1210, 1216, 122, 1228, 1234,
+    124, 1246, 1252, 126, 1264, 1270, 1276, 128, 1288, 1294, 130, 1306, 1312, 132, 1324, 1330,
+    1336, 134, 1348, 1354, 136, 1364, 1370, 1376, 138, 1388, 1394, 14, 1406, 1412, 142, 1424,
+    1430, 1436, 144, 1448, 1454, 146, 1466, 1472, 148, 1484, 1490, 1496, 150, 1508, 1514, 152,
+    1526, 154, 1550, 156, 1574, 158, 16, 1610, 162, 1634, 164, 166, 1668, 168, 1692, 170,
+    172, 1728, 174, 1752, 176, 178, 1788, 18, 1812, 182, 184, 1848, 186, 1872, 188, 190,
+    1908, 192, 1932, 194, 196, 1966, 198, 1990, 3, 203, 2027, 205, 2051, 207, 209, 2087,
+    211, 2111, 213, 2135, 215, 217, 2171, 219, 2195, 23, 223, 2231, 225, 2255, 227, 229,
+    2289, 231, 2313, 233, 235, 2349, 237, 2373, 239, 25, 2409, 243, 2433, 245, 247, 2469,
+    249, 2493, 251, 253, 2529, 255, 2553, 257, 259, 2587, 27, 2611, 263, 265, 2647, 267,
+    2671, 269, 271, 2707, 273, 2731, 275, 2755, 277, 279, 2791, 29, 2815, 283, 285, 2851,
+    287, 2873, 289, 291, 2909, 293, 2933, 295, 297, 2969, 299, 2993, 31, 303, 3029, 305,
+    306, 308, 310, 312, 314, 318, 32, 322, 324, 326, 330, 332, 334, 336, 338, 34,
+    344, 346, 348, 350, 352, 356, 358, 36, 362, 364, 368, 370, 372, 374, 376, 38,
+    382, 384, 386, 388, 392, 394, 396, 398, 4, 402, 406, 408, 410, 412, 414, 418,
+    42, 422, 424, 426, 430, 432, 434, 436, 438, 44, 444, 446, 448, 450, 452, 456,
+    458, 46, 462, 464, 468, 470, 472, 474, 476, 48, 482, 484, 486, 488, 492, 494,
+    496, 498, 50, 504, 506, 508, 510, 512, 514, 518, 52, 522, 524, 526, 530, 532,
+    534, 536, 54, 542, 544, 546, 548, 550, 554, 556, 558, 56, 562, 566, 568, 570,
+    572, 574, 576, 58, 582, 584, 586, 588, 592, 594, 596, 598, 6, 604, 606, 608,
+    610, 616, 62, 624, 630, 634, 64, 644, 648, 654, 66, 662, 668, 672, 678, 68,
+    686, 692, 696, 70, 706, 710, 716, 72, 724, 730, 734, 74, 744, 748, 754, 76,
+    762, 768, 772, 778, 78, 786, 792, 796, 8, 806, 810, 816, 82, 824, 830, 834,
+    84, 844, 848, 854, 86, 864, 868, 872, 878, 88, 886, 892, 896, 90, 906, 910,
+    916, 92, 926, 930, 934, 94, 944, 948, 954, 96, 964, 968, 972, 978, 98, 988,
+    992, 996, 10, 1006, 1010, 1016, 102, 1026, 1030, 1034, 104, 1044, 1050, 1054, 106, 1064,
+    1068, 1072, 108, 1082, 1088, 1092, 1096, 110, 1106, 1112, 1116, 112, 1126, 1130, 1134, 114,
+    1144, 1150, 1154, 116, 1164, 1168, 1174, 118, 1182, 1188, 1192, 1196, 12, 1206, 1212, 1216,
+    122, 1230, 124, 1250, 126, 1268, 128, 1288, 130, 1306, 132, 1326, 1336, 134, 1354, 136,
+    1374, 138, 1392, 14, 1412, 142, 1430, 144, 1450, 146, 1468, 148, 1488, 150, 1506, 152,
+    1526, 154, 1544, 1554, 156, 1574, 158, 1592, 16, 1612, 162, 1630, 164, 1650, 166, 1668,
+    168, 1688, 170, 1708, 172, 1726, 174, 1746, 1754, 176, 1774, 178, 1792, 18, 1812, 182,
+    1832, 184, 1850, 186, 1870, 188, 1888, 190, 1908, 192, 1926, 194, 1946, 1956, 196, 1974,
+    198, 1994, 3, 2013, 203, 2033, 205, 2051, 207, 2071, 209, 2089, 211, 2109, 213, 2127,
+    215, 2147, 217, 2165, 2175, 219, 2195, 23, 2213, 223, 2233, 225, 2251, 227, 2271, 229,
+    2289, 231, 2309, 233, 2327, 235, 2347, 237, 2367, 2375, 239, 2395, 25, 2413, 243, 2433,
+    244, 246, 248, 250, 252, 254, 256, 258, 26, 262, 264, 266, 2670, 268, 270, 272,
+    274, 276, 278, 28, 282, 284, 286, 288, 290, 292, 294, 296, 298, 30, 302, 304,
+    306, 308, 3090, 310, 312, 314, 316, 318, 32, 322, 324, 326, 328, 330, 332, 334,
+    336, 338, 34, 342, 344, 346, 348, 3490, 350, 352, 354, 356, 358, 36, 362, 364,
+    366, 368, 370, 372, 374, 376, 378, 38, 382, 384, 386, 388, 390, 3910, 392, 394,
+    396, 398, 4, 402, 404, 406, 408, 410, 412, 414, 416, 418, 42, 422, 424, 426,
+    428, 430, 432, 4330, 434, 436, 438, 44, 442, 444, 446, 448, 450, 452, 454, 456,
+    458, 46, 462, 464, 466, 468, 470, 472, 4730, 474, 476, 478, 48, 482, 484, 486,
+    488, 492, 496, 50, 504, 508, 512, 514, 52, 522, 526, 530, 534, 538, 54, 546,
+    550, 554, 556, 56, 564, 568, 572, 576, 58, 584, 588, 592, 596, 6, 602, 606,
+    610, 614, 618, 62, 626, 630, 634, 638, 64, 644, 648, 652, 656, 66, 664, 668,
+    672, 676, 68, 682, 686, 690, 694, 698, 70, 706, 710, 714, 718, 72, 724, 728,
+    732, 736, 74, 744, 748, 752, 756, 76, 762, 766, 770, 774, 78, 782, 786, 790,
+    794, 798, 8, 804, 808, 812, 816, 82, 824, 828, 832, 836, 84, 844, 846, 850,
+    854, 86, 862, 866, 870, 874, 878, 88, 886, 888, 892, 896, 90, 904, 908, 912,
+    916, 92, 924, 926, 930, 934, 94, 942, 946, 950, 954, 958, 96, 966, 968, 972,
+    98, 984, 992, 10, 1008, 1014, 102, 1030, 104, 1046, 1052, 106, 1068, 1076, 108, 1092,
+    110, 1106, 1114, 112, 1130, 114, 1144, 1152, 116, 1168, 1174, 118, 1190, 12, 1206, 1214,
+    122, 1228, 1236, 124, 1252, 126, 1266, 1274, 128, 1290, 130, 1304, 1312, 132, 1328, 1336,
+    134, 1350, 136, 1366, 1374, 138, 1388, 1396, 14, 1412, 142, 1426, 1434, 144, 1450, 146,
+    1464, 1472, 148, 1488, 1496, 150, 1510, 152, 1526, 1534, 154, 1548, 156, 1564, 1572, 158,
+    1586, 1594, 16, 1610, 162, 1626, 1632, 164, 1648, 1656, 166, 1670, 168, 1686, 1694, 170,
+    1708, 172, 1724, 1732, 174, 1748, 1754, 176, 1770, 178, 1786, 1792, 18, 1808, 1816, 182,
+    1832, 184, 1846, 1854, 186, 1870, 188, 1884, 1892, 190, 1908, 1914, 192, 1930, 194, 1946,
+    196, 1968, 198, 3, 203, 2031, 205, 207, 209, 2091, 211, 213, 215, 2153, 217, 219,
+    23, 223, 2229, 225, 227, 229, 2289, 231, 233, 235, 2351, 237, 239, 25, 2411, 243,
+    245, 247, 2473, 249, 251, 253, 255, 2549, 257, 259, 27, 2611, 263, 265, 267, 2671,
+    269, 271, 273, 2733, 275, 277, 279, 2793, 29, 283, 285, 287, 2869, 289, 291, 293,
+    2931, 295, 297, 299, 2991, 31, 303, 305, 3053, 307, 309, 311, 313, 3129, 315, 317,
+    319, 3191, 33, 323, 325, 3251, 327, 329, 331, 3313, 333, 335, 337, 3373, 339, 35,
+    343, 345, 3449, 347, 349, 351, 3511, 353, 355, 357, 3571, 359, 37, 363, 3633, 365,
+    367, 369, 371, 3709, 373, 375, 377, 3769, 379, 39, 383, 3831, 385, 387, 389, 3891,
+    390, 394, 396, 4, 402, 406, 408, 412, 416, 418, 42, 424, 428, 430, 434, 436,
+    44, 442, 446, 448, 452, 454, 458, 46, 464, 466, 470, 474, 476, 48, 482, 486,
+    488, 492, 494, 498, 50, 504, 506, 510, 512, 516, 52, 522, 524, 528, 532, 534,
+    538, 54, 544, 546, 550, 552, 556, 558, 56, 564, 568, 570, 574, 576, 58, 582,
+    586, 588, 592, 596, 598, 6, 604, 608, 610, 614, 616, 62, 622, 626, 628, 632,
+    634, 638, 64, 644, 646, 650, 654, 656, 66, 662, 666, 668, 672, 674, 678, 68,
+    684, 686, 690, 692, 696, 70, 702, 704, 708, 712, 714, 718, 72, 724, 726, 730,
+    732, 736, 74, 742, 744, 748, 750, 754, 756, 76, 762, 766, 770, 772, 776, 778,
+    78, 788, 794, 8, 806, 812, 82, 824, 830, 836, 84, 848, 854, 86, 866, 872,
+    88, 886, 892, 90, 904, 910, 916, 92, 928, 934, 94, 946, 952, 96, 964, 970,
+    976, 98, 988, 994, 10, 1008, 1014, 102, 1026, 1032, 104, 1044, 1050, 1056, 106, 1068,
+    1074, 108, 1086, 1092, 110, 1104, 1110, 1116, 112, 1130, 1136, 114, 1148, 1154, 116, 1166,
+    1172, 118, 1184, 1190, 1196, 12, 1208, 1214, 122, 1226, 1232, 124, 1246, 1252, 126, 1264,
+    1270, 1276, 128, 1288, 1294, 130, 1306, 1312, 132, 1324, 1330, 1336, 134, 1348, 1354, 136,
+    1368, 1374, 138, 1386, 1392, 14, 1404, 1410, 1416, 142, 1428, 1434, 144, 1446, 1452, 146,
+    1464, 1470, 148, 1484, 1490, 1496, 150, 1508, 1514, 152, 1526, 1532, 154, 1544, 1550, 1556,
+    156, 158, 1586, 16, 1612, 162, 164, 1648, 166, 1672, 168, 170, 1708, 172, 1734, 174,
+    176, 1770, 178, 18, 1806, 182, 1832, 184, 186, 1868, 188, 1892, 190, 192, 1928, 194,
+    1954, 196, 198, 1990, 3, 203, 2027, 205, 2051, 207, 209, 2089, 211, 2113, 213, 215,
+    2149, 217, 2173, 219, 23, 2211, 223, 2235, 225, 227, 2271, 229, 231, 2309, 233, 2333,
+    235, 237, 2369, 239, 2393, 25, 243, 2431, 245, 2455, 247, 249, 2491, 251, 253, 2527,
+    255, 2553, 257, 259, 2589, 27, 2613, 263, 265, 2649, 267, 2675, 269, 271, 2711, 273,
+    275, 2747, 277, 2771, 279, 29, 2809, 283, 2833, 285, 287, 2869, 289, 2895, 291, 293,
+    2931, 295, 297, 2967, 299, 2991, 31, 303, 3029, 305, 3053, 307, 309, 3089, 311, 3113,
+    312, 314, 318, 32, 322, 324, 328, 330, 332, 334, 336, 34, 342, 344, 346, 350,
+    352, 354, 356, 36, 362, 364, 366, 368, 372, 374, 376, 378, 38, 384, 386, 388,
+    390, 394, 396, 398, 4, 402, 406, 408, 410, 412, 416, 418, 42, 422, 424, 428,
+    430, 432, 434, 438, 44, 442, 444, 446, 450, 452, 454, 456, 46, 462, 464, 466,
+    468, 472, 474, 476, 478, 48, 484, 486, 488, 490, 494, 496, 498, 50, 502, 506,
+    508, 510, 512, 516, 518, 52, 522, 524, 528, 530, 532, 534, 538, 54, 542, 544,
+    546, 550, 552, 554, 556, 56, 562, 564, 566, 568, 572, 574, 576, 578, 58, 584,
+    586, 588, 590, 594, 596, 598, 6, 604, 606, 608, 610, 612, 616, 618, 62, 622,
+    624, 630, 634, 64, 644, 650, 654, 66, 664, 668, 674, 68, 684, 688, 694, 70,
+    704, 708, 712, 72, 722, 728, 732, 738, 74, 748, 752, 756, 76, 766, 772, 776,
+    78, 786, 792, 796, 8, 806, 810, 816, 82, 826, 830, 834, 84, 844, 850, 854,
+    86, 864, 870, 874, 88, 884, 888, 894, 90, 904, 908, 914, 92, 922, 928, 932,
+    938, 94, 948, 952, 958, 96, 966, 972, 976, 98, 986, 992, 996, 10, 1006, 1010,
+    1016, 102, 1026, 1030, 1036, 104, 1044, 1050, 1054, 106, 1064, 1070, 1074, 108, 1084, 1088,
+    1094, 110, 1104, 1108, 1114, 112, 1124, 1128, 1132, 114, 1142, 1148, 1152, 1158, 116, 1166,
+    1172, 1176, 118, 1186, 1192, 1196, 12, 1206, 1210, 1216, 122, 1226, 1230, 1236, 124, 1246,
+    1250, 126, 1270, 128, 1290, 130, 1308, 132, 1328, 134, 1348, 136, 1368, 138, 1386, 14,
+    1406, 142, 1426, 144, 1446, 1456, 146, 1474, 148, 1494, 150, 1514, 152, 1534, 154, 1552,
+    156, 1572, 158, 1592, 16, 1612, 162, 1630, 164, 1650, 166, 1670, 168, 1690, 170, 1708,
+    172, 1728, 174, 1748, 176, 1768, 178, 1788, 18, 1806, 182, 1826, 184, 1846, 186, 1866,
+    1876, 188, 1894, 190, 1914, 192, 1934, 194, 1954, 196, 1972, 198, 1992, 3, 2013, 203,
+    2033, 205, 2051, 207, 2071, 209, 2091, 211, 2111, 213, 2129, 215, 2149, 217, 2169, 219,
+    2189, 23, 2209, 223, 2227, 225, 2247, 227, 2267, 229, 2287, 2295, 231, 2315, 233, 2335,
+    235, 2355, 237, 2375, 239, 2393, 25, 2413, 243, 2433, 245, 2453, 247, 2471, 249, 2491,
+    250, 252, 254, 256, 258, 26, 262, 264, 266, 268, 270, 272, 274, 276, 278, 28,
+    282, 284, 286, 288, 290, 2910, 292, 294, 296, 298, 30, 302, 304, 306, 308, 310,
+    312, 314, 316, 318, 32, 322, 324, 326, 328, 330, 332, 334, 336, 338, 34, 342,
+    344, 346, 348, 350, 352, 354, 356, 358, 36, 362, 364, 366, 368, 370, 372, 374,
+    3750, 376, 378, 38, 382, 384, 386, 388, 390, 392, 394, 396, 398, 4, 402, 404,
+    406, 408, 410, 412, 414, 416, 418, 42, 422, 424, 426, 428, 430, 432, 434, 436,
+    438, 44, 442, 444, 446, 448, 450, 452, 454, 456, 458, 4590, 46, 462, 464, 466,
+    468, 470, 472, 474, 476, 478, 48, 482, 484, 486, 488, 490, 492, 494, 496, 498,
+    50, 504, 508, 512, 516, 52, 524, 528, 532, 536, 54, 542, 546, 550, 554, 56,
+    562, 566, 570, 574, 58, 582, 586, 590, 594, 598, 6, 606, 610, 614, 618, 62,
+    624, 628, 632, 636, 64, 644, 648, 652, 656, 66, 664, 668, 672, 676, 68, 684,
+    688, 692, 696, 70, 704, 708, 710, 714, 72, 722, 726, 730, 734, 74, 742, 746,
+    750, 754, 758, 76, 766, 770, 774, 778, 78, 786, 790, 792, 796, 8, 804, 808,
+    812, 816, 82, 824, 828, 832, 836, 84, 844, 848, 852, 856, 86, 864, 868, 872,
+    876, 88, 882, 886, 890, 894, 90, 902, 906, 910, 914, 918, 92, 926, 930, 934,
+    938, 94, 946, 950, 954, 958, 96, 964, 968, 972, 976, 98, 984, 988, 992, 996,
+    10, 1008, 1016, 102, 1032, 104, 1046, 1054, 106, 1070, 108, 1086, 1094, 110, 1110, 112,
+    1124, 1132, 114, 1148, 116, 1164, 1172, 118, 1188, 1196, 12, 1210, 122, 1226, 1234, 124,
+    1250, 126, 1266, 1274, 128, 1290, 130, 1304, 1312, 132, 1328, 1336, 134, 1352, 136, 1368,
+    1376, 138, 1390, 14, 1406, 1414, 142, 1430, 144, 1446, 1454, 146, 1468, 148, 1484, 1492,
+    150, 1508, 1516, 152, 1532, 154, 1546, 1554, 156, 1570, 158, 1586, 1594, 16, 1610, 162,
+    1624, 1632, 164, 1648, 166, 1664, 1672, 168, 1688, 1696, 170, 1710, 172, 1726, 1734, 174,
+    1750, 176, 1766, 1774, 178, 1790, 18, 1804, 1812, 182, 1828, 1836, 184, 1852, 186, 1868,
+    1876, 188, 1890, 190, 1906, 1914, 192, 1930, 194, 1946, 1954, 196, 1968, 198, 1984, 1992,
+    2, 202, 2032, 204, 206, 208, 210, 2110, 212, 214, 216, 2172, 218, 22, 222, 224,
+    2250, 226, 228, 230, 232, 2328, 234, 236, 238, 2390, 24, 242, 244, 246, 2468, 248,
+    250, 252, 2532, 254, 256, 258, 26, 2610, 262, 264, 266, 2672, 268, 270, 272, 274,
+    2750, 276, 278, 28, 282, 2828, 284, 286, 288, 2890, 290, 292, 294, 296, 2968, 298,
+    30, 302, 3032, 304, 306, 308, 310, 3110, 312, 314, 316, 3172, 318, 32, 322, 324,
+    3250, 326, 328, 330, 332, 3328, 334, 336, 338, 3390, 34, 342, 344, 346, 3468, 348,
+    350, 352, 3532, 354, 356, 358, 36, 3610, 362, 364, 366, 3672, 368, 370, 372, 374,
+    3750, 376, 378, 38, 382, 3828, 384, 386, 388, 3890, 390, 392, 394, 396, 3968, 398,
+    4, 404, 406, 410, 412, 416, 42, 422, 424, 428, 432, 434, 438, 44, 444, 446,
+    450, 454, 456, 46, 462, 466, 468, 472, 476, 478, 48, 484, 488, 490, 494, 496,
+    50, 504, 506, 510, 512, 516, 52, 522, 524, 528, 532, 534, 538, 54, 544, 546,
+    550, 554, 556, 56, 562, 566, 568, 572, 576, 578, 58, 584, 588, 590, 594, 596,
+    6, 604, 606, 610, 612, 616, 62, 622, 624, 628, 632, 634, 638, 64, 644, 646,
+    650, 654, 656, 66, 662, 666, 668, 672, 676, 678, 68, 684, 688, 690, 694, 696,
+    70, 704, 706, 710, 712, 716, 72, 722, 724, 728, 732, 734, 738, 74, 744, 746,
+    750, 754, 756, 76, 762, 766, 768, 772, 776, 778, 78, 784, 788, 790, 794, 796,
+    8, 806, 812, 82, 824, 832, 84, 844, 850, 856, 86, 868, 876, 88, 888, 894,
+    90, 906, 912, 92, 924, 932, 94, 944, 950, 956, 96, 968, 976, 98, 988, 994,
+    10, 1006, 1012, 102, 1024, 1032, 104, 1044, 1050, 1056, 106, 1068, 1076, 108, 1088, 1094,
+    110, 1106, 1112, 112, 1124, 1132, 114, 1144, 1150, 1156, 116, 1168, 1176, 118, 1188, 1194,
+    12, 1206, 1212, 122, 1224, 1232, 124, 1244, 1250, 1256, 126, 1268, 1276, 128, 1288, 1294,
+    130, 1306, 1312, 132, 1324, 1332, 134, 1344, 1350, 1356, 136, 1368, 1376, 138, 1388, 1394,
+    14, 1406, 1412, 142, 1424, 1432, 144, 1444, 1450, 1456, 146, 1468, 1476, 148, 1488, 1494,
+    150, 1506, 1512, 152, 1524, 1532, 154, 1544, 1550, 1556, 156, 1568, 1576, 158, 1588, 1594,
+    16, 1612, 162, 164, 1650, 166, 168, 1688, 170, 1712, 172, 174, 1750, 176, 178, 1788,
+    18, 1812, 182, 184, 1850, 186, 188, 1888, 190, 1912, 192, 194, 1950, 196, 198, 1988,
+    3, 2013, 203, 205, 2051, 207, 209, 2089, 211, 2113, 213, 215, 2151, 217, 219, 2189,
+    23, 2213, 223, 225, 2251, 227, 229, 2289, 231, 2313, 233, 235, 2351, 237, 239, 2389,
+    25, 2413, 243, 245, 2451, 247, 249, 2489, 251, 2513, 253, 255, 2551, 257, 259, 2589,
+    27, 2613, 263, 265, 2651, 267, 269, 2689, 271, 2713, 273, 275, 2751, 277, 279, 2789,
+    29, 2813, 283, 285, 2851, 287, 289, 2889, 291, 2913, 293, 295, 2951, 297, 299, 2989,
+    31, 3013, 303, 305, 3051, 307, 309, 3089, 311, 3113, 313, 315, 3151, 317, 319, 3189,
+    32, 322, 324, 328, 330, 332, 336, 338, 34, 342, 344, 348, 350, 352, 356, 358,
+    36, 362, 364, 368, 370, 372, 376, 378, 38, 382, 384, 388, 390, 392, 396, 398,
+    4, 402, 404, 408, 410, 412, 416, 418, 42, 422, 424, 428, 430, 432, 436, 438,
+    44, 442, 444, 448, 450, 452, 456, 458, 46, 462, 464, 468, 470, 472, 476, 478,
+    48, 482, 484, 488, 490, 492, 496, 498, 50, 502, 504, 508, 510, 512, 516, 518,
+    52, 522, 524, 528, 530, 532, 536, 538, 54, 542, 544, 548, 550, 552, 556, 558,
+    56, 562, 564, 568, 570, 572, 576, 578, 58, 582, 584, 588, 590, 592, 596, 598,
+    6, 602, 604, 608, 610, 612, 616, 618, 62, 622, 624, 628, 630, 632, 636, 638,
+    64, 644, 650, 656, 66, 664, 670, 676, 68, 684, 690, 696, 70, 704, 710, 716,
+    72, 724, 730, 736, 74, 744, 750, 756, 76, 764, 770, 776, 78, 784, 790, 796,
+    8, 804, 810, 816, 82, 824, 830, 836, 84, 844, 850, 856, 86, 864, 870, 876,
+    88, 884, 890, 896, 90, 904, 910, 916, 92, 924, 930, 936, 94, 944, 950, 956,
+    96, 964, 970, 976, 98, 984, 990, 996, 10, 1004, 1010, 1016, 102, 1024, 1030, 1036,
+    104, 1044, 1050, 1056, 106, 1064, 1070, 1076, 108, 1084, 1090, 1096, 110, 1104, 1110, 1116,
+    112, 1124, 1130, 1136, 114, 1144, 1150, 1156, 116, 1164, 1170, 1176, 118, 1184, 1190, 1196,
+    12, 1204, 1210, 1216, 122, 1224, 1230, 1236, 124, 1244, 1250, 1256, 126, 1264, 1270, 1276,
+    128, 1290, 130, 1310, 132, 1330, 134, 1350, 136, 1370, 138, 1390, 14, 1410, 142, 1430,
+    144, 1450, 146, 1470, 148, 1490, 150, 1510, 152, 1530, 154, 1550, 156, 1570, 158, 1590,
+    16, 1610, 162, 1630, 164, 1650, 166, 1670, 168, 1690, 170, 1710, 172, 1730, 174, 1750,
+    176, 1770, 178, 1790, 18, 1810, 182, 1830, 184, 1850, 186, 1870, 188, 1890, 190, 1910,
+    192, 1930, 194, 1950, 196, 1970, 198, 1990, 3, 2011, 203, 2031, 205, 2051, 207, 2071,
+    209, 2091, 211, 2111, 213, 2131, 215, 2151, 217, 2171, 219, 2191, 23, 2211, 223, 2231,
+    225, 2251, 227, 2271, 229, 2291, 231, 2311, 233, 2331, 235, 2351, 237, 2371, 239, 2391,
+    25, 2411, 243, 2431, 245, 2451, 247, 2471, 249, 2491, 251, 2511, 253, 2531, 255, 2551,
+    256, 258, 26, 262, 264, 266, 268, 270, 272, 274, 276, 278, 28, 282, 284, 286,
+    288, 290, 292, 294, 296, 298, 30, 302, 304, 306, 308, 310, 312, 314, 316, 318,
+    32, 322, 324, 326, 328, 330, 332, 334, 336, 338, 34, 342, 344, 346, 348, 350,
+    352, 354, 356, 358, 36, 362, 364, 366, 368, 370, 372, 374, 376, 378, 38, 382,
+    384, 386, 388, 390, 392, 394, 396, 398, 4, 402, 404, 406, 408, 410, 412, 414,
+    416, 418, 42, 422, 424, 426, 428, 430, 432, 434, 436, 438, 44, 442, 444, 446,
+    448, 450, 452, 454, 456, 458, 46, 462, 464, 466, 468, 470, 472, 474, 476, 478,
+    48, 482, 484, 486, 488, 490, 492, 494, 496, 498, 50, 502, 504, 506, 508, 510,
+    512, 516, 52, 524, 528, 532, 536, 54, 544, 548, 552, 556, 56, 564, 568, 572,
+    576, 58, 584, 588, 592, 596, 6, 604, 608, 612, 616, 62, 624, 628, 632, 636,
+    64, 644, 648, 652, 656, 66, 664, 668, 672, 676, 68, 684, 688, 692, 696, 70,
+    704, 708, 712, 716, 72, 724, 728, 732, 736, 74, 744, 748, 752, 756, 76, 764,
+    768, 772, 776, 78, 784, 788, 792, 796, 8, 804, 808, 812, 816, 82, 824, 828,
+    832, 836, 84, 844, 848, 852, 856, 86, 864, 868, 872, 876, 88, 884, 888, 892,
+    896, 90, 904, 908, 912, 916, 92, 924, 928, 932, 936, 94, 944, 948, 952, 956,
+    96, 964, 968, 972, 976, 98, 984, 988, 992, 996, 10, 1004, 1008, 1012, 1016, 102,
+    1024, 1032, 104, 1048, 106, 1064, 1072, 108, 1088, 1096, 110, 1112, 112, 1128, 114, 1144,
+    1152, 116, 1168, 1176, 118, 1192, 12, 1208, 122, 1224, 1232, 124, 1248, 1256, 126, 1272,
+    128, 1288, 130, 1304, 1312, 132, 1328, 1336, 134, 1352, 136, 1368, 138, 1384, 1392, 14,
+    1408, 1416, 142, 1432, 144, 1448, 146, 1464, 1472, 148, 1488, 1496, 150, 1512, 152, 1528,
+    154, 1544, 1552, 156, 1568, 1576, 158, 1592, 16, 1608, 162, 1624, 1632, 164, 1648, 1656,
+    166, 1672, 168, 1688, 170, 1704, 1712, 172, 1728, 1736, 174, 1752, 176, 1768, 178, 1784,
+    1792, 18, 1808, 1816, 182, 1832, 184, 1848, 186, 1864, 1872, 188, 1888, 1896, 190, 1912,
+    192, 1928, 194, 1944, 1952, 196, 1968, 1976, 198, 1992, 3, 2009, 203, 2025, 2033, 205,
+    2048, 206, 208, 210, 212, 2128, 214, 216, 218, 2192, 22, 222, 224, 226, 228, 2288,
+    230, 232, 234, 2352, 236, 238, 24, 242, 244, 2448, 246, 248, 250, 2512, 252, 254,
+    256, 258, 26, 2608, 262, 264, 266, 2672, 268, 270, 272, 274, 276, 2768, 278, 28,
+    282, 2832, 284, 286, 288, 290, 292, 2928, 294, 296, 298, 2992, 30, 302, 304, 306,
+    308, 3088, 310, 312, 314, 3152, 316, 318, 32, 322, 324, 3248, 326, 328, 330, 3312,
+    332, 334, 336, 338, 34, 3408, 342, 344, 346, 3472, 348, 350, 352, 354, 356, 3568,
+    358, 36, 362, 3632, 364, 366, 368, 370, 372, 3728, 374, 376, 378, 3792, 38, 382,
+    384, 386, 388, 3888, 390, 392, 394, 3952, 396, 398, 4, 402, 404, 4048, 406, 408,
+    410, 412, 416, 42, 422, 426, 428, 432, 436, 438, 44, 444, 448, 452, 454, 458,
+    46, 464, 468, 470, 474, 476, 48, 484, 486, 490, 492, 496, 50, 502, 506, 508,
+    512, 516, 52, 522, 524, 528, 532, 534, 538, 54, 544, 548, 550, 554, 556, 56,
+    564, 566, 570, 572, 576, 58, 582, 586, 588, 592, 596, 598, 6, 604, 608, 612,
+    614, 618, 62, 624, 628, 630, 634, 636, 64, 644, 646, 650, 652, 656, 66, 662,
+    666, 668, 672, 676, 68, 682, 684, 688, 692, 694, 698, 70, 704, 708, 710, 714,
+    716, 72, 724, 726, 730, 732, 736, 74, 742, 746, 748, 752, 756, 758, 76, 764,
+    768, 772, 774, 778, 78, 784, 788, 790, 794, 796, 8, 804, 806, 810, 812, 816,
+    82, 826, 832, 84, 844, 852, 86, 864, 870, 876, 88, 890, 896, 90, 908, 916,
+    92, 928, 934, 94, 948, 954, 96, 966, 972, 98, 986, 992, 10, 1004, 1012, 102,
+    1024, 1030, 104, 1044, 1050, 1056, 106, 1068, 1076, 108, 1088, 1094, 110, 1108, 1114, 112,
+    1126, 1132, 114, 1146, 1152, 116, 1164, 1172, 118, 1184, 1190, 1196, 12, 1210, 1216, 122,
+    1228, 1236, 124, 1248, 1254, 126, 1268, 1274, 128, 1286, 1292, 130, 1306, 1312, 132, 1324,
+    1332, 134, 1344, 1350, 136, 1364, 1370, 1376, 138, 1388, 1396, 14, 1408, 1414, 142, 1428,
+    1434, 144, 1446, 1452, 146, 1466, 1472, 148, 1484, 1492, 150, 1504, 1510, 1516, 152, 1530,
+    1536, 154, 1548, 1556, 156, 1568, 1574, 158, 1588, 1594, 16, 1606, 1612, 162, 1626, 1632,
+    164, 1652, 166, 168, 1690, 170, 172, 1728, 174, 1754, 176, 178, 1792, 18, 182, 1830,
+    184, 186, 1868, 188, 190, 1908, 192, 1932, 194, 196, 1972, 198, 3, 2011, 203, 205,
+    2049, 207, 209, 2087, 211, 2113, 213, 215, 2151, 217, 219, 2189, 23, 223, 2229, 225,
+    2253, 227, 229, 2293, 231, 233, 2331, 235, 237, 2369, 239, 2395, 25, 243, 2433, 245,
+    247, 2471, 249, 251, 2509, 253, 255, 2549, 257, 2573, 259, 27, 2613, 263, 265, 2651,
+    267, 269, 2689, 271, 273, 2727, 275, 2753, 277, 279, 2791, 29, 283, 2829, 285, 287,
+    2869, 289, 2893, 291, 293, 2933, 295, 297, 2971, 299, 31, 3009, 303, 3035, 305, 307,
+    3073, 309, 311, 3111, 313, 315, 3149, 317, 319, 3189, 33, 3213, 323, 325, 3253, 327,
+    328, 330, 332, 336, 338, 34, 344, 346, 348, 350, 354, 356, 358, 36, 364, 366,
+    368, 372, 374, 376, 38, 382, 384, 386, 390, 392, 394, 396, 4, 402, 404, 408,
+    410, 412, 414, 418, 42, 422, 424, 428, 430, 432, 436, 438, 44, 442, 446, 448,
+    450, 454, 456, 458, 46, 464, 466, 468, 472, 474, 476, 478, 48, 484, 486, 488,
+    492, 494, 496, 50, 502, 504, 506, 510, 512, 514, 518, 52, 522, 524, 528, 530,
+    532, 536, 538, 54, 542, 546, 548, 550, 552, 556, 558, 56, 564, 566, 568, 570,
+    574, 576, 578, 58, 584, 586, 588, 592, 594, 596, 6, 602, 604, 606, 610, 612,
+    614, 616, 62, 622, 624, 628, 630, 632, 634, 638, 64, 642, 646, 648, 650, 652,
+    656, 66, 666, 670, 676, 68, 686, 692, 696, 70, 706, 712, 716, 72, 728, 732,
+    738, 74, 748, 752, 76, 762, 768, 774, 78, 784, 788, 794, 8, 804, 808, 814,
+    82, 824, 830, 834, 84, 844, 850, 856, 86, 866, 870, 876, 88, 886, 890, 896,
+    90, 906, 912, 916, 92, 926, 932, 936, 94, 948, 952, 958, 96, 968, 972, 98,
+    984, 988, 994, 10, 1004, 1008, 1014, 102, 1024, 1030, 1034, 104, 1044, 1050, 1054, 106,
+    1064, 1070, 1076, 108, 1086, 1090, 1096, 110, 1106, 1112, 1116, 112, 1126, 1132, 1136, 114,
+    1146, 1152, 1158, 116, 1168, 1172, 118, 1182, 1188, 1192, 12, 1204, 1208, 1214, 122, 1224,
+    1228, 1234, 124, 1244, 1250, 1254, 126, 1264, 1270, 1274, 128, 1286, 1290, 1296, 130, 1306,
+    1310, 132, 1332, 134, 1352, 136, 1372, 138, 1392, 14, 1414, 142, 1434, 144, 1454, 146,
+    1474, 148, 150, 1506, 152, 1526, 154, 1546, 156, 1566, 158, 1588, 16, 1608, 162, 1628,
+    164, 1648, 166, 1670, 168, 1690, 170, 1710, 172, 1730, 174, 1752, 176, 1772, 178, 1792,
+    18, 1812, 182, 1832, 184, 1854, 186, 1874, 188, 1894, 190, 1914, 192, 194, 1946, 196,
+    1966, 198, 1986, 3, 2009, 203, 2029, 205, 2049, 207, 2069, 209, 2089, 211, 2111, 213,
+    2131, 215, 2151, 217, 2171, 219, 2193, 23, 2213, 223, 2233, 225, 2253, 227, 2275, 229,
+    2295, 231, 2315, 233, 2335, 235, 237, 2367, 239, 2387, 25, 2407, 243, 2427, 245, 2449,
+    247, 2469, 249, 2489, 251, 2509, 253, 2531, 255, 2551, 257, 2571, 259, 2591, 27, 2613,
+    262, 264, 266, 268, 270, 272, 274, 276, 278, 28, 282, 284, 286, 288, 290, 292,
+    294, 296, 30, 302, 304, 306, 308, 310, 312, 314, 316, 318, 32, 322, 324, 326,
+    328, 330, 332, 334, 336, 338, 34, 342, 344, 346, 348, 350, 352, 354, 356, 358,
+    36, 362, 364, 366, 368, 370, 372, 374, 376, 378, 38, 382, 386, 388, 390, 392,
+    394, 396, 398, 4, 402, 404, 406, 408, 410, 412, 414, 416, 418, 42, 422, 424,
+    426, 428, 430, 432, 434, 436, 438, 44, 442, 444, 446, 448, 450, 452, 454, 456,
+    458, 46, 462, 464, 466, 468, 472, 474, 476, 478, 48, 482, 484, 486, 488, 490,
+    492, 494, 496, 498, 50, 502, 504, 506, 508, 510, 512, 514, 516, 518, 52, 522,
+    524, 528, 532, 536, 54, 544, 548, 552, 558, 56, 566, 570, 574, 578, 58, 586,
+    590, 594, 6, 602, 606, 610, 614, 62, 622, 626, 630, 634, 64, 644, 648, 652,
+    656, 66, 664, 668, 672, 676, 68, 684, 688, 692, 696, 70, 704, 708, 712, 716,
+    72, 724, 730, 734, 738, 74, 746, 750, 754, 758, 76, 766, 770, 774, 78, 782,
+    786, 790, 794, 8, 802, 806, 812, 816, 82, 824, 828, 832, 836, 84, 844, 848,
+    852, 856, 86, 864, 868, 872, 876, 88, 884, 888, 892, 898, 90, 906, 910, 914,
+    918, 92, 926, 930, 934, 94, 942, 946, 950, 954, 96, 962, 966, 970, 974, 98,
+    984, 988, 992, 996, 10, 1004, 1008, 1012, 1016, 102, 1024, 1028, 1032, 1036, 104, 1044,
+    1048, 106, 1064, 1074, 108, 1090, 110, 1106, 1114, 112, 1130, 114, 1146, 1156, 116, 1172,
+    118, 1188, 12, 1204, 1212, 122, 1228, 124, 1246, 1254, 126, 1270, 128, 1286, 1294, 130,
+    1310, 132, 1328, 1336, 134, 1352, 136, 1368, 138, 1384, 1392, 14, 1410, 142, 1426, 1434,
+    144, 1450, 146, 1466, 1474, 148, 1490, 150, 1508, 1516, 152, 1532, 154, 1548, 156, 1564,
+    1572, 158, 1590, 16, 1606, 1614, 162, 1630, 164, 1646, 1654, 166, 1672, 168, 1688, 1696,
+    170, 1712, 172, 1728, 174, 1744, 1754, 176, 1770, 178, 1786, 1794, 18, 1810, 182, 1826,
+    1836, 184, 1852, 186, 1868, 188, 1884, 1892, 190, 1908, 192, 1924, 1934, 194, 1950, 196,
+    1966, 1974, 198, 1990, 3, 2009, 2017, 203, 2033, 205, 2049, 207, 2065, 2073, 209, 2089,
+    210, 212, 2130, 214, 216, 218, 22, 222, 2228, 224, 226, 228, 230, 2310, 232, 234,
+    236, 238, 24, 2408, 242, 244, 246, 248, 2490, 250, 252, 254, 256, 258, 2588, 26,
+    262, 264, 266, 2670, 268, 270, 272, 274, 276, 2768, 278, 28, 282, 284, 2850, 286,
+    288, 290, 292, 294, 2948, 296, 298, 30, 302, 3032, 304, 306, 308, 310, 312, 3130,
+    314, 316, 318, 32, 3212, 322, 324, 326, 328, 330, 3310, 332, 334, 336, 338, 3392,
+    34, 342, 344, 346, 348, 3490, 350, 352, 354, 356, 3572, 358, 36, 362, 364, 366,
+    3670, 368, 370, 372, 374, 376, 3768, 378, 38, 382, 384, 3850, 386, 388, 390, 392,
+    394, 3948, 396, 398, 4, 402, 4030, 404, 406, 408, 410, 412, 4128, 414, 416, 418,
+    42, 422, 426, 430, 432, 436, 44, 442, 446, 448, 452, 456, 46, 462, 466, 468,
+    472, 476, 48, 482, 484, 488, 492, 494, 498, 50, 504, 508, 512, 514, 518, 52,
+    524, 528, 530, 534, 538, 54, 544, 548, 550, 554, 558, 56, 564, 566, 570, 574,
+    576, 58, 584, 586, 590, 594, 596, 6, 602, 606, 610, 612, 616, 62, 622, 626,
+    630, 632, 636, 64, 642, 646, 648, 652, 656, 66, 662, 666, 668, 672, 676, 678,
+    68, 684, 688, 692, 694, 698, 70, 704, 708, 712, 714, 718, 72, 724, 728, 730,
+    734, 738, 74, 744, 748, 750, 754, 756, 76, 764, 766, 770, 774, 776, 78, 784,
+    786, 790, 792, 796, 8, 802, 806, 810, 812, 816, 82, 822, 826, 830, 832, 836,
+    84, 846, 852, 86, 866, 872, 88, 884, 892, 90, 904, 910, 92, 924, 930, 94,
+    944, 950, 96, 964, 970, 976, 98, 990, 996, 10, 1010, 1016, 102, 1028, 1036, 104,
+    1048, 1056, 106, 1068, 1074, 108, 1088, 1094, 110, 1108, 1114, 112, 1128, 1134, 114, 1146,
+    1154, 116, 1166, 1174, 118, 1186, 1192, 12, 1206, 1212, 122, 1226, 1232, 124, 1246, 1252,
+    126, 1264, 1272, 128, 1284, 1292, 130, 1304, 1310, 132, 1324, 1330, 134, 1344, 1350, 1356,
+    136, 1370, 1376, 138, 1390, 1396, 14, 1410, 1416, 142, 1428, 1436, 144, 1448, 1454, 146,
+    1468, 1474, 148, 1488, 1494, 150, 1508, 1514, 152, 1526, 1534, 154, 1546, 1554, 156, 1566,
+    1572, 158, 1586, 1592, 16, 1606, 1612, 162, 1626, 1632, 164, 1644, 1652, 166, 1664, 1672,
+    168, 1690, 170, 172, 1730, 174, 176, 1770, 178, 18, 1808, 182, 184, 1848, 186, 188,
+    1888, 190, 192, 1926, 194, 1952, 196, 198, 1992, 3, 203, 2033, 205, 207, 2071, 209,
+    211, 2111, 213, 215, 2151, 217, 219, 2189, 23, 223, 2229, 225, 227, 2269, 229, 231,
+    2307, 233, 2335, 235, 237, 2373, 239, 25, 2413, 243, 245, 2453, 247, 249, 2491, 251,
+    253, 2531, 255, 257, 2571, 259, 27, 2609, 263, 265, 2649, 267, 269, 2687, 271, 2715,
+    273, 275, 2753, 277, 279, 2793, 29, 283, 2833, 285, 287, 2871, 289, 291, 2911, 293,
+    295, 2949, 297, 299, 2989, 31, 303, 3029, 305, 307, 3069, 309, 3095, 311, 313, 3133,
+    315, 317, 3173, 319, 33, 3213, 323, 325, 3251, 327, 329, 3291, 331, 333, 3331, 335,
+    336, 338, 34, 344, 346, 348, 352, 354, 356, 36, 362, 364, 368, 370, 372, 374,
+    378, 38, 382, 386, 388, 390, 394, 396, 398, 4, 404, 406, 408, 412, 414, 416,
+    42, 422, 424, 428, 430, 432, 436, 438, 44, 444, 446, 448, 450, 454, 456, 46,
+    462, 464, 466, 470, 472, 474, 478, 48, 482, 484, 488, 490, 492, 496, 498, 50,
+    504, 506, 508, 512, 514, 516, 52, 522, 524, 526, 530, 532, 534, 538, 54, 542,
+    546, 548, 550, 554, 556, 558, 56, 564, 566, 568, 572, 574, 576, 58, 582, 584,
+    588, 590, 592, 596, 598, 6, 602, 606, 608, 610, 614, 616, 618, 62, 624, 626,
+    630, 632, 634, 638, 64, 642, 644, 648, 650, 652, 656, 658, 66, 664, 666, 668,
+    672, 676, 68, 686, 692, 698, 70, 708, 714, 72, 724, 728, 734, 74, 744, 750,
+    754, 76, 766, 770, 776, 78, 786, 792, 796, 8, 808, 812, 82, 824, 828, 834,
+    84, 844, 850, 854, 86, 866, 870, 876, 88, 886, 892, 896, 90, 908, 912, 92,
+    922, 928, 934, 94, 944, 948, 954, 96, 964, 970, 976, 98, 986, 990, 996, 10,
+    1006, 1012, 1018, 102, 1028, 1032, 104, 1044, 1048, 1054, 106, 1064, 1070, 1074, 108, 1086,
+    1090, 1096, 110, 1106, 1112, 1116, 112, 1128, 1132, 114, 1142, 1148, 1154, 116, 1164, 1170,
+    1174, 118, 1184, 1190, 1196, 12, 1206, 1212, 1216, 122, 1226, 1232, 1238, 124, 1248, 1254,
+    126, 1264, 1268, 1274, 128, 1284, 1290, 1294, 130, 1306, 1310, 1316, 132, 1326, 1332, 1336,
+    134, 1352, 136, 1374, 138, 1394, 14, 142, 1426, 144, 1448, 146, 1468, 148, 1488, 150,
+    1510, 152, 1530, 154, 1552, 156, 1572, 158, 1594, 16, 162, 1626, 164, 1646, 166, 1668,
+    168, 1688, 170, 1710, 172, 1730, 174, 1752, 176, 1772, 178, 1794, 18, 1814, 182, 184,
+    1846, 186, 1866, 188, 1888, 190, 1908, 192, 1930, 194, 1950, 196, 1972, 198, 1992, 3,
+    2015, 203, 2035, 205, 207, 2067, 209, 2087, 211, 2109, 213, 2129, 215, 2151, 217, 2171,
+    219, 2193, 23, 2213, 223, 2235, 225, 2255, 227, 229, 2287, 231, 2307, 233, 2329, 235,
+    2349, 237, 2371, 239, 2391, 25, 2413, 243, 2433, 245, 2455, 247, 2475, 249, 251, 2507,
+    253, 2529, 255, 2549, 257, 2571, 259, 2591, 27, 2611, 263, 2633, 265, 2653, 267, 2675,
+    268, 270, 272, 274, 276, 278, 28, 284, 286, 288, 290, 292, 294, 296, 298, 30,
+    302, 304, 306, 308, 310, 312, 314, 316, 318, 32, 322, 326, 328, 330, 332, 334,
+    336, 338, 34, 342, 344, 346, 348, 350, 352, 354, 356, 358, 36, 362, 364, 368,
+    370, 372, 374, 376, 378, 38, 382, 384, 386, 388, 390, 392, 394, 396, 398, 4,
+    402, 404, 406, 408, 412, 414, 416, 418, 42, 422, 424, 426, 428, 430, 432, 434,
+    436, 438, 44, 442, 444, 446, 448, 450, 452, 456, 458, 46, 462, 464, 466, 468,
+    470, 472, 474, 476, 478, 48, 482, 484, 486, 488, 490, 492, 494, 498, 50, 502,
+    504, 506, 508, 510, 512, 514, 516, 518, 52, 522, 524, 526, 528, 530, 532, 534,
+    536, 54, 546, 550, 554, 558, 56, 566, 570, 574, 58, 584, 588, 592, 596, 6,
+    604, 608, 612, 616, 62, 624, 630, 634, 638, 64, 646, 650, 654, 66, 662, 666,
+    672, 676, 68, 684, 688, 692, 696, 70, 704, 708, 714, 718, 72, 726, 730, 734,
+    74, 742, 746, 750, 754, 76, 764, 768, 772, 776, 78, 784, 788, 792, 796, 8,
+    806, 810, 814, 818, 82, 826, 830, 834, 84, 844, 848, 852, 856, 86, 864, 868,
+    872, 876, 88, 884, 890, 894, 898, 90, 906, 910, 914, 92, 922, 926, 932, 936,
+    94, 944, 948, 952, 956, 96, 964, 968, 974, 978, 98, 986, 990, 994, 10, 1002,
+    1006, 1010, 1016, 102, 1024, 1028, 1032, 1036, 104, 1044, 1048, 1052, 1056, 106, 1066, 1070,
+    1074, 108, 1090, 110, 1108, 1116, 112, 1132, 114, 1150, 116, 1166, 1174, 118, 1192, 12,
+    1208, 122, 1224, 1234, 124, 1250, 126, 1266, 1276, 128, 1292, 130, 1308, 132, 1326, 1334,
+    134, 1350, 136, 1368, 1376, 138, 1392, 14, 1410, 142, 1426, 1434, 144, 1452, 146, 1468,
+    148, 1484, 1494, 150, 1510, 152, 1526, 1536, 154, 1552, 156, 1568, 158, 1586, 1594, 16,
+    1610, 162, 1628, 1636, 164, 1652, 166, 1670, 168, 1686, 1694, 170, 1712, 172, 1728, 174,
+    1744, 1754, 176, 1770, 178, 1786, 1796, 18, 1812, 182, 1828, 184, 1846, 1854, 186, 1870,
+    188, 1888, 190, 1904, 1912, 192, 1930, 194, 1946, 1954, 196, 1972, 198, 1988, 3, 2005,
+    2015, 203, 2031, 205, 2047, 2057, 207, 2073, 209, 2089, 211, 2107, 2115, 213, 2131, 215,
+    2148, 216, 218, 22, 222, 2232, 224, 226, 228, 230, 232, 234, 2348, 236, 238, 24,
+    242, 244, 2450, 246, 248, 250, 252, 254, 2550, 256, 258, 26, 262, 264, 2650, 266,
+    268, 270, 272, 274, 2752, 276, 278, 28, 282, 284, 286, 2868, 288, 290, 292, 294,
+    296, 2970, 298, 30, 302, 304, 306, 3070, 308, 310, 312, 314, 316, 3170, 318, 32,
+    322, 324, 326, 3272, 328, 330, 332, 334, 336, 338, 3388, 34, 342, 344, 346, 348,
+    3490, 350, 352, 354, 356, 358, 3590, 36, 362, 364, 366, 368, 3690, 370, 372, 374,
+    376, 378, 38, 3808, 382, 384, 386, 388, 390, 3910, 392, 394, 396, 398, 4, 4010,
+    402, 404, 406, 408, 410, 4110, 412, 414, 416, 418, 42, 4212, 422, 424, 426, 428,
+    430, 432, 436, 44, 442, 446, 450, 452, 456, 46, 464, 466, 470, 474, 476, 48,
+    484, 486, 490, 494, 496, 50, 504, 506, 510, 514, 516, 52, 524, 526, 530, 534,
+    536, 54, 544, 546, 550, 554, 558, 56, 564, 568, 570, 574, 578, 58, 584, 588,
+    590, 594, 598, 6, 604, 608, 610, 614, 618, 62, 624, 628, 630, 634, 638, 64,
+    644, 648, 650, 654, 658, 66, 664, 668, 672, 674, 678, 68, 684, 688, 692, 694,
+    698, 70, 704, 708, 712, 714, 718, 72, 724, 728, 732, 734, 738, 74, 744, 748,
+    752, 754, 76, 762, 766, 768, 772, 776, 78, 782, 786, 788, 792, 796, 8, 802,
+    806, 808, 812, 816, 82, 822, 826, 828, 832, 836, 84, 842, 846, 848, 852, 856,
+    86, 866, 872, 88, 886, 892, 90, 906, 912, 92, 926, 932, 94, 946, 952, 96,
+    966, 974, 98, 986, 994, 10, 1006, 1014, 102, 1026, 1034, 104, 1046, 1054, 106, 1068,
+    1074, 108, 1088, 1094, 110, 1108, 1114, 112, 1128, 1134, 114, 1148, 1154, 116, 1168, 1174,
+    118, 1188, 1194, 12, 1208, 1214, 122, 1228, 1234, 124, 1248, 1254, 126, 1268, 1276, 128,
+    1288, 1296, 130, 1308, 1316, 132, 1328, 1336, 134, 1348, 1356, 136, 1370, 1376, 138, 1390,
+    1396, 14, 1410, 1416, 142, 1430, 1436, 144, 1450, 1456, 146, 1470, 1476, 148, 1490, 1496,
+    150, 1510, 152, 1524, 1530, 154, 1544, 1550, 156, 1564, 1570, 158, 1584, 1590, 16, 1604,
+    1610, 162, 1624, 1630, 164, 1644, 1650, 166, 1664, 1672, 168, 1684, 1692, 170, 1704, 1712,
+    172, 1732, 174, 176, 1772, 178, 18, 1812, 182, 184, 1852, 186, 188, 1892, 190, 192,
+    1932, 194, 196, 1974, 198, 3, 2015, 203, 205, 207, 2067, 209, 211, 2109, 213, 215,
+    2149, 217, 219, 2189, 23, 223, 2229, 225, 227, 2269, 229, 231, 2309, 233, 235, 2349,
+    237, 239, 2391, 25, 243, 2431, 245, 247, 2471, 249, 251, 2511, 253, 255, 2551, 257,
+    259, 2591, 27, 263, 2631, 265, 267, 2671, 269, 271, 2713, 273, 275, 2753, 277, 279,
+    2793, 29, 283, 2833, 285, 287, 2873, 289, 291, 2913, 293, 295, 2953, 297, 299, 2995,
+    31, 303, 305, 3047, 307, 309, 3089, 311, 313, 3129, 315, 317, 3169, 319, 33, 3209,
+    323, 325, 3249, 327, 329, 3289, 331, 333, 3329, 335, 337, 3369, 339, 35, 3411, 343,
+    344, 346, 348, 352, 354, 358, 36, 362, 366, 368, 370, 374, 376, 378, 38, 384,
+    386, 390, 392, 394, 398, 4, 402, 406, 408, 410, 414, 416, 42, 422, 424, 426,
+    430, 432, 434, 438, 44, 442, 446, 448, 450, 454, 456, 46, 462, 464, 468, 470,
+    472, 476, 478, 48, 484, 486, 488, 492, 494, 496, 50, 502, 504, 508, 510, 512,
+    516, 518, 52, 524, 526, 528, 532, 534, 536, 54, 542, 544, 548, 550, 552, 556,
+    558, 56, 564, 566, 570, 572, 574, 578, 58, 582, 586, 588, 590, 594, 596, 598,
+    6, 604, 606, 610, 612, 614, 618, 62, 622, 626, 628, 630, 634, 636, 64, 642,
+    644, 646, 650, 652, 654, 658, 66, 664, 666, 668, 672, 674, 676, 68, 682, 684,
+    688, 692, 70, 704, 708, 714, 72, 724, 730, 736, 74, 746, 752, 756, 76, 768,
+    774, 78, 784, 790, 794, 8, 806, 810, 816, 82, 826, 832, 84, 842, 848, 854,
+    86, 864, 870, 876, 88, 886, 892, 896, 90, 908, 912, 92, 924, 928, 934, 94,
+    944, 950, 956, 96, 966, 972, 978, 98, 988, 994, 10, 1004, 1010, 1014, 102, 1026,
+    1030, 1036, 104, 1046, 1052, 106, 1064, 1068, 1074, 108, 1084, 1090, 1096, 110, 1106, 1112,
+    1116, 112, 1128, 1132, 114, 1144, 1148, 1154, 116, 1166, 1170, 1176, 118, 1186, 1192, 1198,
+    12, 1208, 1214, 122, 1224, 1230, 1234, 124, 1246, 1250, 1256, 126, 1268, 1272, 128, 1284,
+    1288, 1294, 130, 1304, 1310, 1316, 132, 1326, 1332, 1336, 134, 1348, 1352, 136, 1364, 1370,
+    1374, 138, 14, 1406, 142, 1428, 144, 1450, 146, 1472, 148, 1492, 150, 1514, 152, 154,
+    1546, 156, 1568, 158, 1590, 16, 1610, 162, 1632, 164, 1654, 166, 168, 1686, 170, 1708,
+    172, 1728, 174, 1750, 176, 1772, 178, 1794, 18, 1814, 182, 184, 1846, 186, 1868, 188,
+    1890, 190, 1912, 192, 1932, 194, 1954, 196, 198, 1986, 3, 2009, 203, 2031, 205, 2051,
+    207, 2073, 209, 2095, 211, 213, 2127, 215, 2149, 217, 2169, 219, 2191, 23, 2213, 223,
+    2235, 225, 227, 2267, 229, 2289, 231, 2309, 233, 2331, 235, 2353, 237, 2373, 239, 2395,
+    25, 243, 2427, 245, 2449, 247, 2471, 249, 2493, 251, 2513, 253, 2535, 255, 257, 2567,
+    259, 2589, 27, 2611, 263, 2631, 265, 2653, 267, 2675, 269, 271, 2707, 273, 2729, 275,
+    2748, 278, 28, 282, 284, 286, 288, 290, 292, 294, 296, 298, 30, 302, 304, 308,
+    310, 312, 314, 316, 318, 32, 322, 324, 326, 328, 330, 332, 336, 338, 34, 342,
+    344, 346, 348, 350, 352, 354, 356, 358, 36, 362, 366, 368, 370, 372, 374, 376,
+    378, 38, 382, 384, 386, 388, 390, 392, 396, 398, 4, 402, 404, 406, 408, 410,
+    412, 414, 416, 418, 42, 424, 426, 428, 430, 432, 434, 436, 438, 44, 442, 444,
+    446, 448, 450, 454, 456, 458, 46, 462, 464, 466, 468, 470, 472, 474, 476, 478,
+    48, 484, 486, 488, 490, 492, 494, 496, 498, 50, 502, 504, 506, 508, 512, 514,
+    516, 518, 52, 522, 524, 526, 528, 530, 532, 534, 536, 54, 542, 544, 546, 548,
+    550, 554, 56, 562, 566, 572, 576, 58, 584, 588, 592, 598, 6, 606, 610, 614,
+    62, 622, 628, 632, 636, 64, 644, 648, 652, 658, 66, 666, 670, 674, 68, 682,
+    688, 692, 696, 70, 704, 708, 712, 718, 72, 726, 730, 734, 74, 744, 748, 752,
+    756, 76, 764, 768, 774, 778, 78, 786, 790, 794, 8, 804, 808, 812, 816, 82,
+    824, 828, 834, 838, 84, 846, 850, 854, 86, 864, 868, 872, 876, 88, 884, 890,
+    894, 898, 90, 906, 910, 914, 92, 924, 928, 932, 936, 94, 944, 950, 954, 958,
+    96, 966, 970, 974, 98, 984, 988, 992, 996, 10, 1006, 1010, 1014, 102, 1022, 1026,
+    1030, 1036, 104, 1044, 1048, 1052, 1056, 106, 1066, 1070, 1074, 108, 1082, 1086, 1090, 1096,
+    110, 1108, 112, 1126, 1134, 114, 1152, 116, 1168, 118, 1186, 1194, 12, 1212, 122, 1228,
+    124, 1246, 1254, 126, 1272, 128, 1288, 130, 1306, 1314, 132, 1332, 134, 1348, 136, 1366,
+    1374, 138, 1392, 14, 1408, 142, 1426, 1434, 144, 1452, 146, 1468, 148, 1486, 1494, 150,
+    1512, 152, 1530, 154, 1546, 1554, 156, 1572, 158, 1590, 16, 1606, 1614, 162, 1632, 164,
+    1650, 166, 1666, 1676, 168, 1692, 170, 1710, 172, 1726, 1736, 174, 1752, 176, 1770, 178,
+    1786, 1796, 18, 1812, 182, 1830, 184, 1846, 1856, 186, 1872, 188, 1890, 190, 1906, 1916,
+    192, 1932, 194, 1950, 196, 1968, 1976, 198, 1992, 3, 2011, 203, 2029, 205, 2045, 2053,
+    207, 2071, 209, 2089, 211, 2105, 2115, 213, 2131, 215, 2149, 217, 2165, 2175, 219, 2191,
+    22, 222, 224, 2250, 226, 228, 230, 232, 234, 236, 2370, 238, 24, 242, 244, 246,
+    248, 2492, 250, 252, 254, 256, 258, 26, 2612, 262, 264, 266, 268, 270, 272, 274,
+    2748, 276, 278, 28, 282, 284, 286, 2870, 288, 290, 292, 294, 296, 298, 2990, 30,
+    302, 304, 306, 308, 310, 3110, 312, 314, 316, 318, 32, 322, 3230, 324, 326, 328,
+    330, 332, 334, 3350, 336, 338, 34, 342, 344, 346, 3470, 348, 350, 352, 354, 356,
+    358, 3590, 36, 362, 364, 366, 368, 370, 3710, 372, 374, 376, 378, 38, 382, 3832,
+    384, 386, 388, 390, 392, 394, 3952, 396, 398, 4, 402, 404, 406, 408, 4088, 410,
+    412, 414, 416, 418, 42, 4210, 422, 424, 426, 428, 430, 432, 4330, 434, 436, 438,
+    44, 444, 446, 450, 454, 456, 46, 464, 468, 470, 474, 478, 48, 484, 488, 492,
+    494, 498, 50, 506, 508, 512, 516, 52, 522, 526, 530, 532, 536, 54, 542, 546,
+    550, 554, 556, 56, 564, 566, 570, 574, 578, 58, 584, 588, 590, 594, 598, 6,
+    604, 608, 612, 616, 62, 622, 626, 628, 632, 636, 64, 642, 646, 650, 652, 656,
+    66, 664, 666, 670, 674, 676, 68, 684, 688, 690, 694, 698, 70, 704, 708, 712,
+    714, 718, 72, 724, 728, 732, 736, 74, 742, 746, 750, 752, 756, 76, 762, 766,
+    770, 774, 776, 78, 784, 786, 790, 794, 798, 8, 804, 808, 810, 814, 818, 82,
+    824, 828, 832, 834, 84, 842, 846, 848, 852, 856, 86, 862, 866, 870, 872, 876,
+    88, 886, 894, 90, 908, 914, 92, 928, 934, 94, 948, 956, 96, 968, 976, 98,
+    990, 996, 10, 1010, 102, 1024, 1030, 104, 1044, 1052, 106, 1066, 1072, 108, 1086, 1092,
+    110, 1106, 1114, 112, 1126, 1134, 114, 1148, 1154, 116, 1168, 1176, 118, 1188, 1196, 12,
+    1210, 1216, 122, 1230, 124, 1244, 1250, 126, 1264, 1272, 128, 1286, 1292, 130, 1306, 1312,
+    132, 1326, 1334, 134, 1346, 1354, 136, 1368, 1374, 138, 1388, 1396, 14, 1408, 1416, 142,
+    1430, 1436, 144, 1450, 146, 1464, 1470, 148, 1484, 1492, 150, 1504, 1512, 152, 1526, 1532,
+    154, 1546, 1554, 156, 1566, 1574, 158, 1588, 1594, 16, 1608, 1614, 162, 1628, 1636, 164,
+    1650, 1656, 166, 1670, 168, 1684, 1690, 170, 1704, 1712, 172, 1724, 1732, 174, 1746, 1752,
+    176, 1772, 178, 18, 182, 1828, 184, 186, 1870, 188, 190, 1910, 192, 194, 1952, 196,
+    198, 1992, 3, 203, 205, 2049, 207, 209, 2091, 211, 213, 2131, 215, 217, 2173, 219,
+    23, 2213, 223, 225, 227, 2269, 229, 231, 2309, 233, 235, 2351, 237, 239, 2393, 25,
+    243, 2433, 245, 247, 249, 2489, 251, 253, 2529, 255, 257, 2571, 259, 27, 2613, 263,
+    265, 2653, 267, 269, 271, 2709, 273, 275, 2749, 277, 279, 2791, 29, 283, 2833, 285,
+    287, 2873, 289, 291, 293, 2929, 295, 297, 2969, 299, 31, 3011, 303, 305, 3053, 307,
+    309, 3093, 311, 313, 315, 3149, 317, 319, 3189, 33, 323, 3231, 325, 327, 3273, 329,
+    331, 3313, 333, 335, 337, 3369, 339, 35, 3409, 343, 345, 3451, 347, 349, 3491, 351,
+    352, 354, 358, 36, 362, 366, 368, 372, 374, 376, 38, 382, 384, 388, 390, 394,
+    396, 398, 4, 404, 406, 410, 412, 416, 418, 42, 424, 426, 428, 432, 434, 438,
+    44, 442, 446, 448, 450, 454, 456, 46, 462, 464, 468, 470, 472, 476, 478, 48,
+    484, 486, 490, 492, 494, 498, 50, 504, 506, 508, 512, 514, 516, 52, 522, 526,
+    528, 530, 534, 536, 54, 542, 544, 548, 550, 552, 556, 558, 56, 564, 566, 568,
+    572, 574, 578, 58, 582, 586, 588, 590, 594, 596, 6, 602, 604, 608, 610, 612,
+    616, 618, 62, 624, 626, 630, 632, 634, 638, 64, 644, 646, 648, 652, 654, 656,
+    66, 662, 666, 668, 670, 674, 676, 68, 682, 684, 688, 690, 692, 696, 698, 70,
+    704, 710, 714, 72, 726, 732, 736, 74, 748, 754, 76, 764, 770, 776, 78, 786,
+    792, 798, 8, 808, 814, 82, 824, 830, 836, 84, 846, 852, 86, 864, 868, 874,
+    88, 886, 890, 896, 90, 908, 912, 92, 924, 930, 934, 94, 946, 952, 956, 96,
+    968, 974, 98, 984, 990, 996, 10, 1006, 1012, 1018, 102, 1028, 1034, 104, 1044, 1050,
+    1056, 106, 1066, 1072, 108, 1084, 1088, 1094, 110, 1106, 1110, 1116, 112, 1126, 1132, 114,
+    1144, 1148, 1154, 116, 1166, 1170, 1176, 118, 1188, 1192, 12, 1204, 1210, 1214, 122, 1226,
+    1232, 1236, 124, 1248, 1254, 126, 1264, 1270, 1276, 128, 1286, 1292, 130, 1302, 1308, 1314,
+    132, 1324, 1330, 1336, 134, 1346, 1352, 136, 1364, 1368, 1374, 138, 1386, 1390, 1396, 14,
+    1408, 142, 1430, 144, 1452, 146, 1474, 148, 150, 1506, 152, 1528, 154, 1550, 156, 1572,
+    158, 1594, 16, 162, 1628, 164, 1650, 166, 1672, 168, 1694, 170, 172, 1726, 174, 1748,
+    176, 1770, 178, 1792, 18, 1814, 182, 184, 1848, 186, 1870, 188, 1892, 190, 1914, 192,
+    194, 1946, 196, 1968, 198, 1990, 3, 2013, 203, 2035, 205, 207, 2069, 209, 2091, 211,
+    2113, 213, 2135, 215, 217, 2167, 219, 2189, 23, 2211, 223, 2233, 225, 2255, 227, 229,
+    2287, 231, 2309, 233, 2331, 235, 2353, 237, 239, 2387, 25, 2409, 243, 2431, 245, 2453,
+    247, 2475, 249, 251, 2507, 253, 2529, 255, 2551, 257, 2573, 259, 27, 2607, 263, 2629,
+    265, 2651, 267, 2673, 269, 2695, 271, 273, 2727, 275, 2749, 277, 2771, 279, 2793, 29,
+    282, 284, 286, 288, 290, 292, 294, 296, 30, 302, 304, 306, 308, 310, 312, 314,
+    316, 318, 32, 324, 326, 328, 330, 332, 334, 336, 338, 34, 344, 346, 348, 350,
+    352, 354, 356, 358, 36, 362, 366, 368, 370, 372, 374, 376, 378, 38, 382, 384,
+    388, 390, 392, 394, 396, 398, 4, 402, 404, 406, 410, 412, 414, 416, 418, 42,
+    422, 424, 426, 428, 432, 434, 436, 438, 44, 442, 444, 446, 448, 450, 452, 456,
+    458, 46, 462, 464, 466, 468, 470, 472, 474, 478, 48, 482, 484, 486, 488, 490,
+    492, 494, 496, 50, 502, 504, 506, 508, 510, 512, 514, 516, 52, 522, 524, 526,
+    528, 530, 532, 534, 536, 538, 54, 544, 546, 548, 550, 552, 554, 556, 558, 56,
+    562, 568, 572, 576, 58, 584, 590, 594, 6, 602, 606, 612, 616, 62, 624, 628,
+    634, 638, 64, 646, 650, 656, 66, 664, 668, 672, 678, 68, 686, 690, 694, 70,
+    704, 708, 712, 716, 72, 726, 730, 734, 74, 744, 748, 752, 756, 76, 766, 770,
+    774, 78, 782, 788, 792, 796, 8, 804, 810, 814, 82, 822, 826, 832, 836, 84,
+    844, 848, 854, 858, 86, 866, 870, 876, 88, 884, 888, 892, 898, 90, 906, 910,
+    914, 92, 924, 928, 932, 936, 94, 946, 950, 954, 96, 964, 968, 972, 976, 98,
+    986, 990, 994, 10, 1002, 1008, 1012, 1016, 102, 1024, 1030, 1034, 104, 1042, 1046, 1052,
+    1056, 106, 1064, 1068, 1074, 1078, 108, 1086, 1090, 1096, 110, 1104, 1108, 1112, 1118, 112,
+    1126, 1134, 114, 1152, 116, 1170, 118, 1188, 12, 1206, 1214, 122, 1232, 124, 1250, 126,
+    1266, 1276, 128, 1294, 130, 1310, 132, 1328, 134, 1346, 1354, 136, 1372, 138, 1390, 14,
+    1408, 142, 1424, 1434, 144, 1452, 146, 1468, 148, 1486, 1496, 150, 1512, 152, 1530, 154,
+    1548, 156, 1566, 1574, 158, 1592, 16, 1610, 162, 1628, 164, 1644, 1654, 166, 1672, 168,
+    1688, 170, 1706, 1716, 172, 1732, 174, 1750, 176, 1768, 178, 1786, 1794, 18, 1812, 182,
+    1830, 184, 1848, 186, 1864, 1874, 188, 1892, 190, 1908, 192, 1926, 1936, 194, 1952, 196,
+    1970, 198, 1988, 3, 2007, 2015, 203, 2033, 205, 2051, 207, 2069, 209, 2085, 2095, 211,
+    2113, 213, 2129, 215, 2147, 2157, 217, 2173, 219, 2191, 23, 2209, 223, 2227, 2235, 225,
+    226, 2270, 228, 230, 232, 234, 236, 238, 24, 2410, 242, 244, 246, 248, 250, 252,
+    254, 2550, 256, 258, 26, 262, 264, 266, 268, 270, 2710, 272, 274, 276, 278, 28,
+    282, 284, 2850, 286, 288, 290, 292, 294, 296, 298, 2990, 30, 302, 304, 306, 308,
+    310, 312, 314, 3150, 316, 318, 32, 322, 324, 326, 328, 3290, 330, 332, 334, 336,
+    338, 34, 342, 3430, 344, 346, 348, 350, 352, 354, 356, 358, 3588, 36, 362, 364,
+    366, 368, 370, 372, 3730, 374, 376, 378, 38, 382, 384, 386, 3870, 388, 390, 392,
+    394, 396, 398, 4, 4012, 402, 404, 406, 408, 410, 412, 414, 416, 4170, 418, 42,
+    422, 424, 426, 428, 430, 4310, 432, 434, 436, 438, 44, 442, 444, 4450, 446, 448,
+    450, 454, 458, 46, 464, 468, 472, 474, 48, 482, 486, 490, 492, 496, 50, 504,
+    506, 510, 514, 518, 52, 524, 528, 532, 534, 54, 542, 546, 548, 552, 556, 56,
+    562, 566, 570, 574, 578, 58, 584, 588, 592, 594, 598, 6, 606, 608, 612, 616,
+    62, 622, 626, 630, 634, 636, 64, 644, 648, 650, 654, 658, 66, 664, 668, 672,
+    676, 68, 682, 686, 690, 694, 696, 70, 704, 708, 710, 714, 718, 72, 724, 728,
+    732, 736, 74, 742, 746, 750, 752, 756, 76, 764, 768, 770, 774, 778, 78, 784,
+    788, 792, 796, 8, 802, 806, 810, 812, 816, 82, 824, 826, 830, 834, 838, 84,
+    844, 848, 852, 854, 86, 862, 866, 870, 872, 876, 88, 884, 886, 890, 894, 898,
+    90, 908, 914, 92, 928, 936, 94, 950, 96, 964, 972, 98, 986, 992, 10, 1006,
+    1014, 102, 1028, 1034, 104, 1048, 1056, 106, 1070, 108, 1084, 1090, 110, 1104, 1112, 112,
+    1126, 1132, 114, 1148, 1154, 116, 1168, 1176, 118, 1190, 1196, 12, 1210, 122, 1224, 1232,
+    124, 1246, 1252, 126, 1266, 1274, 128, 1288, 1294, 130, 1308, 1316, 132, 1330, 134, 1344,
+    1352, 136, 1366, 1372, 138, 1386, 1394, 14, 1408, 1414, 142, 1428, 1436, 144, 1450, 146,
+    1464, 1470, 148, 1484, 1492, 150, 1506, 1512, 152, 1528, 1534, 154, 1548, 1556, 156, 1570,
+    1576, 158, 1590, 16, 1604, 1612, 162, 1626, 1632, 164, 1646, 1654, 166, 1668, 1674, 168,
+    1688, 1696, 170, 1710, 172, 1724, 1732, 174, 1746, 1752, 176, 1766, 1774, 178, 1788, 1794,
+    18, 182, 1830, 184, 186, 1872, 188, 190, 192, 1928, 194, 196, 1970, 198, 3, 2013,
+    203, 205, 207, 2069, 209, 211, 2113, 213, 215, 217, 2169, 219, 23, 2211, 223, 225,
+    2253, 227, 229, 231, 2309, 233, 235, 2351, 237, 239, 2393, 25, 243, 245, 2449, 247,
+    249, 2493, 251, 253, 255, 2549, 257, 259, 2591, 27, 263, 2633, 265, 267, 269, 2689,
+    271, 273, 2731, 275, 277, 2773, 279, 29, 283, 2829, 285, 287, 2873, 289, 291, 293,
+    2929, 295, 297, 2971, 299, 31, 3013, 303, 305, 307, 3069, 309, 311, 3111, 313, 315,
+    3153, 317, 319, 33, 3209, 323, 325, 3253, 327, 329, 331, 3309, 333, 335, 3351, 337,
+    339, 3393, 35, 343, 345, 3449, 347, 349, 3491, 351, 353, 3533, 355, 357, 359, 3589,
+    36, 364, 366, 368, 372, 374, 378, 38, 382, 386, 388, 392, 394, 396, 4, 402,
+    406, 408, 410, 414, 416, 42, 422, 426, 428, 430, 434, 436, 44, 442, 444, 448,
+    450, 454, 456, 46, 462, 464, 468, 470, 472, 476, 478, 48, 484, 486, 490, 492,
+    496, 498, 50, 504, 506, 510, 512, 516, 518, 52, 524, 526, 530, 532, 534, 538,
+    54, 544, 546, 548, 552, 554, 558, 56, 562, 566, 568, 572, 574, 578, 58, 582,
+    586, 588, 592, 594, 596, 6, 602, 606, 608, 610, 614, 616, 62, 622, 624, 628,
+    630, 634, 636, 64, 642, 644, 648, 650, 654, 656, 66, 662, 664, 668, 670, 672,
+    676, 678, 68, 684, 686, 690, 692, 696, 698, 70, 704, 706, 710, 712, 714, 718,
+    72, 726, 732, 74, 744, 748, 754, 76, 766, 772, 776, 78, 788, 794, 8, 806,
+    810, 816, 82, 828, 834, 84, 844, 850, 856, 86, 866, 872, 88, 884, 890, 896,
+    90, 906, 912, 92, 924, 928, 934, 94, 946, 952, 958, 96, 968, 974, 98, 986,
+    990, 996, 10, 1008, 1014, 102, 1024, 1030, 1036, 104, 1048, 1052, 106, 1064, 1070, 1076,
+    108, 1086, 1092, 110, 1104, 1110, 1114, 112, 1126, 1132, 1138, 114, 1148, 1154, 116, 1166,
+    1170, 1176, 118, 1188, 1194, 12, 1204, 1210, 1216, 122, 1228, 1232, 124, 1244, 1250, 1256,
+    126, 1266, 1272, 128, 1284, 1290, 1294, 130, 1306, 1312, 132, 1322, 1328, 1334, 134, 1346,
+    1352, 1356, 136, 1368, 1374, 138, 1384, 1390, 1396, 14, 1408, 1414, 142, 1424, 1430, 1436,
+    144, 1452, 146, 148, 1486, 150, 1508, 152, 1532, 154, 1554, 156, 158, 1588, 16, 1610,
+    162, 1632, 164, 166, 1666, 168, 1688, 170, 1712, 172, 1734, 174, 176, 1768, 178, 1790,
+    18, 1812, 182, 184, 1846, 186, 1868, 188, 1892, 190, 1914, 192, 194, 1948, 196, 1970,
+    198, 1992, 3, 203, 2027, 205, 2051, 207, 2073, 209, 2095, 211, 213, 2129, 215, 2151,
+    217, 2173, 219, 23, 2207, 223, 2231, 225, 2253, 227, 2275, 229, 231, 2309, 233, 2331,
+    235, 2355, 237, 239, 2387, 25, 2411, 243, 2433, 245, 247, 2467, 249, 2489, 251, 2511,
+    253, 2535, 255, 257, 2569, 259, 2591, 27, 2613, 263, 265, 2647, 267, 2669, 269, 2691,
+    271, 2715, 273, 275, 2749, 277, 2771, 279, 2793, 29, 283, 2827, 285, 2849, 287, 2873,
+    288, 290, 292, 294, 298, 30, 302, 304, 306, 308, 310, 314, 316, 318, 32, 322,
+    324, 326, 328, 332, 334, 336, 338, 34, 342, 344, 346, 350, 352, 354, 356, 358,
+    36, 362, 364, 368, 370, 372, 374, 376, 378, 38, 382, 386, 388, 390, 392, 394,
+    396, 398, 4, 404, 406, 408, 410, 412, 414, 416, 418, 42, 424, 426, 428, 430,
+    432, 434, 436, 44, 442, 444, 446, 448, 450, 452, 454, 458, 46, 462, 464, 466,
+    468, 470, 472, 476, 478, 48, 482, 484, 486, 488, 490, 494, 496, 498, 50, 502,
+    504, 506, 508, 512, 514, 516, 518, 52, 522, 524, 526, 530, 532, 534, 536, 538,
+    54, 542, 544, 548, 550, 552, 554, 556, 558, 56, 562, 566, 568, 570, 572, 574,
+    576, 58, 586, 590, 594, 6, 604, 608, 612, 616, 62, 626, 630, 636, 64, 644,
+    648, 654, 658, 66, 666, 672, 676, 68, 684, 690, 694, 70, 702, 708, 712, 716,
+    72, 726, 730, 734, 74, 744, 748, 752, 756, 76, 766, 770, 774, 78, 784, 788,
+    792, 798, 8, 806, 810, 816, 82, 824, 828, 834, 838, 84, 846, 852, 856, 86,
+    864, 870, 874, 88, 882, 888, 892, 896, 90, 906, 910, 914, 92, 924, 928, 932,
+    936, 94, 946, 950, 954, 96, 964, 968, 972, 978, 98, 986, 990, 996, 10, 1004,
+    1008, 1014, 102, 1022, 1026, 1032, 1036, 104, 1044, 1050, 1054, 106, 1062, 1068, 1072, 1076,
+    108, 1086, 1090, 1094, 110, 1104, 1108, 1112, 1116, 112, 1126, 1130, 1134, 114, 1144, 1148,
+    1152, 116, 1170, 118, 1188, 12, 1206, 122, 1224, 1234, 124, 1252, 126, 1270, 128, 1288,
+    130, 1306, 1316, 132, 1334, 134, 1352, 136, 1370, 138, 1388, 14, 1406, 1414, 142, 1432,
+    144, 1450, 146, 1468, 148, 1486, 1496, 150, 1514, 152, 1532, 154, 1550, 156, 1568, 158,
+    1586, 1594, 16, 1612, 162, 1630, 164, 1648, 166, 1666, 1676, 168, 1694, 170, 1712, 172,
+    1730, 174, 1748, 176, 1766, 1774, 178, 1792, 18, 1810, 182, 1828, 184, 1846, 1856, 186,
+    1874, 188, 1892, 190, 1910, 192, 1928, 194, 1946, 1954, 196, 1972, 198, 1990, 3, 2009,
+    203, 2027, 205, 2045, 2055, 207, 2073, 209, 2091, 211, 2109, 213, 2127, 2135, 215, 2153,
+    217, 2171, 219, 2189, 23, 2207, 223, 2225, 2235, 225, 2253, 227, 2271, 229, 2289, 231,
+    2306, 232, 234, 236, 238, 24, 242, 244, 2450, 246, 248, 250, 252, 254, 256, 258,
+    26, 262, 2630, 264, 266, 268, 270, 272, 274, 276, 278, 28, 2810, 282, 284, 286,
+    288, 290, 292, 294, 296, 298, 2990, 30, 302, 304, 306, 308, 310, 312, 314, 316,
+    3170, 318, 32, 322, 324, 326, 328, 330, 332, 334, 3350, 336, 338, 34, 342, 344,
+    346, 348, 350, 352, 3530, 354, 356, 358, 36, 362, 364, 366, 368, 370, 3710, 372,
+    374, 376, 378, 38, 382, 384, 386, 388, 390, 3910, 392, 394, 396, 398, 4, 402,
+    404, 406, 408, 4090, 410, 412, 414, 416, 418, 42, 422, 424, 426, 4270, 428, 430,
+    432, 434, 436, 438, 44, 442, 444, 4450, 446, 448, 450, 452, 454, 456, 458, 46,
+    462, 464, 468, 472, 476, 48, 482, 486, 490, 494, 498, 50, 504, 508, 512, 516,
+    52, 522, 526, 530, 534, 536, 54, 544, 548, 552, 554, 56, 562, 566, 570, 572,
+    576, 58, 584, 588, 590, 594, 598, 6, 606, 608, 612, 616, 62, 624, 626, 630,
+    634, 638, 64, 644, 648, 652, 656, 66, 662, 666, 670, 674, 678, 68, 684, 688,
+    692, 696, 70, 702, 706, 710, 714, 716, 72, 724, 728, 732, 734, 74, 742, 746,
+    750, 754, 756, 76, 764, 768, 772, 774, 78, 782, 786, 790, 792, 796, 8, 804,
+    808, 810, 814, 818, 82, 826, 828, 832, 836, 84, 844, 846, 850, 854, 858, 86,
+    864, 868, 872, 876, 88, 882, 886, 890, 894, 898, 90, 904, 908, 912, 916, 92,
+    922, 930, 94, 944, 952, 96, 966, 972, 98, 988, 994, 10, 1008, 1016, 102, 1030,
+    104, 1044, 1052, 106, 1066, 1074, 108, 1088, 1096, 110, 1110, 112, 1124, 1132, 114, 1146,
+    1152, 116, 1168, 1174, 118, 1188, 1196, 12, 1210, 122, 1224, 1232, 124, 1246, 1254, 126,
+    1268, 1276, 128, 1290, 130, 1304, 1312, 132, 1326, 1334, 134, 1348, 1354, 136, 1370, 1376,
+    138, 1390, 14, 1406, 1412, 142, 1426, 1434, 144, 1448, 1456, 146, 1470, 148, 1484, 1492,
+    150, 1506, 1514, 152, 1528, 1534, 154, 1550, 156, 1564, 1570, 158, 1586, 1592, 16, 1606,
+    1614, 162, 1628, 1636, 164, 1650, 166, 1664, 1672, 168, 1686, 1694, 170, 1708, 1714, 172,
+    1730, 174, 1744, 1750, 176, 1766, 1772, 178, 1788, 1794, 18, 1808, 1816, 182, 1830, 184,
+    1844, 186, 188, 1888, 190, 192, 1932, 194, 196, 198, 1988, 3, 203, 2033, 205, 207,
+    209, 2091, 211, 213, 215, 2149, 217, 219, 2191, 23, 223, 225, 2249, 227, 229, 2293,
+    231, 233, 235, 2351, 237, 239, 2393, 25, 243, 245, 2451, 247, 249, 251, 2509, 253,
+    255, 2551, 257, 259, 27, 2609, 263, 265, 2653, 267, 269, 271, 2711, 273, 275, 2753,
+    277, 279, 29, 2811, 283, 285, 287, 2869, 289, 291, 2913, 293, 295, 297, 2969, 299,
+    31, 3013, 303, 305, 307, 3071, 309, 311, 313, 3129, 315, 317, 3171, 319, 33, 323,
+    3229, 325, 327, 3273, 329, 331, 333, 3331, 335, 337, 3373, 339, 35, 343, 3431, 345,
+    347, 349, 3489, 351, 353, 3531, 355, 357, 359, 3589, 37, 363, 3633, 365, 367, 369,
+    370, 372, 374, 378, 38, 384, 386, 390, 392, 394, 398, 4, 404, 406, 410, 412,
+    416, 418, 42, 424, 426, 430, 432, 436, 438, 44, 444, 446, 450, 452, 456, 458,
+    46, 464, 466, 470, 472, 476, 478, 48, 484, 488, 490, 492, 496, 50, 502, 504,
+    508, 510, 514, 516, 52, 522, 524, 528, 530, 534, 536, 54, 542, 544, 548, 550,
+    554, 556, 56, 562, 564, 568, 570, 574, 576, 58, 582, 586, 588, 590, 594, 596,
+    6, 602, 606, 608, 612, 614, 616, 62, 622, 626, 628, 632, 634, 636, 64, 642,
+    646, 648, 652, 654, 658, 66, 662, 666, 668, 672, 674, 678, 68, 684, 686, 688,
+    692, 694, 698, 70, 704, 706, 710, 712, 714, 718, 72, 724, 726, 730, 732, 734,
+    74, 744, 750, 756, 76, 766, 772, 78, 784, 790, 796, 8, 808, 812, 82, 824,
+    830, 836, 84, 848, 854, 86, 864, 870, 876, 88, 888, 894, 90, 906, 910, 916,
+    92, 928, 934, 94, 946, 952, 956, 96, 968, 974, 98, 986, 992, 10, 1004, 1008,
+    1014, 102, 1026, 1032, 104, 1044, 1050, 1054, 106, 1066, 1072, 108, 1084, 1090, 1096, 110,
+    1106, 1112, 112, 1124, 1130, 1136, 114, 1148, 1152, 116, 1164, 1170, 1176, 118, 1188, 1194,
+    12, 1204, 1210, 1216, 122, 1228, 1234, 124, 1246, 1250, 1256, 126, 1268, 1274, 128, 1286,
+    1292, 1298, 130, 1308, 1314, 132, 1326, 1332, 134, 1344, 1348, 1354, 136, 1366, 1372, 138,
+    1384, 1390, 1396, 14, 1406, 1412, 142, 1424, 1430, 1436, 144, 1446, 1452, 146, 1464, 1470,
+    148, 1488, 150, 1510, 152, 1534, 154, 156, 1568, 158, 1592, 16, 1614, 162, 164, 1648,
+    166, 1672, 168, 170, 1706, 172, 1730, 174, 1752, 176, 178, 1788, 18, 1810, 182, 1834,
+    184, 186, 1868, 188, 1890, 190, 1914, 192, 194, 1948, 196, 1972, 198, 3, 2007, 203,
+    2031, 205, 2053, 207, 209, 2087, 211, 2111, 213, 2133, 215, 217, 2169, 219, 2191, 23,
+    2215, 223, 225, 2249, 227, 2273, 229, 231, 2307, 233, 2329, 235, 2353, 237, 239, 2387,
+    25, 2411, 243, 2433, 245, 247, 2469, 249, 2491, 251, 2515, 253, 255, 2549, 257, 2573,
+    259, 2595, 27, 263, 2629, 265, 2653, 267, 269, 2687, 271, 2711, 273, 2733, 275, 277,
+    2769, 279, 2791, 29, 2815, 283, 285, 2849, 287, 2871, 289, 2895, 291, 293, 2929, 295,
+    296, 298, 30, 302, 304, 306, 308, 312, 314, 316, 318, 32, 322, 326, 328, 330,
+    332, 334, 336, 34, 342, 344, 346, 348, 350, 352, 356, 358, 36, 362, 364, 366,
+    368, 372, 374, 376, 378, 38, 382, 386, 388, 390, 392, 394, 396, 4, 402, 404,
+    406, 408, 410, 412, 416, 418, 42, 422, 424, 426, 428, 432, 434, 436, 438, 44,
+    442, 446, 448, 450, 452, 454, 456, 46, 462, 464, 466, 468, 470, 472, 476, 478,
+    48, 482, 484, 486, 488, 492, 494, 496, 498, 50, 502, 504, 508, 510, 512, 514,
+    516, 518, 52, 524, 526, 528, 530, 532, 534, 538, 54, 542, 544, 546, 548, 552,
+    554, 556, 558, 56, 562, 564, 568, 570, 572, 574, 576, 578, 58, 584, 586, 588,
+    590, 594, 6, 604, 608, 614, 62, 622, 628, 632, 636, 64, 646, 650, 654, 66,
+    664, 668, 674, 68, 682, 688, 692, 696, 70, 706, 710, 714, 72, 724, 728, 734,
+    74, 742, 748, 752, 756, 76, 766, 770, 774, 78, 784, 788, 794, 8, 802, 808,
+    812, 816, 82, 826, 830, 834, 84, 844, 848, 854, 86, 862, 866, 872, 876, 88,
+    886, 890, 894, 90, 904, 908, 914, 92, 922, 926, 932, 936, 94, 946, 950, 954,
+    96, 964, 968, 974, 978, 98, 986, 992, 996, 10, 1006, 1010, 1014, 102, 1024, 1028,
+    1034, 1038, 104, 1046, 1052, 1056, 106, 1066, 1070, 1074, 108, 1084, 1088, 1092, 1098, 110,
+    1106, 1112, 1116, 112, 1126, 1130, 1134, 114, 1144, 1148, 1152, 1158, 116, 1166, 1172, 1176,
+    118, 1190, 12, 1208, 122, 1226, 124, 1246, 1254, 126, 1272, 128, 1292, 130, 1310, 132,
+    1328, 134, 1346, 136, 1366, 1374, 138, 1392, 14, 1412, 142, 1430, 144, 1448, 146, 1466,
+    148, 1484, 1494, 150, 1512, 152, 1532, 154, 1550, 156, 1568, 158, 1586, 16, 1604, 1614,
+    162, 1632, 164, 1650, 166, 1670, 168, 1688, 170, 1706, 172, 1724, 1734, 174, 1752, 176,
+    1770, 178, 1790, 18, 1808, 182, 1826, 184, 1844, 1854, 186, 1872, 188, 1890, 190, 1910,
+    192, 1928, 194, 1946, 1956, 196, 1974, 198, 1992, 3, 2011, 203, 2031, 205, 2049, 207,
+    2067, 2077, 209, 2095, 211, 2113, 213, 2131, 215, 2151, 217, 2169, 219, 2187, 2197, 23,
+    2215, 223, 2233, 225, 2251, 227, 2269, 229, 2289, 231, 2307, 2317, 233, 2335, 235, 2353,
+    236, 238, 24, 242, 244, 246, 248, 2490, 250, 252, 254, 256, 258, 26, 262, 264,
+    266, 268, 270, 272, 2730, 274, 276, 278, 28, 282, 284, 286, 288, 290, 292, 294,
+    296, 2970, 298, 30, 302, 304, 306, 308, 310, 312, 314, 316, 318, 32, 3210, 322,
+    324, 326, 328, 330, 332, 334, 336, 338, 34, 342, 344, 3450, 346, 348, 350, 352,
+    354, 356, 358, 36, 362, 364, 366, 368, 3690, 370, 372, 374, 376, 378, 38, 382,
+    384, 386, 388, 390, 3910, 392, 394, 396, 398, 4, 402, 404, 406, 408, 410, 412,
+    414, 4150, 416, 418, 42, 422, 424, 426, 428, 430, 432, 434, 436, 438, 4390, 44,
+    442, 444, 446, 448, 450, 452, 454, 456, 458, 46, 462, 4630, 464, 466, 468, 470,
+    472, 476, 48, 484, 486, 490, 494, 498, 50, 506, 510, 512, 516, 52, 524, 528,
+    532, 534, 54, 542, 546, 550, 554, 558, 56, 564, 568, 572, 576, 58, 582, 586,
+    590, 594, 598, 6, 606, 608, 612, 616, 62, 624, 628, 630, 634, 64, 642, 646,
+    650, 654, 656, 66, 664, 668, 672, 676, 68, 682, 686, 690, 694, 698, 70, 704,
+    708, 712, 716, 72, 724, 726, 730, 734, 738, 74, 746, 748, 752, 756, 76, 764,
+    768, 772, 774, 78, 782, 786, 790, 794, 796, 8, 804, 808, 812, 816, 82, 822,
+    826, 830, 834, 838, 84, 844, 848, 852, 856, 86, 864, 866, 870, 874, 878, 88,
+    886, 890, 892, 896, 90, 904, 908, 912, 914, 92, 922, 926, 930, 934, 938, 94,
+    944, 952, 96, 966, 974, 98, 988, 996, 10, 1010, 102, 1026, 1034, 104, 1048, 1056,
+    106, 1070, 108, 1084, 1092, 110, 1106, 1114, 112, 1128, 114, 1144, 1152, 116, 1166, 1174,
+    118, 1188, 1196, 12, 1210, 122, 1224, 1232, 124, 1246, 1254, 126, 1270, 128, 1284, 1292,
+    130, 1306, 1314, 132, 1328, 1336, 134, 1350, 136, 1366, 1372, 138, 1388, 1394, 14, 1410,
+    142, 1424, 1432, 144, 1446, 1454, 146, 1468, 1476, 148, 1490, 150, 1506, 1512, 152, 1528,
+    1534, 154, 1550, 156, 1564, 1572, 158, 1586, 1594, 16, 1608, 1616, 162, 1630, 164, 1646,
+    1652, 166, 1668, 1674, 168, 1690, 170, 1704, 1712, 172, 1726, 1734, 174, 1748, 1756, 176,
+    1770, 178, 1786, 1794, 18, 1808, 1816, 182, 1830, 184, 1844, 1852, 186, 1866, 1874, 188,
+    1888, 190, 192, 194, 1948, 196, 198, 1992, 3, 203, 205, 2053, 207, 209, 211, 2111,
+    213, 215, 217, 2171, 219, 23, 223, 2229, 225, 227, 229, 2289, 231, 233, 2333, 235,
+    237, 239, 2391, 25, 243, 245, 2451, 247, 249, 251, 2509, 253, 255, 257, 2569, 259,
+    27, 2613, 263, 265, 267, 2673, 269, 271, 273, 2731, 275, 277, 279, 2791, 29, 283,
+    285, 2849, 287, 289, 2893, 291, 293, 295, 2953, 297, 299, 31, 3011, 303, 305, 307,
+    3071, 309, 311, 313, 3129, 315, 317, 319, 3189, 33, 323, 3233, 325, 327, 329, 3291,
+    331, 333, 335, 3351, 337, 339, 35, 3409, 343, 345, 347, 3469, 349, 351, 3513, 353,
+    355, 357, 3573, 359, 37, 363, 3631, 365, 367, 369, 3691, 371, 373, 375, 3749, 377,
+    378, 38, 384, 386, 390, 392, 396, 398, 4, 404, 408, 410, 414, 416, 42, 422,
+    426, 428, 430, 434, 436, 44, 442, 446, 448, 452, 454, 458, 46, 464, 466, 470,
+    472, 476, 478, 48, 484, 486, 490, 492, 496, 50, 502, 504, 508, 510, 514, 516,
+    52, 522, 526, 528, 532, 534, 538, 54, 544, 546, 548, 552, 554, 558, 56, 564,
+    566, 570, 572, 576, 578, 58, 584, 588, 590, 594, 596, 6, 602, 606, 608, 610,
+    614, 616, 62, 622, 626, 628, 632, 634, 638, 64, 644, 646, 650, 652, 656, 658,
+    66, 664, 668, 670, 672, 676, 68, 682, 684, 688, 690, 694, 696, 70, 702, 706,
+    708, 712, 714, 718, 72, 724, 726, 730, 732, 734, 738, 74, 744, 746, 750, 752,
+    756, 76, 768, 774, 78, 786, 790, 796, 8, 808, 814, 82, 826, 832, 84, 844,
+    850, 856, 86, 868, 874, 88, 886, 892, 90, 904, 910, 914, 92, 926, 932, 94,
+    944, 950, 956, 96, 968, 974, 98, 986, 992, 10, 1004, 1010, 1016, 102, 1028, 1034,
+    104, 1044, 1050, 1056, 106, 1068, 1074, 108, 1086, 1092, 110, 1104, 1110, 1116, 112, 1128,
+    1134, 114, 1146, 1152, 1156, 116, 1168, 1174, 118, 1186, 1192, 12, 1204, 1210, 1216, 122,
+    1228, 1234, 124, 1246, 1252, 126, 1264, 1270, 1276, 128, 1286, 1292, 130, 1304, 1310, 1316,
+    132, 1328, 1334, 134, 1346, 1352, 136, 1364, 1370, 1376, 138, 1388, 1394, 14, 1404, 1410,
+    1416, 142, 1428, 1434, 144, 1446, 1452, 146, 1464, 1470, 1476, 148, 1488, 1494, 150, 1506,
+    1512, 152, 154, 1546, 156, 1570, 158, 1594, 16, 162, 1630, 164, 1652, 166, 168, 1688,
+    170, 1712, 172, 174, 1748, 176, 1770, 178, 18, 1806, 182, 1830, 184, 1854, 186, 188,
+    1888, 190, 1912, 192, 194, 1948, 196, 1972, 198, 3, 2009, 203, 2031, 205, 207, 2067,
+    209, 2091, 211, 2115, 213, 215, 2149, 217, 2173, 219, 23, 2209, 223, 2233, 225, 227,
+    2267, 229, 2291, 231, 2315, 233, 235, 2351, 237, 2373, 239, 25, 2409, 243, 2433, 245,
+    247, 2469, 249, 2493, 251, 253, 2527, 255, 2551, 257, 2575, 259, 27, 2611, 263, 2633,
+    265, 267, 2669, 269, 2693, 271, 273, 2729, 275, 2751, 277, 279, 2787, 29, 2811, 283,
+    2835, 285, 287, 2869, 289, 2893, 291, 293, 2929, 295, 2953, 297, 299, 2987, 31, 3011,
+    302, 304, 306, 310, 312, 314, 316, 318, 32, 324, 326, 328, 330, 332, 336, 338,
+    34, 342, 344, 348, 350, 352, 354, 356, 36, 362, 364, 366, 368, 370, 374, 376,
+    378, 38, 382, 384, 388, 390, 392, 394, 396, 4, 402, 404, 406, 408, 410, 414,
+    416, 418, 42, 422, 426, 428, 430, 432, 434, 436, 44, 442, 444, 446, 448, 450,
+    454, 456, 458, 46, 462, 466, 468, 470, 472, 474, 476, 48, 482, 484, 486, 488,
+    492, 494, 496, 498, 50, 502, 506, 508, 510, 512, 514, 518, 52, 522, 524, 526,
+    528, 532, 534, 536, 538, 54, 544, 546, 548, 550, 552, 554, 558, 56, 562, 564,
+    566, 570, 572, 574, 576, 578, 58, 584, 586, 588, 590, 592, 596, 598, 6, 602,
+    604, 610, 614, 62, 624, 628, 632, 638, 64, 646, 652, 656, 66, 666, 670, 676,
+    68, 684, 690, 694, 70, 704, 708, 714, 72, 722, 728, 732, 736, 74, 746, 750,
+    756, 76, 766, 770, 774, 78, 784, 788, 794, 8, 802, 808, 812, 816, 82, 826,
+    832, 836, 84, 846, 850, 854, 86, 864, 868, 874, 88, 884, 888, 892, 898, 90,
+    906, 912, 916, 92, 926, 930, 936, 94, 944, 950, 954, 96, 964, 968, 972, 978,
+    98, 986, 992, 996, 10, 1006, 1010, 1016, 102, 1024, 1030, 1034, 104, 1044, 1048, 1054,
+    106, 1062, 1068, 1072, 1076, 108, 1086, 1090, 1096, 110, 1106, 1110, 1114, 112, 1124, 1128,
+    1134, 114, 1142, 1148, 1152, 1156, 116, 1166, 1172, 1176, 118, 1186, 1190, 1194, 12, 1204,
+    1208, 122, 1228, 124, 1246, 126, 1266, 1276, 128, 1294, 130, 1312, 132, 1332, 134, 1350,
+    136, 1370, 138, 1388, 14, 1408, 142, 1426, 144, 1446, 1454, 146, 1474, 148, 1492, 150,
+    1512, 152, 1530, 154, 1548, 156, 1568, 158, 1586, 16, 1606, 1616, 162, 1634, 164, 1652,
+    166, 1672, 168, 1690, 170, 1710, 172, 1728, 174, 1748, 176, 1766, 178, 1786, 1794, 18,
+    1814, 182, 1832, 184, 1852, 186, 1870, 188, 1888, 190, 1908, 192, 1926, 194, 1946, 1956,
+    196, 1974, 198, 1992, 3, 2013, 203, 2031, 205, 2051, 207, 2069, 209, 2089, 211, 2107,
+    213, 2127, 2135, 215, 2155, 217, 2173, 219, 2193, 23, 2211, 223, 2229, 225, 2249, 227,
+    2267, 229, 2287, 2297, 231, 2315, 233, 2333, 235, 2353, 237, 2371, 239, 2391, 25, 2409,
+    242, 244, 246, 248, 250, 252, 254, 2550, 256, 258, 26, 262, 264, 266, 268, 270,
+    272, 274, 276, 278, 28, 282, 284, 286, 288, 2890, 290, 292, 294, 296, 298, 30,
+    302, 304, 306, 308, 310, 312, 314, 316, 318, 32, 322, 3230, 324, 326, 328, 330,
+    332, 334, 336, 338, 34, 342, 344, 346, 348, 350, 352, 354, 356, 3570, 358, 36,
+    362, 364, 366, 368, 370, 372, 374, 376, 378, 38, 382, 384, 386, 388, 390, 3910,
+    392, 394, 396, 398, 4, 402, 404, 406, 408, 410, 412, 414, 416, 418, 42, 422,
+    424, 4250, 426, 428, 430, 432, 434, 436, 438, 44, 442, 444, 446, 448, 450, 452,
+    454, 456, 458, 4590, 46, 462, 464, 466, 468, 470, 472, 474, 476, 478, 48, 482,
+    484, 488, 492, 494, 50, 502, 506, 510, 514, 518, 52, 526, 528, 532, 536, 54,
+    544, 548, 552, 556, 56, 562, 566, 570, 574, 578, 58, 586, 590, 594, 596, 6,
+    604, 608, 612, 616, 62, 624, 628, 630, 634, 64, 642, 646, 650, 654, 658, 66,
+    664, 668, 672, 676, 68, 684, 688, 692, 696, 70, 702, 706, 710, 714, 718, 72,
+    726, 730, 732, 736, 74, 744, 748, 752, 756, 76, 764, 766, 770, 774, 78, 782,
+    786, 790, 794, 798, 8, 804, 808, 812, 816, 82, 824, 828, 832, 834, 84, 842,
+    846, 850, 854, 858, 86, 866, 868, 872, 876, 88, 884, 888, 892, 896, 90, 902,
+    906, 910, 914, 918, 92, 926, 930, 934, 936, 94, 944, 948, 952, 956, 96, 964,
+    968, 974, 98, 990, 10, 1004, 1012, 102, 1028, 1036, 104, 1050, 106, 1066, 1072, 108,
+    1088, 1096, 110, 1110, 112, 1126, 1134, 114, 1148, 1156, 116, 1172, 118, 1186, 1194, 12,
+    1208, 122, 1224, 1232, 124, 1246, 1254, 126, 1270, 128, 1284, 1292, 130, 1308, 1314, 132,
+    1330, 134, 1344, 1352, 136, 1368, 1376, 138, 1390, 14, 1406, 1412, 142, 1428, 1436, 144,
+    1450, 146, 1466, 1474, 148, 1488, 1496, 150, 1512, 152, 1526, 1534, 154, 1548, 156, 1564,
+    1572, 158, 1586, 1594, 16, 1610, 162, 1624, 1632, 164, 1648, 1654, 166, 1670, 168, 1684,
+    1692, 170, 1708, 1716, 172, 1730, 174, 1746, 1752, 176, 1768, 1776, 178, 1790, 18, 1806,
+    1814, 182, 1828, 1836, 184, 1852, 186, 1866, 1874, 188, 1888, 190, 1904, 1912, 192, 1926,
+    194, 1950, 196, 198, 3, 2011, 203, 205, 207, 2071, 209, 211, 213, 2131, 215, 217,
+    219, 2193, 23, 223, 225, 2253, 227, 229, 231, 2313, 233, 235, 237, 239, 2389, 25,
+    243, 245, 2449, 247, 249, 251, 2509, 253, 255, 257, 2569, 259, 27, 263, 2631, 265,
+    267, 269, 2691, 271, 273, 275, 2751, 277, 279, 29, 2811, 283, 285, 287, 2873, 289,
+    291, 293, 2933, 295, 297, 299, 2993, 31, 303, 305, 307, 3069, 309, 311, 313, 3129,
+    315, 317, 319, 3189, 33, 323, 325, 3249, 327, 329, 331, 3311, 333, 335, 337, 3371,
+    339, 35, 343, 3431, 345, 347, 349, 3491, 351, 353, 355, 3553, 357, 359, 37, 3613,
+    363, 365, 367, 3673, 369, 371, 373, 375, 3749, 377, 379, 39, 3809, 383, 385, 387,
+    388, 390, 392, 396, 4, 402, 404, 408, 412, 414, 418, 42, 424, 426, 430, 432,
+    436, 438, 44, 444, 448, 450, 454, 456, 46, 462, 466, 468, 472, 474, 478, 48,
+    484, 486, 490, 492, 496, 50, 502, 504, 508, 510, 514, 516, 52, 522, 526, 528,
+    532, 534, 538, 54, 544, 548, 550, 554, 556, 56, 562, 566, 568, 572, 574, 578,
+    58, 584, 586, 590, 592, 596, 598, 6, 604, 608, 610, 614, 616, 62, 622, 626,
+    628, 632, 634, 638, 64, 644, 646, 650, 652, 656, 66, 662, 664, 668, 670, 674,
+    676, 68, 684, 686, 690, 692, 696, 698, 70, 704, 708, 710, 714, 716, 72, 722,
+    726, 728, 732, 734, 738, 74, 744, 746, 750, 752, 756, 76, 762, 764, 768, 770,
+    774, 78, 786, 792, 8, 804, 810, 816, 82, 828, 834, 84, 846, 852, 86, 864,
+    870, 876, 88, 888, 894, 90, 906, 912, 92, 924, 930, 936, 94, 950, 956, 96,
+    968, 974, 98, 986, 992, 10, 1004, 1010, 1016, 102, 1028, 1034, 104, 1046, 1052, 106,
+    1064, 1070, 1076, 108, 1088, 1094, 110, 1106, 1112, 112, 1124, 1130, 1136, 114, 1148, 1154,
+    116, 1166, 1172, 118, 1184, 1190, 1196, 12, 1208, 1214, 122, 1228, 1234, 124, 1246, 1252,
+    126, 1264, 1270, 1276, 128, 1288, 1294, 130, 1306, 1312, 132, 1324, 1330, 1336, 134, 1348,
+    1354, 136, 1366, 1372, 138, 1384, 1390, 1396, 14, 1408, 1414, 142, 1426, 1432, 144, 1444,
+    1450, 1456, 146, 1468, 1474, 148, 1486, 1494, 150, 1506, 1512, 152, 1524, 1530, 1536, 154,
+    1548, 156, 1572, 158, 16, 1608, 162, 1632, 164, 166, 1668, 168, 1692, 170, 172, 1728,
+    174, 1752, 176, 178, 1790, 18, 1814, 182, 184, 1850, 186, 1874, 188, 190, 1910, 192,
+    194, 1946, 196, 1970, 198, 3, 2007, 203, 2031, 205, 207, 2069, 209, 2093, 211, 213,
+    2129, 215, 2153, 217, 219, 2189, 23, 2213, 223, 225, 2249, 227, 2273, 229, 231, 2311,
+    233, 2335, 235, 237, 2371, 239, 2395, 25, 243, 2431, 245, 247, 2467, 249, 2491, 251,
+    253, 2527, 255, 2551, 257, 259, 2589, 27, 2613, 263, 265, 2649, 267, 2673, 269, 271,
+    2709, 273, 2733, 275, 277, 2769, 279, 2793, 29, 283, 2829, 285, 2855, 287, 289, 2891,
+    291, 2915, 293, 295, 2951, 297, 299, 2987, 31, 3011, 303, 305, 3047, 307, 3071, 309,
+    310, 312, 314, 316, 32, 322, 324, 326, 328, 332, 334, 336, 338, 34, 344, 346,
+    348, 350, 354, 356, 358, 36, 362, 366, 368, 370, 372, 374, 378, 38, 382, 384,
+    386, 390, 392, 394, 396, 4, 402, 404, 406, 408, 412, 414, 416, 418, 42, 424,
+    426, 428, 430, 432, 436, 438, 44, 442, 444, 448, 450, 452, 454, 456, 46, 462,
+    464, 466, 470, 472, 474, 476, 478, 48, 484, 486, 488, 490, 494, 496, 498, 50,
+    502, 506, 508, 510, 512, 516, 518, 52, 522, 524, 528, 530, 532, 534, 536, 54,
+    542, 544, 546, 548, 552, 554, 556, 558, 56, 564, 566, 568, 570, 574, 576, 578,
+    58, 582, 586, 588, 590, 592, 594, 598, 6, 602, 604, 606, 610, 612, 614, 616,
+    62, 624, 628, 634, 64, 644, 648, 652, 66, 662, 668, 672, 676, 68, 686, 692,
+    696, 70, 706, 710, 716, 72, 726, 730, 736, 74, 744, 750, 754, 76, 764, 768,
+    774, 78, 784, 788, 794, 8, 802, 808, 812, 818, 82, 826, 832, 836, 84, 846,
+    852, 856, 86, 866, 870, 876, 88, 884, 890, 894, 90, 904, 910, 914, 92, 924,
+    928, 934, 94, 942, 948, 952, 958, 96, 968, 972, 976, 98, 986, 992, 996, 10,
+    1006, 1010, 1016, 102, 1026, 1030, 1034, 104, 1044, 1050, 1054, 106, 1064, 1068, 1074, 108,
+    1084, 1088, 1092, 110, 1102, 1108, 1112, 1118, 112, 1126, 1132, 1136, 114, 1146, 1150, 1156,
+    116, 1166, 1170, 1176, 118, 1184, 1190, 1194, 12, 1204, 1208, 1214, 122, 1224, 1228, 1234,
+    124, 1248, 126, 1266, 128, 1286, 130, 1306, 132, 1324, 1334, 134, 1354, 136, 1374, 138,
+    1392, 14, 1412, 142, 1432, 144, 1450, 146, 1470, 148, 1490, 150, 1508, 152, 1528, 154,
+    1548, 156, 1566, 158, 1586, 16, 1606, 1616, 162, 1634, 164, 1654, 166, 1674, 168, 1692,
+    170, 1712, 172, 1732, 174, 1750, 176, 1770, 178, 1790, 18, 1808, 182, 1828, 184, 1848,
+    186, 1866, 188, 1886, 190, 1906, 1914, 192, 1934, 194, 1954, 196, 1972, 198, 1992, 3,
+    2013, 203, 2031, 205, 2051, 207, 2071, 209, 2091, 211, 2109, 213, 2129, 215, 2149, 217,
+    2167, 219, 2187, 23, 2207, 2215, 223, 2235, 225, 2255, 227, 2273, 229, 2293, 231, 2313,
+    233, 2331, 235, 2351, 237, 2371, 239, 2389, 25, 2409, 243, 2429, 245, 2447, 247, 2467,
+    248, 250, 252, 254, 256, 258, 26, 262, 264, 2650, 266, 268, 270, 272, 274, 276,
+    278, 28, 282, 284, 286, 288, 290, 292, 294, 296, 298, 30, 302, 304, 306, 308,
+    310, 312, 314, 316, 318, 32, 322, 3230, 324, 326, 328, 330, 332, 334, 336, 338,
+    34, 342, 344, 346, 348, 350, 352, 354, 356, 358, 36, 362, 364, 366, 368, 370,
+    372, 374, 376, 378, 38, 382, 3830, 384, 386, 388, 390, 392, 394, 396, 398, 4,
+    402, 404, 406, 408, 410, 412, 414, 416, 418, 42, 422, 424, 426, 428, 430, 432,
+    434, 436, 438, 44, 4410, 442, 444, 446, 448, 450, 452, 454, 456, 458, 46, 462,
+    464, 466, 468, 470, 472, 474, 476, 478, 48, 482, 484, 486, 488, 490, 492, 494,
+    496, 50, 502, 506, 510, 514, 52, 522, 526, 530, 534, 538, 54, 546, 550, 554,
+    558, 56, 564, 568, 572, 576, 58, 584, 588, 592, 596, 6, 604, 608, 612, 616,
+    62, 622, 626, 630, 634, 64, 642, 646, 650, 654, 658, 66, 666, 670, 674, 676,
+    68, 684, 688, 692, 696, 70, 704, 708, 712, 716, 72, 724, 728, 732, 736, 74,
+    742, 746, 750, 754, 76, 762, 766, 770, 774, 778, 78, 786, 790, 794, 796, 8,
+    804, 808, 812, 816, 82, 824, 828, 832, 836, 84, 844, 848, 852, 854, 86, 862,
+    866, 870, 874, 88, 882, 886, 890, 894, 898, 90, 906, 910, 912, 916, 92, 924,
+    928, 932, 936, 94, 944, 948, 952, 956, 96, 964, 968, 972, 974, 98, 982, 986,
+    990, 10, 1006, 1014, 102, 1030, 104, 1044, 1052, 106, 1068, 1076, 108, 1090, 110, 1106,
+    1114, 112, 1130, 114, 1146, 1152, 116, 1168, 1176, 118, 1192, 12, 1206, 1214, 122, 1230,
+    124, 1246, 1254, 126, 1268, 128, 1284, 1292, 130, 1308, 1316, 132, 1330, 134, 1346, 1354,
+    136, 1370, 138, 1384, 1392, 14, 1408, 1416, 142, 1432, 144, 1446, 1454, 146, 1470, 148,
+    1486, 1494, 150, 1508, 152, 1524, 1532, 154, 1548, 1556, 156, 1570, 158, 1586, 1594, 16,
+    1610, 162, 1624, 1632, 164, 1648, 1656, 166, 1672, 168, 1686, 1694, 170, 1710, 172, 1726,
+    1734, 174, 1748, 176, 1764, 1772, 178, 1788, 1796, 18, 1810, 182, 1826, 1834, 184, 1850,
+    186, 1864, 1872, 188, 1888, 1896, 190, 1912, 192, 1926, 1934, 194, 1950, 196, 1966, 1972,
+    198, 3, 2013, 203, 205, 207, 209, 2091, 211, 213, 215, 2151, 217, 219, 23, 223,
+    2229, 225, 227, 229, 2291, 231, 233, 235, 2353, 237, 239, 25, 243, 2431, 245, 247,
+    249, 2493, 251, 253, 255, 257, 2569, 259, 27, 263, 2631, 265, 267, 269, 271, 2709,
+    273, 275, 277, 2771, 279, 29, 283, 2833, 285, 287, 289, 291, 2911, 293, 295, 297,
+    2973, 299, 31, 303, 305, 3049, 307, 309, 311, 3111, 313, 315, 317, 3173, 319, 33,
+    323, 325, 3251, 327, 329, 331, 3313, 333, 335, 337, 339, 3389, 35, 343, 345, 3451,
+    347, 349, 351, 353, 3529, 355, 357, 359, 3591, 37, 363, 365, 3653, 367, 369, 371,
+    373, 3731, 375, 377, 379, 3793, 39, 383, 385, 387, 3869, 389, 391, 393, 3931, 395,
+    396, 4, 402, 406, 408, 412, 414, 418, 42, 424, 428, 430, 434, 436, 44, 442,
+    446, 448, 452, 454, 458, 46, 464, 468, 470, 474, 476, 48, 482, 486, 488, 492,
+    496, 498, 50, 504, 508, 510, 514, 516, 52, 524, 526, 530, 532, 536, 54, 542,
+    544, 548, 550, 554, 558, 56, 564, 566, 570, 572, 576, 58, 582, 584, 588, 592,
+    594, 598, 6, 604, 606, 610, 612, 616, 62, 622, 626, 628, 632, 634, 638, 64,
+    644, 646, 650, 654, 656, 66, 662, 666, 668, 672, 674, 678, 68, 684, 688, 690,
+    694, 696, 70, 702, 706, 708, 712, 714, 718, 72, 724, 728, 730, 734, 736, 74,
+    742, 746, 748, 752, 756, 758, 76, 764, 768, 770, 774, 776, 78, 782, 786, 790,
+    792, 8, 804, 810, 82, 824, 830, 836, 84, 848, 854, 86, 866, 872, 88, 886,
+    892, 90, 904, 910, 916, 92, 928, 934, 94, 948, 954, 96, 966, 972, 98, 984,
+    990, 996, 10, 1008, 1016, 102, 1028, 1034, 104, 1046, 1052, 106, 1064, 1070, 108, 1084,
+    1090, 1096, 110, 1108, 1114, 112, 1126, 1132, 114, 1146, 1152, 116, 1164, 1170, 1176, 118,
+    1188, 1194, 12, 1206, 1214, 122, 1226, 1232, 124, 1244, 1250, 1256, 126, 1268, 1276, 128,
+    1288, 1294, 130, 1306, 1312, 132, 1324, 1330, 134, 1344, 1350, 1356, 136, 1368, 1374, 138,
+    1386, 1392, 14, 1406, 1412, 142, 1424, 1430, 1436, 144, 1448, 1454, 146, 1466, 1474, 148,
+    1486, 1492, 150, 1504, 1510, 1516, 152, 1528, 1536, 154, 1548, 1554, 156, 1566, 1572, 158,
+    1584, 16, 1610, 162, 164, 1646, 166, 1672, 168, 170, 1708, 172, 1734, 174, 176, 1770,
+    178, 18, 1808, 182, 1832, 184, 186, 1870, 188, 190, 1906, 192, 1932, 194, 196, 1968,
+    198, 1994, 3, 203, 2031, 205, 207, 2069, 209, 2093, 211, 213, 2131, 215, 217, 2167,
+    219, 2193, 23, 223, 2229, 225, 2255, 227, 229, 2291, 231, 233, 2329, 235, 2353, 237,
+    239, 2391, 25, 243, 2427, 245, 2453, 247, 249, 2489, 251, 2515, 253, 255, 2551, 257,
+    259, 2589, 27, 2613, 263, 265, 2651, 267, 269, 2687, 271, 2713, 273, 275, 2749, 277,
+    2773, 279, 29, 2811, 283, 285, 2849, 287, 2873, 289, 291, 2911, 293, 295, 2947, 297,
+    2973, 299, 31, 3009, 303, 3033, 305, 307, 3071, 309, 311, 3109, 313, 3133, 315, 317,
+    318, 32, 322, 324, 326, 330, 332, 334, 336, 34, 342, 344, 346, 350, 352, 354,
+    356, 36, 362, 364, 366, 368, 372, 374, 376, 38, 382, 384, 386, 388, 392, 394,
+    396, 398, 4, 404, 406, 408, 410, 414, 416, 418, 42, 424, 426, 428, 430, 434,
+    436, 438, 44, 444, 446, 448, 450, 454, 456, 458, 46, 462, 466, 468, 470, 472,
+    476, 478, 48, 482, 486, 488, 490, 492, 496, 498, 50, 502, 506, 508, 510, 512,
+    514, 518, 52, 522, 524, 528, 530, 532, 534, 538, 54, 542, 544, 548, 550, 552,
+    554, 558, 56, 562, 564, 566, 570, 572, 574, 576, 58, 582, 584, 586, 590, 592,
+    594, 596, 6, 602, 604, 606, 610, 612, 614, 616, 62, 622, 624, 626, 628, 632,
+    634, 64, 644, 648, 654, 66, 664, 668, 674, 68, 684, 688, 694, 70, 704, 708,
+    714, 72, 722, 728, 732, 74, 742, 748, 752, 76, 762, 768, 772, 778, 78, 788,
+    792, 798, 8, 808, 812, 818, 82, 826, 832, 836, 84, 846, 852, 856, 86, 866,
+    872, 876, 88, 886, 892, 896, 90, 906, 912, 916, 92, 926, 930, 936, 94, 946,
+    950, 956, 96, 966, 970, 976, 98, 986, 990, 996, 10, 1006, 1010, 1016, 102, 1026,
+    1030, 1034, 104, 1044, 1050, 1054, 106, 1064, 1070, 1074, 108, 1084, 1090, 1094, 110, 1104,
+    1110, 1114, 112, 1124, 1130, 1134, 114, 1144, 1148, 1154, 116, 1164, 1168, 1174, 118, 1184,
+    1188, 1194, 12, 1204, 1208, 1214, 122, 1224, 1228, 1232, 124, 1242, 1248, 1252, 126, 1262,
+    1268, 128, 1288, 130, 1308, 132, 1328, 134, 1346, 136, 1366, 138, 1386, 14, 1406, 142,
+    1426, 144, 1446, 146, 1466, 148, 1486, 150, 1506, 152, 1526, 1536, 154, 1554, 156, 1574,
+    158, 1594, 16, 1614, 162, 1634, 164, 1654, 166, 1674, 168, 1694, 170, 1714, 172, 1734,
+    174, 1752, 176, 1772, 178, 1792, 18, 1812, 182, 1832, 184, 1852, 186, 1872, 188, 1892,
+    190, 1912, 192, 1932, 194, 1950, 196, 1970, 198, 1990, 3, 2011, 203, 2031, 205, 2051,
+    207, 2071, 209, 2091, 211, 2111, 213, 2131, 215, 2151, 217, 2169, 219, 2189, 23, 2209,
+    223, 2229, 225, 2249, 227, 2269, 229, 2289, 231, 2309, 233, 2329, 235, 2349, 237, 2367,
+    239, 2387, 25, 2407, 243, 2427, 245, 2447, 247, 2467, 249, 2487, 251, 2507, 253, 2527,
+    254, 256, 258, 26, 262, 264, 266, 268, 270, 272, 274, 276, 278, 28, 282, 284,
+    286, 288, 290, 292, 294, 296, 298, 30, 302, 304, 306, 3070, 308, 310, 312, 314,
+    316, 318, 32, 322, 324, 326, 328, 330, 332, 334, 336, 338, 34, 342, 344, 346,
+    348, 350, 352, 354, 356, 358, 36, 362, 364, 366, 368, 370, 372, 374, 376, 378,
+    38, 382, 384, 386, 388, 390, 392, 394, 396, 398, 4, 402, 404, 406, 408, 410,
+    412, 414, 416, 418, 42, 422, 424, 426, 428, 430, 432, 434, 436, 438, 44, 442,
+    444, 446, 448, 450, 452, 454, 456, 458, 46, 462, 464, 466, 468, 470, 472, 474,
+    476, 478, 48, 482, 484, 486, 488, 490, 492, 494, 496, 498, 50, 502, 504, 506,
+    508, 512, 514, 52, 522, 526, 530, 534, 54, 542, 546, 550, 554, 56, 562, 566,
+    570, 574, 58, 582, 586, 590, 594, 6, 602, 606, 610, 614, 618, 62, 626, 630,
+    634, 638, 64, 646, 650, 654, 658, 66, 666, 670, 674, 678, 68, 686, 690, 694,
+    698, 70, 706, 710, 714, 718, 72, 724, 728, 732, 736, 74, 744, 748, 752, 756,
+    76, 764, 768, 772, 776, 78, 784, 788, 792, 796, 8, 804, 808, 812, 816, 82,
+    824, 828, 832, 836, 84, 844, 848, 852, 856, 86, 864, 868, 872, 876, 88, 884,
+    888, 892, 896, 90, 904, 908, 912, 916, 92, 924, 926, 930, 934, 94, 942, 946,
+    950, 954, 96, 962, 966, 970, 974, 98, 982, 986, 990, 994, 10, 1002, 1006, 1010,
+    1014, 102, 1030, 104, 1046, 1054, 106, 1070, 108, 1086, 1094, 110, 1110, 112, 1126, 1132,
+    114, 1148, 116, 1164, 1172, 118, 1188, 12, 1204, 1212, 122, 1228, 1236, 124, 1252, 126,
+    1268, 1276, 128, 1292, 130, 1308, 1316, 132, 1332, 134, 1346, 1354, 136, 1370, 138, 1386,
+    1394, 14, 1410, 142, 1426, 1434, 144, 1450, 146, 1466, 1474, 148, 1490, 150, 1506, 1514,
+    152, 1530, 154, 1544, 1552, 156, 1568, 158, 1584, 1592, 16, 1608, 162, 1624, 1632, 164,
+    1648, 1656, 166, 1672, 168, 1688, 1696, 170, 1712, 172, 1728, 1736, 174, 1750, 176, 1766,
+    1774, 178, 1790, 18, 1806, 1814, 182, 1830, 184, 1846, 1854, 186, 1870, 188, 1886, 1894,
+    190, 1910, 192, 1926, 1934, 194, 1950, 196, 1964, 1972, 198, 1988, 3, 2005, 2013, 203,
+    2028, 204, 206, 208, 2092, 210, 212, 214, 216, 2170, 218, 22, 222, 224, 2250, 226,
+    228, 230, 232, 2330, 234, 236, 238, 24, 2408, 242, 244, 246, 2472, 248, 250, 252,
+    254, 2552, 256, 258, 26, 262, 2630, 264, 266, 268, 270, 2710, 272, 274, 276, 278,
+    2788, 28, 282, 284, 286, 2868, 288, 290, 292, 2932, 294, 296, 298, 30, 3010, 302,
+    304, 306, 308, 3090, 310, 312, 314, 316, 3170, 318, 32, 322, 324, 3248, 326, 328,
+    330, 3312, 332, 334, 336, 338, 3390, 34, 342, 344, 346, 3470, 348, 350, 352, 354,
+    3550, 356, 358, 36, 362, 3628, 364, 366, 368, 3692, 370, 372, 374, 376, 3772, 378,
+    38, 382, 384, 3850, 386, 388, 390, 392, 3930, 394, 396, 398, 4, 4008, 402, 404,
+    406, 408, 412, 416, 418, 42, 424, 428, 432, 434, 438, 44, 444, 446, 450, 454,
+    456, 46, 462, 466, 470, 472, 476, 48, 482, 484, 488, 492, 494, 498, 50, 504,
+    508, 510, 514, 516, 52, 522, 526, 530, 532, 536, 54, 542, 546, 548, 552, 554,
+    558, 56, 564, 568, 570, 574, 576, 58, 584, 586, 590, 592, 596, 6, 602, 606,
+    608, 612, 614, 618, 62, 624, 628, 630, 634, 636, 64, 644, 646, 650, 652, 656,
+    66, 662, 666, 668, 672, 676, 678, 68, 684, 688, 690, 694, 698, 70, 704, 706,
+    710, 714, 716, 72, 722, 726, 728, 732, 736, 738, 74, 744, 748, 752, 754, 758,
+    76, 764, 766, 770, 774, 776, 78, 782, 786, 790, 792, 796, 8, 802, 804, 808,
+    812, 82, 824, 830, 836, 84, 850, 856, 86, 868, 874, 88, 888, 894, 90, 906,
+    912, 92, 926, 932, 94, 944, 950, 96, 964, 970, 976, 98, 988, 996, 10, 1008,
+    1014, 102, 1026, 1034, 104, 1046, 1052, 106, 1064, 1072, 108, 1084, 1090, 1096, 110, 1110,
+    1116, 112, 1128, 1134, 114, 1148, 1154, 116, 1166, 1172, 118, 1186, 1192, 12, 1204, 1210,
+    122, 1224, 1230, 1236, 124, 1248, 1254, 126, 1268, 1274, 128, 1286, 1294, 130, 1306, 1312,
+    132, 1324, 1332, 134, 1344, 1350, 1356, 136, 1370, 1376, 138, 1388, 1394, 14, 1408, 1414,
+    142, 1426, 1432, 144, 1446, 1452, 146, 1464, 1470, 1476, 148, 1490, 1496, 150, 1508, 1514,
+    152, 1528, 1534, 154, 1546, 1552, 156, 1566, 1572, 158, 1584, 1590, 16, 1604, 1610, 1616,
+    162, 164, 1648, 166, 1674, 168, 170, 1712, 172, 174, 1750, 176, 178, 1788, 18, 1812,
+    182, 184, 1850, 186, 188, 1888, 190, 192, 1926, 194, 1952, 196, 198, 1990, 3, 203,
+    2029, 205, 2055, 207, 209, 2093, 211, 213, 2131, 215, 217, 2169, 219, 2195, 23, 223,
+    2233, 225, 227, 2271, 229, 231, 2309, 233, 2333, 235, 237, 2371, 239, 25, 2409, 243,
+    245, 2447, 247, 2473, 249, 251, 2511, 253, 255, 2549, 257, 2575, 259, 27, 2613, 263,
+    265, 2651, 267, 269, 2689, 271, 2713, 273, 275, 2751, 277, 279, 2789, 29, 283, 2827,
+    285, 2853, 287, 289, 2891, 291, 293, 2929, 295, 2955, 297, 299, 2993, 31, 303, 3031,
+    305, 307, 3069, 309, 3095, 311, 313, 3133, 315, 317, 3171, 319, 33, 3209, 323, 3233,
+    324, 328, 330, 332, 334, 338, 34, 342, 344, 348, 350, 352, 354, 358, 36, 362,
+    366, 368, 370, 372, 376, 378, 38, 382, 386, 388, 390, 392, 396, 398, 4, 404,
+    406, 408, 410, 414, 416, 418, 42, 424, 426, 428, 432, 434, 436, 438, 44, 444,
+    446, 448, 452, 454, 456, 46, 462, 464, 466, 470, 472, 474, 476, 48, 482, 484,
+    486, 490, 492, 494, 496, 50, 502, 504, 508, 510, 512, 514, 518, 52, 522, 524,
+    528, 530, 532, 534, 538, 54, 542, 546, 548, 550, 552, 556, 558, 56, 562, 566,
+    568, 570, 572, 576, 578, 58, 584, 586, 588, 590, 594, 596, 598, 6, 604, 606,
+    608, 612, 614, 616, 618, 62, 624, 626, 628, 632, 634, 636, 64, 642, 644, 646,
+    650, 654, 66, 664, 670, 674, 68, 684, 690, 694, 70, 704, 710, 714, 72, 726,
+    730, 736, 74, 746, 750, 756, 76, 766, 770, 776, 78, 786, 792, 796, 8, 806,
+    812, 816, 82, 826, 832, 836, 84, 846, 852, 856, 86, 868, 872, 878, 88, 888,
+    892, 90, 902, 908, 912, 92, 922, 928, 932, 94, 944, 948, 954, 96, 964, 968,
+    974, 98, 984, 988, 994, 10, 1004, 1010, 1014, 102, 1024, 1030, 1034, 104, 1044, 1050,
+    1054, 106, 1064, 1070, 1074, 108, 1086, 1090, 1096, 110, 1106, 1110, 1116, 112, 1126, 1130,
+    1136, 114, 1146, 1152, 1156, 116, 1166, 1172, 1176, 118, 1186, 1192, 1196, 12, 1206, 1212,
+    1216, 122, 1228, 1232, 1238, 124, 1248, 1252, 126, 1262, 1268, 1272, 128, 1282, 1288, 1294,
+    130, 1308, 132, 1328, 134, 1348, 136, 1370, 138, 1390, 14, 1410, 142, 1430, 144, 1450,
+    146, 1470, 148, 1490, 150, 1512, 152, 1532, 154, 1552, 156, 1572, 158, 1592, 16, 1612,
+    162, 1632, 164, 1654, 166, 1674, 168, 1694, 170, 1714, 172, 1734, 174, 1754, 176, 1774,
+    178, 18, 1806, 182, 1826, 184, 1846, 186, 1866, 188, 1886, 190, 1906, 192, 1926, 194,
+    1948, 196, 1968, 198, 1988, 3, 2009, 203, 2029, 205, 2049, 207, 2069, 209, 2091, 211,
+    2111, 213, 2131, 215, 2151, 217, 2171, 219, 2191, 23, 2211, 223, 2233, 225, 2253, 227,
+    2273, 229, 2293, 231, 2313, 233, 2333, 235, 2353, 237, 2375, 239, 2395, 25, 2415, 243,
+    2435, 245, 2455, 247, 2475, 249, 2495, 251, 253, 2527, 255, 2547, 257, 2567, 259, 2587,
+    26, 262, 264, 266, 268, 270, 272, 274, 276, 278, 28, 282, 284, 286, 288, 290,
+    292, 294, 296, 298, 30, 302, 304, 306, 308, 310, 312, 314, 316, 318, 32, 322,
+    324, 326, 328, 330, 332, 334, 336, 338, 34, 342, 344, 346, 348, 350, 352, 354,
+    356, 36, 362, 364, 366, 368, 370, 372, 374, 376, 378, 38, 382, 384, 386, 388,
+    390, 392, 394, 396, 398, 4, 402, 404, 406, 408, 410, 412, 414, 416, 418, 42,
+    422, 424, 426, 428, 430, 432, 434, 436, 438, 44, 442, 444, 446, 448, 450, 452,
+    454, 456, 458, 46, 462, 464, 466, 468, 470, 472, 474, 476, 478, 48, 482, 484,
+    486, 488, 490, 492, 494, 496, 498, 50, 504, 506, 508, 510, 512, 514, 516, 518,
+    52, 524, 528, 532, 536, 54, 544, 548, 552, 556, 56, 564, 568, 572, 576, 58,
+    584, 588, 592, 596, 6, 604, 608, 612, 616, 62, 624, 628, 632, 636, 64, 644,
+    650, 654, 658, 66, 666, 670, 674, 678, 68, 686, 690, 694, 698, 70, 706, 710,
+    714, 72, 722, 726, 730, 734, 74, 742, 746, 750, 754, 76, 762, 766, 770, 774,
+    78, 782, 786, 792, 796, 8, 804, 808, 812, 816, 82, 824, 828, 832, 836, 84,
+    844, 848, 852, 856, 86, 864, 868, 872, 876, 88, 884, 888, 892, 896, 90, 904,
+    908, 912, 916, 92, 924, 928, 932, 938, 94, 946, 950, 954, 958, 96, 966, 970,
+    974, 978, 98, 986, 990, 994, 998, 10, 1006, 1010, 1014, 102, 1022, 1026, 1030, 1034,
+    104, 1046, 1054, 106, 1070, 108, 1088, 1096, 110, 1112, 112, 1128, 1136, 114, 1152, 116,
+    1168, 118, 1184, 1192, 12, 1208, 122, 1226, 1234, 124, 1250, 126, 1266, 1274, 128, 1290,
+    130, 1306, 1314, 132, 1330, 134, 1346, 1354, 136, 1372, 138, 1388, 1396, 14, 1412, 142,
+    1428, 144, 1444, 1452, 146, 1468, 148, 1484, 1492, 150, 1510, 152, 1526, 1534, 154, 1550,
+    156, 1566, 1574, 158, 1590, 16, 1606, 1614, 162, 1630, 164, 1646, 1656, 166, 1672, 168,
+    1688, 1696, 170, 1712, 172, 1728, 174, 1744, 1752, 176, 1768, 178, 1784, 1792, 18, 1810,
+    182, 1826, 1834, 184, 1850, 186, 1866, 1874, 188, 1890, 190, 1906, 1914, 192, 1930, 194,
+    1948, 1956, 196, 1972, 198, 1988, 1996, 3, 2013, 203, 2029, 205, 2045, 2053, 207, 2069,
+    208, 210, 2110, 212, 214, 216, 218, 2190, 22, 222, 224, 226, 2272, 228, 230, 232,
+    234, 236, 2368, 238, 24, 242, 244, 2450, 246, 248, 250, 252, 2532, 254, 256, 258,
+    26, 262, 2628, 264, 266, 268, 270, 2710, 272, 274, 276, 278, 2790, 28, 282, 284,
+    286, 288, 2888, 290, 292, 294, 296, 2970, 298, 30, 302, 304, 3050, 306, 308, 310,
+    312, 3132, 314, 316, 318, 32, 322, 3228, 324, 326, 328, 330, 3310, 332, 334, 336,
+    338, 3392, 34, 342, 344, 346, 348, 3488, 350, 352, 354, 356, 3570, 358, 36, 362,
+    364, 3650, 366, 368, 370, 372, 374, 3748, 376, 378, 38, 382, 3830, 384, 386, 388,
+    390, 3910, 392, 394, 396, 398, 3992, 4, 402, 404, 406, 408, 4088, 410, 412, 414,
+    416, 42, 422, 426, 428, 432, 434, 438, 44, 444, 448, 452, 454, 458, 46, 464,
+    468, 470, 474, 478, 48, 484, 486, 490, 494, 496, 50, 504, 506, 510, 512, 516,
+    52, 522, 526, 528, 532, 536, 54, 542, 546, 548, 552, 554, 558, 56, 564, 568,
+    572, 574, 578, 58, 584, 588, 590, 594, 598, 6, 604, 606, 610, 614, 616, 62,
+    624, 626, 630, 632, 636, 64, 642, 646, 650, 652, 656, 66, 662, 666, 668, 672,
+    674, 678, 68, 684, 688, 692, 694, 698, 70, 704, 708, 710, 714, 718, 72, 724,
+    726, 730, 734, 736, 74, 744, 746, 750, 752, 756, 76, 762, 766, 770, 772, 776,
+    78, 782, 786, 788, 792, 796, 798, 8, 804, 808, 812, 814, 818, 82, 824, 828,
+    830, 84, 844, 850, 856, 86, 870, 876, 88, 890, 896, 90, 908, 916, 92, 928,
+    934, 94, 948, 954, 96, 968, 974, 98, 986, 994, 10, 1006, 1012, 102, 1026, 1032,
+    104, 1044, 1052, 106, 1064, 1070, 108, 1084, 1090, 110, 1104, 1110, 1116, 112, 1130, 1136,
+    114, 1148, 1156, 116, 1168, 1174, 118, 1188, 1194, 12, 1208, 1214, 122, 1226, 1234, 124,
+    1246, 1252, 126, 1266, 1272, 128, 1286, 1292, 130, 1304, 1312, 132, 1324, 1330, 134, 1344,
+    1350, 1356, 136, 1370, 1376, 138, 1388, 1396, 14, 1408, 1414, 142, 1428, 1434, 144, 1448,
+    1454, 146, 1466, 1474, 148, 1486, 1492, 150, 1506, 1512, 152, 1526, 1532, 154, 1544, 1552,
+    156, 1564, 1570, 158, 1584, 1590, 1596, 16, 1610, 1616, 162, 1630, 1636, 164, 1648, 1656,
+    166, 168, 1688, 170, 1714, 172, 174, 1752, 176, 178, 1792, 18, 182, 1830, 184, 186,
+    1870, 188, 190, 1908, 192, 194, 1948, 196, 1974, 198, 3, 2013, 203, 205, 2051, 207,
+    209, 2091, 211, 213, 2129, 215, 217, 2169, 219, 23, 2207, 223, 2233, 225, 227, 2273,
+    229, 231, 2311, 233, 235, 2351, 237, 239, 2389, 25, 243, 2429, 245, 2455, 247, 249,
+    2493, 251, 253, 2533, 255, 257, 2571, 259, 27, 2611, 263, 265, 2649, 267, 269, 2689,
+    271, 2713, 273, 275, 2753, 277, 279, 2791, 29, 283, 2831, 285, 287, 2869, 289, 291,
+    2909, 293, 295, 2947, 297, 2973, 299, 31, 3013, 303, 305, 3051, 307, 309, 3091, 311,
+    313, 3129, 315, 317, 3169, 319, 3195, 33, 323, 3233, 325, 327, 3273, 329, 331, 3311,
+    332, 334, 338, 34, 342, 346, 348, 350, 354, 356, 358, 36, 364, 366, 368, 372,
+    374, 376, 38, 382, 384, 386, 390, 392, 394, 398, 4, 402, 404, 408, 410, 412,
+    416, 418, 42, 424, 426, 428, 430, 434, 436, 44, 442, 444, 446, 450, 452, 454,
+    456, 46, 462, 464, 468, 470, 472, 476, 478, 48, 482, 486, 488, 490, 494, 496,
+    498, 50, 504, 506, 508, 512, 514, 516, 52, 522, 524, 528, 530, 532, 534, 538,
+    54, 542, 546, 548, 550, 552, 556, 558, 56, 564, 566, 568, 572, 574, 576, 58,
+    582, 584, 586, 590, 592, 594, 598, 6, 602, 604, 608, 610, 612, 616, 618, 62,
+    624, 626, 628, 630, 634, 636, 638, 64, 644, 646, 650, 652, 654, 656, 66, 662,
+    664, 670, 674, 68, 686, 690, 696, 70, 706, 712, 716, 72, 726, 732, 738, 74,
+    748, 752, 76, 764, 768, 774, 78, 784, 790, 794, 8, 804, 810, 816, 82, 826,
+    830, 836, 84, 846, 852, 856, 86, 868, 872, 88, 882, 888, 894, 90, 904, 908,
+    914, 92, 924, 930, 934, 94, 944, 950, 956, 96, 966, 970, 976, 98, 986, 992,
+    996, 10, 1008, 1012, 102, 1022, 1028, 1034, 104, 1044, 1048, 1054, 106, 1064, 1070, 1074,
+    108, 1086, 1090, 1096, 110, 1106, 1112, 1116, 112, 1126, 1132, 1138, 114, 1148, 1152, 116,
+    1164, 1168, 1174, 118, 1184, 1190, 1194, 12, 1204, 1210, 1214, 122, 1226, 1230, 1236, 124,
+    1246, 1252, 1256, 126, 1266, 1272, 1278, 128, 1288, 1292, 130, 1304, 1308, 1314, 132, 1324,
+    1330, 134, 1350, 136, 1370, 138, 1392, 14, 1412, 142, 1434, 144, 1454, 146, 1474, 148,
+    150, 1506, 152, 1526, 154, 1548, 156, 1568, 158, 1588, 16, 1610, 162, 1630, 164, 1652,
+    166, 1672, 168, 1692, 170, 1714, 172, 1734, 174, 176, 1766, 178, 1786, 18, 1806, 182,
+    1828, 184, 1848, 186, 1870, 188, 1890, 190, 1910, 192, 1932, 194, 1952, 196, 1974, 198,
+    1994, 3, 2015, 203, 205, 2047, 207, 2067, 209, 2089, 211, 2109, 213, 2129, 215, 2151,
+    217, 2171, 219, 2193, 23, 2213, 223, 2233, 225, 2255, 227, 2275, 229, 231, 2307, 233,
+    2327, 235, 2347, 237, 2369, 239, 2389, 25, 2411, 243, 2431, 245, 2451, 247, 2473, 249,
+    2493, 251, 2515, 253, 2535, 255, 2555, 257, 259, 2587, 27, 2607, 263, 2629, 265, 2649,
+    266, 268, 270, 272, 274, 276, 278, 28, 282, 284, 286, 288, 290, 292, 294, 296,
+    30, 302, 304, 306, 308, 310, 312, 314, 316, 318, 32, 322, 324, 326, 328, 330,
+    332, 334, 336, 338, 34, 342, 344, 346, 348, 350, 354, 356, 358, 36, 362, 364,
+    366, 368, 370, 372, 374, 376, 378, 38, 382, 384, 386, 388, 390, 392, 394, 396,
+    398, 4, 402, 404, 408, 410, 412, 414, 416, 418, 42, 422, 424, 426, 428, 430,
+    432, 434, 436, 438, 44, 442, 444, 446, 448, 450, 452, 454, 456, 46, 462, 464,
+    466, 468, 470, 472, 474, 476, 478, 48, 482, 484, 486, 488, 490, 492, 494, 496,
+    498, 50, 502, 504, 506, 508, 510, 512, 516, 518, 52, 522, 524, 526, 528, 530,
+    532, 536, 54, 544, 548, 552, 556, 56, 564, 570, 574, 578, 58, 586, 590, 594,
+    6, 602, 606, 610, 614, 62, 624, 628, 632, 636, 64, 644, 648, 652, 656, 66,
+    664, 668, 672, 678, 68, 686, 690, 694, 698, 70, 706, 710, 714, 72, 722, 726,
+    732, 736, 74, 744, 748, 752, 756, 76, 764, 768, 772, 776, 78, 786, 790, 794,
+    798, 8, 806, 810, 814, 82, 822, 826, 830, 834, 84, 844, 848, 852, 856, 86,
+    864, 868, 872, 876, 88, 884, 888, 894, 898, 90, 906, 910, 914, 92, 922, 926,
+    930, 934, 94, 942, 948, 952, 956, 96, 964, 968, 972, 976, 98, 984, 988, 992,
+    996, 10, 1006, 1010, 1014, 1018, 102, 1026, 1030, 1034, 104, 1042, 1046, 1050, 1056, 106,
+    1064, 1072, 108, 1088, 110, 1104, 1114, 112, 1130, 114, 1146, 1154, 116, 1172, 118, 1188,
+    12, 1204, 1212, 122, 1230, 124, 1246, 1254, 126, 1272, 128, 1288, 130, 1304, 1312, 132,
+    1330, 134, 1346, 1354, 136, 1370, 138, 1388, 1396, 14, 1412, 142, 1428, 144, 1446, 1454,
+    146, 1470, 148, 1488, 1496, 150, 1512, 152, 1528, 154, 1546, 1554, 156, 1570, 158, 1586,
+    1596, 16, 1612, 162, 1628, 164, 1644, 1654, 166, 1670, 168, 1686, 1694, 170, 1712, 172,
+    1728, 174, 1744, 1752, 176, 1770, 178, 1786, 1794, 18, 1812, 182, 1828, 184, 1844, 1852,
+    186, 1870, 188, 1886, 1894, 190, 1910, 192, 1928, 1936, 194, 1952, 196, 1968, 198, 1986,
+    1994, 3, 2011, 203, 2029, 2037, 205, 2053, 207, 2069, 209, 2087, 2095, 211, 2111, 213,
+    2126, 214, 216, 218, 22, 2210, 222, 224, 226, 228, 230, 2310, 232, 234, 236, 238,
+    24, 2410, 242, 244, 246, 248, 250, 2508, 252, 254, 256, 258, 26, 2608, 262, 264,
+    266, 268, 2692, 270, 272, 274, 276, 278, 2792, 28, 282, 284, 286, 288, 2892, 290,
+    292, 294, 296, 298, 2990, 30, 302, 304, 306, 308, 3090, 310, 312, 314, 316, 318,
+    3190, 32, 322, 324, 326, 328, 3290, 330, 332, 334, 336, 338, 3390, 34, 342, 344,
+    346, 348, 3490, 350, 352, 354, 356, 358, 3588, 36, 362, 364, 366, 368, 3688, 370,
+    372, 374, 376, 3772, 378, 38, 382, 384, 386, 3872, 388, 390, 392, 394, 396, 3972,
+    398, 4, 402, 404, 406, 4070, 408, 410, 412, 414, 416, 4170, 418, 42, 422, 424,
+    426, 428, 432, 436, 44, 442, 446, 448, 452, 456, 46, 462, 466, 468, 472, 476,
+    48, 482, 486, 488, 492, 496, 50, 502, 506, 508, 512, 516, 52, 522, 526, 528,
+    532, 536, 538, 54, 544, 548, 552, 554, 558, 56, 564, 568, 572, 574, 578, 58,
+    584, 588, 592, 594, 598, 6, 604, 608, 612, 614, 618, 62, 624, 628, 632, 634,
+    638, 64, 644, 648, 652, 654, 658, 66, 664, 668, 672, 674, 678, 68, 684, 688,
+    692, 694, 698, 70, 704, 708, 712, 714, 718, 72, 724, 728, 732, 734, 738, 74,
+    744, 748, 752, 754, 758, 76, 764, 768, 770, 774, 778, 78, 784, 788, 790, 794,
+    798, 8, 804, 808, 810, 814, 818, 82, 824, 828, 830, 834, 838, 84, 844, 848,
+    850, 86, 864, 870, 88, 884, 890, 90, 904, 910, 92, 924, 930, 94, 944, 950,
+    96, 964, 970, 98, 984, 990, 10, 1004, 1010, 102, 1024, 1030, 104, 1044, 1050, 106,
+    1064, 1070, 1076, 108, 1090, 1096, 110, 1110, 1116, 112, 1130, 1136, 114, 1150, 1156, 116,
+    1170, 1176, 118, 1190, 1196, 12, 1210, 1216, 122, 1230, 1236, 124, 1250, 1256, 126, 1270,
+    1276, 128, 1290, 1296, 130, 1310, 1316, 132, 1330, 1336, 134, 1350, 1356, 136, 1370, 1376,
+    138, 1390, 1396, 14, 1408, 1416, 142, 1428, 1436, 144, 1448, 1456, 146, 1468, 1476, 148,
+    1488, 1496, 150, 1508, 1516, 152, 1528, 1536, 154, 1548, 1556, 156, 1568, 1576, 158, 1588,
+    1596, 16, 1608, 1616, 162, 1628, 1634, 164, 1648, 1654, 166, 1668, 1674, 168, 1688, 1694,
+    170, 172, 1728, 174, 176, 1768, 178, 18, 1808, 182, 184, 1848, 186, 188, 1888, 190,
+    192, 1928, 194, 196, 1968, 198, 3, 2009, 203, 205, 2049, 207, 209, 2087, 211, 213,
+    2127, 215, 2155, 217, 219, 2195, 23, 223, 2235, 225, 227, 2273, 229, 231, 2313, 233,
+    235, 2353, 237, 239, 2393, 25, 243, 2433, 245, 247, 2473, 249, 251, 2513, 253, 255,
+    2553, 257, 259, 2593, 27, 263, 2633, 265, 267, 2673, 269, 271, 2713, 273, 275, 2753,
+    277, 279, 2793, 29, 283, 2833, 285, 287, 2873, 289, 291, 2913, 293, 295, 2951, 297,
+    299, 2991, 31, 303, 3031, 305, 307, 3071, 309, 311, 3111, 313, 315, 3151, 317, 319,
+    3191, 33, 323, 3231, 325, 327, 3271, 329, 331, 3311, 333, 335, 3351, 337, 339, 3391,
+    34, 342, 346, 348, 350, 354, 356, 36, 362, 364, 366, 370, 372, 374, 378, 38,
+    382, 386, 388, 390, 394, 396, 4, 402, 404, 406, 410, 412, 414, 418, 42, 422,
+    426, 428, 430, 434, 436, 438, 44, 444, 446, 450, 452, 454, 458, 46, 462, 466,
+    468, 470, 474, 476, 478, 48, 484, 486, 490, 492, 494, 498, 50, 502, 506, 508,
+    510, 514, 516, 518, 52, 524, 526, 530, 532, 534, 538, 54, 542, 544, 548, 550,
+    552, 556, 558, 56, 564, 566, 568, 572, 574, 576, 58, 582, 584, 588, 590, 592,
+    596, 598, 6, 604, 606, 608, 612, 614, 616, 62, 622, 624, 628, 630, 632, 636,
+    638, 64, 644, 646, 648, 652, 654, 656, 66, 662, 664, 668, 670, 672, 676, 678,
+};
+
+// The shortest representation of the 16-bit floating point value with the given bits, which has mantissaBits
+// explicit significand bits and exponentBits exponent bits, from its table
+template <std::uint32_t mantissaBits, std::uint32_t exponentBits>
+inline ryu::floating_decimal_128 binary16_table_to_fd128(const std::uint16_t* table, std::uint16_t bits) noexcept
+{
+    constexpr std::uint32_t size = ((1u << exponentBits) - 1u) << mantissaBits;
+    constexpr std::uint32_t sign_bit = 1u << (mantissaBits + exponentBits);
+    constexpr int bias = (1 << (exponentBits - 1)) - 1;
+
+    const std::uint32_t index = bits & (sign_bit - 1u);
+
+    // Infinity and NaN are not stored
+    if (index >= size)
+    {
+        return ryu::generic_binary_to_decimal(bits, mantissaBits, exponentBits, false);
+    }
+
+    const std::uint32_t entry = table[index];
+    const std::uint32_t significand = entry >> 1;
+
+    ryu::floating_decimal_128 fd;
+    fd.mantissa = significand;
+    fd.exponent = 0;
+    fd.sign = (bits & sign_bit) != 0;
+
+    if (significand != 0)
+    {
+        const auto biased_exponent = static_cast<int>(index >> mantissaBits);
+        std::uint32_t binary_significand = index & ((1u << mantissaBits) - 1u);
+        if (biased_exponent != 0)
+        {
+            binary_significand |= 1u << mantissaBits;
+        }
+
+        const int binary_exponent = (biased_exponent == 0 ? 1 : biased_exponent) - bias - static_cast<int>(mantissaBits)
+                                    + 31 - boost::core::countl_zero(binary_significand);
+
+        fd.exponent = log::floor_log10_pow2(binary_exponent) + static_cast<int>(entry & 1u) - (num_digits(significand) - 1);
+    }
+
+    return fd;
+}
+
+inline ryu::floating_decimal_128 float16_bits_to_fd128(std::uint16_t bits) noexcept
+{
+    return binary16_table_to_fd128<10, 5>(float16_decimal_table, bits);
+}
+
+inline ryu::floating_decimal_128 bfloat16_bits_to_fd128(std::uint16_t bits) noexcept
+{
+    return binary16_table_to_fd128<7, 8>(bfloat16_decimal_table, bits);
+}
+
+}}} // Namespaces
+
+#endif // BOOST_CHARCONV_DETAIL_TO_CHARS_16_BIT_FLOAT_TABLES_HPP
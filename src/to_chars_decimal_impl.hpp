@@ -0,0 +1,136 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#ifndef BOOST_CHARCONV_DETAIL_TO_CHARS_DECIMAL_IMPL_HPP
+#define BOOST_CHARCONV_DETAIL_TO_CHARS_DECIMAL_IMPL_HPP
+
+#include <boost/charconv/detail/config.hpp>
+#include <boost/charconv/detail/to_chars_result.hpp>
+#include <boost/charconv/detail/to_chars_integer_impl.hpp>
+#include <boost/charconv/detail/integer_search_trees.hpp>
+#include <boost/charconv/detail/type_traits.hpp>
+#include <boost/charconv/detail/memcpy.hpp>
+#include <system_error>
+#include <cstring>
+#include <cstdint>
+
+namespace boost { namespace charconv { namespace detail {
+
+// Writes exactly width digits of value into first, including leading zeros.
+// value must be less than 10^width
+template <typename Unsigned_Integer>
+inline void to_chars_fixed_width(char* first, Unsigned_Integer value, int width) noexcept
+{
+    char buffer[10];
+
+    while (width > 9)
+    {
+        const auto chunk = static_cast<std::uint32_t>(value % 1000000000U);
+        value /= 1000000000U;
+        width -= 9;
+
+        decompose32(chunk, buffer);
+        boost::charconv::detail::memcpy(first + width, buffer + 1, 9);
+    }
+
+    decompose32(static_cast<std::uint32_t>(value), buffer);
+    boost::charconv::detail::memcpy(first, buffer + (10 - width), static_cast<std::size_t>(width));
+}
+
+// Prints value * 10^-scale in fixed notation with at least min_fraction_digits digits after the decimal point.
+// Trailing zeros of the fraction beyond min_fraction_digits are removed.
+//
+// The length of the output is known before anything is written,
+// so the integer part, decimal point, fraction, and padding are each written once into their final position.
+template <typename Integer>
+to_chars_result to_chars_decimal_impl(char* first, char* last, Integer value, int scale, int min_fraction_digits) noexcept
+{
+    using Unsigned_Integer = detail::make_unsigned_t<Integer>;
+
+    if (first > last || min_fraction_digits < 0)
+    {
+        return {last, std::errc::invalid_argument};
+    }
+
+    const bool is_negative = value < 0;
+    Unsigned_Integer unsigned_value = is_negative ? static_cast<Unsigned_Integer>(0U - static_cast<Unsigned_Integer>(value)) :
+                                                    static_cast<Unsigned_Integer>(value);
+
+    // Remove the trailing zeros we are allowed to
+    std::int64_t fraction_digits = scale;
+    if (unsigned_value == 0)
+    {
+        // Zero is all trailing zeros, and is padded back out to min_fraction_digits below
+        fraction_digits = 0;
+    }
+    else
+    {
+        while (fraction_digits > min_fraction_digits && unsigned_value % 10U == 0)
+        {
+            unsigned_value /= 10U;
+            --fraction_digits;
+        }
+    }
+
+    const std::int64_t total_digits = unsigned_value == 0 ? 1 : num_digits(unsigned_value);
+
+    // Digits of the value that end up after the decimal point, and the zeros that are appended to each part
+    const std::int64_t value_fraction_digits = fraction_digits > 0 ? fraction_digits : 0;
+    const std::int64_t integer_zeros = fraction_digits < 0 ? -fraction_digits : 0;
+    const std::int64_t fraction_padding = min_fraction_digits > value_fraction_digits ? min_fraction_digits - value_fraction_digits : 0;
+
+    const std::int64_t integer_digits = value_fraction_digits >= total_digits ? 1 : total_digits - value_fraction_digits;
+    const std::int64_t output_fraction_digits = value_fraction_digits + fraction_padding;
+
+    const std::int64_t total_length = static_cast<std::int64_t>(is_negative) + integer_digits + integer_zeros +
+                                      (output_fraction_digits > 0 ? 1 + output_fraction_digits : 0);
+
+    if (total_length > last - first)
+    {
+        return {last, std::errc::value_too_large};
+    }
+
+    // Split the value at the decimal point
+    Unsigned_Integer integer_part = 0;
+    Unsigned_Integer fraction_part = unsigned_value;
+    if (value_fraction_digits < total_digits)
+    {
+        Unsigned_Integer pow10 = 1;
+        for (std::int64_t i = 0; i < value_fraction_digits; ++i)
+        {
+            pow10 *= 10U;
+        }
+
+        integer_part = unsigned_value / pow10;
+        fraction_part = unsigned_value % pow10;
+    }
+
+    if (is_negative)
+    {
+        *first++ = '-';
+    }
+
+    to_chars_fixed_width(first, integer_part, static_cast<int>(integer_digits));
+    first += integer_digits;
+
+    std::memset(first, '0', static_cast<std::size_t>(integer_zeros));
+    first += integer_zeros;
+
+    if (output_fraction_digits > 0)
+    {
+        *first++ = '.';
+
+        to_chars_fixed_width(first, fraction_part, static_cast<int>(value_fraction_digits));
+        first += value_fraction_digits;
+
+        std::memset(first, '0', static_cast<std::size_t>(fraction_padding));
+        first += fraction_padding;
+    }
+
+    return {first, std::errc()};
+}
+
+}}} // Namespaces
+
+#endif // BOOST_CHARCONV_DETAIL_TO_CHARS_DECIMAL_IMPL_HPP
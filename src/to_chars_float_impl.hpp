@@ -15,6 +15,7 @@
 #include <boost/charconv/detail/dragonbox/floff.hpp>
 #include <boost/charconv/detail/bit_layouts.hpp>
 #include <boost/charconv/detail/dragonbox/dragonbox.hpp>
+#include <boost/charconv/detail/ryu/generic_128_precision.hpp>
 #include <boost/charconv/detail/to_chars_integer_impl.hpp>
 #include <boost/charconv/detail/to_chars_result.hpp>
 #include <boost/charconv/detail/emulated128.hpp>
@@ -44,6 +45,10 @@
 #  include <boost/charconv/detail/issignaling.hpp>
 #endif
 
+#ifdef BOOST_CHARCONV_16_BIT_FLOAT_TABLES
+#  include "to_chars_16_bit_float_tables.hpp"
+#endif
+
 namespace boost {
 namespace charconv {
 namespace detail {
@@ -245,6 +250,30 @@ inline std::uint64_t extract_exp<long double, uint128>(long double, uint128 uint
 
 #endif
 
+// Writes the 8 hexits of value, most significant first, to buffer without branching.
+// The nibbles are spread one per byte so that they land in memory in printing order,
+// and then each byte is turned into '0'-'9' or 'a'-'f' in parallel.
+inline void print_8_hexits(std::uint32_t value, char* buffer) noexcept
+{
+    std::uint64_t x;
+
+    #if BOOST_CHARCONV_ENDIAN_LITTLE_BYTE
+    x = (value >> 16) | (static_cast<std::uint64_t>(value & 0xFFFFU) << 32);
+    x = ((x >> 8) & UINT64_C(0x000000FF000000FF)) | ((x & UINT64_C(0x000000FF000000FF)) << 16);
+    x = ((x >> 4) & UINT64_C(0x000F000F000F000F)) | ((x & UINT64_C(0x000F000F000F000F)) << 8);
+    #else
+    x = (static_cast<std::uint64_t>(value >> 16) << 32) | (value & 0xFFFFU);
+    x = ((x & UINT64_C(0x0000FF000000FF00)) << 8) | (x & UINT64_C(0x000000FF000000FF));
+    x = ((x & UINT64_C(0x00F000F000F000F0)) << 4) | (x & UINT64_C(0x000F000F000F000F));
+    #endif
+
+    // Every byte holding 10 or more gets the extra 'a' - '0' - 10 == 39
+    constexpr auto ones = UINT64_C(0x0101010101010101);
+    x += ones * '0' + (((x + ones * 6) >> 4) & ones) * 39;
+
+    std::memcpy(buffer, &x, sizeof(x));
+}
+
 template <typename Real>
 to_chars_result to_chars_hex(char* first, char* last, Real value, int precision) noexcept
 {
@@ -433,8 +462,14 @@ to_chars_result to_chars_hex(char* first, char* last, Real value, int precision)
     const std::uint32_t abs_unbiased_exponent = unbiased_exponent < 0 ? static_cast<std::uint32_t>(-unbiased_exponent) :
                                                 static_cast<std::uint32_t>(unbiased_exponent);
 
-    // Bounds check
-    const std::ptrdiff_t total_length = total_buffer_length(real_precision, abs_unbiased_exponent, (value < 0));
+    // Bounds check. With a precision the length is exact once the decimal point is counted,
+    // and without one real_precision is large enough to cover it.
+    std::ptrdiff_t total_length = total_buffer_length(real_precision, abs_unbiased_exponent, (value < 0));
+    if (precision != -1 && real_precision > 0)
+    {
+        ++total_length;
+    }
+
     if (total_length > buffer_size)
     {
         return {last, std::errc::value_too_large};
@@ -481,32 +516,38 @@ to_chars_result to_chars_hex(char* first, char* last, Real value, int precision)
     if (real_precision > 0)
     {
         *first++ = '.';
+
+        // Convert the fraction 32 bits at a time, left aligning the last chunk
+        constexpr auto hex_chunks = (hex_precision + 7) / 8;
+        char hexits[hex_chunks * 8];
         std::int32_t remaining_bits = hex_bits;
 
-        while (true)
+        for (int i = 0; i < hex_chunks; ++i)
         {
-            remaining_bits -= nibble_bits;
-            const auto current_nibble = static_cast<std::uint32_t>(aligned_significand >> remaining_bits);
-            *first++ = digit_table[current_nibble];
-
-            --real_precision;
-            if (real_precision == 0)
+            std::uint32_t chunk;
+            if (remaining_bits >= 32)
             {
-                break;
+                remaining_bits -= 32;
+                chunk = static_cast<std::uint32_t>(aligned_significand >> remaining_bits);
             }
-            else if (remaining_bits == 0)
+            else
             {
-                // Do not print trailing zeros with unspecified precision
-                if (precision != -1)
-                {
-                    std::memset(first, '0', static_cast<std::size_t>(real_precision));
-                    first += real_precision;
-                }
-                break;
+                chunk = static_cast<std::uint32_t>(aligned_significand) << (32 - remaining_bits);
+                remaining_bits = 0;
             }
 
-            // Mask away the hexit we just printed
-            aligned_significand &= (static_cast<Unsigned_Integer>(1) << remaining_bits) - 1;
+            print_8_hexits(chunk, hexits + i * 8);
+        }
+
+        const auto num_hexits = real_precision < hex_precision ? real_precision : hex_precision;
+        std::memcpy(first, hexits, static_cast<std::size_t>(num_hexits));
+        first += num_hexits;
+
+        // Do not print trailing zeros with unspecified precision
+        if (precision != -1 && real_precision > hex_precision)
+        {
+            std::memset(first, '0', static_cast<std::size_t>(real_precision - hex_precision));
+            first += real_precision - hex_precision;
         }
     }
 
@@ -526,7 +567,7 @@ to_chars_result to_chars_hex(char* first, char* last, Real value, int precision)
         }
     }
 
-    // Print the exponent
+    // Print the exponent, which was accounted for in the bounds check
     *first++ = 'p';
     if (unbiased_exponent < 0)
     {
@@ -537,134 +578,156 @@ to_chars_result to_chars_hex(char* first, char* last, Real value, int precision)
         *first++ = '+';
     }
 
-    return to_chars_int(first, last, abs_unbiased_exponent);
+    const auto exponent_digits = num_digits(abs_unbiased_exponent);
+    char exponent_buffer[10];
+    decompose32(abs_unbiased_exponent, exponent_buffer);
+    std::memcpy(first, exponent_buffer + (sizeof(exponent_buffer) - static_cast<std::size_t>(exponent_digits)), static_cast<std::size_t>(exponent_digits));
+
+    return {first + exponent_digits, std::errc()};
 }
 
 #ifdef BOOST_MSVC
 # pragma warning(pop)
 #endif
 
-template <typename Real>
-to_chars_result to_chars_fixed_impl(char* first, char* last, Real value, chars_format fmt = chars_format::general, int precision = -1) noexcept
+// Reciprocals of 10^1 to 10^16 for splitting a shortest significand, which has at most 17 digits,
+// into its integer and fractional digits. For n < 10^17, n / 10^i == umul128(n, multiplier).high >> shift
+// (see Granlund and Montgomery, "Division by invariant integers using multiplication").
+struct pow10_reciprocal
 {
-    const std::ptrdiff_t buffer_size = last - first;
-    auto real_precision = get_real_precision<Real>(precision);
-    if (buffer_size < real_precision || first > last)
-    {
-        return {last, std::errc::value_too_large};
-    }
-
-    auto abs_value = std::abs(value);
+    std::uint64_t multiplier;
+    int shift;
+};
+
+static constexpr pow10_reciprocal pow10_reciprocals[] = {
+    {UINT64_C(0x199999999999999A), 0}, {UINT64_C(0x028F5C28F5C28F5D), 0},
+    {UINT64_C(0x010624DD2F1A9FBF), 2}, {UINT64_C(0x01A36E2EB1C432CB), 6},
+    {UINT64_C(0x014F8B588E368F09), 9}, {UINT64_C(0x00431BDE82D7B635), 10},
+    {UINT64_C(0x00D6BF94D5E57A43), 15}, {UINT64_C(0x00ABCC77118461CF), 18},
+    {UINT64_C(0x0225C17D04DAD297), 23}, {UINT64_C(0x006DF37F675EF6EB), 24},
+    {UINT64_C(0x00AFEBFF0BCB24AB), 28}, {UINT64_C(0x008CBCCC096F5089), 31},
+    {UINT64_C(0x01C25C268497681D), 36}, {UINT64_C(0x016849B86A12B9B1), 39},
+    {UINT64_C(0x00901D7CF73AB0AD), 41}, {UINT64_C(0x00734ACA5F6226F1), 44}
+};
+
+// n / 10^i for n < 10^17 and 1 <= i <= 16
+inline std::uint64_t divide_by_pow10(std::uint64_t n, int i) noexcept
+{
+    BOOST_CHARCONV_ASSERT(i >= 1 && i <= 16);
+    const auto& r = pow10_reciprocals[i - 1];
+    return umul128(n, r.multiplier).high >> r.shift;
+}
 
-    auto value_struct = boost::charconv::detail::to_decimal(value);
-    if (value_struct.is_negative)
+// Writes n < 10^18 as exactly digits characters, with leading zeros
+inline char* print_zero_padded(char* first, std::uint64_t n, int digits) noexcept
+{
+    char buffer[19];
+    if (digits <= 9)
     {
-        *first++ = '-';
+        decompose32(static_cast<std::uint32_t>(n), buffer + 9);
     }
-
-    if (value_struct.significand == 0)
+    else
     {
-        *first++ = '0';
-        if (precision > -1)
-        {
-            *first++ = '.';
-            std::memset(first, '0', static_cast<std::size_t>(precision));
-            first += precision;
-        }
-
-        return {first, std::errc()};
+        // The leading zero of the low half is overwritten by the last digit of the high half
+        decompose32(static_cast<std::uint32_t>(n % UINT64_C(1000000000)), buffer + 9);
+        decompose32(static_cast<std::uint32_t>(n / UINT64_C(1000000000)), buffer);
     }
 
-    const int starting_num_digits = num_digits(value_struct.significand);
-    int num_dig = starting_num_digits;
-    if (precision != -1)
-    {
-        while (num_dig > precision + 2)
-        {
-            value_struct.significand /= 10;
-            ++value_struct.exponent;
-            --num_dig;
-        }
+    std::memcpy(first, buffer + (sizeof(buffer) - static_cast<std::size_t>(digits)), static_cast<std::size_t>(digits));
+    return first + digits;
+}
 
-        if (num_dig == precision + 2)
-        {
-            const auto trailing_dig = value_struct.significand % 10;
-            value_struct.significand /= 10;
-            ++value_struct.exponent;
-            --num_dig;
+// Shortest representation in fixed notation. The length of the output is known from the decimal significand
+// and exponent, so every part of it is written once at its final position.
+template <typename Real>
+to_chars_result to_chars_fixed_impl(char* first, char* last, Real value) noexcept
+{
+    const auto value_struct = boost::charconv::detail::to_decimal(value);
+    const auto significand = static_cast<std::uint64_t>(value_struct.significand);
+    const int exponent = significand == 0 ? 0 : value_struct.exponent;
 
-            if (trailing_dig >= 5)
-            {
-                ++value_struct.significand;
-            }
-        }
+    const int num_dig = significand == 0 ? 1 : num_digits(significand);
 
-        // In general formatting we remove trailing 0s
-        if (fmt == chars_format::general)
-        {
-            while (value_struct.significand % 10 == 0)
-            {
-                value_struct.significand /= 10;
-                ++value_struct.exponent;
-                --num_dig;
-            }
-        }
+    // Number of digits before the decimal point, which is not positive for values below 1
+    const int integer_digits = num_dig + exponent;
+
+    std::ptrdiff_t total_length = static_cast<std::ptrdiff_t>(value_struct.is_negative);
+    if (exponent >= 0)
+    {
+        total_length += integer_digits;
+    }
+    else if (integer_digits > 0)
+    {
+        total_length += num_dig + 1;
+    }
+    else
+    {
+        total_length += 2 - integer_digits + num_dig;
     }
 
-    // Make sure the result will fit in the buffer
-    const std::ptrdiff_t total_length = total_buffer_length(num_dig, value_struct.exponent, (value < 0));
-    if (total_length > buffer_size)
+    if (total_length > last - first)
     {
         return {last, std::errc::value_too_large};
     }
 
-    // Insert leading 0s if needed before printing the significand 
-    if (abs_value < 1)
+    if (value_struct.is_negative)
     {
-        // Additional bounds check for inserted zeros
-        if (-value_struct.exponent - starting_num_digits + 2 > (last - first))
-        {
-            return {last, std::errc::value_too_large};
-        }
-
-        std::memcpy(first, "0.", 2U);
-        std::memset(first + 2, '0', -value_struct.exponent - starting_num_digits);
-        first += 2 - value_struct.exponent - starting_num_digits;
+        *first++ = '-';
     }
 
-    auto r = to_chars_integer_impl(first, last, value_struct.significand);
-    if (r.ec != std::errc())
+    // d...d000
+    if (exponent >= 0)
     {
-        return r;
+        first = print_zero_padded(first, significand, num_dig);
+        std::memset(first, '0', static_cast<std::size_t>(exponent));
+        return {first + exponent, std::errc()};
     }
 
-    // Bounds check
-    if (abs_value >= 1)
+    // d...d.d...d
+    if (integer_digits > 0)
     {
-        if (value_struct.exponent < 0 && -value_struct.exponent < buffer_size)
-        {
-            std::memmove(r.ptr + value_struct.exponent + 1, r.ptr + value_struct.exponent,
-                         static_cast<std::size_t>(-value_struct.exponent));
-            std::memset(r.ptr + value_struct.exponent, '.', 1);
-            ++r.ptr;
-        }
+        const auto integer_part = divide_by_pow10(significand, -exponent);
+        const auto fractional_part = significand - integer_part * power_of_10[-exponent];
 
-        // Add additional zeros as needed
-        if (value_struct.exponent > 0)
-        {
-            const auto zeros_to_append = static_cast<std::size_t>(value_struct.exponent);
+        first = print_zero_padded(first, integer_part, integer_digits);
+        *first++ = '.';
+        return {print_zero_padded(first, fractional_part, -exponent), std::errc()};
+    }
 
-            if (zeros_to_append > static_cast<std::size_t>(last - r.ptr))
-            {
-                return {last, std::errc::value_too_large};
-            }
+    // 0.00...0d...d
+    std::memcpy(first, "0.", 2U);
+    std::memset(first + 2, '0', static_cast<std::size_t>(-integer_digits));
+    first += 2 - integer_digits;
+    return {print_zero_padded(first, significand, num_dig), std::errc()};
+}
 
-            std::memset(r.ptr, '0', zeros_to_append);
-            r.ptr += zeros_to_append;
-        }
+// Integers in [1, 2^digits) are the only values in their rounding interval with no fractional digits,
+// so their shortest representation in general and fixed notation is the integer itself.
+// Returns false when the value is not such an integer, which is decided from the exponent and fraction bits.
+template <typename Real, typename Unsigned_Integer>
+inline bool exact_integer_value(Real value, Unsigned_Integer& integer_value, bool& is_negative) noexcept
+{
+    using layout = typename std::conditional<std::is_same<Real, double>::value, ieee754_binary64, ieee754_binary32>::type;
+    constexpr auto significand_mask = (static_cast<Unsigned_Integer>(1) << layout::significand_bits) - 1;
+    constexpr auto exponent_mask = (static_cast<Unsigned_Integer>(1) << layout::exponent_bits) - 1;
+
+    const auto bits = convert_value<Unsigned_Integer>(value);
+    const int exponent = static_cast<int>((bits >> layout::significand_bits) & exponent_mask) + layout::exponent_bias;
+    if (exponent < 0 || exponent > layout::significand_bits)
+    {
+        return false;
+    }
+
+    const int fraction_bits = layout::significand_bits - exponent;
+    const auto significand = bits & significand_mask;
+    if ((significand & ((static_cast<Unsigned_Integer>(1) << fraction_bits) - 1)) != 0)
+    {
+        return false;
     }
 
-    return { r.ptr, std::errc() };
+    integer_value = (significand | (significand_mask + 1)) >> fraction_bits;
+    is_negative = (bits >> (layout::significand_bits + layout::exponent_bits)) != 0;
+    return true;
 }
 
 template <typename Real>
@@ -685,11 +748,25 @@ to_chars_result to_chars_float_impl(char* first, char* last, Real value, chars_f
     // Unspecified precision so we always go with the shortest representation
     if (precision == -1)
     {
+        if (fmt == boost::charconv::chars_format::general || fmt == boost::charconv::chars_format::fixed)
+        {
+            Unsigned_Integer integer_value;
+            bool is_negative;
+            if (exact_integer_value(value, integer_value, is_negative))
+            {
+                if (is_negative)
+                {
+                    *first++ = '-';
+                }
+                return to_chars_integer_impl(first, last, integer_value);
+            }
+        }
+
         if (fmt == boost::charconv::chars_format::general)
         {
             if (abs_value >= 1 && abs_value < max_fractional_value)
             {
-                return to_chars_fixed_impl(first, last, value, fmt, precision);
+                return to_chars_fixed_impl(first, last, value);
             }
             else if (abs_value >= max_fractional_value && abs_value < max_value)
             {
@@ -710,7 +787,7 @@ to_chars_result to_chars_float_impl(char* first, char* last, Real value, chars_f
         }
         else if (fmt == boost::charconv::chars_format::fixed)
         {
-            return to_chars_fixed_impl(first, last, value, fmt, precision);
+            return to_chars_fixed_impl(first, last, value);
         }
     }
     else
@@ -719,19 +796,29 @@ to_chars_result to_chars_float_impl(char* first, char* last, Real value, chars_f
         {
             if (fmt == boost::charconv::chars_format::general)
             {
-                constexpr int max_output_length = std::is_same<Real, double>::value ? 773 : 117;
                 constexpr int max_precision = std::is_same<Real, double>::value ? 767 : 112;
                 // We remove trailing zeros, so precision > max_precision is same as precision == max_precision.
                 if (precision > max_precision)
                 {
                     precision = max_precision;
                 }
+
+                // Write straight into the caller's buffer when it can hold the longest possible output,
+                // and only go through the temporary buffer when the result may or may not fit
+                if (static_cast<std::size_t>(last - first) >= boost::charconv::detail::floff_general_max_length(precision))
+                {
+                    return boost::charconv::detail::floff<boost::charconv::detail::default_main_cache,
+                                                          boost::charconv::detail::default_extended_cache>(value, precision,
+                                                                                                           first, last, fmt);
+                }
+
+                constexpr std::size_t max_output_length = boost::charconv::detail::floff_general_max_length(max_precision);
                 char temp_buffer[max_output_length];
-                auto result = boost::charconv::detail::floff<boost::charconv::detail::main_cache_full,
-                                                             boost::charconv::detail::extended_cache_long>(value, precision,
-                                                                                                           temp_buffer,
-                                                                                                           temp_buffer + max_output_length,
-                                                                                                           fmt);
+                auto result = boost::charconv::detail::floff<boost::charconv::detail::default_main_cache,
+                                                             boost::charconv::detail::default_extended_cache>(value, precision,
+                                                                                                              temp_buffer,
+                                                                                                              temp_buffer + max_output_length,
+                                                                                                              fmt);
                 auto output_size = static_cast<std::size_t>(result.ptr - temp_buffer);
                 if (static_cast<std::size_t>(last - first) < output_size)
                 {
@@ -739,11 +826,10 @@ to_chars_result to_chars_float_impl(char* first, char* last, Real value, chars_f
                 }
                 std::memcpy(first, temp_buffer, output_size);
                 return {first + output_size, std::errc()};
-                
             }
-            return boost::charconv::detail::floff<boost::charconv::detail::main_cache_full,
-                                                  boost::charconv::detail::extended_cache_long>(value, precision,
-                                                                                                first, last, fmt);
+            return boost::charconv::detail::floff<boost::charconv::detail::default_main_cache,
+                                                  boost::charconv::detail::default_extended_cache>(value, precision,
+                                                                                                   first, last, fmt);
         }
     }
 
@@ -800,8 +886,24 @@ to_chars_result to_chars_float_impl(char* first, char* last, long double value,
     }
     #endif
 
-    // Sanity check our bounds
     const std::ptrdiff_t buffer_size = last - first;
+
+    // With a precision the output comes from the exact decimal expansion of the value.
+    // It checks the bounds itself, so a buffer of exactly the length of the output is enough.
+    if (precision >= 0 && fmt != boost::charconv::chars_format::hex && first <= last)
+    {
+        const auto fb128 = boost::charconv::detail::ryu::long_double_to_fb128(value);
+        const auto num_chars = boost::charconv::detail::ryu::generic_to_chars_precision(fb128, first, buffer_size, fmt, precision);
+
+        if (num_chars > 0)
+        {
+            return { first + num_chars, std::errc() };
+        }
+
+        return {last, std::errc::value_too_large};
+    }
+
+    // Sanity check our bounds
     auto real_precision = boost::charconv::detail::get_real_precision<long double>(precision);
     if (buffer_size < real_precision || first > last)
     {
@@ -865,8 +967,24 @@ to_chars_result to_chars_float_impl(char* first, char* last, __float128 value, c
         return boost::charconv::detail::to_chars_nonfinite(first, last, value, FP_INFINITE);
     }
 
-    // Sanity check our bounds
     const std::ptrdiff_t buffer_size = last - first;
+
+    // With a precision the output comes from the exact decimal expansion of the value.
+    // It checks the bounds itself, so a buffer of exactly the length of the output is enough.
+    if (precision >= 0 && fmt != boost::charconv::chars_format::hex && first <= last)
+    {
+        const auto fb128 = boost::charconv::detail::ryu::float128_to_fb128(value);
+        const auto num_chars = boost::charconv::detail::ryu::generic_to_chars_precision(fb128, first, buffer_size, fmt, precision);
+
+        if (num_chars > 0)
+        {
+            return { first + num_chars, std::errc() };
+        }
+
+        return {last, std::errc::value_too_large};
+    }
+
+    // Sanity check our bounds
     auto real_precision = boost::charconv::detail::get_real_precision<__float128>(precision);
     if (buffer_size < real_precision || first > last)
     {
@@ -915,6 +1033,32 @@ to_chars_result to_chars_float_impl(char* first, char* last, __float128 value, c
 
 #if defined(BOOST_CHARCONV_HAS_FLOAT16) || defined(BOOST_CHARCONV_HAS_BRAINFLOAT16)
 
+#ifdef BOOST_CHARCONV_HAS_FLOAT16
+inline ryu::floating_decimal_128 shortest_16_bit_float(std::float16_t value) noexcept
+{
+    #ifdef BOOST_CHARCONV_16_BIT_FLOAT_TABLES
+    std::uint16_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return float16_bits_to_fd128(bits);
+    #else
+    return ryu::float16_t_to_fd128(value);
+    #endif
+}
+#endif
+
+#ifdef BOOST_CHARCONV_HAS_BRAINFLOAT16
+inline ryu::floating_decimal_128 shortest_16_bit_float(std::bfloat16_t value) noexcept
+{
+    #ifdef BOOST_CHARCONV_16_BIT_FLOAT_TABLES
+    std::uint16_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bfloat16_bits_to_fd128(bits);
+    #else
+    return ryu::float16_t_to_fd128(value);
+    #endif
+}
+#endif
+
 template <typename T>
 to_chars_result to_chars_16_bit_float_impl(char* first, char* last, T value, chars_format fmt, int precision) noexcept
 {
@@ -935,7 +1079,7 @@ to_chars_result to_chars_16_bit_float_impl(char* first, char* last, T value, cha
 
     if (fmt == boost::charconv::chars_format::general || fmt == boost::charconv::chars_format::scientific)
     {
-        const auto fd128 = boost::charconv::detail::ryu::float16_t_to_fd128(value);
+        const auto fd128 = shortest_16_bit_float(value);
         const auto num_chars = boost::charconv::detail::ryu::generic_to_chars(fd128, first, last - first, fmt, precision);
 
         if (num_chars > 0)
@@ -949,7 +1093,7 @@ to_chars_result to_chars_16_bit_float_impl(char* first, char* last, T value, cha
     }
     else if (fmt == boost::charconv::chars_format::fixed)
     {
-        const auto fd128 = boost::charconv::detail::ryu::float16_t_to_fd128(value);
+        const auto fd128 = shortest_16_bit_float(value);
         const auto num_chars = boost::charconv::detail::ryu::generic_to_chars_fixed(fd128, first, last - first, precision);
 
         if (num_chars > 0)
@@ -0,0 +1,174 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+#if defined(BOOST_CHARCONV_HAS_FLOAT16) || defined(BOOST_CHARCONV_HAS_BRAINFLOAT16)
+
+#include <system_error>
+#include <iostream>
+#include <string>
+#include <limits>
+#include <cstring>
+#include <cstdint>
+#include <cmath>
+
+template <typename T>
+T from_bits(std::uint16_t bits)
+{
+    T value;
+    std::memcpy(&value, &bits, sizeof(T));
+    return value;
+}
+
+template <typename T>
+std::uint16_t to_bits(T value)
+{
+    std::uint16_t bits;
+    std::memcpy(&bits, &value, sizeof(T));
+    return bits;
+}
+
+template <typename T>
+void check_parse(const std::string& str, std::uint16_t expected_bits, std::errc expected_ec = std::errc())
+{
+    T value {};
+    const auto r = boost::charconv::from_chars_erange(str.data(), str.data() + str.size(), value);
+
+    if (!BOOST_TEST(r.ec == expected_ec) || !BOOST_TEST(r.ptr == str.data() + str.size()) || !BOOST_TEST_EQ(to_bits(value), expected_bits))
+    {
+        std::cerr << "Failure parsing: " << str << "\nExpected bits: " << expected_bits << std::endl; // LCOV_EXCL_LINE
+    }
+}
+
+// The exact decimal representation of an IEEE 754 value with trailing zeros removed
+std::string exact_decimal(double value)
+{
+    char buffer[256];
+    const auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), value, boost::charconv::chars_format::scientific, 150);
+    BOOST_TEST(r);
+
+    std::string str(buffer, r.ptr);
+    const auto exp_pos = str.find('e');
+    std::string significand = str.substr(0, exp_pos);
+    while (significand.back() == '0')
+    {
+        significand.pop_back();
+    }
+    if (significand.back() == '.')
+    {
+        significand.pop_back();
+    }
+
+    return significand + str.substr(exp_pos);
+}
+
+template <typename T>
+void test_exhaustive()
+{
+    constexpr auto mantissa_bits = std::numeric_limits<T>::digits - 1;
+    constexpr auto exponent_bits = 15 - mantissa_bits;
+    constexpr std::uint16_t inf_bits = static_cast<std::uint16_t>(((1U << exponent_bits) - 1U) << mantissa_bits);
+
+    for (std::uint32_t i = 0; i <= UINT16_MAX; ++i)
+    {
+        const auto bits = static_cast<std::uint16_t>(i);
+        const auto magnitude = static_cast<std::uint16_t>(bits & 0x7FFFU);
+        const T value = from_bits<T>(bits);
+
+        char buffer[64] {};
+
+        if (magnitude > inf_bits)
+        {
+            const auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), value);
+            BOOST_TEST(r);
+
+            T parsed {};
+            const auto r2 = boost::charconv::from_chars(buffer, r.ptr, parsed);
+            BOOST_TEST(r2) && BOOST_TEST(parsed != parsed);
+            continue;
+        }
+
+        // Round trip through the shortest representation of the 16-bit type
+        auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), value);
+        BOOST_TEST(r);
+        check_parse<T>(std::string(buffer, r.ptr), bits);
+
+        if (magnitude == inf_bits)
+        {
+            continue;
+        }
+
+        // Round trip through the shortest representation of float which is much longer
+        const auto float_value = static_cast<float>(value);
+        r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), float_value);
+        BOOST_TEST(r);
+        check_parse<T>(std::string(buffer, r.ptr), bits);
+
+        // And through the exact value
+        check_parse<T>(exact_decimal(static_cast<double>(float_value)), bits);
+
+        if (bits != magnitude)
+        {
+            continue;
+        }
+
+        // The halfway point to the next value must round to even,
+        // and anything just above or below it must not be affected by that
+        const auto next = static_cast<std::uint16_t>(bits + 1);
+        const double lower = static_cast<double>(float_value);
+        const double upper = next == inf_bits ? std::ldexp(1.0, std::numeric_limits<T>::max_exponent) :
+                                                static_cast<double>(static_cast<float>(from_bits<T>(next)));
+        const std::string halfway = exact_decimal((lower + upper) / 2);
+        const auto exp_pos = halfway.find('e');
+        std::string significand = halfway.substr(0, exp_pos);
+        const std::string exponent = halfway.substr(exp_pos);
+
+        const std::uint16_t even = (bits & 1U) == 0 ? bits : next;
+        const auto ec_for = [&](std::uint16_t result) { return result == 0 || result == inf_bits ? std::errc::result_out_of_range : std::errc(); };
+
+        check_parse<T>(halfway, even, ec_for(even));
+
+        std::string below = significand;
+        below.back() = static_cast<char>(below.back() - 1);
+        if (below.find('.') == std::string::npos)
+        {
+            below += '.';
+        }
+        check_parse<T>(below + "99999999999999999999999999" + exponent, bits, ec_for(bits));
+
+        if (significand.find('.') == std::string::npos)
+        {
+            significand += '.';
+        }
+        check_parse<T>(significand + "00000000000000000000000001" + exponent, next, ec_for(next));
+    }
+}
+
+int main()
+{
+    #ifdef BOOST_CHARCONV_HAS_FLOAT16
+    test_exhaustive<std::float16_t>();
+    check_parse<std::float16_t>("65504", UINT16_C(0x7BFF));
+    check_parse<std::float16_t>("2048e4", UINT16_C(0x7C00), std::errc::result_out_of_range);
+    check_parse<std::float16_t>("-2048e4", UINT16_C(0xFC00), std::errc::result_out_of_range);
+    #endif
+
+    #ifdef BOOST_CHARCONV_HAS_BRAINFLOAT16
+    test_exhaustive<std::bfloat16_t>();
+    check_parse<std::bfloat16_t>("2048e4", UINT16_C(0x4B9C));
+    #endif
+
+    return boost::report_errors();
+}
+
+#else
+
+int main()
+{
+    return 0;
+}
+
+#endif
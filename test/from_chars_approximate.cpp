@@ -0,0 +1,194 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <system_error>
+#include <iostream>
+#include <iomanip>
+#include <random>
+#include <string>
+#include <limits>
+#include <cstring>
+#include <cstdint>
+#include <cmath>
+
+static std::mt19937_64 rng(42);
+constexpr std::size_t N = 1024;
+
+template <typename T>
+struct bits_type;
+
+template <>
+struct bits_type<float> { using type = std::uint32_t; };
+
+template <>
+struct bits_type<double> { using type = std::uint64_t; };
+
+template <typename T>
+typename bits_type<T>::type to_bits(T value)
+{
+    typename bits_type<T>::type bits;
+    std::memcpy(&bits, &value, sizeof(T));
+    return bits;
+}
+
+// Distance in ULP between two finite values of the same sign
+template <typename T>
+typename bits_type<T>::type ulp_distance(T lhs, T rhs)
+{
+    const auto lhs_bits = to_bits(lhs);
+    const auto rhs_bits = to_bits(rhs);
+    return lhs_bits > rhs_bits ? lhs_bits - rhs_bits : rhs_bits - lhs_bits;
+}
+
+// The approximation must be within 1 ULP of from_chars, and identical if exact is true
+template <typename T>
+void check(const std::string& str, bool exact = false)
+{
+    T expected {};
+    const auto r = boost::charconv::from_chars(str.c_str(), str.c_str() + str.size(), expected);
+
+    T value {};
+    const auto r2 = boost::charconv::from_chars_approximate(str.c_str(), str.c_str() + str.size(), value);
+
+    if (!BOOST_TEST(r.ec == r2.ec) || !BOOST_TEST(r.ptr == r2.ptr))
+    {
+        std::cerr << "Input: " << str << std::endl; // LCOV_EXCL_LINE
+        return;
+    }
+
+    if (r.ec != std::errc())
+    {
+        return;
+    }
+
+    if (expected != expected)
+    {
+        BOOST_TEST(value != value);
+    }
+    else if (!BOOST_TEST_EQ(std::signbit(value), std::signbit(expected)) ||
+             !BOOST_TEST_LE(ulp_distance(value, expected), exact ? 0U : 1U))
+    {
+        std::cerr << std::setprecision(std::numeric_limits<T>::max_digits10)
+                  << "Input: " << str << "\nExpected: " << expected << "\nGot: " << value << std::endl; // LCOV_EXCL_LINE
+    }
+}
+
+template <typename T>
+void test_spot_values()
+{
+    check<T>("0", true);
+    check<T>("-0", true);
+    check<T>("1", true);
+    check<T>("1.5", true);
+    check<T>("-2.5e-3", true);
+    check<T>("3.141592653589793238462643383279", true);
+    check<T>("inf", true);
+    check<T>("-nan", true);
+    check<T>("1e500", true);
+    check<T>("1e-500", true);
+    check<T>("", true);
+    check<T>("abc", true);
+    check<T>("+1", true);
+    check<T>("1.0abc", true);
+    check<T>("0.000000000000000000000000000000000000000000000000000000000000000000001", true);
+
+    // Near the bounds of the type the approximation must not overflow or flush to zero
+    check<T>("1.79769313486231570814527423731704356798070567525844996598917476803157260780e308");
+    check<T>("3.40282346638528859811704183484516925440e38");
+    check<T>("4.9406564584124654417656879286822137236505980e-324");
+    check<T>("1.40129846432481707092372958328991613128026194187651577175706828388979108268586060148663818836212158203125e-45");
+    check<T>("2.2250738585072011e-308");
+    check<T>("2.2250738585072012e-308");
+
+    // Values that take the slow path in from_chars
+    check<T>("7.0420557077594588669468784357561207962098443483187940792729600000e+59");
+    check<T>("9007199254740993.0000000000000000000000000000000000000000000000000001");
+    check<T>("9007199254740992.9999999999999999999999999999999999999999999999999999");
+    check<T>("2.00000017881393432617187499");
+    check<T>("2.000000178813934326171875");
+    check<T>("2.00000017881393432617187501");
+}
+
+// Shortest representations have at most 17 digits, so the approximation is exact
+template <typename T>
+void test_shortest_values()
+{
+    std::uniform_int_distribution<typename bits_type<T>::type> bits_dist;
+
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        const auto bits = bits_dist(rng);
+        T value;
+        std::memcpy(&value, &bits, sizeof(T));
+
+        char buffer[64] {};
+        const auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), value);
+        BOOST_TEST(r);
+        check<T>(std::string(buffer, r.ptr), true);
+    }
+}
+
+// Decimal expansions of points halfway between two floats, and slightly above or below them.
+// Those of more than 19 digits are the inputs where the approximation may differ from from_chars,
+// and cut to 19 digits they must be exact.
+void test_halfway_values()
+{
+    std::uniform_int_distribution<std::uint32_t> bits_dist(0, 0x7F7FFFFEU);
+
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        const auto bits = bits_dist(rng);
+        float lower;
+        std::memcpy(&lower, &bits, sizeof(float));
+        const float upper = std::nextafter(lower, std::numeric_limits<float>::infinity());
+
+        // The midpoint of two floats is exactly representable as a double
+        const double halfway = (static_cast<double>(lower) + static_cast<double>(upper)) / 2;
+
+        char buffer[256] {};
+        const auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), halfway, boost::charconv::chars_format::scientific, 120);
+        BOOST_TEST(r);
+
+        std::string str(buffer, r.ptr);
+        const auto exp_pos = str.find('e');
+        const std::string significand = str.substr(0, exp_pos);
+        const std::string exponent = str.substr(exp_pos);
+
+        check<float>(str);
+        check<float>(significand + "1" + exponent);
+        check<float>(significand.substr(0, 40) + exponent);
+        check<float>(significand.substr(0, 20) + exponent, true);
+        check<double>(significand.substr(0, 20) + exponent, true);
+        check<double>(str);
+    }
+}
+
+int main()
+{
+    test_spot_values<float>();
+    test_spot_values<double>();
+
+    test_shortest_values<float>();
+    test_shortest_values<double>();
+
+    test_halfway_values();
+
+    // Hexadecimal is always exact
+    double d {};
+    double expected {};
+    const char* str = "1.8p+1";
+    auto r = boost::charconv::from_chars_approximate(str, str + std::strlen(str), d, boost::charconv::chars_format::hex);
+    BOOST_TEST(r);
+    r = boost::charconv::from_chars(str, str + std::strlen(str), expected, boost::charconv::chars_format::hex);
+    BOOST_TEST(r) && BOOST_TEST_EQ(d, expected);
+
+    // string_view overload
+    float f {};
+    r = boost::charconv::from_chars_approximate(boost::core::string_view("0.25"), f);
+    BOOST_TEST(r) && BOOST_TEST_EQ(f, 0.25F);
+
+    return boost::report_errors();
+}
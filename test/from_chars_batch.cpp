@@ -0,0 +1,164 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <boost/core/detail/string_view.hpp>
+#include <system_error>
+#include <random>
+#include <string>
+#include <vector>
+#include <limits>
+#include <cstring>
+#include <cstdint>
+#include <iostream>
+#include <iomanip>
+
+static std::mt19937_64 rng(42);
+constexpr std::size_t N = 1024;
+
+// Every element of the batch must match a standalone call to from_chars
+template <typename T>
+void check_batch(const std::vector<std::string>& strings, boost::charconv::chars_format fmt = boost::charconv::chars_format::general)
+{
+    const T sentinel = static_cast<T>(-42.5);
+
+    std::vector<boost::core::string_view> views(strings.begin(), strings.end());
+    std::vector<T> values(strings.size(), sentinel);
+    std::vector<std::errc> errors(strings.size(), std::errc::io_error);
+
+    const auto successes = boost::charconv::from_chars_batch(views.data(), views.size(), values.data(), errors.data(), fmt);
+
+    std::size_t expected_successes = 0;
+    for (std::size_t i = 0; i < strings.size(); ++i)
+    {
+        T expected = sentinel;
+        const auto first = strings[i].c_str();
+        const auto last = first + strings[i].size();
+        auto r = boost::charconv::from_chars(first, last, expected, fmt);
+        std::errc expected_ec = r.ec;
+        if (r.ec == std::errc() && r.ptr != last)
+        {
+            expected_ec = std::errc::invalid_argument;
+            expected = sentinel;
+        }
+
+        if (!BOOST_TEST(errors[i] == expected_ec))
+        {
+            std::cerr << "Error mismatch for: \"" << strings[i] << "\"" << std::endl; // LCOV_EXCL_LINE
+        }
+
+        if (expected_ec == std::errc())
+        {
+            ++expected_successes;
+        }
+
+        if (expected != expected)
+        {
+            BOOST_TEST(values[i] != values[i]);
+        }
+        else if (!BOOST_TEST(std::memcmp(&values[i], &expected, sizeof(T)) == 0))
+        {
+            std::cerr << std::setprecision(std::numeric_limits<T>::max_digits10)
+                      << "Value mismatch for: \"" << strings[i] << "\"\n"
+                      << "Expected: " << expected << "\nGot: " << values[i] << std::endl; // LCOV_EXCL_LINE
+        }
+    }
+
+    BOOST_TEST_EQ(successes, expected_successes);
+}
+
+template <typename T>
+void test_random_values()
+{
+    std::uniform_real_distribution<T> dist(static_cast<T>(-1e10), static_cast<T>(1e10));
+    std::uniform_int_distribution<std::uint64_t> bits_dist;
+    std::vector<std::string> strings;
+
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        char buffer[64] {};
+        T value = dist(rng);
+
+        // Mix in arbitrary bit patterns to exercise the slow paths as well
+        if (i % 3 == 0)
+        {
+            const auto bits = bits_dist(rng);
+            std::memcpy(&value, &bits, sizeof(T));
+            if (!(value == value) || value == std::numeric_limits<T>::infinity() || value == -std::numeric_limits<T>::infinity())
+            {
+                value = static_cast<T>(i);
+            }
+        }
+
+        auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), value);
+        BOOST_TEST(r);
+        strings.emplace_back(buffer, r.ptr);
+    }
+
+    check_batch<T>(strings);
+}
+
+template <typename T>
+void test_edge_cases()
+{
+    const std::vector<std::string> strings {
+        "", "0", "-0", "1", "-1", "1.5", "1e5", "1e-5", "0.1", "3.141592653589793",
+        "inf", "-inf", "infinity", "nan", "-nan", "nan(snan)",
+        "1e500", "-1e500", "1e-500", "-1e-500",
+        "1.", ".5", "abc", "1.0abc", "12 ", " 12", "+1", "--1",
+        "2.2250738585072011e-308", "4.9406564584124654e-324", "1.7976931348623157e+308",
+        "1.17549435e-38", "3.40282347e+38", "1.40129846e-45",
+        "9007199254740993", "123456789012345678901234567890",
+        "0.000000000000000000000000000000000000000000001",
+        "7.0420557077594588669468784357561207962098443483187940792729600000e+59"
+    };
+
+    check_batch<T>(strings);
+}
+
+template <typename T>
+void test_formats()
+{
+    const std::vector<std::string> strings {"1.5", "1e5", "1.5e-3", "0x1p3", "1p3", "ff", "1.8p1"};
+
+    check_batch<T>(strings, boost::charconv::chars_format::general);
+    check_batch<T>(strings, boost::charconv::chars_format::fixed);
+    check_batch<T>(strings, boost::charconv::chars_format::scientific);
+    check_batch<T>(strings, boost::charconv::chars_format::hex);
+}
+
+template <typename T>
+void test_batch_sizes()
+{
+    // Ragged batch sizes: empty, a single element, every small odd and even size, and a large batch,
+    // each compared element by element against single from_chars calls
+    for (std::size_t count = 0; count <= 1001; count = count < 20 ? count + 1 : 1001 + (count == 1001))
+    {
+        std::vector<std::string> strings;
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            strings.emplace_back(std::to_string(i) + ".12345678901234567890e" + std::to_string(static_cast<int>(i) - 10));
+        }
+
+        check_batch<T>(strings);
+    }
+}
+
+int main()
+{
+    test_random_values<float>();
+    test_random_values<double>();
+
+    test_edge_cases<float>();
+    test_edge_cases<double>();
+
+    test_formats<float>();
+    test_formats<double>();
+
+    test_batch_sizes<float>();
+    test_batch_sizes<double>();
+
+    return boost::report_errors();
+}
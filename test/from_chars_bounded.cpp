@@ -0,0 +1,209 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <system_error>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+#include <limits>
+#include <cstring>
+#include <cstdint>
+#include <cmath>
+
+static std::mt19937_64 rng(42);
+constexpr std::size_t N = 1024;
+
+// Within the limit the result must be identical to from_chars
+template <typename T>
+void check_same(const std::string& str, std::size_t max_digits, boost::charconv::chars_format fmt = boost::charconv::chars_format::general)
+{
+    T expected {};
+    const auto r = boost::charconv::from_chars(str.c_str(), str.c_str() + str.size(), expected, fmt);
+
+    T value {};
+    const auto r2 = boost::charconv::from_chars_bounded(str.c_str(), str.c_str() + str.size(), value, max_digits, fmt);
+
+    if (!BOOST_TEST(r.ec == r2.ec) || !BOOST_TEST(r.ptr == r2.ptr))
+    {
+        std::cerr << "Input: " << str << std::endl; // LCOV_EXCL_LINE
+        return;
+    }
+
+    if (expected != expected)
+    {
+        BOOST_TEST(value != value);
+    }
+    else if (!BOOST_TEST(value == expected) || !BOOST_TEST_EQ(std::signbit(value), std::signbit(expected)))
+    {
+        std::cerr << "Input: " << str << std::endl; // LCOV_EXCL_LINE
+    }
+}
+
+template <typename T>
+void check_too_long(const std::string& str, std::size_t max_digits, std::size_t expected_offset)
+{
+    T value = static_cast<T>(42);
+    const auto r = boost::charconv::from_chars_bounded(str.c_str(), str.c_str() + str.size(), value, max_digits);
+    if (!BOOST_TEST(r.ec == std::errc::value_too_large) || !BOOST_TEST(r.ptr == str.c_str() + expected_offset) || !BOOST_TEST_EQ(value, static_cast<T>(42)))
+    {
+        std::cerr << "Input: " << str << std::endl; // LCOV_EXCL_LINE
+    }
+}
+
+template <typename T>
+void test_spot_values()
+{
+    check_same<T>("1", 1);
+    check_same<T>("-1.5", 2);
+    check_same<T>("1.5e10", 2);
+    check_same<T>("1.5e+10", 2);
+    check_same<T>("0.000123", 7);
+    check_same<T>("123456789012345678901234567890", 30);
+    check_same<T>("1.5e", 2);
+    check_same<T>("1.5abc", 2);
+    check_same<T>("", 10);
+    check_same<T>("-", 10);
+    check_same<T>("+1", 10);
+    check_same<T>(".", 10);
+    check_same<T>("inf", 0);
+    check_same<T>("-infinity", 0);
+    check_same<T>("nan", 0);
+    check_same<T>("nan(snan)", 4);
+    check_same<T>("nan(ind)", 3);
+    check_same<T>("1e500", 3);
+    check_same<T>("1e-500", 3);
+    check_same<T>("1.8p+1", 2, boost::charconv::chars_format::hex);
+    check_same<T>("abc.defp-10", 6, boost::charconv::chars_format::hex);
+    check_same<T>("1.5", 2, boost::charconv::chars_format::fixed);
+    check_same<T>("1.5e3", 2, boost::charconv::chars_format::scientific);
+
+    // Leading and trailing zeros count towards the limit
+    check_too_long<T>("123", 2, 2);
+    check_too_long<T>("-1.23", 2, 4);
+    check_too_long<T>("0.001", 3, 4);
+    check_too_long<T>("1000", 3, 3);
+    check_too_long<T>("1e123", 2, 4);
+    check_too_long<T>("1e-000001", 5, 8);
+    check_too_long<T>("nan(snan)", 3, 7);
+    check_too_long<T>("0." + std::string(1000000, '0') + "1", 1000, 1001);
+}
+
+template <typename T>
+void test_random_values()
+{
+    std::uniform_int_distribution<std::uint64_t> bits_dist;
+
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        const auto bits = bits_dist(rng);
+        double value {};
+        std::memcpy(&value, &bits, sizeof(double));
+
+        char buffer[64] {};
+        const auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), value, boost::charconv::chars_format::scientific);
+        BOOST_TEST(r);
+
+        check_same<T>(std::string(buffer, r.ptr), 17);
+        check_same<T>(std::string(buffer, r.ptr), 2000);
+    }
+}
+
+// Decimal digits of 5^p, i.e. of 2^-p without the leading "0."
+std::string pow5_digits(int p)
+{
+    std::vector<int> digits {1};
+    for (int i = 0; i < p; ++i)
+    {
+        int carry = 0;
+        for (auto& d : digits)
+        {
+            d = d * 5 + carry;
+            carry = d / 10;
+            d %= 10;
+        }
+        while (carry != 0)
+        {
+            digits.push_back(carry % 10);
+            carry /= 10;
+        }
+    }
+
+    std::string str(static_cast<std::size_t>(p) - digits.size(), '0');
+    for (auto it = digits.rbegin(); it != digits.rend(); ++it)
+    {
+        str += static_cast<char>('0' + *it);
+    }
+    return str;
+}
+
+template <typename T>
+void check_value(const std::string& str, T expected)
+{
+    T value {};
+    const auto r = boost::charconv::from_chars(str.c_str(), str.c_str() + str.size(), value);
+    if (!BOOST_TEST(r) || !BOOST_TEST(r.ptr == str.c_str() + str.size()) || !BOOST_TEST(value == expected))
+    {
+        std::cerr << "Input of length " << str.size() << " starting with " << str.substr(0, 40) << std::endl; // LCOV_EXCL_LINE
+    }
+}
+
+// Inputs much longer than the digits that can affect rounding, which every type has to resolve
+// from the leading digits and whether anything after them is non-zero
+template <typename T>
+void test_long_values()
+{
+    const T one = 1;
+    const T next = std::nextafter(one, static_cast<T>(2));
+
+    // Exactly halfway between 1 and the next value, which rounds to even
+    const std::string halfway = "1." + pow5_digits(std::numeric_limits<T>::digits);
+    const std::string below = halfway.substr(0, halfway.size() - 1) + "4";
+
+    for (const std::size_t length : {10U, 2000U, 20000U, 50000U})
+    {
+        check_value<T>(halfway + std::string(length, '0'), one);
+        check_value<T>(halfway + std::string(length, '0') + "1", next);
+        check_value<T>(halfway + std::string(length, '0') + "1e0", next);
+        check_value<T>(below + std::string(length, '9'), one);
+        check_value<T>("0." + std::string(length, '0') + "1e" + std::to_string(length + 1), one);
+        check_value<T>("1" + std::string(length, '0') + "e-" + std::to_string(length), one);
+        check_value<T>("-" + std::string(length, '0') + "1.5", static_cast<T>(-1.5));
+    }
+
+    // The number ends before the trailing characters
+    const std::string trailing = "2.5" + std::string(5000, 'x');
+    T value {};
+    const auto r = boost::charconv::from_chars(trailing.c_str(), trailing.c_str() + trailing.size(), value);
+    BOOST_TEST(r) && BOOST_TEST(r.ptr == trailing.c_str() + 3) && BOOST_TEST(value == static_cast<T>(2.5));
+}
+
+int main()
+{
+    test_spot_values<float>();
+    test_spot_values<double>();
+
+    test_random_values<float>();
+    test_random_values<double>();
+
+    test_long_values<float>();
+    test_long_values<double>();
+
+    #ifndef BOOST_CHARCONV_UNSUPPORTED_LONG_DOUBLE
+    test_spot_values<long double>();
+    test_random_values<long double>();
+    test_long_values<long double>();
+    #endif
+
+    // string_view overload
+    double d {};
+    auto r = boost::charconv::from_chars_bounded(boost::core::string_view("0.25"), d, 3);
+    BOOST_TEST(r) && BOOST_TEST_EQ(d, 0.25);
+    r = boost::charconv::from_chars_bounded(boost::core::string_view("0.25"), d, 2);
+    BOOST_TEST(r.ec == std::errc::value_too_large) && BOOST_TEST_EQ(d, 0.25);
+
+    return boost::report_errors();
+}
@@ -0,0 +1,198 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <system_error>
+#include <iostream>
+#include <random>
+#include <string>
+#include <limits>
+#include <cstring>
+#include <cstdint>
+
+using boost::charconv::decimal_rounding;
+
+static std::mt19937_64 rng(42);
+constexpr std::size_t N = 1024;
+
+void spot_check(const std::string& str, int scale, std::int64_t expected, decimal_rounding round = decimal_rounding::nearest_even)
+{
+    std::int64_t value = -42;
+    const auto r = boost::charconv::from_chars_decimal(str.c_str(), str.c_str() + str.size(), value, scale, round);
+    if (!BOOST_TEST(r) || !BOOST_TEST(r.ptr == str.c_str() + str.size()) || !BOOST_TEST_EQ(value, expected))
+    {
+        std::cerr << "Input: " << str << " scale: " << scale << " rounding: " << static_cast<unsigned>(round) << std::endl; // LCOV_EXCL_LINE
+    }
+}
+
+void spot_check_error(const std::string& str, int scale, std::errc expected_ec, decimal_rounding round = decimal_rounding::nearest_even)
+{
+    std::int64_t value = -42;
+    const auto r = boost::charconv::from_chars_decimal(str.c_str(), str.c_str() + str.size(), value, scale, round);
+    if (!BOOST_TEST(r.ec == expected_ec) || !BOOST_TEST_EQ(value, -42))
+    {
+        std::cerr << "Input: " << str << " scale: " << scale << std::endl; // LCOV_EXCL_LINE
+    }
+}
+
+void test_spot_values()
+{
+    spot_check("1234.5600", 4, 12345600);
+    spot_check("-1234.56", 4, -12345600);
+    spot_check("1234", 4, 12340000);
+    spot_check("0.0001", 4, 1);
+    spot_check(".5", 2, 50);
+    spot_check("7.", 1, 70);
+    spot_check("0", 8, 0);
+    spot_check("-0", 8, 0);
+    spot_check("1.23456e2", 4, 1234560);
+    spot_check("1.23456E+2", 4, 1234560);
+    spot_check("123456e-3", 4, 1234560);
+    spot_check("1e-10", 4, 0);
+    spot_check("0e999999", 4, 0);
+    spot_check("1500", -2, 15);
+    spot_check("12345678901234567890123e-22", 2, 123);
+    spot_check("0.000000000000000000000000000000000000001e39", 0, 1);
+    spot_check("9223372036854775807", 0, INT64_MAX);
+    spot_check("-9223372036854775808", 0, INT64_MIN);
+    spot_check("922337203685477580.7", 1, INT64_MAX);
+    spot_check("-92233720368547758.08", 2, INT64_MIN);
+
+    // Rounding of values with extra digits
+    spot_check("2.345", 2, 234);
+    spot_check("2.345", 2, 235, decimal_rounding::nearest_away);
+    spot_check("2.345", 2, 234, decimal_rounding::truncate);
+    spot_check("2.355", 2, 236);
+    spot_check("2.355", 2, 236, decimal_rounding::nearest_away);
+    spot_check("2.355", 2, 235, decimal_rounding::truncate);
+    spot_check("2.3451", 2, 235);
+    spot_check("2.3449", 2, 234, decimal_rounding::nearest_away);
+    spot_check("-2.345", 2, -234);
+    spot_check("-2.345", 2, -235, decimal_rounding::nearest_away);
+    spot_check("-2.349", 2, -234, decimal_rounding::truncate);
+    spot_check("0.5", 0, 0);
+    spot_check("1.5", 0, 2);
+    spot_check("0.05", 0, 0, decimal_rounding::nearest_away);
+    spot_check("2.345000000000000000000000000000000", 2, 234);
+    spot_check("2.345000000000000000000000000000001", 2, 235);
+    spot_check("2.344999999999999999999999999999999", 2, 234, decimal_rounding::nearest_away);
+
+    // Errors
+    spot_check_error("", 2, std::errc::invalid_argument);
+    spot_check_error("abc", 2, std::errc::invalid_argument);
+    spot_check_error("+1", 2, std::errc::invalid_argument);
+    spot_check_error("inf", 2, std::errc::invalid_argument);
+    spot_check_error("nan", 2, std::errc::invalid_argument);
+    spot_check_error("9223372036854775808", 0, std::errc::result_out_of_range);
+    spot_check_error("-9223372036854775809", 0, std::errc::result_out_of_range);
+    spot_check_error("922337203685477580.8", 1, std::errc::result_out_of_range);
+    spot_check_error("9223372036854775807.5", 0, std::errc::result_out_of_range);
+    spot_check_error("1e19", 0, std::errc::result_out_of_range);
+    spot_check_error("1e999999999", 0, std::errc::result_out_of_range);
+    spot_check_error("123456789012345678901234567890", 0, std::errc::result_out_of_range);
+
+    // Trailing characters are not consumed
+    std::int64_t value = 0;
+    const char* str = "12.5 USD";
+    auto r = boost::charconv::from_chars_decimal(str, str + std::strlen(str), value, 2);
+    BOOST_TEST(r) && BOOST_TEST(r.ptr == str + 4) && BOOST_TEST_EQ(value, 1250);
+
+    // string_view overload
+    r = boost::charconv::from_chars_decimal(boost::core::string_view("99.99"), value, 2);
+    BOOST_TEST(r) && BOOST_TEST_EQ(value, 9999);
+}
+
+// Writes value / 10^scale in plain decimal notation, followed by extra digits
+std::string to_decimal_string(std::int64_t value, int scale, const std::string& extra)
+{
+    const bool negative = value < 0;
+    std::string digits = std::to_string(negative ? 0U - static_cast<std::uint64_t>(value) : static_cast<std::uint64_t>(value));
+    while (digits.size() <= static_cast<std::size_t>(scale))
+    {
+        digits.insert(digits.begin(), '0');
+    }
+    digits.insert(digits.end() - scale, '.');
+    return (negative ? "-" : "") + digits + extra;
+}
+
+void test_random_values()
+{
+    std::uniform_int_distribution<std::int64_t> value_dist((std::numeric_limits<std::int64_t>::min)() / 10, (std::numeric_limits<std::int64_t>::max)() / 10);
+    std::uniform_int_distribution<int> scale_dist(0, 18);
+    std::uniform_int_distribution<int> digit_dist(0, 9);
+    std::uniform_int_distribution<int> length_dist(0, 25);
+
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        const std::int64_t value = value_dist(rng);
+        const int scale = scale_dist(rng);
+
+        // Exact values in plain and exponential notation
+        const std::string plain = to_decimal_string(value, scale, "");
+        spot_check(plain, scale, value);
+        spot_check(std::to_string(value) + "e-" + std::to_string(scale), scale, value);
+
+        // Extra digits below the scale
+        std::string extra;
+        const int length = length_dist(rng);
+        for (int j = 0; j < length; ++j)
+        {
+            extra += static_cast<char>('0' + digit_dist(rng));
+        }
+
+        const int first_extra = extra.empty() ? 0 : extra[0] - '0';
+        const bool rest_non_zero = extra.size() > 1 && extra.find_first_not_of('0', 1) != std::string::npos;
+        const std::int64_t away = value < 0 ? value - 1 : value + 1;
+
+        const std::string str = to_decimal_string(value, scale, extra);
+        spot_check(str, scale, value, decimal_rounding::truncate);
+        spot_check(str, scale, first_extra >= 5 ? away : value, decimal_rounding::nearest_away);
+        const bool even_up = first_extra > 5 || (first_extra == 5 && (rest_non_zero || (value & 1) != 0));
+        spot_check(str, scale, even_up ? away : value, decimal_rounding::nearest_even);
+    }
+}
+
+#ifdef BOOST_CHARCONV_HAS_INT128
+void test_int128()
+{
+    boost::int128_type value = 0;
+
+    const char* str = "170141183460469231731687303715884105727";
+    auto r = boost::charconv::from_chars_decimal(str, str + std::strlen(str), value, 0);
+    BOOST_TEST(r) && BOOST_TEST(value == (std::numeric_limits<boost::int128_type>::max)());
+
+    str = "-1701411834604692317316873037158841057.28";
+    r = boost::charconv::from_chars_decimal(str, str + std::strlen(str), value, 2);
+    BOOST_TEST(r) && BOOST_TEST(value == (std::numeric_limits<boost::int128_type>::min)());
+
+    str = "170141183460469231731687303715884105728";
+    r = boost::charconv::from_chars_decimal(str, str + std::strlen(str), value, 0);
+    BOOST_TEST(r.ec == std::errc::result_out_of_range);
+
+    // Beyond the range of int64_t
+    str = "123456789012345678901234.5678";
+    r = boost::charconv::from_chars_decimal(str, str + std::strlen(str), value, 2);
+    const boost::int128_type expected = static_cast<boost::int128_type>(UINT64_C(12345678901234567890)) * 1000000 + 123457;
+    BOOST_TEST(r) && BOOST_TEST(value == expected);
+
+    r = boost::charconv::from_chars_decimal(boost::core::string_view("1e30"), value, 9);
+    BOOST_TEST(r.ec == std::errc::result_out_of_range);
+
+    r = boost::charconv::from_chars_decimal(boost::core::string_view("1e30"), value, 4);
+    BOOST_TEST(r) && BOOST_TEST(value == static_cast<boost::int128_type>(UINT64_C(10000000000000000000)) * static_cast<boost::int128_type>(UINT64_C(1000000000000000)));
+}
+#endif
+
+int main()
+{
+    test_spot_values();
+    test_random_values();
+
+    #ifdef BOOST_CHARCONV_HAS_INT128
+    test_int128();
+    #endif
+
+    return boost::report_errors();
+}
@@ -0,0 +1,229 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <system_error>
+#include <iostream>
+#include <random>
+#include <string>
+#include <limits>
+#include <cstring>
+#include <cstdint>
+#include <cmath>
+
+using boost::charconv::number_grammar;
+
+static std::mt19937_64 rng(42);
+constexpr std::size_t N = 1024;
+
+// The accepted prefix must have the same value as when parsed by from_chars with chars_format::general
+template <typename T>
+void check_valid(const std::string& str, number_grammar grammar, std::size_t expected_length = std::string::npos)
+{
+    if (expected_length == std::string::npos)
+    {
+        expected_length = str.size();
+    }
+
+    T value {};
+    const auto r = boost::charconv::from_chars(str.c_str(), str.c_str() + str.size(), value, grammar);
+    if (!BOOST_TEST(r) || !BOOST_TEST(r.ptr == str.c_str() + expected_length))
+    {
+        std::cerr << "Input: " << str << " grammar: " << static_cast<unsigned>(grammar) << std::endl; // LCOV_EXCL_LINE
+        return;
+    }
+
+    // from_chars does not take a leading +
+    const auto offset = static_cast<std::size_t>(str[0] == '+');
+    T expected {};
+    const auto r2 = boost::charconv::from_chars(str.c_str() + offset, str.c_str() + expected_length, expected);
+    BOOST_TEST(r2);
+
+    if (expected != expected)
+    {
+        BOOST_TEST(value != value);
+        BOOST_TEST_EQ(std::signbit(value), std::signbit(expected));
+    }
+    else if (!BOOST_TEST(std::memcmp(&value, &expected, sizeof(T)) == 0))
+    {
+        std::cerr << "Input: " << str << " grammar: " << static_cast<unsigned>(grammar) << std::endl; // LCOV_EXCL_LINE
+    }
+}
+
+template <typename T>
+void check_invalid(const std::string& str, number_grammar grammar)
+{
+    T value = static_cast<T>(42);
+    const auto r = boost::charconv::from_chars(str.c_str(), str.c_str() + str.size(), value, grammar);
+    if (!BOOST_TEST(r.ec == std::errc::invalid_argument) || !BOOST_TEST(r.ptr == str.c_str()) || !BOOST_TEST_EQ(value, static_cast<T>(42)))
+    {
+        std::cerr << "Input: " << str << " grammar: " << static_cast<unsigned>(grammar) << std::endl; // LCOV_EXCL_LINE
+    }
+}
+
+template <typename T>
+void test_standard()
+{
+    constexpr auto g = number_grammar::standard;
+
+    check_valid<T>("01", g);
+    check_valid<T>(".5", g);
+    check_valid<T>("1.", g);
+    check_valid<T>("1e5", g);
+    check_valid<T>("inf", g);
+    check_valid<T>("-Infinity", g);
+    check_valid<T>("nan(snan)", g);
+    check_invalid<T>("+1", g);
+    check_invalid<T>("", g);
+}
+
+template <typename T>
+void test_json()
+{
+    constexpr auto g = number_grammar::json;
+
+    check_valid<T>("0", g);
+    check_valid<T>("-0", g);
+    check_valid<T>("-0.0", g);
+    check_valid<T>("10", g);
+    check_valid<T>("0.5", g);
+    check_valid<T>("-1.5e-5", g);
+    check_valid<T>("1E+5", g);
+    check_valid<T>("1e05", g);
+    check_valid<T>("12,", g, 2);
+    check_valid<T>("1e", g, 1);
+    check_valid<T>("0x10", g, 1);
+
+    check_invalid<T>("", g);
+    check_invalid<T>("-", g);
+    check_invalid<T>("+1", g);
+    check_invalid<T>("01", g);
+    check_invalid<T>("-00.5", g);
+    check_invalid<T>(".5", g);
+    check_invalid<T>("-.5", g);
+    check_invalid<T>("1.", g);
+    check_invalid<T>("1.e5", g);
+    check_invalid<T>("inf", g);
+    check_invalid<T>("-infinity", g);
+    check_invalid<T>("nan", g);
+    check_invalid<T>("NaN", g);
+}
+
+template <typename T>
+void test_toml()
+{
+    constexpr auto g = number_grammar::toml;
+
+    check_valid<T>("+1.0", g);
+    check_valid<T>("3.1415", g);
+    check_valid<T>("-0.01", g);
+    check_valid<T>("5e+22", g);
+    check_valid<T>("1e06", g);
+    check_valid<T>("-2E-2", g);
+    check_valid<T>("6.626e-34", g);
+    check_valid<T>("-0.0", g);
+    check_valid<T>("+0.0", g);
+    check_valid<T>("inf", g);
+    check_valid<T>("+inf", g);
+    check_valid<T>("-inf", g);
+    check_valid<T>("nan", g);
+    check_valid<T>("+nan", g);
+    check_valid<T>("-nan", g);
+    check_valid<T>("infinity", g, 3);
+    check_valid<T>("nan(snan)", g, 3);
+    check_valid<T>("1_000.0", g, 1);
+
+    check_invalid<T>("", g);
+    check_invalid<T>("+", g);
+    check_invalid<T>("01.5", g);
+    check_invalid<T>("+01", g);
+    check_invalid<T>(".7", g);
+    check_invalid<T>("7.", g);
+    check_invalid<T>("3.e+20", g);
+    check_invalid<T>("+-1", g);
+    check_invalid<T>("Inf", g);
+    check_invalid<T>("NAN", g);
+    check_invalid<T>("in", g);
+}
+
+template <typename T>
+void test_csv()
+{
+    constexpr auto g = number_grammar::csv;
+
+    check_valid<T>("+1.5", g);
+    check_valid<T>("-1.5", g);
+    check_valid<T>("007", g);
+    check_valid<T>(".5", g);
+    check_valid<T>("+.5", g);
+    check_valid<T>("5.", g);
+    check_valid<T>("1e5", g);
+    check_valid<T>("1.5;", g, 3);
+
+    check_invalid<T>("", g);
+    check_invalid<T>("+", g);
+    check_invalid<T>("-+1", g);
+    check_invalid<T>("+-1", g);
+    check_invalid<T>(".", g);
+    check_invalid<T>("inf", g);
+    check_invalid<T>("-inf", g);
+    check_invalid<T>("nan", g);
+}
+
+// Everything to_chars writes for a finite value is valid in all of the grammars
+template <typename T>
+void test_random_values()
+{
+    std::uniform_int_distribution<std::uint64_t> bits_dist;
+
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        const auto bits = bits_dist(rng);
+        T value {};
+        std::memcpy(&value, &bits, sizeof(T));
+        if (!(value == value) || value == std::numeric_limits<T>::infinity() || value == -std::numeric_limits<T>::infinity())
+        {
+            continue;
+        }
+
+        char buffer[64] {};
+        const auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), value);
+        BOOST_TEST(r);
+
+        const std::string str(buffer, r.ptr);
+        check_valid<T>(str, number_grammar::json);
+        check_valid<T>(str, number_grammar::toml);
+        check_valid<T>(str, number_grammar::csv);
+    }
+}
+
+int main()
+{
+    test_standard<float>();
+    test_standard<double>();
+
+    test_json<float>();
+    test_json<double>();
+
+    test_toml<float>();
+    test_toml<double>();
+
+    test_csv<float>();
+    test_csv<double>();
+
+    test_random_values<float>();
+    test_random_values<double>();
+
+    // string_view overloads
+    double d {};
+    auto r = boost::charconv::from_chars(boost::core::string_view("+2.5"), d, number_grammar::toml);
+    BOOST_TEST(r) && BOOST_TEST_EQ(d, 2.5);
+
+    float f {};
+    r = boost::charconv::from_chars(boost::core::string_view("01"), f, number_grammar::json);
+    BOOST_TEST(r.ec == std::errc::invalid_argument);
+
+    return boost::report_errors();
+}
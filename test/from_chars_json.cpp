@@ -0,0 +1,216 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <system_error>
+#include <iostream>
+#include <random>
+#include <string>
+#include <limits>
+#include <cstring>
+#include <cstdint>
+
+using boost::charconv::json_number;
+using boost::charconv::json_number_kind;
+
+static std::mt19937_64 rng(42);
+constexpr std::size_t N = 1024;
+
+json_number parse(const std::string& str, std::size_t expected_length)
+{
+    json_number value {};
+    const auto r = boost::charconv::from_chars_json(str.c_str(), str.c_str() + str.size(), value);
+    if (!BOOST_TEST(r) || !BOOST_TEST(r.ptr == str.c_str() + expected_length))
+    {
+        std::cerr << "Input: " << str << std::endl; // LCOV_EXCL_LINE
+    }
+    return value;
+}
+
+void check_int64(const std::string& str, std::int64_t expected, std::size_t expected_length = std::string::npos)
+{
+    const auto value = parse(str, expected_length == std::string::npos ? str.size() : expected_length);
+    if (!BOOST_TEST(value.kind == json_number_kind::int64) || !BOOST_TEST_EQ(value.int64_value, expected))
+    {
+        std::cerr << "Input: " << str << std::endl; // LCOV_EXCL_LINE
+    }
+}
+
+void check_uint64(const std::string& str, std::uint64_t expected)
+{
+    const auto value = parse(str, str.size());
+    if (!BOOST_TEST(value.kind == json_number_kind::uint64) || !BOOST_TEST_EQ(value.uint64_value, expected))
+    {
+        std::cerr << "Input: " << str << std::endl; // LCOV_EXCL_LINE
+    }
+}
+
+void check_double(const std::string& str, std::size_t expected_length = std::string::npos)
+{
+    const auto value = parse(str, expected_length == std::string::npos ? str.size() : expected_length);
+
+    double expected {};
+    const auto r = boost::charconv::from_chars(str.c_str(), str.c_str() + str.size(), expected);
+    BOOST_TEST(r);
+
+    if (!BOOST_TEST(value.kind == json_number_kind::double_) || !BOOST_TEST(std::memcmp(&value.double_value, &expected, sizeof(double)) == 0))
+    {
+        std::cerr << "Input: " << str << std::endl; // LCOV_EXCL_LINE
+    }
+}
+
+void check_error(const std::string& str, std::errc expected_ec)
+{
+    json_number value {};
+    value.kind = json_number_kind::int64;
+    value.int64_value = -42;
+
+    const auto r = boost::charconv::from_chars_json(str.c_str(), str.c_str() + str.size(), value);
+    if (!BOOST_TEST(r.ec == expected_ec) || !BOOST_TEST(value.kind == json_number_kind::int64) || !BOOST_TEST_EQ(value.int64_value, -42))
+    {
+        std::cerr << "Input: " << str << std::endl; // LCOV_EXCL_LINE
+    }
+
+    if (expected_ec == std::errc::invalid_argument)
+    {
+        BOOST_TEST(r.ptr == str.c_str());
+    }
+}
+
+void test_integers()
+{
+    check_int64("0", 0);
+    check_int64("-0", 0);
+    check_int64("1", 1);
+    check_int64("-1", -1);
+    check_int64("1234567890", 1234567890);
+    check_int64("9223372036854775807", INT64_MAX);
+    check_int64("-9223372036854775808", INT64_MIN);
+
+    check_uint64("9223372036854775808", UINT64_C(9223372036854775808));
+    check_uint64("9999999999999999999", UINT64_C(9999999999999999999));
+    check_uint64("10000000000000000000", UINT64_C(10000000000000000000));
+    check_uint64("18446744073709551615", UINT64_MAX);
+
+    // Integers that do not fit are doubles
+    check_double("-9223372036854775809");
+    check_double("-10000000000000000000");
+    check_double("18446744073709551616");
+    check_double("18446744073709551620");
+    check_double("99999999999999999999");
+    check_double("100000000000000000000");
+    check_double("123456789012345678901234567890");
+}
+
+void test_doubles()
+{
+    check_double("0.0");
+    check_double("-0.0");
+    check_double("1.5");
+    check_double("-1.5");
+    check_double("1e2");
+    check_double("1E2");
+    check_double("1e+2");
+    check_double("1e-2");
+    check_double("0e0");
+    check_double("-0e10");
+    check_double("0.1");
+    check_double("3.141592653589793");
+    check_double("2.2250738585072011e-308");
+    check_double("4.9406564584124654e-324");
+    check_double("1.7976931348623157e+308");
+    check_double("9007199254740993.0");
+    check_double("0.000000000000000000000000000000000000000000001");
+    check_double("7.0420557077594588669468784357561207962098443483187940792729600000e+59");
+}
+
+void test_grammar()
+{
+    // Trailing characters are not consumed
+    check_int64("12,", 12, 2);
+    check_int64("12]", 12, 2);
+    check_int64("0x1p3", 0, 1);
+    check_int64("1e", 1, 1);
+    check_int64("1e+", 1, 1);
+    check_double("1.5e", 3);
+    check_double("1.5E-", 3);
+    check_double("1.5 ", 3);
+
+    // Not allowed by RFC 8259
+    check_error("", std::errc::invalid_argument);
+    check_error("-", std::errc::invalid_argument);
+    check_error("+1", std::errc::invalid_argument);
+    check_error("00", std::errc::invalid_argument);
+    check_error("01", std::errc::invalid_argument);
+    check_error("-01", std::errc::invalid_argument);
+    check_error("00.5", std::errc::invalid_argument);
+    check_error(".5", std::errc::invalid_argument);
+    check_error("-.5", std::errc::invalid_argument);
+    check_error("1.", std::errc::invalid_argument);
+    check_error("1.e5", std::errc::invalid_argument);
+    check_error("inf", std::errc::invalid_argument);
+    check_error("-infinity", std::errc::invalid_argument);
+    check_error("nan", std::errc::invalid_argument);
+    check_error("abc", std::errc::invalid_argument);
+
+    // Out of range doubles
+    check_error("1e400", std::errc::result_out_of_range);
+    check_error("-1e400", std::errc::result_out_of_range);
+    check_error("1e-400", std::errc::result_out_of_range);
+
+    // string_view overload
+    json_number value {};
+    const auto r = boost::charconv::from_chars_json(boost::core::string_view("-42"), value);
+    BOOST_TEST(r) && BOOST_TEST(value.kind == json_number_kind::int64) && BOOST_TEST_EQ(value.int64_value, -42);
+}
+
+// Must match the result of classifying the token first and then calling from_chars for the chosen type
+void test_random_values()
+{
+    std::uniform_int_distribution<std::uint64_t> uint_dist;
+    std::uniform_int_distribution<int> shift_dist(0, 63);
+    std::uniform_real_distribution<double> double_dist(-1e10, 1e10);
+
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        const auto u = uint_dist(rng) >> shift_dist(rng);
+        const std::string str = std::to_string(u);
+        if (u <= static_cast<std::uint64_t>(INT64_MAX))
+        {
+            check_int64(str, static_cast<std::int64_t>(u));
+            check_int64("-" + str, -static_cast<std::int64_t>(u));
+        }
+        else
+        {
+            check_uint64(str, u);
+            check_double("-" + str);
+        }
+
+        char buffer[64] {};
+        const auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), double_dist(rng), boost::charconv::chars_format::scientific);
+        BOOST_TEST(r);
+        check_double(std::string(buffer, r.ptr));
+
+        std::uint64_t bits = uint_dist(rng);
+        double value {};
+        std::memcpy(&value, &bits, sizeof(double));
+        if (value == value && value != std::numeric_limits<double>::infinity() && value != -std::numeric_limits<double>::infinity())
+        {
+            const auto r2 = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), value, boost::charconv::chars_format::scientific);
+            BOOST_TEST(r2);
+            check_double(std::string(buffer, r2.ptr));
+        }
+    }
+}
+
+int main()
+{
+    test_integers();
+    test_doubles();
+    test_grammar();
+    test_random_values();
+
+    return boost::report_errors();
+}
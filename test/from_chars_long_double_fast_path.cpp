@@ -0,0 +1,124 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+
+#ifndef BOOST_CHARCONV_UNSUPPORTED_LONG_DOUBLE
+
+#include <system_error>
+#include <iostream>
+#include <iomanip>
+#include <random>
+#include <string>
+#include <limits>
+#include <cstdlib>
+#include <cstdint>
+#include <cfenv>
+#include <cmath>
+
+static std::mt19937_64 rng(42);
+constexpr std::size_t N = 4096;
+
+// strtold is correctly rounded in the current rounding mode
+void check(const std::string& str)
+{
+    const long double expected = std::strtold(str.c_str(), nullptr);
+
+    long double value {};
+    const auto r = boost::charconv::from_chars(str.c_str(), str.c_str() + str.size(), value);
+    if (!BOOST_TEST(r) || !BOOST_TEST(r.ptr == str.c_str() + str.size()) ||
+        !BOOST_TEST(value == expected) || !BOOST_TEST_EQ(std::signbit(value), std::signbit(expected)))
+    {
+        std::cerr << std::setprecision(std::numeric_limits<long double>::max_digits10)
+                  << "Input: " << str << "\nExpected: " << expected << "\nGot: " << value << std::endl; // LCOV_EXCL_LINE
+    }
+}
+
+std::string make_number(std::uint64_t significand, int exponent, bool negative, std::size_t trailing_zeros = 0)
+{
+    std::string str = negative ? "-" : "";
+    str += std::to_string(significand);
+    str += std::string(trailing_zeros, '0');
+    str += "e" + std::to_string(exponent);
+    return str;
+}
+
+void test_spot_values()
+{
+    check("0");
+    check("-0");
+    check("1");
+    check("0.1");
+    check("-0.3");
+    check("123.456");
+    check("1e27");
+    check("1e-27");
+    check("1e28");
+    check("1e-28");
+    check("18446744073709551615");
+    check("18446744073709551616");
+    check("18446744073709551617");
+    check("18446744073709551617e-27");
+    check("1.0000000000000000000000000000000");
+    check("12345678901234567890000000000000e-10");
+    check("1.5e30");
+    check("15e40");
+    check("1e46");
+    check("1e47");
+    check("1e66");
+    check("9.9999999999999999999e27");
+    check("3.4028234663852885981170418348451692544e38");
+    check("5192296858534827628530496329220096e27");
+}
+
+// Values in and around the range where a single multiplication or division is exact
+void test_random_values()
+{
+    std::uniform_int_distribution<std::uint64_t> significand_dist;
+    std::uniform_int_distribution<int> shift_dist(0, 63);
+    std::uniform_int_distribution<int> exponent_dist(-60, 70);
+    std::uniform_int_distribution<int> zeros_dist(0, 18);
+
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        // Zero significands are covered by the spot values
+        const auto significand = (significand_dist(rng) >> shift_dist(rng)) | 1U;
+        const auto exponent = exponent_dist(rng);
+        const bool negative = (i & 1U) != 0;
+
+        check(make_number(significand, exponent, negative));
+        check(make_number(significand, exponent, negative, static_cast<std::size_t>(zeros_dist(rng))));
+    }
+}
+
+int main()
+{
+    test_spot_values();
+    test_random_values();
+
+    // The fast path must not be used when it would not round in the current mode
+    #if defined(FE_UPWARD) && defined(FE_DOWNWARD) && defined(FE_TOWARDZERO)
+    for (const int mode : {FE_UPWARD, FE_DOWNWARD, FE_TOWARDZERO})
+    {
+        if (std::fesetround(mode) == 0)
+        {
+            test_spot_values();
+            test_random_values();
+        }
+    }
+    std::fesetround(FE_TONEAREST);
+    #endif
+
+    return boost::report_errors();
+}
+
+#else
+
+int main()
+{
+    return 0;
+}
+
+#endif
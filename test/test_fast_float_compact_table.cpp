@@ -0,0 +1,82 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#define BOOST_CHARCONV_FASTFLOAT_COMPACT_TABLE
+
+#include <boost/charconv/detail/fast_float/fast_float.hpp>
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <system_error>
+#include <iostream>
+#include <random>
+#include <string>
+#include <cstring>
+#include <cstdint>
+
+using boost::charconv::detail::fast_float::powers;
+using boost::charconv::detail::fast_float::compact_powers;
+
+static std::mt19937_64 rng(42);
+constexpr std::size_t N = 4096;
+
+// Every reconstructed power must be identical to the full table
+void test_table()
+{
+    for (int q = powers::smallest_power_of_five; q <= powers::largest_power_of_five; ++q)
+    {
+        const auto index = static_cast<std::size_t>(2 * (q - powers::smallest_power_of_five));
+        const auto value = compact_powers::get(q);
+        if (!BOOST_TEST_EQ(value.high, powers::power_of_five_128[index]) || !BOOST_TEST_EQ(value.low, powers::power_of_five_128[index + 1]))
+        {
+            std::cerr << "q: " << q << std::endl; // LCOV_EXCL_LINE
+        }
+    }
+}
+
+// The header only parser uses the compact table, the library is built with the full one
+template <typename T>
+void check(const std::string& str)
+{
+    T expected {};
+    const auto r = boost::charconv::from_chars(str.c_str(), str.c_str() + str.size(), expected);
+
+    T value {};
+    const auto r2 = boost::charconv::detail::fast_float::from_chars(str.c_str(), str.c_str() + str.size(), value);
+
+    // On overflow and underflow the library leaves the value unmodified
+    if (!BOOST_TEST(r.ptr == r2.ptr) || (r.ec == std::errc() && !BOOST_TEST(std::memcmp(&value, &expected, sizeof(T)) == 0)))
+    {
+        std::cerr << "Input: " << str << std::endl; // LCOV_EXCL_LINE
+    }
+}
+
+template <typename T>
+void test_random_values()
+{
+    std::uniform_int_distribution<std::uint64_t> significand_dist;
+    std::uniform_int_distribution<int> exponent_dist(-360, 320);
+
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        check<T>(std::to_string(significand_dist(rng)) + "e" + std::to_string(exponent_dist(rng)));
+    }
+}
+
+int main()
+{
+    test_table();
+
+    test_random_values<float>();
+    test_random_values<double>();
+
+    check<double>("2.2250738585072011e-308");
+    check<double>("2.2250738585072012e-308");
+    check<double>("4.9406564584124654e-324");
+    check<double>("1.7976931348623157e308");
+    check<double>("1.7976931348623159e308");
+    check<double>("9007199254740993");
+    check<double>("7.3177701707893310e+15");
+
+    return boost::report_errors();
+}
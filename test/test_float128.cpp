@@ -583,6 +583,16 @@ void test_nans()
     BOOST_TEST(isnanq(boost::charconv::detail::nans())) && BOOST_TEST(issignaling(boost::charconv::detail::nans()));
 }
 
+void test_negative_zero()
+{
+    for (const auto fmt : {boost::charconv::chars_format::general, boost::charconv::chars_format::fixed})
+    {
+        char buffer[64] {};
+        const auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), -0.0Q, fmt);
+        BOOST_TEST(r.ec == std::errc()) && BOOST_TEST_CSTR_EQ(buffer, "-0");
+    }
+}
+
 #if defined(__GNUC__) && __GNUC__ < 9 && __GNUC__ >= 5
 #pragma GCC diagnostic pop
 #endif
@@ -828,6 +838,7 @@ int main()
     spot_check_nan("-nan(snan)", boost::charconv::chars_format::general);
 
     test_nanq();
+    test_negative_zero();
     #if defined(__GNUC__) && __GNUC__ >= 6
     test_nans();
     #endif
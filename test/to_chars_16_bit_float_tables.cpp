@@ -0,0 +1,36 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include "../src/to_chars_16_bit_float_tables.hpp"
+#include <boost/core/lightweight_test.hpp>
+#include <iostream>
+#include <cstdint>
+
+using namespace boost::charconv::detail;
+
+// Every bit pattern, including the non-finite ones that are not stored, gives the same result as Ryu
+template <std::uint32_t mantissaBits, std::uint32_t exponentBits>
+void test_all_values(ryu::floating_decimal_128 (*lookup)(std::uint16_t))
+{
+    for (std::uint32_t bits = 0; bits < 65536U; ++bits)
+    {
+        const auto from_table = lookup(static_cast<std::uint16_t>(bits));
+        const auto from_ryu = ryu::generic_binary_to_decimal(bits, mantissaBits, exponentBits, false);
+
+        if (!BOOST_TEST(from_table.mantissa == from_ryu.mantissa) ||
+            !BOOST_TEST_EQ(from_table.exponent, from_ryu.exponent) ||
+            !BOOST_TEST_EQ(from_table.sign, from_ryu.sign))
+        {
+            std::cerr << "Bits: " << std::hex << bits << std::endl; // LCOV_EXCL_LINE
+        }
+    }
+}
+
+int main()
+{
+    test_all_values<10, 5>(float16_bits_to_fd128); // std::float16_t
+    test_all_values<7, 8>(bfloat16_bits_to_fd128); // std::bfloat16_t
+
+    return boost::report_errors();
+}
@@ -0,0 +1,188 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <system_error>
+#include <iostream>
+#include <random>
+#include <vector>
+#include <algorithm>
+#include <string>
+#include <limits>
+#include <cstring>
+#include <cstdint>
+#include <cmath>
+
+static std::mt19937_64 rng(42);
+
+template <typename T>
+struct bits_type;
+
+template <>
+struct bits_type<float> { using type = std::uint32_t; };
+
+template <>
+struct bits_type<double> { using type = std::uint64_t; };
+
+// Random bit patterns, integers, and the values with the longest output in each format
+template <typename T>
+std::vector<T> make_values()
+{
+    using bits = typename bits_type<T>::type;
+
+    std::vector<T> values;
+    for (int i = 0; i < 200; ++i)
+    {
+        const auto bit_pattern = static_cast<bits>(rng());
+        T value;
+        std::memcpy(&value, &bit_pattern, sizeof(T));
+        values.push_back(value);
+        values.push_back(static_cast<T>(static_cast<std::int32_t>(rng())));
+    }
+
+    const T special_values[] = {T(0), -T(0), T(1), T(-0.1), -std::numeric_limits<T>::denorm_min(), -std::numeric_limits<T>::min(),
+                                std::numeric_limits<T>::lowest(), -std::numeric_limits<T>::infinity(), std::numeric_limits<T>::quiet_NaN(),
+                                -std::numeric_limits<T>::signaling_NaN()};
+    values.insert(values.end(), std::begin(special_values), std::end(special_values));
+
+    return values;
+}
+
+template <typename T>
+boost::charconv::to_chars_result to_chars_value(char* first, char* last, T value, boost::charconv::chars_format fmt, int precision)
+{
+    return precision == -1 ? boost::charconv::to_chars(first, last, value, fmt) : boost::charconv::to_chars(first, last, value, fmt, precision);
+}
+
+// The batch gives the values printed by to_chars joined by the separator.
+// On a short buffer it stops at the first value that to_chars cannot print into the rest of the buffer.
+template <typename T>
+void test_batch(boost::charconv::chars_format fmt, int precision)
+{
+    const auto values = make_values<T>();
+
+    std::string expected;
+    for (const auto value : values)
+    {
+        char buffer[1024];
+        const auto r = to_chars_value(buffer, buffer + sizeof(buffer), value, fmt, precision);
+        BOOST_TEST(r.ec == std::errc());
+
+        if (!expected.empty())
+        {
+            expected += ';';
+        }
+        expected.append(buffer, r.ptr);
+    }
+
+    std::vector<char> output(expected.size() + 1);
+    std::vector<char> single(expected.size() + 1);
+
+    // Every size up to 64, then growing sizes up to the full output
+    for (std::size_t size = 0; size <= expected.size(); size = (size == expected.size() ? size + 1 : (std::min)(size < 64 ? size + 1 : size * 3 / 2, expected.size())))
+    {
+        std::size_t count = 0;
+        std::size_t length = 0;
+        for (; count < values.size(); ++count)
+        {
+            const std::size_t start = count == 0 ? 0 : length + 1;
+            if (start > size)
+            {
+                break;
+            }
+
+            const auto r = to_chars_value(single.data() + start, single.data() + size, values[count], fmt, precision);
+            if (r.ec != std::errc())
+            {
+                break;
+            }
+            length = static_cast<std::size_t>(r.ptr - single.data());
+        }
+
+        char* const first = output.data();
+        const auto r = precision == -1 ? boost::charconv::to_chars_batch(first, first + size, values.data(), values.size(), ';', fmt) :
+                                         boost::charconv::to_chars_batch(first, first + size, values.data(), values.size(), ';', fmt, precision);
+
+        BOOST_TEST(r.ec == (count == values.size() ? std::errc() : std::errc::value_too_large));
+        BOOST_TEST_EQ(r.count, count);
+        BOOST_TEST_EQ(static_cast<std::size_t>(r.ptr - first), length);
+
+        if (!BOOST_TEST_EQ(std::string(first, r.ptr), expected.substr(0, length)))
+        {
+            std::cerr << "Format: " << static_cast<int>(fmt) << ", precision: " << precision << ", size: " << size << std::endl; // LCOV_EXCL_LINE
+        }
+    }
+}
+
+// Shortest scientific output whose exponent has more digits than the one of the integer significand.
+// Nothing may be written past the end of the buffer, by the batch or by to_chars on its own.
+template <typename T>
+void test_near_end(const std::vector<T>& values)
+{
+    constexpr char canary = '#';
+
+    for (std::size_t size = 0; size <= 80; ++size)
+    {
+        std::vector<char> output(size + 16, canary);
+        char* const first = output.data();
+
+        const auto r = boost::charconv::to_chars_batch(first, first + size, values.data(), values.size(), ';', boost::charconv::chars_format::scientific);
+        BOOST_TEST(r.ptr <= first + size);
+        BOOST_TEST(r.count <= values.size());
+        BOOST_TEST(r.ec == (r.count == values.size() ? std::errc() : std::errc::value_too_large));
+
+        for (std::size_t i = size; i < output.size(); ++i)
+        {
+            if (!BOOST_TEST_EQ(output[i], canary))
+            {
+                std::cerr << "Batch size: " << size << ", overwritten at: " << i << std::endl; // LCOV_EXCL_LINE
+                break; // LCOV_EXCL_LINE
+            }
+        }
+
+        for (const auto value : values)
+        {
+            std::vector<char> single(size + 16, canary);
+            const auto r2 = boost::charconv::to_chars(single.data(), single.data() + size, value, boost::charconv::chars_format::scientific);
+            BOOST_TEST(r2.ec != std::errc() || r2.ptr <= single.data() + size);
+            BOOST_TEST_EQ(std::string(single.data() + size, single.size() - size), std::string(16, canary));
+        }
+    }
+}
+
+template <typename T>
+void test_formats()
+{
+    for (const auto fmt : {boost::charconv::chars_format::general, boost::charconv::chars_format::scientific,
+                           boost::charconv::chars_format::fixed, boost::charconv::chars_format::hex})
+    {
+        test_batch<T>(fmt, -1);
+        test_batch<T>(fmt, 0);
+        test_batch<T>(fmt, 6);
+        test_batch<T>(fmt, 40);
+    }
+}
+
+int main()
+{
+    test_formats<float>();
+    test_formats<double>();
+
+    test_near_end<float>({3.0613504e+07F, 5.233703e+12F, -3.072e+01F, 1e-45F, -3.4028235e+38F});
+    test_near_end<double>({1.0193297423204352e+16, 1e+16, -2.2250738585072014e-308, 5e-324, 1.7976931348623157e+308, 12.5});
+
+    // An empty batch writes nothing, even into an empty buffer
+    char buffer[1] {};
+    const auto r = boost::charconv::to_chars_batch(buffer, buffer, static_cast<const double*>(nullptr), 0, ',');
+    BOOST_TEST(r.ec == std::errc() && r.ptr == buffer && r.count == 0);
+
+    // The negative precision of to_chars gives 6 digits
+    const double values[] = {0.1, 2.5};
+    char output[64] {};
+    const auto r2 = boost::charconv::to_chars_batch(output, output + sizeof(output), values, 2, ',', boost::charconv::chars_format::fixed, -3);
+    BOOST_TEST(r2) && BOOST_TEST_EQ(std::string(output, r2.ptr), "0.100000,2.500000");
+
+    return boost::report_errors();
+}
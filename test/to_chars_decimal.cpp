@@ -0,0 +1,192 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <system_error>
+#include <iostream>
+#include <random>
+#include <string>
+#include <limits>
+#include <cstring>
+#include <algorithm>
+#include <cstdint>
+
+static std::mt19937_64 rng(42);
+constexpr std::size_t N = 1024;
+
+void spot_check(std::int64_t value, int scale, const std::string& expected)
+{
+    char buffer[128] {};
+    const auto r = boost::charconv::to_chars_decimal(buffer, buffer + sizeof(buffer), value, scale);
+    if (!BOOST_TEST(r) || !BOOST_TEST_EQ(std::string(buffer, r.ptr), expected))
+    {
+        std::cerr << "Value: " << value << " scale: " << scale << std::endl; // LCOV_EXCL_LINE
+    }
+}
+
+void spot_check(std::int64_t value, int scale, int min_fraction_digits, const std::string& expected)
+{
+    char buffer[128] {};
+    const auto r = boost::charconv::to_chars_decimal(buffer, buffer + sizeof(buffer), value, scale, min_fraction_digits);
+    if (!BOOST_TEST(r) || !BOOST_TEST_EQ(std::string(buffer, r.ptr), expected))
+    {
+        std::cerr << "Value: " << value << " scale: " << scale << " min fraction digits: " << min_fraction_digits << std::endl; // LCOV_EXCL_LINE
+    }
+}
+
+void test_spot_values()
+{
+    spot_check(12345600, 4, "1234.5600");
+    spot_check(-12345600, 4, "-1234.5600");
+    spot_check(1, 4, "0.0001");
+    spot_check(-1, 4, "-0.0001");
+    spot_check(0, 4, "0.0000");
+    spot_check(0, 0, "0");
+    spot_check(42, 0, "42");
+    spot_check(15, -2, "1500");
+    spot_check(0, -2, "0");
+    spot_check(123456789, 9, "0.123456789");
+    spot_check(1234567890, 9, "1.234567890");
+    spot_check(5, 25, "0.0000000000000000000000005");
+    spot_check(INT64_MAX, 0, "9223372036854775807");
+    spot_check(INT64_MIN, 0, "-9223372036854775808");
+    spot_check(INT64_MAX, 10, "922337203.6854775807");
+    spot_check(INT64_MIN, 19, "-0.9223372036854775808");
+    spot_check(INT64_MIN, 20, "-0.09223372036854775808");
+
+    // Trimming and padding the fraction
+    spot_check(12345600, 4, 2, "1234.56");
+    spot_check(12345600, 4, 0, "1234.56");
+    spot_check(12340000, 4, 0, "1234");
+    spot_check(12340000, 4, 1, "1234.0");
+    spot_check(12345600, 4, 6, "1234.560000");
+    spot_check(1234, 0, 2, "1234.00");
+    spot_check(15, -2, 2, "1500.00");
+    spot_check(0, 4, 0, "0");
+    spot_check(0, 4, 2, "0.00");
+    spot_check(-10, 1, 0, "-1");
+    spot_check(1000, 3, 0, "1");
+    spot_check(1001, 3, 0, "1.001");
+    spot_check(100, 5, 0, "0.001");
+    spot_check(0, (std::numeric_limits<int>::max)(), 0, "0");
+    spot_check(10, 3, 2, "0.01");
+
+    char buffer[16] {};
+
+    // Exactly enough room
+    auto r = boost::charconv::to_chars_decimal(buffer, buffer + 10, -12345600, 4);
+    BOOST_TEST(r) && BOOST_TEST(r.ptr == buffer + 10);
+
+    // Not enough room
+    r = boost::charconv::to_chars_decimal(buffer, buffer + 9, -12345600, 4);
+    BOOST_TEST(r.ec == std::errc::value_too_large) && BOOST_TEST(r.ptr == buffer + 9);
+
+    r = boost::charconv::to_chars_decimal(buffer, buffer + sizeof(buffer), 1, -(std::numeric_limits<int>::max)());
+    BOOST_TEST(r.ec == std::errc::value_too_large);
+
+    r = boost::charconv::to_chars_decimal(buffer, buffer + sizeof(buffer), 1, 1, (std::numeric_limits<int>::max)());
+    BOOST_TEST(r.ec == std::errc::value_too_large);
+
+    // Invalid arguments
+    r = boost::charconv::to_chars_decimal(buffer, buffer + sizeof(buffer), 1, 1, -1);
+    BOOST_TEST(r.ec == std::errc::invalid_argument);
+
+    r = boost::charconv::to_chars_decimal(buffer + 1, buffer, 1, 1);
+    BOOST_TEST(r.ec == std::errc::invalid_argument);
+}
+
+// Writes value / 10^scale in plain decimal notation
+std::string to_decimal_string(std::int64_t value, int scale)
+{
+    const bool negative = value < 0;
+    std::string digits = std::to_string(negative ? 0U - static_cast<std::uint64_t>(value) : static_cast<std::uint64_t>(value));
+    while (digits.size() <= static_cast<std::size_t>(scale))
+    {
+        digits.insert(digits.begin(), '0');
+    }
+    if (scale > 0)
+    {
+        digits.insert(digits.end() - scale, '.');
+    }
+    return (negative ? "-" : "") + digits;
+}
+
+void test_random_values()
+{
+    std::uniform_int_distribution<std::int64_t> value_dist((std::numeric_limits<std::int64_t>::min)(), (std::numeric_limits<std::int64_t>::max)());
+    std::uniform_int_distribution<int> scale_dist(0, 22);
+    std::uniform_int_distribution<int> shift_dist(0, 18);
+
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        // Shift right to also get short values with trailing zeros
+        const std::int64_t value = value_dist(rng) >> shift_dist(rng) * 3;
+        const int scale = scale_dist(rng);
+
+        const std::string expected = to_decimal_string(value, scale);
+        spot_check(value, scale, expected);
+
+        // Round trip with every number of minimum fraction digits
+        for (int min_fraction_digits = 0; min_fraction_digits <= scale + 2; ++min_fraction_digits)
+        {
+            char buffer[64] {};
+            const auto r = boost::charconv::to_chars_decimal(buffer, buffer + sizeof(buffer), value, scale, min_fraction_digits);
+            BOOST_TEST(r);
+
+            const std::string str(buffer, r.ptr);
+            const auto point = str.find('.');
+            const int fraction_digits = point == std::string::npos ? 0 : static_cast<int>(str.size() - point - 1);
+            BOOST_TEST_GE(fraction_digits, min_fraction_digits);
+            BOOST_TEST_LE(fraction_digits, (std::max)(scale, min_fraction_digits));
+            if (fraction_digits > min_fraction_digits)
+            {
+                BOOST_TEST_NE(str.back(), '0');
+            }
+
+            std::int64_t parsed = 0;
+            const auto r2 = boost::charconv::from_chars_decimal(buffer, r.ptr, parsed, scale);
+            if (!BOOST_TEST(r2) || !BOOST_TEST(r2.ptr == r.ptr) || !BOOST_TEST_EQ(parsed, value))
+            {
+                std::cerr << "Round trip failed for: " << str << std::endl; // LCOV_EXCL_LINE
+            }
+        }
+    }
+}
+
+#ifdef BOOST_CHARCONV_HAS_INT128
+void test_int128()
+{
+    char buffer[128] {};
+
+    auto r = boost::charconv::to_chars_decimal(buffer, buffer + sizeof(buffer), (std::numeric_limits<boost::int128_type>::max)(), 4);
+    BOOST_TEST(r) && BOOST_TEST_EQ(std::string(buffer, r.ptr), "17014118346046923173168730371588410.5727");
+
+    r = boost::charconv::to_chars_decimal(buffer, buffer + sizeof(buffer), (std::numeric_limits<boost::int128_type>::min)(), 2);
+    BOOST_TEST(r) && BOOST_TEST_EQ(std::string(buffer, r.ptr), "-1701411834604692317316873037158841057.28");
+
+    r = boost::charconv::to_chars_decimal(buffer, buffer + sizeof(buffer), (std::numeric_limits<boost::int128_type>::min)(), 39);
+    BOOST_TEST(r) && BOOST_TEST_EQ(std::string(buffer, r.ptr), "-0.170141183460469231731687303715884105728");
+
+    const boost::int128_type value = static_cast<boost::int128_type>(UINT64_C(12345678901234567890)) * 1000000 + 123400;
+    r = boost::charconv::to_chars_decimal(buffer, buffer + sizeof(buffer), value, 6, 2);
+    BOOST_TEST(r) && BOOST_TEST_EQ(std::string(buffer, r.ptr), "12345678901234567890.1234");
+
+    boost::int128_type parsed = 0;
+    const auto r2 = boost::charconv::from_chars_decimal(buffer, r.ptr, parsed, 6);
+    BOOST_TEST(r2) && BOOST_TEST(parsed == value);
+}
+#endif
+
+int main()
+{
+    test_spot_values();
+    test_random_values();
+
+    #ifdef BOOST_CHARCONV_HAS_INT128
+    test_int128();
+    #endif
+
+    return boost::report_errors();
+}
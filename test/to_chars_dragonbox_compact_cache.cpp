@@ -0,0 +1,105 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv/detail/dragonbox/dragonbox.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <iostream>
+#include <random>
+#include <limits>
+#include <cstring>
+#include <cstdint>
+#include <cmath>
+
+using namespace boost::charconv::detail;
+
+static std::mt19937_64 rng(42);
+constexpr std::size_t N = 1U << 16;
+
+// A recovered entry is at most two units in the last place above the full cache entry,
+// which is within the error the algorithm tolerates (checked below by comparing the results)
+void test_cache()
+{
+    for (int k = cache_holder_ieee754_binary64::min_k; k <= cache_holder_ieee754_binary64::max_k; ++k)
+    {
+        const auto full = policy_impl::cache::full::get_cache<ieee754_binary64>(k);
+        const auto compact = policy_impl::cache::compact::get_cache<ieee754_binary64>(k);
+        if (!BOOST_TEST_EQ(full.high, compact.high) || !BOOST_TEST(compact.low >= full.low && compact.low - full.low <= 2))
+        {
+            std::cerr << "k: " << k << std::endl; // LCOV_EXCL_LINE
+        }
+    }
+
+    for (int k = cache_holder_ieee754_binary32::min_k; k <= cache_holder_ieee754_binary32::max_k; ++k)
+    {
+        BOOST_TEST_EQ(policy_impl::cache::full::get_cache<ieee754_binary32>(k), policy_impl::cache::compact::get_cache<ieee754_binary32>(k));
+    }
+}
+
+template <typename T>
+void check(T value)
+{
+    const auto full = to_decimal(value, policy::cache::full);
+    const auto compact = to_decimal(value, policy::cache::compact);
+    if (!BOOST_TEST_EQ(full.significand, compact.significand) || !BOOST_TEST_EQ(full.exponent, compact.exponent))
+    {
+        std::cerr << std::hexfloat << "Value: " << value << std::endl; // LCOV_EXCL_LINE
+    }
+}
+
+template <typename T, typename Unsigned>
+void test_random_values()
+{
+    std::uniform_int_distribution<Unsigned> bits_dist;
+
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        const auto bits = bits_dist(rng);
+        T value;
+        std::memcpy(&value, &bits, sizeof(T));
+
+        if (std::isfinite(value) && value != 0)
+        {
+            check(std::abs(value));
+        }
+    }
+}
+
+// Every binary exponent, and with it every cache entry, with the smallest, largest and a random significand
+void test_all_exponents()
+{
+    std::uniform_int_distribution<std::uint64_t> significand_dist(0, (UINT64_C(1) << 52) - 1);
+
+    for (std::uint64_t exponent = 0; exponent < 2047; ++exponent)
+    {
+        for (const auto significand : {UINT64_C(0), UINT64_C(1), (UINT64_C(1) << 52) - 1, significand_dist(rng)})
+        {
+            const auto bits = (exponent << 52) | significand;
+            double value;
+            std::memcpy(&value, &bits, sizeof(double));
+
+            if (value != 0)
+            {
+                check(value);
+            }
+        }
+    }
+}
+
+int main()
+{
+    test_cache();
+
+    test_random_values<float, std::uint32_t>();
+    test_random_values<double, std::uint64_t>();
+    test_all_exponents();
+
+    check((std::numeric_limits<double>::min)());
+    check((std::numeric_limits<double>::max)());
+    check(std::numeric_limits<double>::denorm_min());
+    check(1.0);
+    check(0.3);
+    check(1e23);
+
+    return boost::report_errors();
+}
@@ -0,0 +1,182 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <system_error>
+#include <iostream>
+#include <random>
+#include <string>
+#include <limits>
+#include <cstring>
+#include <cstdint>
+#include <cstdlib>
+#include <cmath>
+
+static std::mt19937_64 rng(42);
+
+std::string ecmascript_string(double value)
+{
+    char buffer[64];
+    const auto r = boost::charconv::to_chars_ecmascript(buffer, buffer + sizeof(buffer), value);
+    BOOST_TEST(r.ec == std::errc());
+    return std::string(buffer, r.ptr);
+}
+
+// Number::toString from the specification, built from the digits of to_chars in scientific notation
+std::string reference_string(double value)
+{
+    char buffer[64];
+    const auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), value, boost::charconv::chars_format::scientific);
+    const std::string scientific(buffer, r.ptr);
+
+    std::string result;
+    std::size_t pos = 0;
+    if (scientific[0] == '-')
+    {
+        result = "-";
+        pos = 1;
+    }
+
+    const auto e = scientific.find('e');
+    std::string digits;
+    for (std::size_t i = pos; i < e; ++i)
+    {
+        if (scientific[i] != '.')
+        {
+            digits += scientific[i];
+        }
+    }
+
+    const int k = static_cast<int>(digits.size());
+    const int n = std::atoi(scientific.c_str() + e + 1) + 1;
+
+    if (k <= n && n <= 21)
+    {
+        result += digits + std::string(static_cast<std::size_t>(n - k), '0');
+    }
+    else if (0 < n && n <= 21)
+    {
+        result += digits.substr(0, static_cast<std::size_t>(n)) + "." + digits.substr(static_cast<std::size_t>(n));
+    }
+    else if (-6 < n && n <= 0)
+    {
+        result += "0." + std::string(static_cast<std::size_t>(-n), '0') + digits;
+    }
+    else
+    {
+        result += digits.substr(0, 1);
+        if (k > 1)
+        {
+            result += "." + digits.substr(1);
+        }
+        result += (n - 1 < 0 ? "e-" : "e+") + std::to_string(std::abs(n - 1));
+    }
+
+    return result;
+}
+
+void test_spot_values()
+{
+    BOOST_TEST_EQ(ecmascript_string(0.0), "0");
+    BOOST_TEST_EQ(ecmascript_string(-0.0), "0");
+    BOOST_TEST_EQ(ecmascript_string(1.0), "1");
+    BOOST_TEST_EQ(ecmascript_string(-1.5), "-1.5");
+    BOOST_TEST_EQ(ecmascript_string(123.456), "123.456");
+    BOOST_TEST_EQ(ecmascript_string(0.1 + 0.2), "0.30000000000000004");
+    BOOST_TEST_EQ(ecmascript_string(9007199254740992.0), "9007199254740992");
+    BOOST_TEST_EQ(ecmascript_string(12345678901234567890.0), "12345678901234567000");
+    BOOST_TEST_EQ(ecmascript_string(1e20), "100000000000000000000");
+    BOOST_TEST_EQ(ecmascript_string(1e21), "1e+21");
+    BOOST_TEST_EQ(ecmascript_string(-1.2345e21), "-1.2345e+21");
+    BOOST_TEST_EQ(ecmascript_string(1e100), "1e+100");
+    BOOST_TEST_EQ(ecmascript_string(0.000001), "0.000001");
+    BOOST_TEST_EQ(ecmascript_string(0.0000015), "0.0000015");
+    BOOST_TEST_EQ(ecmascript_string(1e-7), "1e-7");
+    BOOST_TEST_EQ(ecmascript_string(-1.5e-7), "-1.5e-7");
+    BOOST_TEST_EQ(ecmascript_string(1.5e-10), "1.5e-10");
+    BOOST_TEST_EQ(ecmascript_string(std::numeric_limits<double>::denorm_min()), "5e-324");
+    BOOST_TEST_EQ(ecmascript_string((std::numeric_limits<double>::min)()), "2.2250738585072014e-308");
+    BOOST_TEST_EQ(ecmascript_string((std::numeric_limits<double>::max)()), "1.7976931348623157e+308");
+    BOOST_TEST_EQ(ecmascript_string(std::numeric_limits<double>::infinity()), "Infinity");
+    BOOST_TEST_EQ(ecmascript_string(-std::numeric_limits<double>::infinity()), "-Infinity");
+    BOOST_TEST_EQ(ecmascript_string(std::numeric_limits<double>::quiet_NaN()), "NaN");
+    BOOST_TEST_EQ(ecmascript_string(-std::numeric_limits<double>::quiet_NaN()), "NaN");
+}
+
+// Every length below the output is too short, and the output fits exactly without writing past last
+void test_buffer_sizes(double value)
+{
+    const auto expected = ecmascript_string(value);
+
+    for (std::size_t size = 0; size <= expected.size(); ++size)
+    {
+        char buffer[64];
+        std::memset(buffer, '#', sizeof(buffer));
+
+        const auto r = boost::charconv::to_chars_ecmascript(buffer, buffer + size, value);
+        if (size < expected.size())
+        {
+            BOOST_TEST(r.ec == std::errc::value_too_large);
+        }
+        else
+        {
+            BOOST_TEST(r.ec == std::errc());
+            BOOST_TEST_EQ(std::string(buffer, r.ptr), expected);
+        }
+
+        if (!BOOST_TEST_EQ(buffer[size], '#'))
+        {
+            std::cerr << "Value: " << expected << ", size: " << size << std::endl; // LCOV_EXCL_LINE
+        }
+    }
+}
+
+void test_random_values()
+{
+    for (int i = 0; i < 100000; ++i)
+    {
+        const auto bit_pattern = rng();
+        double value;
+        std::memcpy(&value, &bit_pattern, sizeof(value));
+        if (!std::isfinite(value) || value == 0)
+        {
+            continue;
+        }
+
+        // Half of the values are scaled into [2^-80, 2^80), which covers every layout and the exponents around -7 and 21
+        if (i % 2 == 0)
+        {
+            int exponent;
+            value = std::ldexp(std::frexp(value, &exponent), static_cast<int>(rng() % 160) - 80);
+        }
+
+        const auto str = ecmascript_string(value);
+        if (!BOOST_TEST_EQ(str, reference_string(value)))
+        {
+            continue; // LCOV_EXCL_LINE
+        }
+
+        double round_trip;
+        const auto r = boost::charconv::from_chars(str.data(), str.data() + str.size(), round_trip);
+        BOOST_TEST(r.ec == std::errc());
+        BOOST_TEST_EQ(round_trip, value);
+    }
+}
+
+int main()
+{
+    test_spot_values();
+
+    for (const double value : {0.0, -0.0, 7.0, -123.0, 1e20, -1.25, 0.1, -0.000001234, 1e-7, 1.5e-7, -1.2345e21, 1e100,
+                               5e-324, -1.7976931348623157e308, std::numeric_limits<double>::infinity(),
+                               -std::numeric_limits<double>::infinity(), std::numeric_limits<double>::quiet_NaN()})
+    {
+        test_buffer_sizes(value);
+    }
+
+    test_random_values();
+
+    return boost::report_errors();
+}
@@ -105,6 +105,141 @@ void fixed_values()
     auto r1 = boost::charconv::to_chars(buffer1, buffer1 + sizeof(buffer1), v1);
     BOOST_TEST(r1.ec == std::errc());
     BOOST_TEST_CSTR_EQ(buffer1, "61851632");
+
+    // Every layout of the shortest fixed output must fit a buffer of exactly its length
+    const std::pair<T, const char*> values[] = {
+        {T(0), "0"}, {T(-0.0), "-0"}, {T(7), "7"}, {T(1e10), "10000000000"}, {T(-123.25), "-123.25"},
+        {T(0.5), "0.5"}, {T(-0.125), "-0.125"}, {T(1e-5), "0.00001"}, {T(3.5e-3), "0.0035"}
+    };
+
+    for (const auto& value : values)
+    {
+        const auto length = std::strlen(value.second);
+
+        char buffer2[64] {};
+        auto r2 = boost::charconv::to_chars(buffer2, buffer2 + length, value.first, boost::charconv::chars_format::fixed);
+        BOOST_TEST(r2.ec == std::errc()) && BOOST_TEST_EQ(std::string(buffer2, r2.ptr), value.second);
+
+        r2 = boost::charconv::to_chars(buffer2, buffer2 + length - 1, value.first, boost::charconv::chars_format::fixed);
+        BOOST_TEST(r2.ec == std::errc::value_too_large);
+    }
+}
+
+// Integers up to 2^digits print as the integer in shortest general and fixed notation
+template <typename T>
+void exact_integer_values()
+{
+    boost::detail::splitmix64 rng;
+    constexpr int digits = std::numeric_limits<T>::digits;
+
+    for (int i = 0; i < 1024; ++i)
+    {
+        const std::uint64_t integer = (rng() >> (64 - digits + static_cast<int>(rng() % digits))) | 1U;
+        const bool is_negative = (rng() & 1) != 0;
+        const T value = is_negative ? -static_cast<T>(integer) : static_cast<T>(integer);
+        const std::string expected = (is_negative ? "-" : "") + std::to_string(integer);
+
+        for (const auto fmt : {boost::charconv::chars_format::general, boost::charconv::chars_format::fixed})
+        {
+            char buffer[64] {};
+            auto r = boost::charconv::to_chars(buffer, buffer + expected.size(), value, fmt);
+            BOOST_TEST(r.ec == std::errc()) && BOOST_TEST_EQ(std::string(buffer, r.ptr), expected);
+
+            r = boost::charconv::to_chars(buffer, buffer + expected.size() - 1, value, fmt);
+            BOOST_TEST(r.ec == std::errc::value_too_large);
+        }
+    }
+
+    const std::uint64_t largest = (UINT64_C(1) << digits) - 1;
+    char buffer[64] {};
+    auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), static_cast<T>(largest), boost::charconv::chars_format::fixed);
+    BOOST_TEST(r.ec == std::errc()) && BOOST_TEST_EQ(std::string(buffer, r.ptr), std::to_string(largest));
+
+    r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), static_cast<T>(largest) / 2, boost::charconv::chars_format::general);
+    BOOST_TEST(r.ec == std::errc()) && BOOST_TEST_EQ(std::string(buffer, r.ptr), std::to_string(largest / 2) + ".5");
+}
+
+template <typename T>
+void general_precision_buffer_sizes()
+{
+    // The output must not depend on whether to_chars writes directly into the buffer or goes through a temporary one
+    const T values[] = {T(0), T(-0.0), T(1), T(-123.25), T(1e-5), T(-9.99995e-5), T(3.14159265358979), T(1e30),
+                        -std::numeric_limits<T>::max(), std::numeric_limits<T>::denorm_min(),
+                        -(std::numeric_limits<T>::min() - std::numeric_limits<T>::denorm_min())};
+
+    for (const auto value : values)
+    {
+        for (const int precision : {0, 1, 6, 9, 17, 40, 200, 1000})
+        {
+            char buffer1[1024] {};
+            const auto r1 = boost::charconv::to_chars(buffer1, buffer1 + sizeof(buffer1), value, boost::charconv::chars_format::general, precision);
+            BOOST_TEST(r1.ec == std::errc());
+            const auto length = static_cast<std::size_t>(r1.ptr - buffer1);
+
+            char buffer2[1024] {};
+            auto r2 = boost::charconv::to_chars(buffer2, buffer2 + length, value, boost::charconv::chars_format::general, precision);
+            BOOST_TEST(r2.ec == std::errc()) && BOOST_TEST_EQ(std::string(buffer2, r2.ptr), std::string(buffer1, r1.ptr));
+
+            r2 = boost::charconv::to_chars(buffer2, buffer2 + length - 1, value, boost::charconv::chars_format::general, precision);
+            BOOST_TEST(r2.ec == std::errc::value_too_large);
+        }
+    }
+
+    // The largest negative subnormal has the longest output of all: a sign, every significant digit, and the exponent
+    char buffer[1024] {};
+    const T value = -(std::numeric_limits<T>::min() - std::numeric_limits<T>::denorm_min());
+    const auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), value, boost::charconv::chars_format::general, 1000);
+    BOOST_TEST(r.ec == std::errc());
+    const std::ptrdiff_t expected_length = std::is_same<T, double>::value ? 774 : 118;
+    BOOST_TEST_EQ(r.ptr - buffer, expected_length);
+}
+
+// Hex output with a precision has an exact length, and must fit a buffer of that length but not one shorter
+template <typename T>
+void hex_precision_buffer_sizes()
+{
+    const T values[] = {T(1), T(-1.5), T(0.1), T(-3.14159265358979), T(1e30), T(-1e-30),
+                        std::numeric_limits<T>::max(), -std::numeric_limits<T>::min(), std::numeric_limits<T>::denorm_min()};
+
+    for (const auto value : values)
+    {
+        for (const int precision : {0, 1, 2, 5, 6, 12, 13, 14, 30})
+        {
+            char buffer1[128] {};
+            const auto r1 = boost::charconv::to_chars(buffer1, buffer1 + sizeof(buffer1), value, boost::charconv::chars_format::hex, precision);
+            BOOST_TEST(r1.ec == std::errc());
+            const auto length = static_cast<std::size_t>(r1.ptr - buffer1);
+
+            char buffer2[128] {};
+            auto r2 = boost::charconv::to_chars(buffer2, buffer2 + length, value, boost::charconv::chars_format::hex, precision);
+            BOOST_TEST(r2.ec == std::errc()) && BOOST_TEST_EQ(std::string(buffer2, r2.ptr), std::string(buffer1, r1.ptr));
+
+            r2 = boost::charconv::to_chars(buffer2, buffer2 + length - 1, value, boost::charconv::chars_format::hex, precision);
+            BOOST_TEST(r2.ec == std::errc::value_too_large);
+        }
+    }
+}
+
+// Shortest output must not depend on what the buffer held before
+template <typename T>
+void stale_buffer_values()
+{
+    const T values[] = {T(123.456), T(-0.001953125), T(1e15) + T(0.5), T(1962919149508896753.88L), T(-2.5e-5), T(7)};
+
+    for (const auto value : values)
+    {
+        for (const auto fmt : {boost::charconv::chars_format::general, boost::charconv::chars_format::scientific})
+        {
+            char clean_buffer[64] {};
+            const auto r1 = boost::charconv::to_chars(clean_buffer, clean_buffer + sizeof(clean_buffer), value, fmt);
+            BOOST_TEST(r1.ec == std::errc());
+
+            char stale_buffer[64];
+            std::memset(stale_buffer, '9', sizeof(stale_buffer));
+            const auto r2 = boost::charconv::to_chars(stale_buffer, stale_buffer + sizeof(stale_buffer), value, fmt);
+            BOOST_TEST(r2.ec == std::errc()) && BOOST_TEST_EQ(std::string(stale_buffer, r2.ptr), std::string(clean_buffer, r1.ptr));
+        }
+    }
 }
 
 template <typename T>
@@ -246,6 +381,20 @@ int main()
     fixed_values<float>();
     fixed_values<double>();
 
+    exact_integer_values<float>();
+    exact_integer_values<double>();
+
+    stale_buffer_values<double>();
+    #if !defined(BOOST_CHARCONV_UNSUPPORTED_LONG_DOUBLE)
+    stale_buffer_values<long double>();
+    #endif
+
+    general_precision_buffer_sizes<float>();
+    general_precision_buffer_sizes<double>();
+
+    hex_precision_buffer_sizes<float>();
+    hex_precision_buffer_sizes<double>();
+
     failing_ci_values<double>();
 
     // Values from ryu tests
@@ -283,6 +432,15 @@ int main()
     spot_check(1.23456789012345, "1.23456789012345e+00", boost::charconv::chars_format::scientific);
     spot_check(1.234567890123456, "1.234567890123456e+00", boost::charconv::chars_format::scientific);
 
+    // Long significands with zeros in the middle and at the end of the digits
+    spot_check(1.0000000000000002, "1.0000000000000002e+00", boost::charconv::chars_format::scientific);
+    spot_check(1.2000000000000002, "1.2000000000000002e+00", boost::charconv::chars_format::scientific);
+    spot_check(1.000000001e-5, "1.000000001e-05", boost::charconv::chars_format::scientific);
+    spot_check(-1.00000000000001e+100, "-1.00000000000001e+100", boost::charconv::chars_format::scientific);
+    spot_check(1.7976931348623157e+308, "1.7976931348623157e+308", boost::charconv::chars_format::scientific);
+    spot_check(2.2250738585072014e-308, "2.2250738585072014e-308", boost::charconv::chars_format::scientific);
+    spot_check(5e-324, "5e-324", boost::charconv::chars_format::scientific);
+
     spot_check(1.0, "1e+00", boost::charconv::chars_format::scientific);
     spot_check(12.0, "1.2e+01", boost::charconv::chars_format::scientific);
     spot_check(123.0, "1.23e+02", boost::charconv::chars_format::scientific);
@@ -1048,6 +1206,13 @@ int main()
     spot_check(0.0, "0.0000000000", boost::charconv::chars_format::fixed, 10);
     spot_check(-0.0, "-0.0000000000", boost::charconv::chars_format::fixed, 10);
 
+    #if !defined(BOOST_CHARCONV_UNSUPPORTED_LONG_DOUBLE)
+    spot_check(0.0L, "0", boost::charconv::chars_format::general);
+    spot_check(-0.0L, "-0", boost::charconv::chars_format::general);
+    spot_check(-0.0L, "-0", boost::charconv::chars_format::fixed);
+    spot_check(-0.0L, "-0e+00", boost::charconv::chars_format::scientific);
+    #endif
+
     #ifdef BOOST_CHARCONV_HAS_FLOAT16
     {
         constexpr int N = 1024;
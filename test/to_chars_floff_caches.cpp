@@ -0,0 +1,151 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv/detail/dragonbox/floff.hpp>
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <iostream>
+#include <random>
+#include <string>
+#include <cstring>
+#include <cstdint>
+#include <cmath>
+
+using namespace boost::charconv::detail;
+using boost::charconv::chars_format;
+
+static std::mt19937_64 rng(42);
+constexpr std::size_t N = 2048;
+
+template <typename MainCache, typename ExtendedCache>
+std::string format(double value, int precision, chars_format fmt)
+{
+    char buffer[1100] {};
+    const auto r = floff<MainCache, ExtendedCache>(value, precision, buffer, buffer + sizeof(buffer), fmt);
+    BOOST_TEST(r);
+    return std::string(buffer, r.ptr);
+}
+
+// Every supported cache pair must give the expected output
+void check(double value, int precision, chars_format fmt, const std::string& expected)
+{
+    const std::string results[] = {
+        format<main_cache_full, extended_cache_long>(value, precision, fmt),
+        format<main_cache_full, extended_cache_super_compact>(value, precision, fmt),
+        format<main_cache_compressed, extended_cache_long>(value, precision, fmt),
+        format<main_cache_compressed, extended_cache_super_compact>(value, precision, fmt)
+    };
+
+    for (const auto& result : results)
+    {
+        if (!BOOST_TEST_EQ(result, expected))
+        {
+            std::cerr << std::hexfloat << "Value: " << value << " precision: " << precision << std::endl; // LCOV_EXCL_LINE
+        }
+    }
+}
+
+void check(double value, int precision, chars_format fmt)
+{
+    check(value, precision, fmt, format<main_cache_full, extended_cache_long>(value, precision, fmt));
+}
+
+// Values that were printed with missing digits or rounded incorrectly
+void test_spot_values()
+{
+    check(-914.81203912556634, 29, chars_format::scientific, "-9.14812039125566343500395305455e+02");
+    check(-1.0442758598704387e-216, 38, chars_format::scientific, "-1.04427585987043873893649636478080101000e-216");
+    check(-1.822679898939569e-271, 34, chars_format::scientific, "-1.8226798989395690388539883893375500e-271");
+    check(240079545047.85733, 25, chars_format::scientific, "2.4007954504785733032226562e+11");
+    check(240079545047.85733, 14, chars_format::fixed, "240079545047.85733032226562");
+    check(0.57999239565407834, 51, chars_format::scientific, "5.799923956540783409607797693752218037843704223632812e-01");
+    check(-5.4792291815337162e-07, 63, chars_format::scientific, "-5.479229181533716164372808249405366609607881400734186172485351562e-07");
+    check(-9.6834479045666119e-11, 11, chars_format::fixed, "-0.00000000010");
+    check(9.652176060727406e-49, 49, chars_format::fixed, "0.0000000000000000000000000000000000000000000000010");
+    check(-514380.47988452989, 0, chars_format::fixed, "-514380");
+    check(-232171897323.43832, 0, chars_format::fixed, "-232171897323");
+
+    // Subnormals whose first segment has an odd number of digits, which were printed with a leading zero
+    // and an exponent one too high
+    check(-9.0254e-310, 4, chars_format::scientific, "-9.0254e-310");
+    check(-9.0254e-310, 0, chars_format::general, "-9e-310");
+    check(4.9406564584124654e-324, 17, chars_format::scientific, "4.94065645841246544e-324");
+    check(7.5791e-310, 2, chars_format::scientific, "7.58e-310");
+    check(1.2345678e-315, 20, chars_format::general, "1.2345678020718682679e-315");
+
+    // The same through to_chars
+    char buffer[64] {};
+    auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), -914.81203912556634, chars_format::scientific, 29);
+    BOOST_TEST(r) && BOOST_TEST_EQ(std::string(buffer, r.ptr), "-9.14812039125566343500395305455e+02");
+    r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), -514380.47988452989, chars_format::fixed, 0);
+    BOOST_TEST(r) && BOOST_TEST_EQ(std::string(buffer, r.ptr), "-514380");
+}
+
+void test_random_values()
+{
+    std::uniform_int_distribution<std::uint64_t> bits_dist;
+
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        const auto bits = bits_dist(rng);
+        double value;
+        std::memcpy(&value, &bits, sizeof(double));
+
+        if (!std::isfinite(value) || value == 0)
+        {
+            continue;
+        }
+
+        for (const int precision : {0, 5, 16, 17, 29, 40, 63, 120})
+        {
+            check(value, precision, chars_format::general);
+            check(value, precision, chars_format::scientific);
+        }
+
+        // The subnormal with the same significand and sign
+        const auto subnormal_bits = bits & UINT64_C(0x800FFFFFFFFFFFFF);
+        double subnormal;
+        std::memcpy(&subnormal, &subnormal_bits, sizeof(double));
+        if (subnormal != 0)
+        {
+            check(subnormal, 3, chars_format::scientific);
+            check(subnormal, 17, chars_format::general);
+        }
+
+        // Fixed output of the whole range is long, so only values of moderate size
+        if (std::abs(value) > 1e-30 && std::abs(value) < 1e30)
+        {
+            check(value, 0, chars_format::fixed);
+            check(value, 6, chars_format::fixed);
+            check(value, 20, chars_format::fixed);
+            check(value, 45, chars_format::fixed);
+        }
+    }
+}
+
+// Every binary exponent, and with it every main cache entry
+void test_all_exponents()
+{
+    for (std::uint64_t exponent = 0; exponent < 2047; ++exponent)
+    {
+        for (const auto significand : {UINT64_C(1), UINT64_C(0x8000000000000), (UINT64_C(1) << 52) - 1})
+        {
+            const auto bits = (exponent << 52) | significand;
+            double value;
+            std::memcpy(&value, &bits, sizeof(double));
+
+            check(value, 17, chars_format::scientific);
+            check(value, 60, chars_format::scientific);
+        }
+    }
+}
+
+int main()
+{
+    test_spot_values();
+    test_random_values();
+    test_all_exponents();
+
+    return boost::report_errors();
+}
@@ -16,6 +16,10 @@
 #include <cfloat>
 #include <cmath>
 
+#ifdef BOOST_CHARCONV_HAS_QUADMATH
+#include <quadmath.h>
+#endif
+
 int const N = 1024;
 
 static boost::detail::splitmix64 rng;
@@ -504,6 +508,76 @@ template<> void test_sprintf_bv_fp<long double>()
 }
 #endif
 
+// With a precision, long double and __float128 used to fall back to snprintf
+// whenever the shortest representation did not have enough digits
+
+#if BOOST_CHARCONV_LDBL_BITS > 64
+
+int sprintf_precision( char* buffer, std::size_t size, long double value, char fmt, int precision )
+{
+    char const format[] = { '%', '.', '*', 'L', fmt, '\0' };
+    return std::snprintf( buffer, size, format, precision, value );
+}
+
+#endif
+
+#ifdef BOOST_CHARCONV_HAS_QUADMATH
+
+int sprintf_precision( char* buffer, std::size_t size, __float128 value, char fmt, int precision )
+{
+    char const format[] = { '%', '.', '*', 'Q', fmt, '\0' };
+    return quadmath_snprintf( buffer, size, format, precision, value );
+}
+
+#endif
+
+template<class T> void test_sprintf_precision( T value )
+{
+    struct format
+    {
+        boost::charconv::chars_format fmt;
+        char printf_fmt;
+    };
+
+    format const formats[] = {
+        { boost::charconv::chars_format::general, 'g' },
+        { boost::charconv::chars_format::scientific, 'e' },
+        { boost::charconv::chars_format::fixed, 'f' }
+    };
+
+    for( auto const& f: formats )
+    {
+        for( int precision: { 0, 1, 6, 17, 20, 33, 36, 50, 100, 1000 } )
+        {
+            char buffer[ 6000 ];
+            char buffer2[ 6000 ];
+
+            int const n = sprintf_precision( buffer2, sizeof( buffer2 ), value, f.printf_fmt, precision );
+            if( n <= 0 || n >= static_cast<int>( sizeof( buffer2 ) ) )
+            {
+                continue;
+            }
+
+            auto r = boost::charconv::to_chars( buffer, buffer + sizeof( buffer ), value, f.fmt, precision );
+
+            if( !BOOST_TEST( r.ec == std::errc() ) || !BOOST_TEST_EQ( std::string( buffer, r.ptr ), std::string( buffer2, static_cast<std::size_t>( n ) ) ) )
+            {
+                // LCOV_EXCL_START
+                std::cerr << "Format: %." << precision << f.printf_fmt << std::endl;
+                // LCOV_EXCL_STOP
+            }
+
+            // A buffer of exactly the right size is enough, and one character less is not
+            r = boost::charconv::to_chars( buffer, buffer + n, value, f.fmt, precision );
+            BOOST_TEST( r.ec == std::errc() );
+            BOOST_TEST_EQ( std::string( buffer, r.ptr ), std::string( buffer2, static_cast<std::size_t>( n ) ) );
+
+            r = boost::charconv::to_chars( buffer, buffer + n - 1, value, f.fmt, precision );
+            BOOST_TEST( r.ec == std::errc::value_too_large );
+        }
+    }
+}
+
 //
 
 int main()
@@ -668,5 +742,53 @@ int main()
     }
     #endif
 
+    // long double with a precision
+
+    #if BOOST_CHARCONV_LDBL_BITS > 64
+    {
+        for( int i = 0; i < N / 16; ++i )
+        {
+            test_sprintf_precision( static_cast<long double>( rng() ) * 1.0L ); // 0 .. 2^64
+            test_sprintf_precision( static_cast<long double>( rng() ) / 18446744073709551616.0L ); // 0.0 .. 1.0
+            test_sprintf_precision( LDBL_MAX / static_cast<long double>( rng() ) ); // large values
+            test_sprintf_precision( -LDBL_MIN * static_cast<long double>( rng() ) ); // small values
+        }
+
+        test_sprintf_precision( LDBL_MAX );
+        test_sprintf_precision( LDBL_MIN );
+        test_sprintf_precision( std::numeric_limits<long double>::denorm_min() );
+        test_sprintf_precision( 0.5L );
+        test_sprintf_precision( 1.5L );
+        test_sprintf_precision( 9.5L );
+        test_sprintf_precision( 0.0L );
+        test_sprintf_precision( -0.0L );
+    }
+    #endif
+
+    // __float128 with a precision
+
+    #ifdef BOOST_CHARCONV_HAS_QUADMATH
+    {
+        for( int i = 0; i < N / 16; ++i )
+        {
+            __float128 const w = static_cast<__float128>( rng() ) * static_cast<__float128>( rng() );
+
+            test_sprintf_precision( w ); // 0 .. 2^128
+            test_sprintf_precision( w / 340282366920938463463374607431768211456.0Q ); // 0.0 .. 1.0
+            test_sprintf_precision( FLT128_MAX / w ); // large values
+            test_sprintf_precision( -FLT128_MIN * w ); // small values
+        }
+
+        test_sprintf_precision( FLT128_MAX );
+        test_sprintf_precision( FLT128_MIN );
+        test_sprintf_precision( FLT128_DENORM_MIN );
+        test_sprintf_precision( static_cast<__float128>( 0.5 ) );
+        test_sprintf_precision( static_cast<__float128>( 1.5 ) );
+        test_sprintf_precision( static_cast<__float128>( 9.5 ) );
+        test_sprintf_precision( static_cast<__float128>( 0.0 ) );
+        test_sprintf_precision( -static_cast<__float128>( 0.0 ) );
+    }
+    #endif
+
     return boost::report_errors();
 }
@@ -0,0 +1,265 @@
+// Copyright 2024 Matt Borland
+// Distributed under the Boost Software License, Version 1.0.
+// https://www.boost.org/LICENSE_1_0.txt
+
+#include <boost/charconv.hpp>
+#include <boost/core/lightweight_test.hpp>
+#include <system_error>
+#include <iostream>
+#include <iomanip>
+#include <random>
+#include <string>
+#include <vector>
+#include <limits>
+#include <cstring>
+#include <cstdint>
+#include <cmath>
+
+static std::mt19937_64 rng(42);
+constexpr std::size_t N = 1024;
+
+template <typename T>
+struct bits_type;
+
+template <>
+struct bits_type<float> { using type = std::uint32_t; };
+
+template <>
+struct bits_type<double> { using type = std::uint64_t; };
+
+template <typename T>
+T from_bits(typename bits_type<T>::type bits)
+{
+    T value;
+    std::memcpy(&value, &bits, sizeof(T));
+    return value;
+}
+
+template <typename T>
+bool same_bits(T lhs, T rhs)
+{
+    return std::memcmp(&lhs, &rhs, sizeof(T)) == 0;
+}
+
+// to_decimal must give the digits of the shortest representation, and from_decimal must give back the value
+template <typename T>
+void test_roundtrip(T value)
+{
+    const auto decimal = boost::charconv::to_decimal(value);
+    BOOST_TEST_EQ(decimal.is_negative, std::signbit(value));
+    BOOST_TEST(decimal.significand == 0 || decimal.significand % 10 != 0);
+
+    char buffer[64] {};
+    const auto r = boost::charconv::to_chars(buffer, buffer + sizeof(buffer), value, boost::charconv::chars_format::scientific);
+    BOOST_TEST(r.ec == std::errc());
+
+    // The significand and exponent printed by to_chars
+    const char* const last = r.ptr;
+    std::string digits;
+    int exponent = 0;
+    for (const char* p = buffer; p != last; ++p)
+    {
+        if (*p >= '0' && *p <= '9')
+        {
+            digits += *p;
+        }
+        else if (*p == 'e')
+        {
+            exponent = std::stoi(std::string(p + 1, last));
+            break;
+        }
+    }
+
+    while (digits.size() > 1 && digits.back() == '0')
+    {
+        digits.pop_back();
+    }
+
+    if (value != 0)
+    {
+        exponent -= static_cast<int>(digits.size()) - 1;
+    }
+
+    if (!BOOST_TEST_EQ(std::to_string(decimal.significand), digits) || !BOOST_TEST_EQ(decimal.exponent, exponent))
+    {
+        std::cerr << "Value: " << std::string(buffer, r.ptr) << std::endl; // LCOV_EXCL_LINE
+    }
+
+    T roundtrip_value {};
+    BOOST_TEST(boost::charconv::from_decimal(decimal, roundtrip_value) == std::errc());
+    BOOST_TEST(same_bits(roundtrip_value, value));
+}
+
+template <typename T>
+void test_to_decimal()
+{
+    using bits = typename bits_type<T>::type;
+
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        const auto value = from_bits<T>(static_cast<bits>(rng()));
+        if (std::isfinite(value))
+        {
+            test_roundtrip(value);
+        }
+    }
+
+    const T values[] = {T(0), -T(0), T(1), T(-0.3), T(1e10), T(123.456), std::numeric_limits<T>::max(), std::numeric_limits<T>::lowest(),
+                        std::numeric_limits<T>::min(), std::numeric_limits<T>::denorm_min(), -std::numeric_limits<T>::denorm_min()};
+    for (const auto value : values)
+    {
+        test_roundtrip(value);
+    }
+
+    const auto decimal = boost::charconv::to_decimal(T(-0.3));
+    BOOST_TEST_EQ(decimal.significand, 3U);
+    BOOST_TEST_EQ(decimal.exponent, -1);
+    BOOST_TEST(decimal.is_negative);
+}
+
+// from_decimal must give the same result as from_chars on the equivalent string
+template <typename T>
+void check_from_decimal(std::uint64_t significand, int exponent, bool is_negative)
+{
+    const std::string str = (is_negative ? "-" : "") + std::to_string(significand) + "e" + std::to_string(exponent);
+
+    T expected = T(42);
+    const auto r = boost::charconv::from_chars(str.c_str(), str.c_str() + str.size(), expected);
+
+    T value = T(42);
+    const auto ec = boost::charconv::from_decimal(significand, exponent, is_negative, value);
+
+    if (!BOOST_TEST(ec == r.ec) || !BOOST_TEST(same_bits(value, expected)))
+    {
+        std::cerr << std::setprecision(std::numeric_limits<T>::max_digits10)
+                  << "Input: " << str << "\nExpected: " << expected << "\nGot: " << value << std::endl; // LCOV_EXCL_LINE
+    }
+}
+
+template <typename T>
+void test_from_decimal()
+{
+    const int max_exponent = std::numeric_limits<T>::max_exponent10 + 25;
+
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        const auto significand = rng() >> (rng() % 64);
+        const auto exponent = static_cast<int>(rng() % static_cast<std::uint64_t>(2 * max_exponent)) - max_exponent;
+        check_from_decimal<T>(significand, exponent, (rng() & 1) != 0);
+    }
+
+    // Exact values, halfway points that need the digits of the significand, and out of range values
+    check_from_decimal<T>(0, 0, false);
+    check_from_decimal<T>(0, 1000, true);
+    check_from_decimal<T>(1, -1000, false);
+    check_from_decimal<T>(1, 1000, true);
+    check_from_decimal<T>(UINT64_C(18446744073709551615), 0, false);
+    check_from_decimal<T>(UINT64_C(18446744073709551615), -19, false);
+    check_from_decimal<T>(UINT64_C(9007199254740993), 0, false);
+    check_from_decimal<T>(UINT64_C(9007199254740993), -308, false);
+    check_from_decimal<T>(UINT64_C(2470328229206232720), -342, false);
+    check_from_decimal<T>(UINT64_C(2470328229206232721), -342, false);
+    check_from_decimal<T>(UINT64_C(17976931348623157), 292, false);
+    check_from_decimal<T>(UINT64_C(17976931348623159), 292, false);
+    check_from_decimal<T>(UINT64_C(16777217), 0, false);
+    check_from_decimal<T>(UINT64_C(16777217), 10, true);
+    check_from_decimal<T>(UINT64_C(7006492321624085354), -64, false);
+    check_from_decimal<T>(UINT64_C(3402823567797336616), 20, false);
+}
+
+// from_decimal_batch must give the results of from_decimal, including for the halfway cases that need a second pass
+template <typename T>
+void test_from_decimal_batch()
+{
+    const int max_exponent = std::numeric_limits<T>::max_exponent10 + 25;
+
+    std::vector<boost::charconv::decimal_fp<std::uint64_t>> decimals;
+    for (std::size_t i = 0; i < 4 * N; ++i)
+    {
+        const auto significand = rng() >> (rng() % 64);
+        const auto exponent = static_cast<int>(rng() % static_cast<std::uint64_t>(2 * max_exponent)) - max_exponent;
+        decimals.push_back({significand, exponent, (rng() & 1) != 0});
+
+        // Values that are exactly halfway between two neighbours, and values just above or below the halfway point
+        const auto neighbour = from_bits<T>(static_cast<typename bits_type<T>::type>(rng() >> (64 - 8 * sizeof(T))));
+        if (std::isfinite(neighbour) && neighbour != 0)
+        {
+            const auto decimal = boost::charconv::to_decimal(neighbour);
+            decimals.push_back({static_cast<std::uint64_t>(decimal.significand) * 10 + 5, decimal.exponent - 1, decimal.is_negative});
+            decimals.push_back({UINT64_C(2470328229206232720) + rng() % 3, -342, false});
+        }
+    }
+    decimals.push_back({0, 0, true});
+    decimals.push_back({1, 1000, false});
+    decimals.push_back({1, -1000, true});
+    decimals.push_back({UINT64_C(9007199254740993), 0, false});
+
+    std::vector<T> values(decimals.size(), T(42));
+    std::vector<std::errc> errors(decimals.size());
+    const auto successes = boost::charconv::from_decimal_batch(decimals.data(), decimals.size(), values.data(), errors.data());
+
+    std::size_t expected_successes {};
+    for (std::size_t i = 0; i < decimals.size(); ++i)
+    {
+        T expected = T(42);
+        const auto ec = boost::charconv::from_decimal(decimals[i], expected);
+        expected_successes += ec == std::errc();
+
+        if (!BOOST_TEST(errors[i] == ec) || !BOOST_TEST(same_bits(values[i], expected)))
+        {
+            std::cerr << "Input: " << decimals[i].significand << "e" << decimals[i].exponent << std::endl; // LCOV_EXCL_LINE
+        }
+    }
+    BOOST_TEST_EQ(successes, expected_successes);
+}
+
+// The results of to_decimal, whose significand type depends on T, must convert back to the same values
+template <typename T>
+void test_from_decimal_batch_round_trip()
+{
+    using bits = typename bits_type<T>::type;
+
+    std::vector<T> values;
+    std::vector<boost::charconv::decimal_fp<bits>> decimals;
+    for (std::size_t i = 0; i < 4 * N; ++i)
+    {
+        const auto value = from_bits<T>(static_cast<bits>(rng()));
+        if (std::isfinite(value))
+        {
+            values.push_back(value);
+            decimals.push_back(boost::charconv::to_decimal(value));
+        }
+    }
+    values.push_back(-std::numeric_limits<T>::denorm_min());
+    decimals.push_back(boost::charconv::to_decimal(values.back()));
+
+    std::vector<T> round_trip(decimals.size(), T(42));
+    std::vector<std::errc> errors(decimals.size());
+    const auto successes = boost::charconv::from_decimal_batch(decimals.data(), decimals.size(), round_trip.data(), errors.data());
+    BOOST_TEST_EQ(successes, decimals.size());
+
+    for (std::size_t i = 0; i < decimals.size(); ++i)
+    {
+        if (!BOOST_TEST(errors[i] == std::errc()) || !BOOST_TEST(same_bits(round_trip[i], values[i])))
+        {
+            std::cerr << std::setprecision(std::numeric_limits<T>::max_digits10) << "Value: " << values[i] << std::endl; // LCOV_EXCL_LINE
+        }
+    }
+}
+
+int main()
+{
+    test_to_decimal<float>();
+    test_to_decimal<double>();
+
+    test_from_decimal<float>();
+    test_from_decimal<double>();
+
+    test_from_decimal_batch<float>();
+    test_from_decimal_batch<double>();
+
+    test_from_decimal_batch_round_trip<float>();
+    test_from_decimal_batch_round_trip<double>();
+
+    return boost::report_errors();
+}